@@ -257,6 +257,7 @@ void Axpy(S alphaS, const AbstractDistMatrix<T>& X, AbstractDistMatrix<T>& Y)
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGINT
 #define EL_ENABLE_BIGFLOAT
+#define EL_ENABLE_HALF
 #include <El/macros/Instantiate.h>
 
 #undef EL_EXTERN
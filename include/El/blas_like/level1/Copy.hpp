@@ -321,6 +321,39 @@ void Copy( const BlockMatrix<S>& A, BlockMatrix<T>& B )
     #include <El/macros/GuardAndPayload.h>
 }
 
+template<typename T>
+void Copy
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B,
+  RedistPlan<T>& plan )
+{
+    EL_DEBUG_CSE
+    if( A.Grid() == B.Grid() &&
+        A.GetLocalDevice() == Device::CPU &&
+        B.GetLocalDevice() == Device::CPU )
+        plan.Execute( A, B );
+    else
+        Copy( A, B );
+}
+
+template<typename S,typename T>
+std::future<void>
+Copy( const Matrix<S>& A, Matrix<T>& B, CPUStream& stream )
+{
+    EL_DEBUG_CSE
+    return stream.Enqueue( [&A,&B]() { Copy( A, B ); } );
+}
+
+template<typename S,typename T>
+std::future<void>
+Copy
+( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B,
+  CPUStream& stream )
+{
+    EL_DEBUG_CSE
+    mpi::AssertThreadSupport();
+    return stream.Enqueue( [&A,&B]() { Copy( A, B ); } );
+}
+
 template<typename T>
 void CopyFromRoot
 ( const Matrix<T>& A, DistMatrix<T,CIRC,CIRC>& B, bool includingViewers )
@@ -400,6 +433,7 @@ EL_EXTERN template void Copy
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGINT
 #define EL_ENABLE_BIGFLOAT
+#define EL_ENABLE_HALF
 #include <El/macros/Instantiate.h>
 
 #undef EL_EXTERN
@@ -0,0 +1,176 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_COPY_BLOCKEXCHANGE_HPP
+#define EL_BLAS_COPY_BLOCKEXCHANGE_HPP
+
+namespace El {
+namespace copy {
+
+namespace block_exchange {
+
+// Redistribute the blocks of the distributed dimension of A, which is
+// distributed over one of the grid communicators U in {MC,MR}, to the other
+// grid communicator V (the remaining dimension being replicated). The owner
+// of each block within every V team is a single member of the U
+// communicator, so the redistribution is one AllGather over the U
+// communicator of the blocks required by the V team of the caller.
+template<typename T>
+void Exchange( const BlockMatrix<T>& A, BlockMatrix<T>& B, bool colwise )
+{
+    EL_DEBUG_CSE
+    AssertSameGrids( A, B );
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const Int length = ( colwise ? height : width );
+    const Int otherLength = ( colwise ? width : height );
+    const Int bsize = ( colwise ? A.BlockHeight() : A.BlockWidth() );
+    const Int cut = ( colwise ? A.ColCut() : A.RowCut() );
+
+    if( colwise )
+        B.AlignAndResize
+        ( bsize, A.BlockWidth(), Mod(A.ColAlign(),B.ColStride()), 0, cut, 0,
+          height, width, false, false );
+    else
+        B.AlignAndResize
+        ( A.BlockHeight(), bsize, 0, Mod(A.RowAlign(),B.RowStride()), 0, cut,
+          height, width, false, false );
+    const Int bsizeB = ( colwise ? B.BlockHeight() : B.BlockWidth() );
+    const Int cutB = ( colwise ? B.ColCut() : B.RowCut() );
+    if( bsizeB != bsize || cutB != cut )
+    {
+        EL_DEBUG_ONLY(
+          Output("Performing expensive GeneralPurpose block exchange");
+        )
+        GeneralPurpose( A, B );
+        return;
+    }
+    if( !A.Participating() )
+        return;
+
+    const int alignA = ( colwise ? A.ColAlign() : A.RowAlign() );
+    const int strideA = ( colwise ? A.ColStride() : A.RowStride() );
+    const int rankA = ( colwise ? A.ColRank() : A.RowRank() );
+    const int alignB = ( colwise ? B.ColAlign() : B.RowAlign() );
+    const int strideB = ( colwise ? B.ColStride() : B.RowStride() );
+    const int rankB = ( colwise ? B.ColRank() : B.RowRank() );
+    mpi::Comm comm = ( colwise ? A.ColComm() : A.RowComm() );
+
+    const Int numBlocks = ( length == 0 ? 0 : (length+cut+bsize-1)/bsize );
+    auto blockLength = [&]( Int block )
+    {
+        const Int beg = Max( block*bsize-cut, Int(0) );
+        const Int end = Min( (block+1)*bsize-cut, length );
+        return end-beg;
+    };
+
+    // Determine the (padded) amount of data contributed by each member of
+    // the U communicator to our V team
+    vector<Int> portions( strideA, 0 );
+    for( Int block=0; block<numBlocks; ++block )
+        if( Mod(alignB+block,strideB) == rankB )
+            portions[Mod(alignA+block,strideA)] +=
+              blockLength(block)*otherLength;
+    Int maxPortion = 0;
+    for( int q=0; q<strideA; ++q )
+        maxPortion = Max( maxPortion, portions[q] );
+    const Int portionSize = mpi::Pad( maxPortion );
+
+    vector<T> buffer;
+    FastResize( buffer, (strideA+1)*portionSize );
+    T* sendBuf = &buffer[0];
+    T* recvBuf = &buffer[portionSize];
+
+    // Pack the blocks that we own and which our V team requires
+    const T* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    Int offset = 0, localOffsetA = 0;
+    for( Int block=0; block<numBlocks; ++block )
+    {
+        if( Mod(alignA+block,strideA) != rankA )
+            continue;
+        const Int b = blockLength(block);
+        if( Mod(alignB+block,strideB) == rankB )
+        {
+            if( colwise )
+                util::InterleaveMatrix<T,Device::CPU>
+                ( b, otherLength,
+                  &ABuf[localOffsetA], 1, ALDim,
+                  &sendBuf[offset],    1, b );
+            else
+                util::InterleaveMatrix<T,Device::CPU>
+                ( otherLength, b,
+                  &ABuf[localOffsetA*ALDim], 1, ALDim,
+                  &sendBuf[offset],          1, otherLength );
+            offset += b*otherLength;
+        }
+        localOffsetA += b;
+    }
+
+    // Communicate
+    mpi::AllGather( sendBuf, portionSize, recvBuf, portionSize, comm );
+
+    // Unpack in the order in which each sender packed
+    T* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+    vector<Int> offsets( strideA, 0 );
+    Int localOffsetB = 0;
+    for( Int block=0; block<numBlocks; ++block )
+    {
+        if( Mod(alignB+block,strideB) != rankB )
+            continue;
+        const Int b = blockLength(block);
+        const int owner = Mod(alignA+block,strideA);
+        const T* data = &recvBuf[owner*portionSize+offsets[owner]];
+        if( colwise )
+            util::InterleaveMatrix<T,Device::CPU>
+            ( b, otherLength,
+              data,                  1, b,
+              &BBuf[localOffsetB],   1, BLDim );
+        else
+            util::InterleaveMatrix<T,Device::CPU>
+            ( otherLength, b,
+              data,                       1, otherLength,
+              &BBuf[localOffsetB*BLDim],  1, BLDim );
+        offsets[owner] += b*otherLength;
+        localOffsetB += b;
+    }
+}
+
+} // namespace block_exchange
+
+template<typename T>
+void ColwiseBlockExchange( const BlockMatrix<T>& A, BlockMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.RowDist() != STAR || B.RowDist() != STAR ||
+          !((A.ColDist() == MC && B.ColDist() == MR) ||
+            (A.ColDist() == MR && B.ColDist() == MC)) )
+          LogicError("Incompatible distributions");
+    )
+    block_exchange::Exchange( A, B, true );
+}
+
+template<typename T>
+void RowwiseBlockExchange( const BlockMatrix<T>& A, BlockMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.ColDist() != STAR || B.ColDist() != STAR ||
+          !((A.RowDist() == MC && B.RowDist() == MR) ||
+            (A.RowDist() == MR && B.RowDist() == MC)) )
+          LogicError("Incompatible distributions");
+    )
+    block_exchange::Exchange( A, B, false );
+}
+
+} // namespace copy
+} // namespace El
+
+#endif // ifndef EL_BLAS_COPY_BLOCKEXCHANGE_HPP
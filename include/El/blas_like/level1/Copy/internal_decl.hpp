@@ -224,6 +224,13 @@ void Scatter
 ( const DistMatrix<T,CIRC,CIRC,BLOCK>& A,
         DistMatrix<T,STAR,STAR,BLOCK>& B );
 
+// (U,STAR) |-> (V,STAR) for {U,V} = {MC,MR}
+template<typename T>
+void ColwiseBlockExchange( const BlockMatrix<T>& A, BlockMatrix<T>& B );
+// (STAR,U) |-> (STAR,V) for {U,V} = {MC,MR}
+template<typename T>
+void RowwiseBlockExchange( const BlockMatrix<T>& A, BlockMatrix<T>& B );
+
 } // namespace copy
 
 } // namespace El
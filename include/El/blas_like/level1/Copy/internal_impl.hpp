@@ -10,6 +10,7 @@
 #define EL_BLAS1_COPY_INTERNAL_IMPL_HPP
 
 #include <El/blas_like/level1/Copy/AllGather.hpp>
+#include <El/blas_like/level1/Copy/BlockExchange.hpp>
 #include <El/blas_like/level1/Copy/ColAllGather.hpp>
 #include <El/blas_like/level1/Copy/ColAllToAllDemote.hpp>
 #include <El/blas_like/level1/Copy/ColAllToAllPromote.hpp>
@@ -72,6 +72,42 @@ void MakeSymmetric
         AxpyTrapezoid( LOWER, T(1), *ATrans, A, -1 );
 }
 
+template<typename T>
+void MakeSymmetric
+( UpperOrLower uplo, SparseMatrix<T>& A, bool conjugate )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Cannot make non-square matrix symmetric");
+    A.AssertConsistent();
+
+    // Keep the stored triangle, drop the opposite one, and mirror the
+    // strictly stored triangle into its place
+    const Int numEntries = A.NumEntries();
+    const SparseMatrix<T> AOrig( A );
+    const Int* rowBuf = AOrig.LockedSourceBuffer();
+    const Int* colBuf = AOrig.LockedTargetBuffer();
+    const T* valBuf = AOrig.LockedValueBuffer();
+    A.SoftEmpty();
+    A.Reserve( 2*numEntries );
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const Int i = rowBuf[e];
+        const Int j = colBuf[e];
+        const T value = valBuf[e];
+        if( i == j )
+        {
+            A.QueueUpdate( i, i, conjugate ? T(RealPart(value)) : value );
+        }
+        else if( (uplo == LOWER && i > j) || (uplo == UPPER && i < j) )
+        {
+            A.QueueUpdate( i, j, value );
+            A.QueueUpdate( j, i, conjugate ? Conj(value) : value );
+        }
+    }
+    A.ProcessQueues();
+}
+
 template<typename T>
 void MakeHermitian( UpperOrLower uplo, Matrix<T>& A )
 {
@@ -97,6 +133,8 @@ void MakeHermitian( UpperOrLower uplo, ElementalMatrix<T>& A )
   ( UpperOrLower uplo, Matrix<T>& A, bool conjugate ); \
   EL_EXTERN template void MakeSymmetric \
   ( UpperOrLower uplo, ElementalMatrix<T>& A, bool conjugate ); \
+  EL_EXTERN template void MakeSymmetric \
+  ( UpperOrLower uplo, SparseMatrix<T>& A, bool conjugate ); \
   EL_EXTERN template void MakeHermitian \
   ( UpperOrLower uplo, Matrix<T>& A ); \
   EL_EXTERN template void MakeHermitian \
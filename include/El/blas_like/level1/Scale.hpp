@@ -148,6 +148,7 @@ void Scale( S alpha, AbstractDistMatrix<Real>& AReal,
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGINT
 #define EL_ENABLE_BIGFLOAT
+#define EL_ENABLE_HALF
 #include <El/macros/Instantiate.h>
 
 #undef EL_EXTERN
@@ -359,6 +359,12 @@ template<typename S,typename T,
          typename=EnableIf<CanCast<S,T>>>
 void Copy( const Matrix<S>& A, Matrix<T>& B );
 
+// Conversions between float and the 16-bit storage formats
+void Copy( const Matrix<Half>& A, Matrix<float>& B );
+void Copy( const Matrix<float>& A, Matrix<Half>& B );
+void Copy( const Matrix<BFloat16>& A, Matrix<float>& B );
+void Copy( const Matrix<float>& A, Matrix<BFloat16>& B );
+
 template<typename S,typename T,
          typename=EnableIf<CanCast<S,T>>>
 void Copy( const ElementalMatrix<S>& A, ElementalMatrix<T>& B );
@@ -373,6 +379,27 @@ template<typename S,typename T,
          typename=EnableIf<CanCast<S,T>>>
 void Copy( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B );
 
+// B := A with a persistent redistribution plan, which is only rebuilt when
+// the distributions, alignments, or sizes change. Copies between grids or
+// off of the CPU fall back to the planless Copy.
+template<typename T>
+void Copy
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B,
+  RedistPlan<T>& plan );
+
+// Enqueue the copy on a CPU stream; A may not be modified, and B may not be
+// accessed, until the returned future is ready. Redistributions communicate
+// from the stream's thread, so no other communication may take place over
+// the communicators of A and B in the meantime.
+template<typename S,typename T>
+std::future<void>
+Copy( const Matrix<S>& A, Matrix<T>& B, CPUStream& stream );
+template<typename S,typename T>
+std::future<void>
+Copy
+( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B,
+  CPUStream& stream );
+
 template<typename T>
 void CopyFromRoot
 ( const Matrix<T>& A, DistMatrix<T,CIRC,CIRC>& B,
@@ -874,6 +901,9 @@ void MakeSymmetric( UpperOrLower uplo, Matrix<T>& A, bool conjugate=false );
 template<typename T>
 void MakeSymmetric
 ( UpperOrLower uplo, ElementalMatrix<T>& A, bool conjugate=false );
+template<typename T>
+void MakeSymmetric
+( UpperOrLower uplo, SparseMatrix<T>& A, bool conjugate=false );
 
 // MakeTrapezoidal
 // ===============
@@ -1027,6 +1057,92 @@ template<typename Ring>
 Entry<Base<Ring>>
 SymmetricMinAbsLoc( UpperOrLower uplo, const AbstractDistMatrix<Ring>& A );
 
+// MultiReduction
+// ==============
+// Batches several Level 1 reductions over distributed matrices so that they
+// are resolved with a single local pass over each argument followed by a
+// single AllReduce. Each contribution is a (scale,value) pair: the inner
+// products are summed with unit scales, the maximum magnitudes are carried as
+// scales, and the two-norms combine their (scale,scaledSquare) pairs as in
+// ColumnTwoNorms, all with one user-defined operation.
+//
+// Since the batch is resolved by one collective, all of the arguments must
+// reduce over the same communicator (the DistComm for the scalar reductions
+// and the ColComm for the column reductions); they must remain valid until
+// StartReduce is called. The column reductions return the
+// results for the local columns of their arguments.
+template<typename Field>
+class MultiReduction
+{
+public:
+    typedef Base<Field> Real;
+
+    // Each registration returns the index of its result
+    Int AddDot
+    ( const AbstractDistMatrix<Field>& A, const AbstractDistMatrix<Field>& B );
+    Int AddFrobeniusNorm( const AbstractDistMatrix<Field>& A );
+    Int AddMaxAbs( const AbstractDistMatrix<Field>& A );
+    Int AddColumnDots
+    ( const AbstractDistMatrix<Field>& A, const AbstractDistMatrix<Field>& B );
+    Int AddColumnTwoNorms( const AbstractDistMatrix<Field>& A );
+
+    void Reduce();
+
+    // A split version of Reduce: when non-blocking collectives are available,
+    // the final AllReduce is left in flight between the two calls so that it
+    // may be overlapped with independent work
+    void StartReduce();
+    void FinishReduce();
+
+    Field Dot( Int index ) const;
+    Real FrobeniusNorm( Int index ) const;
+    Real MaxAbs( Int index ) const;
+    const Matrix<Field>& ColumnDots( Int index ) const;
+    const Matrix<Real>& ColumnTwoNorms( Int index ) const;
+
+    Int NumReductions() const EL_NO_EXCEPT;
+    // Remove all of the registered reductions (and their results)
+    void Clear();
+
+private:
+    enum ReductionType
+    {
+        REDUCE_DOT,
+        REDUCE_FROBENIUS_NORM,
+        REDUCE_MAX_ABS,
+        REDUCE_COLUMN_DOTS,
+        REDUCE_COLUMN_TWO_NORMS
+    };
+
+    struct Reduction
+    {
+        ReductionType type;
+        const AbstractDistMatrix<Field>* A;
+        const AbstractDistMatrix<Field>* B;
+        Int num=0, offset=0;
+        Matrix<Field> fieldResults;
+        Matrix<Real> realResults;
+    };
+
+    vector<Reduction> reductions_;
+    mpi::Comm comm_, crossComm_;
+    int root_=0;
+    bool participating_=true;
+    bool inFlight_=false, reduced_=false;
+    Int numScalarPairs_=0;
+
+    Matrix<Complex<Real>> pairs_;
+    mpi::Request<Complex<Real>> request_;
+    mpi::Op op_;
+    bool createdOp_=false;
+
+    Int Register
+    ( ReductionType type,
+      const AbstractDistMatrix<Field>& A,
+      const AbstractDistMatrix<Field>* B );
+    const Reduction& Result( Int index, ReductionType type ) const;
+};
+
 // Nrm2
 // ====
 template<typename Field>
@@ -1034,6 +1150,18 @@ Base<Field> Nrm2( const Matrix<Field>& x );
 template<typename Field>
 Base<Field> Nrm2( const AbstractDistMatrix<Field>& x );
 
+// PackRFP
+// =======
+// Store the Hermitian matrix implied by the 'uplo' triangle of A in
+// Rectangular Full Packed format (the other triangle is not referenced)
+template<typename T>
+void PackRFP( UpperOrLower uplo, const Matrix<T>& A, RFPMatrix<T>& APacked );
+// APacked is reconfigured on the grid of A
+template<typename T>
+void PackRFP
+( UpperOrLower uplo, const AbstractDistMatrix<T>& A,
+  DistRFPMatrix<T>& APacked );
+
 // QuasiDiagonalScale
 // ==================
 template<typename Field,typename FieldMain>
@@ -1508,6 +1636,14 @@ void TransposeAxpyContract
 ( T alpha, const BlockMatrix<T>& A,
                  BlockMatrix<T>& B, bool conjugate=false );
 
+// UnpackRFP
+// =========
+// Form the full Hermitian matrix stored in Rectangular Full Packed format
+template<typename T>
+void UnpackRFP( const RFPMatrix<T>& APacked, Matrix<T>& A );
+template<typename T>
+void UnpackRFP( const DistRFPMatrix<T>& APacked, AbstractDistMatrix<T>& A );
+
 // UpdateDiagonal
 // ==============
 template<typename T>
@@ -61,6 +61,14 @@ void Gemm
 ( Orientation orientA, Orientation orientB,
   T alpha, const Matrix<T,D>& A, const Matrix<T,D>& B, Matrix<T,D>& C );
 
+// Enqueue the update on a CPU stream; C may not be accessed (and A and B may
+// not be modified) until the returned future is ready
+template<typename T>
+std::future<void> Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const Matrix<T>& A, const Matrix<T>& B,
+  T beta, Matrix<T>& C, CPUStream& stream );
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -86,6 +94,16 @@ void LocalGemm
            const AbstractDistMatrix<T>& B,
                  AbstractDistMatrix<T>& C );
 
+// Multiply
+// ========
+// Y := alpha op(A) X + beta Y for a sparse matrix A and dense X and Y
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const SparseMatrix<T>& A,
+           const Matrix<T>& X,
+  T beta,        Matrix<T>& Y );
+
 // Hemm
 // ====
 template<typename T>
@@ -120,6 +138,18 @@ void Herk
 ( UpperOrLower uplo, Orientation orientation,
   Base<T> alpha, const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& C );
 
+// C := alpha op(A) op(A)^H + beta C, with C in Rectangular Full Packed format
+// (C is updated through two triangular Herk's and one Gemm on its blocks)
+template<typename T>
+void Herk
+( Orientation orientation,
+  Base<T> alpha, const Matrix<T>& A, Base<T> beta, RFPMatrix<T>& C );
+template<typename T>
+void Herk
+( Orientation orientation,
+  Base<T> alpha, const AbstractDistMatrix<T>& A,
+  Base<T> beta,        DistRFPMatrix<T>& C );
+
 // Her2k
 // =====
 template<typename T>
@@ -218,6 +248,14 @@ void QuasiTrsm
 ( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
   F alpha, const Matrix<F>& A, Matrix<F>& B,
   bool checkIfSingular=false );
+// Enqueue the solve on a CPU stream; B may not be accessed (and A may not be
+// modified) until the returned future is ready
+template<typename F>
+std::future<void> Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const Matrix<F>& A, Matrix<F>& B,
+  CPUStream& stream, bool checkIfSingular=false );
 template<typename F>
 void QuasiTrsm
 ( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
@@ -383,12 +421,16 @@ void LocalTrmm
 
 // Trsm
 // ====
+// All algorithms other than TRSM_DEFAULT only support side == LEFT
 namespace TrsmAlgorithmNS {
 enum TrsmAlgorithm {
   TRSM_DEFAULT,
   TRSM_LARGE,
   TRSM_MEDIUM,
-  TRSM_SMALL
+  TRSM_SMALL,
+  // Point-to-point pipelined solve for a few right-hand sides; it is never
+  // chosen by TRSM_DEFAULT
+  TRSM_PIPELINED
 };
 }
 using namespace TrsmAlgorithmNS;
@@ -528,6 +570,13 @@ void LocalTrrk
   T alpha, const DistMatrix<T,STAR,MC  >& A,
            const DistMatrix<T,MR,  STAR>& B,
   T beta,        DistMatrix<T,MC,  MR  >& C );
+template<typename T>
+void LocalTrrk
+( UpperOrLower uplo,
+  Orientation orientB,
+  T alpha, const DistMatrix<T,MC,STAR,BLOCK>& A,
+           const DistMatrix<T,MR,STAR,BLOCK>& B,
+  T beta,        DistMatrix<T,MC,MR,  BLOCK>& C );
 
 // Trr2k
 // =====
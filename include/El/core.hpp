@@ -24,6 +24,7 @@
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <set>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -88,6 +89,8 @@ struct QuadDouble;
 class BigInt;
 class BigFloat;
 #endif
+struct Half;
+struct BFloat16;
 template<typename Real>
 class Complex;
 
@@ -144,6 +147,10 @@ template<> struct IsScalar<BigInt>
 template<> struct IsScalar<BigFloat>
 { static const bool value=true; };
 #endif
+template<> struct IsScalar<Half>
+{ static const bool value=true; };
+template<> struct IsScalar<BFloat16>
+{ static const bool value=true; };
 template<typename T> struct IsScalar<Complex<T>>
 { static const bool value=IsScalar<T>::value; };
 
@@ -171,6 +178,10 @@ template<> struct IsField<Quad>
 template<> struct IsField<BigFloat>
 { static const bool value=true; };
 #endif
+template<> struct IsField<Half>
+{ static const bool value=true; };
+template<> struct IsField<BFloat16>
+{ static const bool value=true; };
 template<typename T> struct IsField<Complex<T>>
 { static const bool value=IsField<T>::value; };
 
@@ -237,6 +248,7 @@ template<typename T> struct IsStdField<Complex<T>>
 #include <El/core/environment/decl.hpp>
 
 #include <El/core/Timer.hpp>
+#include <El/core/Stream.hpp>
 #include <El/core/indexing/decl.hpp>
 #include <El/core/imports/blas.hpp>
 #ifdef HYDROGEN_HAVE_CUDA
@@ -272,6 +284,16 @@ template<typename T=double> class AbstractDistMatrix;
 template<typename T=double> class ElementalMatrix;
 template<typename T=double> class BlockMatrix;
 
+// DistGraph, DistSparseMatrix and DistMultiVec have not been ported yet; they
+// are only declared for the disabled distributed sparse-direct interfaces
+class DistGraph;
+template<typename T=double> class SparseMatrix;
+template<typename T=double> class DistSparseMatrix;
+template<typename T=double> class DistMultiVec;
+template<typename T=double> class RFPMatrix;
+template<typename T=double> class DistRFPMatrix;
+template<typename T> class RedistPlan;
+
 template<typename T=double, Dist U=MC, Dist V=MR,
          DistWrap wrap=ELEMENT, Device=Device::CPU>
 class DistMatrix;
@@ -305,7 +327,14 @@ class DistMatrix;
 // TODO: Sequential map
 //#include <El/core/Map.hpp>
 
+#include <El/core/Graph.hpp>
+#include <El/core/SparseMatrix.hpp>
+
 #include <El/core/DistMap.hpp>
+#include <El/core/RedistPlan.hpp>
+#include <El/core/Workspace.hpp>
+#include <El/core/OutOfCoreMatrix.hpp>
+#include <El/core/RFPMatrix.hpp>
 
 #include <El/core/Permutation.hpp>
 #include <El/core/DistPermutation.hpp>
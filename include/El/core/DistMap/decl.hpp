@@ -86,6 +86,9 @@ private:
 void InvertMap( const vector<Int>& map, vector<Int>& inverseMap );
 void InvertMap( const DistMap& map, DistMap& inverseMap );
 
+// Throw a LogicError if the map is not a permutation of [0,map.size())
+void EnsurePermutation( const vector<Int>& map );
+
 } // namespace El
 
 #endif // ifndef EL_CORE_DISTMAP_DECL_HPP
@@ -0,0 +1,274 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_ELEMENT_HALF_HPP
+#define EL_ELEMENT_HALF_HPP
+
+#include <cstdint>
+#include <limits>
+
+namespace El {
+
+// IEEE 754 binary16 ('Half') and bfloat16 ('BFloat16') are supported purely
+// as storage formats: an entry is widened to float when it is read, all
+// arithmetic is performed in single precision, and the result is rounded
+// (to nearest, ties to even) only when it is written back.
+
+namespace half {
+
+inline std::uint32_t FloatToBits( float alpha ) EL_NO_EXCEPT
+{
+    std::uint32_t bits;
+    std::memcpy( &bits, &alpha, sizeof(float) );
+    return bits;
+}
+
+inline float BitsToFloat( std::uint32_t bits ) EL_NO_EXCEPT
+{
+    float alpha;
+    std::memcpy( &alpha, &bits, sizeof(float) );
+    return alpha;
+}
+
+inline std::uint16_t FloatToHalfBits( float alpha ) EL_NO_EXCEPT
+{
+    std::uint32_t f = FloatToBits( alpha );
+    const std::uint32_t sign = (f >> 16) & 0x8000u;
+    f &= 0x7fffffffu;
+    if( f >= 0x7f800000u )
+    {
+        // Infinities stay infinite and NaNs stay (quiet) NaNs
+        const std::uint32_t nan =
+          ( f > 0x7f800000u ? 0x0200u | ((f >> 13) & 0x03ffu) : 0u );
+        return std::uint16_t(sign | 0x7c00u | nan);
+    }
+    if( f >= 0x477ff000u )
+    {
+        // Anything at least 65520 rounds to infinity
+        return std::uint16_t(sign | 0x7c00u);
+    }
+    if( f < 0x38800000u )
+    {
+        // The result is subnormal (or zero)
+        if( f < 0x33000000u )
+            return std::uint16_t(sign);
+        const std::uint32_t exponent = f >> 23;
+        const std::uint32_t mantissa = (f & 0x007fffffu) | 0x00800000u;
+        const std::uint32_t shift = 126 - exponent;
+        std::uint32_t h = mantissa >> shift;
+        const std::uint32_t remainder = mantissa & ((1u << shift) - 1);
+        const std::uint32_t halfway = 1u << (shift-1);
+        if( remainder > halfway || (remainder == halfway && (h & 1u)) )
+            ++h;
+        return std::uint16_t(sign | h);
+    }
+    // Rebias the exponent from 127 to 15; a carry out of the mantissa
+    // correctly increments the exponent
+    std::uint32_t h = (f - 0x38000000u) >> 13;
+    const std::uint32_t remainder = f & 0x1fffu;
+    if( remainder > 0x1000u || (remainder == 0x1000u && (h & 1u)) )
+        ++h;
+    return std::uint16_t(sign | h);
+}
+
+inline float HalfBitsToFloat( std::uint16_t h ) EL_NO_EXCEPT
+{
+    const std::uint32_t sign = std::uint32_t(h & 0x8000u) << 16;
+    const std::uint32_t exponent = (h >> 10) & 0x1fu;
+    std::uint32_t mantissa = h & 0x03ffu;
+    if( exponent == 0x1fu )
+        return BitsToFloat( sign | 0x7f800000u | (mantissa << 13) );
+    if( exponent == 0 )
+    {
+        if( mantissa == 0 )
+            return BitsToFloat( sign );
+        // Normalize the subnormal
+        std::uint32_t shift = 0;
+        while( !(mantissa & 0x0400u) )
+        {
+            mantissa <<= 1;
+            ++shift;
+        }
+        return BitsToFloat
+          ( sign | ((113-shift) << 23) | ((mantissa & 0x03ffu) << 13) );
+    }
+    return BitsToFloat( sign | ((exponent+112) << 23) | (mantissa << 13) );
+}
+
+inline std::uint16_t FloatToBFloat16Bits( float alpha ) EL_NO_EXCEPT
+{
+    const std::uint32_t f = FloatToBits( alpha );
+    if( (f & 0x7fffffffu) > 0x7f800000u )
+        return std::uint16_t((f >> 16) | 0x0040u);
+    const std::uint32_t lsb = (f >> 16) & 1u;
+    return std::uint16_t((f + 0x7fffu + lsb) >> 16);
+}
+
+inline float BFloat16BitsToFloat( std::uint16_t h ) EL_NO_EXCEPT
+{ return BitsToFloat( std::uint32_t(h) << 16 ); }
+
+} // namespace half
+
+struct Half
+{
+    std::uint16_t bits;
+
+    Half() = default;
+    Half( float alpha ) EL_NO_EXCEPT
+    : bits(half::FloatToHalfBits(alpha)) { }
+    template<typename S,typename=EnableIf<std::is_arithmetic<S>>>
+    Half( const S& alpha ) EL_NO_EXCEPT
+    : Half(float(alpha)) { }
+
+    operator float() const EL_NO_EXCEPT
+    { return half::HalfBitsToFloat(bits); }
+
+    static Half FromBits( std::uint16_t bits ) EL_NO_EXCEPT
+    { Half alpha; alpha.bits = bits; return alpha; }
+
+    Half& operator+=( float alpha ) EL_NO_EXCEPT
+    { return *this = Half(float(*this)+alpha); }
+    Half& operator-=( float alpha ) EL_NO_EXCEPT
+    { return *this = Half(float(*this)-alpha); }
+    Half& operator*=( float alpha ) EL_NO_EXCEPT
+    { return *this = Half(float(*this)*alpha); }
+    Half& operator/=( float alpha ) EL_NO_EXCEPT
+    { return *this = Half(float(*this)/alpha); }
+};
+
+struct BFloat16
+{
+    std::uint16_t bits;
+
+    BFloat16() = default;
+    BFloat16( float alpha ) EL_NO_EXCEPT
+    : bits(half::FloatToBFloat16Bits(alpha)) { }
+    template<typename S,typename=EnableIf<std::is_arithmetic<S>>>
+    BFloat16( const S& alpha ) EL_NO_EXCEPT
+    : BFloat16(float(alpha)) { }
+
+    operator float() const EL_NO_EXCEPT
+    { return half::BFloat16BitsToFloat(bits); }
+
+    static BFloat16 FromBits( std::uint16_t bits ) EL_NO_EXCEPT
+    { BFloat16 alpha; alpha.bits = bits; return alpha; }
+
+    BFloat16& operator+=( float alpha ) EL_NO_EXCEPT
+    { return *this = BFloat16(float(*this)+alpha); }
+    BFloat16& operator-=( float alpha ) EL_NO_EXCEPT
+    { return *this = BFloat16(float(*this)-alpha); }
+    BFloat16& operator*=( float alpha ) EL_NO_EXCEPT
+    { return *this = BFloat16(float(*this)*alpha); }
+    BFloat16& operator/=( float alpha ) EL_NO_EXCEPT
+    { return *this = BFloat16(float(*this)/alpha); }
+};
+
+template<typename T> struct Is16BitFloat
+{ static const bool value=false; };
+template<> struct Is16BitFloat<Half>
+{ static const bool value=true; };
+template<> struct Is16BitFloat<BFloat16>
+{ static const bool value=true; };
+
+// Contiguous conversions to and from single-precision buffers
+// -----------------------------------------------------------
+template<typename T,typename=EnableIf<Is16BitFloat<T>>>
+inline void Widen( Int n, const T* EL_RESTRICT x, float* EL_RESTRICT y )
+EL_NO_EXCEPT
+{
+    for( Int i=0; i<n; ++i )
+        y[i] = float(x[i]);
+}
+
+template<typename T,typename=EnableIf<Is16BitFloat<T>>>
+inline void Narrow( Int n, const float* EL_RESTRICT x, T* EL_RESTRICT y )
+EL_NO_EXCEPT
+{
+    for( Int i=0; i<n; ++i )
+        y[i] = T(x[i]);
+}
+
+} // namespace El
+
+namespace std {
+
+template<>
+class numeric_limits<El::Half>
+{
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr bool is_iec559 = true;
+    static constexpr int radix = 2;
+    static constexpr int digits = 11;
+    static constexpr int digits10 = 3;
+    static constexpr int max_digits10 = 5;
+    static constexpr int min_exponent = -13;
+    static constexpr int max_exponent = 16;
+
+    static El::Half min() EL_NO_EXCEPT
+    { return El::Half::FromBits(0x0400u); }
+    static El::Half max() EL_NO_EXCEPT
+    { return El::Half::FromBits(0x7bffu); }
+    static El::Half lowest() EL_NO_EXCEPT
+    { return El::Half::FromBits(0xfbffu); }
+    static El::Half epsilon() EL_NO_EXCEPT
+    { return El::Half::FromBits(0x1400u); }
+    static El::Half round_error() EL_NO_EXCEPT
+    { return El::Half::FromBits(0x3800u); }
+    static El::Half infinity() EL_NO_EXCEPT
+    { return El::Half::FromBits(0x7c00u); }
+    static El::Half quiet_NaN() EL_NO_EXCEPT
+    { return El::Half::FromBits(0x7e00u); }
+    static El::Half denorm_min() EL_NO_EXCEPT
+    { return El::Half::FromBits(0x0001u); }
+};
+
+template<>
+class numeric_limits<El::BFloat16>
+{
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr bool is_iec559 = false;
+    static constexpr int radix = 2;
+    static constexpr int digits = 8;
+    static constexpr int digits10 = 2;
+    static constexpr int max_digits10 = 4;
+    static constexpr int min_exponent = -125;
+    static constexpr int max_exponent = 128;
+
+    static El::BFloat16 min() EL_NO_EXCEPT
+    { return El::BFloat16::FromBits(0x0080u); }
+    static El::BFloat16 max() EL_NO_EXCEPT
+    { return El::BFloat16::FromBits(0x7f7fu); }
+    static El::BFloat16 lowest() EL_NO_EXCEPT
+    { return El::BFloat16::FromBits(0xff7fu); }
+    static El::BFloat16 epsilon() EL_NO_EXCEPT
+    { return El::BFloat16::FromBits(0x3c00u); }
+    static El::BFloat16 round_error() EL_NO_EXCEPT
+    { return El::BFloat16::FromBits(0x3f00u); }
+    static El::BFloat16 infinity() EL_NO_EXCEPT
+    { return El::BFloat16::FromBits(0x7f80u); }
+    static El::BFloat16 quiet_NaN() EL_NO_EXCEPT
+    { return El::BFloat16::FromBits(0x7fc0u); }
+    static El::BFloat16 denorm_min() EL_NO_EXCEPT
+    { return El::BFloat16::FromBits(0x0001u); }
+};
+
+} // namespace std
+
+#endif // ifndef EL_ELEMENT_HALF_HPP
@@ -10,6 +10,7 @@
 #define EL_ELEMENT_DECL_HPP
 
 #include <El/core/Element/Complex/decl.hpp>
+#include <El/core/Element/Half.hpp>
 #include <El/core/types.hpp>
 
 namespace El {
@@ -47,6 +48,8 @@ template<> std::string TypeName<Quad>();
 template<> std::string TypeName<BigInt>();
 template<> std::string TypeName<BigFloat>();
 #endif
+template<> std::string TypeName<Half>();
+template<> std::string TypeName<BFloat16>();
 template<typename Field,
          typename=EnableIf<IsComplex<Field>>,
          typename=void>
@@ -96,6 +99,10 @@ template<> struct IsPacked<QuadDouble>
 template<> struct IsPacked<Quad>
 { static const bool value=true; };
 #endif
+template<> struct IsPacked<Half>
+{ static const bool value=true; };
+template<> struct IsPacked<BFloat16>
+{ static const bool value=true; };
 template<typename T> struct IsPacked<Complex<T>>
 { static const bool value=IsPacked<T>::value; };
 template<typename T> struct IsPacked<ValueInt<T>>
@@ -116,6 +123,8 @@ using ConvertBase = typename ConvertBaseHelper<F,RealNew>::type;
 // Increase the precision (if possible)
 // ------------------------------------
 template<typename Field> struct PromoteHelper { typedef Field type; };
+template<> struct PromoteHelper<Half> { typedef float type; };
+template<> struct PromoteHelper<BFloat16> { typedef float type; };
 template<> struct PromoteHelper<float> { typedef double type; };
 
 // Handle the promotion of 'double'
@@ -189,6 +198,8 @@ template<> struct IsData<QuadDouble> { static const bool value=true; };
 #ifdef HYDROGEN_HAVE_QUADMATH
 template<> struct IsData<Quad> { static const bool value=true; };
 #endif
+template<> struct IsData<Half> { static const bool value=true; };
+template<> struct IsData<BFloat16> { static const bool value=true; };
 #ifdef HYDROGEN_HAVE_MPC
 template<> struct IsData<BigInt> { static const bool value=true; };
 template<> struct IsData<BigFloat> { static const bool value=true; };
@@ -0,0 +1,104 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_GRAPH_DECL_HPP
+#define EL_CORE_GRAPH_DECL_HPP
+
+namespace El {
+
+// A directed graph stored as a list of (source,target) edges which is sorted
+// lexicographically (and therefore grouped by source) once consistent, along
+// with the offset of the first edge of each source.
+//
+// Edges are usually added with the Queue* routines and a single subsequent
+// call to ProcessQueues(), which sorts the edges and removes duplicates.
+class Graph
+{
+public:
+    // Constructors and destructors
+    // ============================
+    Graph();
+    Graph( Int numSources );
+    Graph( Int numSources, Int numTargets );
+    Graph( const Graph& graph );
+    ~Graph();
+
+    // Assignment and reconfiguration
+    // ==============================
+    const Graph& operator=( const Graph& graph );
+
+    // Make the graph have zero sources, targets, and edges
+    void Empty( bool freeMemory=true );
+    // Remove all edges while keeping the number of sources and targets
+    void SoftEmpty();
+
+    void Resize( Int numVertices );
+    void Resize( Int numSources, Int numTargets );
+
+    // Ensure that there is space for at least the given number of edges
+    void Reserve( Int numEdges );
+
+    // Add (or remove) an edge and immediately restore consistency
+    void Connect( Int source, Int target );
+    void Disconnect( Int source, Int target );
+
+    // Queue the addition (or removal) of an edge until ProcessQueues()
+    void QueueConnection( Int source, Int target ) EL_NO_RELEASE_EXCEPT;
+    void QueueDisconnection( Int source, Int target ) EL_NO_RELEASE_EXCEPT;
+    void ProcessQueues();
+
+    // Directly set the number of edges and whether the graph is consistent;
+    // used by routines which fill the buffers themselves
+    void ForceNumEdges( Int numEdges );
+    void ForceConsistency( bool consistent=true ) EL_NO_EXCEPT;
+
+    // Queries
+    // =======
+    Int NumSources() const EL_NO_EXCEPT;
+    Int NumTargets() const EL_NO_EXCEPT;
+    Int NumEdges() const EL_NO_EXCEPT;
+    Int Capacity() const EL_NO_EXCEPT;
+    bool Consistent() const EL_NO_EXCEPT;
+
+    Int Source( Int edge ) const EL_NO_RELEASE_EXCEPT;
+    Int Target( Int edge ) const EL_NO_RELEASE_EXCEPT;
+    // The index of the first edge with the given source
+    Int SourceOffset( Int source ) const EL_NO_RELEASE_EXCEPT;
+    // The index of the first edge not preceding (source,target)
+    Int Offset( Int source, Int target ) const EL_NO_RELEASE_EXCEPT;
+    Int NumConnections( Int source ) const EL_NO_RELEASE_EXCEPT;
+    bool EdgeExists( Int source, Int target ) const EL_NO_RELEASE_EXCEPT;
+
+    Int* SourceBuffer() EL_NO_EXCEPT;
+    Int* TargetBuffer() EL_NO_EXCEPT;
+    Int* OffsetBuffer() EL_NO_EXCEPT;
+    const Int* LockedSourceBuffer() const EL_NO_EXCEPT;
+    const Int* LockedTargetBuffer() const EL_NO_EXCEPT;
+    const Int* LockedOffsetBuffer() const EL_NO_EXCEPT;
+
+    void AssertConsistent() const;
+
+private:
+    Int numSources_=0, numTargets_=0;
+    bool consistent_=true;
+
+    vector<Int> sources_, targets_;
+    set<pair<Int,Int>> markedForRemoval_;
+
+    // The offset of the first edge of each source (with a trailing entry
+    // for the total number of edges)
+    vector<Int> sourceOffsets_;
+
+    void ComputeSourceOffsets();
+
+    template<typename T> friend class SparseMatrix;
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_GRAPH_DECL_HPP
@@ -12,12 +12,49 @@
 
 namespace El {
 
+// The communication performed by an algorithm over the process columns
+// (MCComm) and rows (MRComm). Since the data exchanged within a process
+// column is itself distributed over the row dimension (and vice versa), the
+// number of words received by each process is colWords/width over MCComm and
+// rowWords/height over MRComm.
+struct GridTraffic
+{
+    double colWords=1, rowWords=1;
+    double colMessages=1, rowMessages=1;
+};
+
+// C := A B with A m x k and B k x n via SUMMA with the given blocksize
+GridTraffic GemmGridTraffic( Int m, Int n, Int k, Int blocksize );
+// A right-looking factorization of an m x n matrix whose panels require a
+// reduction over the process column for every column (e.g., LU with
+// partial pivoting or Householder QR)
+GridTraffic PanelGridTraffic( Int m, Int n, Int blocksize );
+
+// Latencies (in seconds) and inverse bandwidths (in seconds per word) for
+// messages within and between nodes
+struct GridNetwork
+{
+    double intraLatency=5e-7, intraWordTime=2.5e-10;
+    double interLatency=2e-6, interWordTime=2e-9;
+};
+
 class Grid
 {
 public:
     explicit Grid
     ( mpi::Comm comm=mpi::COMM_WORLD, GridOrder order=COLUMN_MAJOR );
     explicit Grid( mpi::Comm comm, int height, GridOrder order=COLUMN_MAJOR );
+
+    // Build the grid whose height and placement onto the nodes minimize the
+    // modeled time of the given traffic: the ranks are reordered so that
+    // each process column (or row, whichever the model favors) is packed
+    // onto as few nodes as possible. The viewing communicator is then a
+    // reordering of 'comm'. Falls back to the default height and ordering if
+    // the nodes hold different numbers of processes.
+    explicit Grid
+    ( mpi::Comm comm, const GridTraffic& traffic,
+      GridOrder order=COLUMN_MAJOR,
+      const GridNetwork& network=GridNetwork() );
     ~Grid();
 
     // Simple interface (simpler version of distributed-based interface)
@@ -93,6 +130,21 @@ public:
 
     static int DefaultHeight( int gridSize ) EL_NO_EXCEPT;
 
+    // The modeled communication time of 'traffic' on a grid of the given
+    // height whose ranks are laid out node by node, 'nodeSize' per node, with
+    // consecutive ranks filling a process column (or a row if 'colsOnNode'
+    // is false)
+    static double CommCost
+    ( int gridSize, int height, int nodeSize, bool colsOnNode,
+      const GridTraffic& traffic,
+      const GridNetwork& network=GridNetwork() ) EL_NO_EXCEPT;
+    // The height, and whether to pack columns (rather than rows) onto nodes,
+    // which minimize CommCost
+    static int TopologyAwareHeight
+    ( int gridSize, int nodeSize, const GridTraffic& traffic,
+      bool& colsOnNode,
+      const GridNetwork& network=GridNetwork() ) EL_NO_EXCEPT;
+
     // To be used internally by Elemental
     static void InitializeDefault();
     static void InitializeTrivial();
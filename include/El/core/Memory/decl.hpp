@@ -33,6 +33,59 @@ constexpr unsigned DefaultMemoryMode<Device::GPU>()
 }
 #endif // HYDROGEN_HAVE_CUB
 
+// CPU memory modes
+// ================
+// Beyond the default of new[] and page-locked memory (which requires CUDA),
+// large buffers of trivially-destructible types may be placed explicitly on
+// the NUMA domains of the node. In each NUMA mode the entries are
+// value-initialized in parallel, with each OpenMP thread touching the same
+// contiguous chunk of the buffer that it is assigned by the level-1 kernels
+// (e.g., Zero and Copy), so that first-touch placement matches the later
+// access pattern as long as the threads are pinned (e.g., OMP_PROC_BIND).
+//
+// Without libnuma, the interleaved and bound modes fall back to first touch.
+namespace CPUMemoryModeNS {
+enum CPUMemoryMode : unsigned
+{
+  CPU_MEMORY_DEFAULT=0,
+  CPU_MEMORY_PINNED=1,
+  // Pages are distributed round-robin over all NUMA domains
+  CPU_MEMORY_INTERLEAVED=2,
+  // Pages are placed on the domain of the thread which first touches them
+  CPU_MEMORY_FIRST_TOUCH=3,
+  // Pages are placed on domain 'mode - CPU_MEMORY_BOUND'
+  CPU_MEMORY_BOUND=4
+};
+}
+using namespace CPUMemoryModeNS;
+
+inline unsigned BoundCPUMemoryMode( int domain ) EL_NO_EXCEPT
+{ return CPU_MEMORY_BOUND + domain; }
+
+// The mode of subsequently-constructed CPU memory (CPU_MEMORY_DEFAULT unless
+// changed); existing buffers are unaffected
+unsigned DefaultCPUMemoryMode() EL_NO_EXCEPT;
+void SetDefaultCPUMemoryMode( unsigned mode );
+
+template <Device D>
+unsigned InitialMemoryMode() { return DefaultMemoryMode<D>(); }
+template <>
+inline unsigned InitialMemoryMode<Device::CPU>()
+{ return DefaultCPUMemoryMode(); }
+
+namespace numa {
+
+// Whether the NUMA placement policies are available at runtime
+bool Available() EL_NO_EXCEPT;
+// The number of NUMA domains (one if unavailable)
+int NumDomains() EL_NO_EXCEPT;
+
+// Allocate uninitialized, page-aligned memory with the placement policy
+// of the given (NUMA) CPU memory mode
+void* Allocate( size_t numBytes, unsigned mode );
+void Free( void* ptr, size_t numBytes ) EL_NO_EXCEPT;
+
+} // namespace numa
 
 template<typename G, Device D=Device::CPU>
 class Memory
@@ -62,7 +115,7 @@ private:
     size_t size_;
     G* rawBuffer_;
     G* buffer_;
-    unsigned int mode_ = DefaultMemoryMode<D>();
+    unsigned int mode_ = InitialMemoryMode<D>();
 };// class Memory
 
 } // namespace El
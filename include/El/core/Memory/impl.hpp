@@ -10,7 +10,13 @@
 #define EL_CORE_MEMORY_IMPL_HPP_
 
 #include <iostream>
+#include <new>
 #include <sstream>
+#include <type_traits>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #ifdef HYDROGEN_HAVE_CUDA
 #include <cuda_runtime.h>
@@ -25,6 +31,39 @@ namespace El
 namespace
 {
 
+// Small buffers gain nothing from explicit placement
+const size_t minNUMABytes = 1 << 16;
+
+template <typename G>
+bool UseNUMA( size_t size, unsigned int mode )
+{
+    return mode >= CPU_MEMORY_INTERLEAVED &&
+      std::is_trivially_destructible<G>::value &&
+      size*sizeof(G) >= minNUMABytes;
+}
+
+// Value-initialize the entries using the same static partition as the
+// contiguous loops of the level-1 kernels
+template <typename G>
+void FirstTouch( G* buffer, size_t size )
+{
+#ifdef _OPENMP
+    #pragma omp parallel
+    {
+        const size_t numThreads = omp_get_num_threads();
+        const size_t thread = omp_get_thread_num();
+        const size_t chunk = (size + numThreads - 1) / numThreads;
+        const size_t start = Min(chunk * thread, size);
+        const size_t end = Min(chunk * (thread + 1), size);
+        for( size_t i=start; i<end; ++i )
+            new (&buffer[i]) G();
+    }
+#else
+    for( size_t i=0; i<size; ++i )
+        new (&buffer[i]) G();
+#endif
+}
+
 // Partially specializable object
 template <typename G, Device D>
 struct MemHelper;
@@ -34,6 +73,12 @@ struct MemHelper<G,Device::CPU>
 {
     static G* New( size_t size, unsigned int mode )
     {
+        if( UseNUMA<G>(size, mode) )
+        {
+            G* ptr = static_cast<G*>(numa::Allocate(size*sizeof(G), mode));
+            FirstTouch( ptr, size );
+            return ptr;
+        }
         G* ptr = nullptr;
         switch (mode) {
         case 0: ptr = new G[size]; break;
@@ -50,12 +95,22 @@ struct MemHelper<G,Device::CPU>
         }
         break;
 #endif // HYDROGEN_HAVE_CUDA
-        default: RuntimeError("Invalid CPU memory allocation mode");
+        default:
+            if( mode >= CPU_MEMORY_INTERLEAVED )
+                ptr = new G[size];
+            else
+                RuntimeError("Invalid CPU memory allocation mode");
         }
         return ptr;
     }
-    static void Delete( G*& ptr, unsigned int mode )
+    static void Delete( G*& ptr, unsigned int mode, size_t size )
     {
+        if( UseNUMA<G>(size, mode) )
+        {
+            numa::Free( ptr, size*sizeof(G) );
+            ptr = nullptr;
+            return;
+        }
         switch (mode) {
         case 0: delete[] ptr; break;
 #ifdef HYDROGEN_HAVE_CUDA
@@ -71,7 +126,11 @@ struct MemHelper<G,Device::CPU>
         }
         break;
 #endif // HYDROGEN_HAVE_CUDA
-        default: RuntimeError("Invalid CPU memory deallocation mode");
+        default:
+            if( mode >= CPU_MEMORY_INTERLEAVED )
+                delete[] ptr;
+            else
+                RuntimeError("Invalid CPU memory deallocation mode");
         }
         ptr = nullptr;
     }
@@ -120,7 +179,7 @@ struct MemHelper<G,Device::GPU>
         return ptr;
     }
 
-    static void Delete( G*& ptr, unsigned int mode )
+    static void Delete( G*& ptr, unsigned int mode, size_t size )
     {
         switch (mode) {
         case 0: EL_CHECK_CUDA(cudaFree(ptr)); break;
@@ -235,7 +294,7 @@ void Memory<G,D>::Empty()
 {
     if(rawBuffer_ != nullptr)
     {
-        MemHelper<G,D>::Delete(rawBuffer_, mode_);
+        MemHelper<G,D>::Delete(rawBuffer_, mode_, size_);
     }
     buffer_ = nullptr;
     size_ = 0;
@@ -246,7 +305,7 @@ void Memory<G,D>::SetMode(unsigned int mode)
 {
     if (size_ > 0 && mode_ != mode)
     {
-        MemHelper<G,D>::Delete(rawBuffer_, mode_);
+        MemHelper<G,D>::Delete(rawBuffer_, mode_, size_);
         rawBuffer_ = MemHelper<G,D>::New(size_, mode);
         buffer_ = rawBuffer_;
     }
@@ -0,0 +1,83 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_OUTOFCOREMATRIX_HPP
+#define EL_CORE_OUTOFCOREMATRIX_HPP
+
+#include <future>
+
+namespace El {
+
+// OutOfCoreMatrix
+// ===============
+// A matrix which is stored on (node-local) disk as a sequence of column
+// panels, each of which is distributed as an [MC,MR] matrix of the full
+// height with zero alignments, so that only a few panels need to be resident
+// at any time. Each process stores the local data of all of its panels in
+// its own BINARY file, which consists of the global height, width, and
+// panel width followed by the column-major local data of each panel.
+//
+// The asynchronous routines perform their file I/O on a background thread
+// and never call MPI, so that they may be overlapped with the computation
+// (and communication) on other resident panels.
+template<typename T>
+class OutOfCoreMatrix
+{
+public:
+    // The files are named directory/basename-<VC rank>.bin and are removed
+    // upon destruction
+    OutOfCoreMatrix
+    ( const El::Grid& grid, string directory, string basename="ooc" );
+    OutOfCoreMatrix
+    ( Int height, Int width, Int panelWidth,
+      const El::Grid& grid, string directory, string basename="ooc" );
+    ~OutOfCoreMatrix();
+
+    OutOfCoreMatrix( const OutOfCoreMatrix<T>& A ) = delete;
+    const OutOfCoreMatrix<T>& operator=( const OutOfCoreMatrix<T>& A ) = delete;
+
+    // (Re)create the file with the given dimensions. The contents are
+    // undefined until each panel has been written.
+    void Resize( Int height, Int width, Int panelWidth );
+
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+    Int PanelWidth() const EL_NO_EXCEPT;
+    Int NumPanels() const EL_NO_EXCEPT;
+    // The global columns of panel k
+    Range<Int> PanelRange( Int k ) const EL_NO_EXCEPT;
+    const El::Grid& Grid() const EL_NO_EXCEPT;
+    const string& Filename() const EL_NO_EXCEPT;
+
+    // Panel k is returned as an n x PanelRange(k) [MC,MR] matrix with zero
+    // alignments (panel is reconfigured if necessary)
+    void ReadPanel( Int k, DistMatrix<T>& panel ) const;
+    // Any distribution is accepted and redistributed if necessary
+    void WritePanel( Int k, const AbstractDistMatrix<T>& panel );
+
+    // The panel is reconfigured before returning, but its data may not be
+    // accessed until the future is ready
+    std::future<void> ReadPanelAsync( Int k, DistMatrix<T>& panel ) const;
+    // The panel must be an aligned [MC,MR] matrix of the correct size and
+    // may not be modified until the future is ready
+    std::future<void> WritePanelAsync( Int k, const DistMatrix<T>& panel );
+
+private:
+    const El::Grid* grid_;
+    string filename_;
+    Int height_=0, width_=0, panelWidth_=0;
+    // The offset (in bytes) of the local data of each panel in our file
+    vector<std::streamoff> offsets_;
+
+    void PreparePanel( Int k, DistMatrix<T>& panel ) const;
+    void AssertPanel( Int k, const AbstractDistMatrix<T>& panel ) const;
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_OUTOFCOREMATRIX_HPP
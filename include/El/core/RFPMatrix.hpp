@@ -0,0 +1,138 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_RFPMATRIX_HPP
+#define EL_CORE_RFPMATRIX_HPP
+
+namespace El {
+
+// RFPMatrix
+// =========
+// An n x n Hermitian matrix whose lower triangle is stored in Rectangular
+// Full Packed format (LAPACK's TRANSR='N', UPLO='L' variant), which requires
+// only n (n+1) / 2 entries while allowing every operation to be expressed in
+// terms of Level 3 kernels on views of a single rectangular buffer.
+//
+// With n1 = n - floor(n/2) and n2 = floor(n/2), A is partitioned as
+//
+//     A = | A11 A21^H |,
+//         | A21 A22   |
+//
+// where A11 is n1 x n1 and A22 is n2 x n2. The packed buffer is
+// (n+1) x n1 when n is even and n x n1 when n is odd, and holds
+//
+//   * the lower triangle of A11 in the lower triangle of Block11(),
+//   * A21 in Block21(), and
+//   * the lower triangle of A22, conjugate-transposed, in the upper triangle
+//     of Block22().
+//
+// The lower triangle of Block22() overlaps the strictly upper triangle of
+// Block11() (and vice versa), so only the referenced triangles may be
+// modified.
+template<typename T>
+class RFPMatrix
+{
+public:
+    // Constructors and destructors
+    // ============================
+    RFPMatrix();
+    RFPMatrix( Int n );
+    RFPMatrix( const RFPMatrix<T>& A );
+    ~RFPMatrix();
+
+    // Assignment and reconfiguration
+    // ==============================
+    const RFPMatrix<T>& operator=( const RFPMatrix<T>& A );
+    void Empty( bool freeMemory=true );
+    // The contents are undefined after resizing
+    void Resize( Int n );
+
+    // Queries
+    // =======
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+    // The sizes of the leading and trailing diagonal blocks
+    Int FirstSize() const EL_NO_EXCEPT;
+    Int SecondSize() const EL_NO_EXCEPT;
+
+    Matrix<T>& Packed() EL_NO_EXCEPT;
+    const Matrix<T>& LockedPacked() const EL_NO_EXCEPT;
+
+    // Views into the packed buffer
+    Matrix<T> Block11();
+    Matrix<T> Block21();
+    Matrix<T> Block22();
+    Matrix<T> LockedBlock11() const;
+    Matrix<T> LockedBlock21() const;
+    Matrix<T> LockedBlock22() const;
+
+    // Entry (i,j) of the full Hermitian matrix
+    T Get( Int i, Int j ) const EL_NO_RELEASE_EXCEPT;
+    // Set entry (i,j) and, implicitly, entry (j,i) to its conjugate
+    void Set( Int i, Int j, T alpha ) EL_NO_RELEASE_EXCEPT;
+
+private:
+    Int n_=0;
+    Matrix<T> packed_;
+};
+
+// DistRFPMatrix
+// =============
+// The same layout as RFPMatrix, but with the packed buffer stored as an
+// [MC,MR] matrix with zero alignments. The blocks are returned as views of
+// the buffer, so they may be passed directly to the distributed kernels (and
+// only half as much data needs to be moved by each redistribution as for a
+// full Hermitian matrix).
+template<typename T>
+class DistRFPMatrix
+{
+public:
+    // Constructors and destructors
+    // ============================
+    DistRFPMatrix( const El::Grid& grid=Grid::Default() );
+    DistRFPMatrix( Int n, const El::Grid& grid=Grid::Default() );
+    DistRFPMatrix( const DistRFPMatrix<T>& A );
+    ~DistRFPMatrix();
+
+    // Assignment and reconfiguration
+    // ==============================
+    const DistRFPMatrix<T>& operator=( const DistRFPMatrix<T>& A );
+    void Empty( bool freeMemory=true );
+    // The contents are undefined after resizing
+    void Resize( Int n );
+
+    // Queries
+    // =======
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+    Int FirstSize() const EL_NO_EXCEPT;
+    Int SecondSize() const EL_NO_EXCEPT;
+    const El::Grid& Grid() const EL_NO_EXCEPT;
+
+    DistMatrix<T>& Packed() EL_NO_EXCEPT;
+    const DistMatrix<T>& LockedPacked() const EL_NO_EXCEPT;
+
+    DistMatrix<T> Block11();
+    DistMatrix<T> Block21();
+    DistMatrix<T> Block22();
+    DistMatrix<T> LockedBlock11() const;
+    DistMatrix<T> LockedBlock21() const;
+    DistMatrix<T> LockedBlock22() const;
+
+    // These routines are collective over the grid
+    T Get( Int i, Int j ) const;
+    void Set( Int i, Int j, T alpha );
+
+private:
+    Int n_=0;
+    DistMatrix<T> packed_;
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_RFPMATRIX_HPP
@@ -0,0 +1,102 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_REDISTPLAN_HPP
+#define EL_CORE_REDISTPLAN_HPP
+
+namespace El {
+
+// RedistPlan
+// ==========
+// A reusable plan for repeatedly redistributing matrices with a fixed
+// (source distribution, target distribution, alignments, size) signature over
+// a single grid. The owner of each entry, the send and receive counts and
+// displacements, and the local packing and unpacking patterns are computed
+// when the plan is built, so that each Execute consists of packing into
+// persistent buffers, a single exchange, and unpacking. Both sides traverse
+// their local entries in column-major order, so no index metadata is
+// communicated.
+//
+// The entries exchanged with each neighbor form the product of a set of local
+// rows and a set of local columns, each of which is stored as a short list of
+// strided runs (a single run per neighbor for elemental distributions), so the
+// plan occupies storage proportional to the number of neighbors and blocks
+// rather than to the number of local entries.
+//
+// When no process communicates with more than a small fraction of the grid,
+// the exchange is performed with point-to-point messages to the precomputed
+// neighbors rather than with an AllToAll over the entire grid.
+//
+// Building a plan costs more than a single Copy, so plans are never created
+// implicitly; callers which repeat the same redistribution keep a plan alive
+// and pass it to Copy( A, B, plan ).
+template<typename T>
+class RedistPlan
+{
+public:
+    RedistPlan();
+    // Build a plan for B := A, where B retains its distribution and
+    // alignments and is resized to match A
+    RedistPlan( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B );
+
+    void Build( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B );
+    void Empty();
+
+    // Whether the plan was built for the distributions, alignments, and
+    // sizes of A and B
+    bool Matches
+    ( const AbstractDistMatrix<T>& A,
+      const AbstractDistMatrix<T>& B ) const;
+
+    // B := A. The plan is rebuilt if the signature of (A,B) does not match.
+    void Execute( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B );
+
+    Int NumSendNeighbors() const EL_NO_EXCEPT;
+    Int NumRecvNeighbors() const EL_NO_EXCEPT;
+
+private:
+    // The local indices start, start+stride, ..., start+(count-1)*stride
+    struct Run
+    {
+        Int start, stride, count;
+    };
+    // A neighbor and the owner coordinates which select its row and column
+    // runs
+    struct Neighbor
+    {
+        int rank, rowOwner, colOwner;
+    };
+
+    bool built_=false, pointToPoint_=false;
+    Int height_=0, width_=0;
+    DistData distA_, distB_;
+    mpi::Comm comm_;
+
+    // The runs of local rows (columns) of A owned by each row (column) owner
+    // of B, and vice versa
+    vector<vector<Run>> sendRowRuns_, sendColRuns_, recvRowRuns_, recvColRuns_;
+    vector<Neighbor> sendNeighbors_, recvNeighbors_;
+    // The entries which the redundant root of B that owns them also owns in A
+    Neighbor localSend_, localRecv_;
+    bool haveLocal_=false;
+
+    vector<int> sendCounts_, sendDispls_, recvCounts_, recvDispls_;
+    vector<T> sendBuf_, recvBuf_, localBuf_;
+    vector<mpi::Request<T>> requests_;
+
+    // Group the local indices by owner and compress each group into runs
+    static vector<vector<Run>>
+    OwnerRuns( const vector<int>& owners, int numOwners );
+    template<typename Function>
+    static void ForEachEntry
+    ( const vector<Run>& rowRuns, const vector<Run>& colRuns, Function func );
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_REDISTPLAN_HPP
@@ -0,0 +1,100 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_SPARSEMATRIX_DECL_HPP
+#define EL_CORE_SPARSEMATRIX_DECL_HPP
+
+namespace El {
+
+// A sparse matrix stored in a row-major coordinate format: the nonzeros are
+// sorted by row and then column once consistent, so that the column indices
+// and values of each row are contiguous (as in compressed sparse row storage).
+//
+// As with Graph, entries are usually added with QueueUpdate and a single
+// subsequent call to ProcessQueues(), which sums any duplicate entries.
+template<typename T>
+class SparseMatrix
+{
+public:
+    // Constructors and destructors
+    // ============================
+    SparseMatrix();
+    SparseMatrix( Int height, Int width );
+    SparseMatrix( const SparseMatrix<T>& A );
+    ~SparseMatrix();
+
+    // Assignment and reconfiguration
+    // ==============================
+    const SparseMatrix<T>& operator=( const SparseMatrix<T>& A );
+
+    // Make the matrix have zero dimensions and entries
+    void Empty( bool freeMemory=true );
+    // Remove all entries while keeping the dimensions
+    void SoftEmpty();
+
+    void Resize( Int height, Int width );
+
+    // Ensure that there is space for at least the given number of entries
+    void Reserve( Int numEntries );
+
+    // Add to (or zero) an entry and immediately restore consistency
+    void Update( Int row, Int col, T value );
+    void Zero( Int row, Int col );
+
+    // Queue an update to (or the removal of) an entry until ProcessQueues()
+    void QueueUpdate( Int row, Int col, T value ) EL_NO_RELEASE_EXCEPT;
+    void QueueZero( Int row, Int col ) EL_NO_RELEASE_EXCEPT;
+    void ProcessQueues();
+
+    // Directly set the number of entries and whether the matrix is
+    // consistent; used by routines which fill the buffers themselves
+    void ForceNumEntries( Int numEntries );
+    void ForceConsistency( bool consistent=true ) EL_NO_EXCEPT;
+
+    // Queries
+    // =======
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+    Int NumEntries() const EL_NO_EXCEPT;
+    Int Capacity() const EL_NO_EXCEPT;
+    bool Consistent() const EL_NO_EXCEPT;
+
+    El::Graph& Graph() EL_NO_EXCEPT;
+    const El::Graph& LockedGraph() const EL_NO_EXCEPT;
+
+    Int Row( Int index ) const EL_NO_RELEASE_EXCEPT;
+    Int Col( Int index ) const EL_NO_RELEASE_EXCEPT;
+    T Value( Int index ) const EL_NO_RELEASE_EXCEPT;
+    // The index of the first entry in the given row
+    Int RowOffset( Int row ) const EL_NO_RELEASE_EXCEPT;
+    // The index of the first entry not preceding (row,col)
+    Int Offset( Int row, Int col ) const EL_NO_RELEASE_EXCEPT;
+    Int NumConnections( Int row ) const EL_NO_RELEASE_EXCEPT;
+
+    // Return the (possibly implicitly zero) entry (row,col)
+    T Get( Int row, Int col ) const EL_NO_RELEASE_EXCEPT;
+
+    Int* SourceBuffer() EL_NO_EXCEPT;
+    Int* TargetBuffer() EL_NO_EXCEPT;
+    Int* OffsetBuffer() EL_NO_EXCEPT;
+    T* ValueBuffer() EL_NO_EXCEPT;
+    const Int* LockedSourceBuffer() const EL_NO_EXCEPT;
+    const Int* LockedTargetBuffer() const EL_NO_EXCEPT;
+    const Int* LockedOffsetBuffer() const EL_NO_EXCEPT;
+    const T* LockedValueBuffer() const EL_NO_EXCEPT;
+
+    void AssertConsistent() const;
+
+private:
+    El::Graph graph_;
+    vector<T> vals_;
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_SPARSEMATRIX_DECL_HPP
@@ -0,0 +1,170 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_STREAM_HPP
+#define EL_CORE_STREAM_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace El {
+
+class CPUStream;
+
+// CPUEvent
+// ========
+// A marker recorded on a CPUStream which completes once all of the work
+// enqueued on the stream before it has finished. An event which has never
+// been recorded is considered complete.
+class CPUEvent
+{
+public:
+    // Block until the most recently recorded work has finished
+    void Synchronize() const
+    { if( marker_.valid() ) marker_.wait(); }
+    // Return whether the most recently recorded work has finished
+    bool Query() const
+    {
+        return !marker_.valid() ||
+          marker_.wait_for(std::chrono::seconds(0)) ==
+          std::future_status::ready;
+    }
+
+private:
+    std::shared_future<void> marker_;
+    friend class CPUStream;
+};
+
+// CPUStream
+// =========
+// An in-order queue of CPU work. Each stream owns a dedicated worker thread
+// which executes the enqueued operations one at a time, in the order in which
+// they were enqueued; independent streams run concurrently with each other
+// and with the calling thread. Within an operation, threaded kernels use a
+// team of up to NumThreads() OpenMP threads.
+//
+// Every operation captures its arguments by reference, so the matrices
+// involved must outlive the operation and may not be accessed by other
+// threads until it has completed.
+class CPUStream
+{
+public:
+    explicit CPUStream( Int numThreads=1 );
+    // Outstanding work is completed before the worker thread is joined
+    ~CPUStream();
+
+    CPUStream( const CPUStream& ) = delete;
+    CPUStream& operator=( const CPUStream& ) = delete;
+
+    Int NumThreads() const EL_NO_EXCEPT;
+
+    // Enqueue a callable and return a future for its result; any exception
+    // that it throws is rethrown by the future
+    template<typename Function>
+    std::future<typename std::result_of<Function()>::type>
+    Enqueue( Function&& function );
+
+    // Enqueue a callable whose completion is only observed through events or
+    // Synchronize; the first exception thrown by such an operation is
+    // rethrown by the next call to Synchronize
+    void Launch( std::function<void()> function );
+
+    // Mark the current end of the queue with the given event
+    void Record( CPUEvent& event );
+    // Delay subsequently-enqueued work until the event has completed
+    // (the event is typically recorded on a different stream)
+    void Wait( const CPUEvent& event );
+
+    // Block until all enqueued work has finished
+    void Synchronize();
+    // Return whether all enqueued work has finished
+    bool Query() const;
+
+private:
+    Int numThreads_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable pending_, idle_;
+    std::deque<std::function<void()>> queue_;
+    bool busy_=false, stopping_=false;
+    std::exception_ptr error_;
+
+    std::thread worker_;
+
+    void Push( std::function<void()> function );
+    void Run();
+};
+
+template<typename Function>
+std::future<typename std::result_of<Function()>::type>
+CPUStream::Enqueue( Function&& function )
+{
+    typedef typename std::result_of<Function()>::type Result;
+    // std::function requires a copyable target, so the task is shared
+    auto task = std::make_shared<std::packaged_task<Result()>>
+      ( std::forward<Function>(function) );
+    auto future = task->get_future();
+    Push( [task]() { (*task)(); } );
+    return future;
+}
+
+// A stream reserved for driving the completion of nonblocking MPI requests
+// so that communication progresses while the calling thread computes. It is
+// created upon first use and destroyed by Finalize.
+CPUStream& ProgressStream();
+void DestroyProgressStream();
+
+namespace mpi {
+
+// Throw unless MPI was initialized with THREAD_MULTIPLE support, as MPI calls
+// made from a stream may overlap with those of the calling thread
+void AssertThreadSupport();
+
+// Complete the request on the given stream; the request (and its buffer) may
+// not be accessed until the returned future is ready
+template<typename T>
+std::future<void>
+WaitAsync( Request<T>& request, CPUStream& stream=ProgressStream() )
+{
+    EL_DEBUG_CSE
+    AssertThreadSupport();
+    return stream.Enqueue
+    ( [&request]()
+      {
+          while( !Test( request ) )
+              std::this_thread::yield();
+      } );
+}
+
+template<typename T>
+std::future<void>
+WaitAllAsync
+( int numRequests, Request<T>* requests, CPUStream& stream=ProgressStream() )
+{
+    EL_DEBUG_CSE
+    AssertThreadSupport();
+    return stream.Enqueue
+    ( [=]()
+      {
+          for( int j=0; j<numRequests; ++j )
+              while( !Test( requests[j] ) )
+                  std::this_thread::yield();
+      } );
+}
+
+} // namespace mpi
+
+} // namespace El
+
+#endif // ifndef EL_CORE_STREAM_HPP
@@ -0,0 +1,105 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_WORKSPACE_HPP
+#define EL_CORE_WORKSPACE_HPP
+
+namespace El {
+
+// Workspace
+// =========
+// A scoped arena for the temporaries of blocked algorithms. Rather than
+// constructing fresh matrices in each iteration (which reallocate as the
+// trailing matrix changes size), an algorithm opens a Workspace<T>::Scope
+// per iteration and attaches its temporaries to entries of the arena; the
+// entries are returned when the scope closes.
+//
+// Requests which do not fit within the arena are served from separate
+// overflow blocks so that previously attached matrices remain valid. Once the
+// outermost scope closes, the arena is regrown (a single time) to the peak
+// number of entries that were simultaneously in use, and so steady-state
+// iterations, as well as later calls with the same workspace, do not
+// allocate. Reserving the workspace size reported by an algorithm's query
+// (e.g., cholesky::WorkspaceSize) up front avoids even the first regrowth.
+template<typename T>
+class Workspace
+{
+public:
+    Workspace();
+    explicit Workspace( Int numEntries );
+
+    Workspace( const Workspace<T>& ) = delete;
+    Workspace<T>& operator=( const Workspace<T>& ) = delete;
+
+    // Ensure that 'numEntries' entries beyond those currently in use can be
+    // required without allocating. If a scope is open, the arena is instead
+    // regrown when the outermost scope closes.
+    void Reserve( Int numEntries );
+    // Free the arena (no scope may be open)
+    void Empty();
+
+    Int Capacity() const EL_NO_EXCEPT;
+    Int InUse() const EL_NO_EXCEPT;
+    // The largest number of entries which were simultaneously in use
+    Int Peak() const EL_NO_EXCEPT;
+    // The number of times that the arena or an overflow block was allocated
+    Int NumAllocations() const EL_NO_EXCEPT;
+
+    // Return 'numEntries' contiguous, uninitialized entries which remain
+    // valid until the innermost open scope closes
+    T* Require( Int numEntries );
+
+    // Attach A to a height x width (column-major) block of the arena
+    void Attach( Matrix<T>& A, Int height, Int width );
+    // Attach A to the arena as a height x width distributed matrix with
+    // alignments of zero, or aligned with 'data' (as with AlignWith)
+    void Attach( ElementalMatrix<T>& A, Int height, Int width );
+    void Attach
+    ( ElementalMatrix<T>& A, Int height, Int width,
+      const El::DistData& data );
+
+    class Scope
+    {
+    public:
+        explicit Scope( Workspace<T>& workspace );
+        ~Scope();
+
+        Scope( const Scope& ) = delete;
+        Scope& operator=( const Scope& ) = delete;
+
+    private:
+        Workspace<T>& workspace_;
+        Int offset_;
+        Int numOverflow_;
+    };
+
+private:
+    Memory<T> arena_;
+    Int offset_=0;
+
+    vector<Memory<T>> overflow_;
+    Int overflowSize_=0;
+
+    Int numScopes_=0;
+    Int peak_=0, target_=0, numAllocations_=0;
+
+    void AttachLocal( ElementalMatrix<T>& A, Int height, Int width );
+    void Release( Int offset, Int numOverflow );
+    void Grow();
+};
+
+// An upper bound on the number of entries that Workspace::Attach requires
+// on any process for a height x width matrix whose rows and columns are
+// distributed over 'colStride' and 'rowStride' processes
+inline Int MaxWorkspaceSize
+( Int height, Int width, Int colStride=1, Int rowStride=1 )
+{ return Max(MaxLength(height,colStride),Int(1))*MaxLength(width,rowStride); }
+
+} // namespace El
+
+#endif // ifndef EL_CORE_WORKSPACE_HPP
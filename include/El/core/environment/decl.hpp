@@ -16,6 +16,7 @@ using std::size_t;
 using std::array;
 using std::function;
 using std::pair;
+using std::set;
 using std::vector;
 
 using std::make_shared;
@@ -585,6 +585,21 @@ void Gemm
   const dcomplex* B, BlasInt BLDim,
   const dcomplex& beta,
         dcomplex* C, BlasInt CLDim );
+// The 16-bit storage formats widen to float and accumulate in float
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const Half& alpha,
+  const Half* A, BlasInt ALDim,
+  const Half* B, BlasInt BLDim,
+  const Half& beta,
+        Half* C, BlasInt CLDim );
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const BFloat16& alpha,
+  const BFloat16* A, BlasInt ALDim,
+  const BFloat16* B, BlasInt BLDim,
+  const BFloat16& beta,
+        BFloat16* C, BlasInt CLDim );
 
 template<typename T>
 void Hemm
@@ -235,6 +235,9 @@ void Create
 ( Comm parentComm, Group subsetGroup, Comm& subsetComm ) EL_NO_RELEASE_EXCEPT;
 void Dup( Comm original, Comm& duplicate ) EL_NO_RELEASE_EXCEPT;
 void Split( Comm comm, int color, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT;
+// Split into the groups of processes which can share memory (i.e., nodes);
+// without MPI-3, each process is treated as its own node
+void SplitShared( Comm comm, int key, Comm& nodeComm ) EL_NO_RELEASE_EXCEPT;
 void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT;
 bool Congruent( Comm comm1, Comm comm2 ) EL_NO_RELEASE_EXCEPT;
 void ErrorHandlerSet
@@ -285,6 +288,18 @@ void Translate
 // Utilities
 void Barrier( Comm comm=COMM_WORLD ) EL_NO_RELEASE_EXCEPT;
 
+// Hierarchical collectives
+// ------------------------
+// When enabled (on every process), AllGather, AllToAll, Broadcast,
+// ReduceScatter and SparseAllToAll of packed types over communicators whose
+// ranks are laid out node by node, with the same number on each node, are
+// performed in two levels: one leader per node exchanges the inter-node data,
+// while the ranks of each node deposit and read their data directly through
+// an MPI-3 shared-memory window. Other communicators are unaffected.
+// The default is set by Hydrogen_USE_HIERARCHICAL_COLLECTIVES.
+void SetHierarchicalCollectives( bool enable ) EL_NO_EXCEPT;
+bool HierarchicalCollectives() EL_NO_EXCEPT;
+
 template<typename T>
 void Wait( Request<T>& request ) EL_NO_RELEASE_EXCEPT;
 
@@ -1022,6 +1037,11 @@ EL_NO_RELEASE_EXCEPT
 template<typename T>
 void AllReduce( T* buf, int count, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking single-buffer AllReduce
+// ------------------------------------
+template<typename T>
+void IAllReduce( T* buf, int count, Op op, Comm comm, Request<T>& request );
+
 // ReduceScatter
 // -------------
 template<typename Real,
@@ -40,6 +40,10 @@ template<> struct MantissaBits<unsigned long long>
 template<> struct MantissaBits<long long int>
 { static const unsigned value = 8*sizeof(long long int)-1; };
 
+template<> struct MantissaBits<Half>
+{ static const unsigned value = 11; };
+template<> struct MantissaBits<BFloat16>
+{ static const unsigned value = 8; };
 template<> struct MantissaBits<float>
 { static const unsigned value = 24; };
 template<> struct MantissaBits<double>
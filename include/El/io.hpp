@@ -61,6 +61,13 @@ template<typename T>
 void Print
 ( const AbstractDistMatrix<T>& A, string title="DistMatrix", ostream& os=cout );
 
+// Sparse
+// ------
+void Print( const Graph& graph, string title="Graph", ostream& os=cout );
+template<typename T>
+void Print
+( const SparseMatrix<T>& A, string title="SparseMatrix", ostream& os=cout );
+
 // Utilities
 // ---------
 template<typename T>
@@ -118,9 +118,45 @@ void HermitianTridiag
   AbstractDistMatrix<Field>& A,
   AbstractDistMatrix<Field>& householderScalars,
   const HermitianTridiagCtrl<Field>& ctrl=HermitianTridiagCtrl<Field>() );
+// Draw the temporaries of each panel from 'workspace', which is grown to
+// herm_tridiag::WorkspaceSize(uplo,A,ctrl) entries if necessary and may be
+// reused across reductions without further allocation
+template<typename Field>
+void HermitianTridiag
+( UpperOrLower uplo,
+  AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& householderScalars,
+  Workspace<Field>& workspace,
+  const HermitianTridiagCtrl<Field>& ctrl=HermitianTridiagCtrl<Field>() );
+
+// Equivalent to HermitianTridiag( LOWER, ... ) on the unpacked matrix, with
+// the result stored back in Rectangular Full Packed format.
+//
+// NOTE: The reduction is not performed in packed form. A dense n x n copy of
+// the matrix (distributed like a [MC,MR] matrix in the second case) is
+// allocated for the duration of the call, so the peak memory is roughly
+// n^2 + n (n+1) / 2 entries rather than the n (n+1) / 2 of the packed
+// storage. These overloads only save memory between reductions.
+template<typename Field>
+void HermitianTridiag
+( RFPMatrix<Field>& A, Matrix<Field>& householderScalars );
+template<typename Field>
+void HermitianTridiag
+( DistRFPMatrix<Field>& A,
+  AbstractDistMatrix<Field>& householderScalars,
+  const HermitianTridiagCtrl<Field>& ctrl=HermitianTridiagCtrl<Field>() );
 
 namespace herm_tridiag {
 
+// An upper bound on the number of workspace entries that any process uses
+// for the distributed reduction of A (excluding any redistribution of A
+// itself). Only the lower reduction on the original grid currently draws on
+// the workspace, and zero is returned for the other approaches.
+template<typename Field>
+Int WorkspaceSize
+( UpperOrLower uplo, const AbstractDistMatrix<Field>& A,
+  const HermitianTridiagCtrl<Field>& ctrl=HermitianTridiagCtrl<Field>() );
+
 template<typename Field>
 void ExplicitCondensed( UpperOrLower uplo, Matrix<Field>& A );
 template<typename Field>
@@ -145,6 +181,24 @@ void ApplyQ
 
 // Hessenberg
 // ==========
+
+namespace HessenbergApproachNS {
+enum HessenbergApproach
+{
+    HESSENBERG_ONE_STAGE, // Direct blocked reduction
+    HESSENBERG_TWO_STAGE  // Reduction to band form followed by bulge-chasing
+};
+}
+using namespace HessenbergApproachNS;
+
+struct HessenbergCtrl
+{
+    HessenbergApproach approach=HESSENBERG_ONE_STAGE;
+    // The number of subdiagonals of the intermediate band form of the
+    // two-stage approach (zero selects the algorithmic blocksize)
+    Int bandwidth=0;
+};
+
 template<typename Field>
 void Hessenberg
 ( UpperOrLower uplo, Matrix<Field>& A, Matrix<Field>& householderScalars );
@@ -156,9 +210,33 @@ void Hessenberg
 namespace hessenberg {
 
 template<typename Field>
-void ExplicitCondensed( UpperOrLower uplo, Matrix<Field>& A );
+void ExplicitCondensed
+( UpperOrLower uplo, Matrix<Field>& A,
+  const HessenbergCtrl& ctrl=HessenbergCtrl() );
+template<typename Field>
+void ExplicitCondensed
+( UpperOrLower uplo, AbstractDistMatrix<Field>& A,
+  const HessenbergCtrl& ctrl=HessenbergCtrl() );
+
+// Two-stage reduction to upper-Hessenberg form: A is first reduced to upper
+// Hessenberg form with 'bandwidth' subdiagonals using blocked Householder
+// transformations, whose reflectors are stored below the band of A, and the
+// band is then reduced by bulge-chasing, with the resulting reflectors
+// returned as the columns of the bandwidth x numBulge matrix 'bulgeReflectors'.
+template<typename Field>
+void TwoStage
+( Matrix<Field>& A,
+  Matrix<Field>& householderScalars,
+  Matrix<Field>& bulgeReflectors,
+  Matrix<Field>& bulgeScalars,
+  const HessenbergCtrl& ctrl=HessenbergCtrl() );
 template<typename Field>
-void ExplicitCondensed( UpperOrLower uplo, AbstractDistMatrix<Field>& A );
+void TwoStage
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& householderScalars,
+  AbstractDistMatrix<Field>& bulgeReflectors,
+  AbstractDistMatrix<Field>& bulgeScalars,
+  const HessenbergCtrl& ctrl=HessenbergCtrl() );
 
 template<typename Field>
 void ApplyQ
@@ -173,6 +251,24 @@ void ApplyQ
   const AbstractDistMatrix<Field>& householderScalars,
         AbstractDistMatrix<Field>& B );
 
+// Apply the unitary matrix from a two-stage (upper) reduction
+template<typename Field>
+void ApplyQ
+( LeftOrRight side, Orientation orientation,
+  const Matrix<Field>& A,
+  const Matrix<Field>& householderScalars,
+  const Matrix<Field>& bulgeReflectors,
+  const Matrix<Field>& bulgeScalars,
+        Matrix<Field>& B );
+template<typename Field>
+void ApplyQ
+( LeftOrRight side, Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& householderScalars,
+  const AbstractDistMatrix<Field>& bulgeReflectors,
+  const AbstractDistMatrix<Field>& bulgeScalars,
+        AbstractDistMatrix<Field>& B );
+
 template<typename Field>
 void FormQ
 ( UpperOrLower uplo,
@@ -186,6 +282,21 @@ void FormQ
   const AbstractDistMatrix<Field>& householderScalars,
         AbstractDistMatrix<Field>& Q );
 
+template<typename Field>
+void FormQ
+( const Matrix<Field>& A,
+  const Matrix<Field>& householderScalars,
+  const Matrix<Field>& bulgeReflectors,
+  const Matrix<Field>& bulgeScalars,
+        Matrix<Field>& Q );
+template<typename Field>
+void FormQ
+( const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& householderScalars,
+  const AbstractDistMatrix<Field>& bulgeReflectors,
+  const AbstractDistMatrix<Field>& bulgeScalars,
+        AbstractDistMatrix<Field>& Q );
+
 } // namespace hessenberg
 
 } // namespace El
@@ -109,6 +109,60 @@ void Overwrite
 
 } // namespace ls
 
+// Sketch-and-precondition least squares
+// -------------------------------------
+// For tall A (m >> n), the rows of A are compressed by a random embedding S
+// with s = oversample*n rows, the (small) sketch S A is factored as Q R, and
+// LSQR is run on min_Y || (A inv(R)) Y - B ||_F, which is well-conditioned
+// with high probability, before setting X := inv(R) Y. A only participates in
+// the sketch and in one multiply (and adjoint multiply) per iteration, so the
+// O(m n^2) Householder QR of A is avoided.
+//
+// Problems which are not overdetermined with orientation NORMAL, or which
+// are too small for the sketch to compress, fall back to the direct solve.
+namespace SketchTypeNS {
+enum SketchType {
+  // Dense i.i.d. Gaussian embedding, applied with GEMM
+  GAUSSIAN_SKETCH,
+  // Each row of A is added, with random signs, into 'sparsity' random rows of
+  // the sketch (a sparse sign embedding in the spirit of CountSketch/OSNAP),
+  // requiring O(sparsity m n) work
+  SPARSE_SKETCH
+};
+}
+using namespace SketchTypeNS;
+
+template<typename Real>
+struct SketchedLeastSquaresCtrl
+{
+    SketchType sketch=SPARSE_SKETCH;
+    Real oversample=4;
+    Int sparsity=8; // only used if 'sketch' is SPARSE_SKETCH
+
+    // LSQR stops once either the residual or the normal-equation residual
+    // is relatively small
+    Real tol=Pow(limits::Epsilon<Real>(),Real(0.9));
+    Int maxIts=200;
+
+    bool progress=false;
+    bool time=false;
+};
+
+template<typename Field>
+void LeastSquares
+( Orientation orientation,
+  const Matrix<Field>& A,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  const SketchedLeastSquaresCtrl<Base<Field>>& ctrl );
+template<typename Field>
+void LeastSquares
+( Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& B,
+        AbstractDistMatrix<Field>& X,
+  const SketchedLeastSquaresCtrl<Base<Field>>& ctrl );
+
 // Ridge regression
 // ================
 // A special case of Tikhonov regularization where the regularization matrix
@@ -11,8 +11,8 @@
 
 #include <El/lapack_like/perm.hpp>
 #include <El/lapack_like/util.hpp>
-//#include <El/lapack_like/factor/ldl/sparse/symbolic.hpp>
-//#include <El/lapack_like/factor/ldl/sparse/numeric.hpp>
+#include <El/lapack_like/factor/ldl/sparse/symbolic.hpp>
+#include <El/lapack_like/factor/ldl/sparse/numeric.hpp>
 
 namespace El {
 
@@ -23,8 +23,25 @@ void Cholesky( UpperOrLower uplo, Matrix<Field>& A );
 template<typename Field>
 void Cholesky
 ( UpperOrLower uplo, AbstractDistMatrix<Field>& A, bool scalapack=false );
+// Draw the temporaries of each step from 'workspace', which is grown to
+// cholesky::WorkspaceSize(uplo,A) entries if necessary and may be reused
+// across factorizations without further allocation
+template<typename Field>
+void Cholesky
+( UpperOrLower uplo, AbstractDistMatrix<Field>& A,
+  Workspace<Field>& workspace );
 template<typename Field>
 void Cholesky( UpperOrLower uplo, DistMatrix<Field,STAR,STAR>& A );
+// Stream the column panels of the out-of-core matrix A through memory
+// (using a left-looking algorithm) and overwrite them with the factor
+template<typename Field>
+void Cholesky( UpperOrLower uplo, OutOfCoreMatrix<Field>& A );
+// Overwrite the Rectangular Full Packed matrix A with its lower Cholesky
+// factor (in the same format)
+template<typename Field>
+void Cholesky( RFPMatrix<Field>& A );
+template<typename Field>
+void Cholesky( DistRFPMatrix<Field>& A );
 
 template<typename Field>
 void ReverseCholesky( UpperOrLower uplo, Matrix<Field>& A );
@@ -59,6 +76,12 @@ void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<Field>& A );
 
 namespace cholesky {
 
+// An upper bound on the number of workspace entries that any process uses
+// for the distributed factorization of A (excluding any redistribution of A
+// itself into an [MC,MR] matrix)
+template<typename Field>
+Int WorkspaceSize( UpperOrLower uplo, const AbstractDistMatrix<Field>& A );
+
 template<typename Field>
 void SolveAfter
 ( UpperOrLower uplo,
@@ -87,6 +110,32 @@ void SolveAfter
   const DistPermutation& P,
         AbstractDistMatrix<Field>& B );
 
+template<typename Field>
+void SolveAfter
+( UpperOrLower uplo,
+  Orientation orientation,
+  const OutOfCoreMatrix<Field>& A,
+        AbstractDistMatrix<Field>& B );
+
+// A must contain the result of Cholesky( A ) on a packed matrix
+template<typename Field>
+void SolveAfter
+( Orientation orientation,
+  const RFPMatrix<Field>& A,
+        Matrix<Field>& B );
+template<typename Field>
+void SolveAfter
+( Orientation orientation,
+  const DistRFPMatrix<Field>& A,
+        AbstractDistMatrix<Field>& B );
+
+// Factor the matrix using a DAG of tile kernels scheduled as OpenMP tasks
+// (when EL_HYBRID is defined) so that the panels may overlap with the
+// trailing updates of previous steps
+template<typename Field>
+void Tile
+( UpperOrLower uplo, Matrix<Field>& A, Int tileSize=Blocksize() );
+
 } // namespace cholesky
 
 // LDL
@@ -297,6 +346,17 @@ template<typename Field>
 void LU( Matrix<Field>& A, Permutation& P );
 template<typename Field>
 void LU( AbstractDistMatrix<Field>& A, DistPermutation& P );
+// Draw the temporaries of each step from 'workspace', which is grown to
+// lu::WorkspaceSize(A) entries if necessary and may be reused across
+// factorizations without further allocation
+template<typename Field>
+void LU
+( AbstractDistMatrix<Field>& A, DistPermutation& P,
+  Workspace<Field>& workspace );
+// Stream the column panels of the out-of-core matrix A through memory
+// (using a left-looking algorithm) and overwrite them with the factors
+template<typename Field>
+void LU( OutOfCoreMatrix<Field>& A, DistPermutation& P );
 
 // LU with full pivoting
 // ---------------------
@@ -336,6 +396,12 @@ void LUMod
 
 namespace lu {
 
+// An upper bound on the number of workspace entries that any process uses
+// for the distributed, partially-pivoted factorization of A (excluding any
+// redistribution of A itself into an [MC,MR] matrix)
+template<typename Field>
+Int WorkspaceSize( const AbstractDistMatrix<Field>& A );
+
 // Solve linear systems using an implicit unpivoted LU factorization
 // -----------------------------------------------------------------
 template<typename Field>
@@ -363,6 +429,12 @@ void SolveAfter
   const AbstractDistMatrix<Field>& A,
   const DistPermutation& P,
         AbstractDistMatrix<Field>& B );
+template<typename Field>
+void SolveAfter
+( Orientation orientation,
+  const OutOfCoreMatrix<Field>& A,
+  const DistPermutation& P,
+        AbstractDistMatrix<Field>& B );
 
 // Solve linear systems using an implicit fully-pivoted LU factorization
 // ---------------------------------------------------------------------
@@ -381,6 +453,13 @@ void SolveAfter
   const DistPermutation& Q,
         AbstractDistMatrix<Field>& B );
 
+// Partially-pivoted LU using a DAG of panel and column-of-tiles update
+// kernels scheduled as OpenMP tasks (when EL_HYBRID is defined)
+// ------------------------------------------------------------------------
+template<typename Field>
+void Tile
+( Matrix<Field>& A, Permutation& P, Int tileSize=Blocksize() );
+
 } // namespace lu
 
 // LQ
@@ -497,6 +576,15 @@ void QR
 ( AbstractDistMatrix<Field>& A,
   AbstractDistMatrix<Field>& householderScalars,
   AbstractDistMatrix<Base<Field>>& signature );
+// Draw the temporaries of each panel from 'workspace', which is grown to
+// qr::WorkspaceSize(A) entries if necessary and may be reused across
+// factorizations without further allocation
+template<typename Field>
+void QR
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& householderScalars,
+  AbstractDistMatrix<Base<Field>>& signature,
+  Workspace<Field>& workspace );
 
 // Return an implicit representation of (Q,R,Omega) such that A Omega^T ~= Q R
 // ---------------------------------------------------------------------------
@@ -517,6 +605,11 @@ void QR
 
 namespace qr {
 
+// An upper bound on the number of workspace entries that any process uses
+// for the panel factorizations of the distributed Householder QR of A
+template<typename Field>
+Int WorkspaceSize( const AbstractDistMatrix<Field>& A );
+
 // Apply Q using its implicit representation
 // -----------------------------------------
 template<typename Field>
@@ -556,12 +649,55 @@ void SolveAfter
         AbstractDistMatrix<Field>& X );
 // TODO(poulson): Version which involves permutation matrix
 
+// Householder QR using a DAG of panel and column-of-tiles update kernels
+// scheduled as OpenMP tasks (when EL_HYBRID is defined)
+// -----------------------------------------------------------------------
+template<typename Field>
+void Tile
+( Matrix<Field>& A,
+  Matrix<Field>& householderScalars,
+  Matrix<Base<Field>>& signature,
+  Int tileSize=Blocksize() );
+
 // Cholesky-based QR
 // -----------------
+enum CholeskyQRVariant
+{
+    // A single pass of R := chol(A^H A), A := A inv(R)
+    CHOLESKY_QR,
+    // Two passes, which yields an orthogonality of O(eps) as long as
+    // cond(A) is less than roughly 1/sqrt(eps)
+    CHOLESKY_QR2,
+    // A first pass with the Gram matrix shifted by
+    // 11 (m n + n (n+1)) eps ||A||_F^2 followed by CholeskyQR2, which is
+    // applicable for condition numbers up to roughly 1/eps
+    // (cf. Fukaya et al.'s "Shifted Cholesky QR for computing the QR
+    // factorization of ill-conditioned matrices" [CITATION])
+    SHIFTED_CHOLESKY_QR3
+};
+
+struct CholeskyQRCtrl
+{
+    CholeskyQRVariant variant=CHOLESKY_QR;
+
+    // Accumulate the Gram matrices (and compute their Cholesky factors) in
+    // Promote<Field>, which preserves the O(eps) orthogonality of
+    // CholeskyQR2 for condition numbers up to roughly 1/eps
+    bool promoteGram=false;
+
+    // If the (unshifted) Gram matrix of the first pass is not numerically
+    // HPD, restart with SHIFTED_CHOLESKY_QR3 rather than throwing
+    bool shiftOnBreakdown=true;
+};
+
 template<typename Field>
-void Cholesky( Matrix<Field>& A, Matrix<Field>& R );
+void Cholesky
+( Matrix<Field>& A, Matrix<Field>& R,
+  const CholeskyQRCtrl& ctrl=CholeskyQRCtrl() );
 template<typename Field>
-void Cholesky( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& R );
+void Cholesky
+( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& R,
+  const CholeskyQRCtrl& ctrl=CholeskyQRCtrl() );
 
 // Return R (with non-negative diagonal) such that A = Q R or A Omega^T = Q R
 // --------------------------------------------------------------------------
@@ -636,6 +772,98 @@ void DisjointNeighborColSwaps
         Matrix<Field>& R,
   const Matrix<Int>& colSwaps );
 
+// Updates of an explicit QR factorization, A = Q R, with Q m x n and R n x n
+// --------------------------------------------------------------------------
+// Modifying k columns or rows at once is Level 3. With the transformations
+// aggregated nb (the algorithmic blocksize) at a time, it costs
+// O((m+n) n (nb+k)^2 / nb) work rather than the O(m n^2) of refactoring.
+// Inserting columns (or deleting rows, or a rank-k modification of a
+// non-square A) requires m >= n+k.
+
+// Insert the columns of C before column j of A
+template<typename Field>
+void InsertColumns
+(       Matrix<Field>& Q,
+        Matrix<Field>& R,
+        Int j,
+  const Matrix<Field>& C );
+template<typename Field>
+void InsertColumns
+(       AbstractDistMatrix<Field>& Q,
+        AbstractDistMatrix<Field>& R,
+        Int j,
+  const AbstractDistMatrix<Field>& C );
+
+// Delete the columns [j,j+numCols) of A
+template<typename Field>
+void DeleteColumns
+( Matrix<Field>& Q,
+  Matrix<Field>& R,
+  Int j,
+  Int numCols );
+template<typename Field>
+void DeleteColumns
+( AbstractDistMatrix<Field>& Q,
+  AbstractDistMatrix<Field>& R,
+  Int j,
+  Int numCols );
+
+// Insert the rows of C before row i of A
+template<typename Field>
+void InsertRows
+(       Matrix<Field>& Q,
+        Matrix<Field>& R,
+        Int i,
+  const Matrix<Field>& C );
+template<typename Field>
+void InsertRows
+(       AbstractDistMatrix<Field>& Q,
+        AbstractDistMatrix<Field>& R,
+        Int i,
+  const AbstractDistMatrix<Field>& C );
+
+// Delete the rows [i,i+numRows) of A
+template<typename Field>
+void DeleteRows
+( Matrix<Field>& Q,
+  Matrix<Field>& R,
+  Int i,
+  Int numRows );
+template<typename Field>
+void DeleteRows
+( AbstractDistMatrix<Field>& Q,
+  AbstractDistMatrix<Field>& R,
+  Int i,
+  Int numRows );
+
+// Update for A := A + U V^H, where U is m x k and V is n x k
+template<typename Field>
+void Mod
+(       Matrix<Field>& Q,
+        Matrix<Field>& R,
+  const Matrix<Field>& U,
+  const Matrix<Field>& V );
+template<typename Field>
+void Mod
+(       AbstractDistMatrix<Field>& Q,
+        AbstractDistMatrix<Field>& R,
+  const AbstractDistMatrix<Field>& U,
+  const AbstractDistMatrix<Field>& V );
+
+// Append the columns of C to a packed Householder QR factorization of A
+template<typename Field>
+void AppendColumns
+(       Matrix<Field>& A,
+        Matrix<Field>& householderScalars,
+        Matrix<Base<Field>>& signature,
+  const Matrix<Field>& C );
+template<typename Field>
+void AppendColumns
+(       AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& householderScalars,
+        AbstractDistMatrix<Base<Field>>& signature,
+  const AbstractDistMatrix<Field>& C );
+
 template<typename Field>
 struct TreeData
 {
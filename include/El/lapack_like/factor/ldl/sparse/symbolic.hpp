@@ -25,8 +25,44 @@
 #include <El/lapack_like/factor/ldl/sparse/symbolic/NodeInfo.hpp>
 
 namespace El {
+
+struct BisectCtrl
+{
+    bool sequential=true;
+    Int numDistSeps=1;
+    // The number of candidate separators to consider for each sequential
+    // bisection
+    Int numSeqSeps=1;
+    // The maximum number of vertices in a leaf of the elimination tree
+    Int cutoff=128;
+    bool storeFactRecvInds=false;
+};
+
 namespace ldl {
 
+// Compute a vertex separator of the (symmetric) graph and the subgraphs of
+// the two halves. The returned map sends each vertex to its new index, with
+// the left half ordered first, then the right half, then the separator.
+// Edges into vertices at or beyond graph.NumSources() (i.e., into ancestor
+// separators) are preserved in the children.
+Int Bisect
+( const Graph& graph,
+        Graph& leftChild,
+        Graph& rightChild,
+        vector<Int>& perm,
+  const BisectCtrl& ctrl=BisectCtrl() );
+
+// Bisect a graph arising from a natural ordering of an nx x ny x nz grid
+// with a plane orthogonal to its largest dimension
+Int NaturalBisect
+( Int nx, Int ny, Int nz,
+  const Graph& graph,
+        Int& nxLeft, Int& nyLeft, Int& nzLeft,
+        Graph& leftChild,
+        Int& nxRight, Int& nyRight, Int& nzRight,
+        Graph& rightChild,
+        vector<Int>& perm );
+
 Int Analysis( NodeInfo& rootInfo, Int myOff=0 );
 void Analysis( DistNodeInfo& rootInfo, bool storeFactRecvInds=true );
 
@@ -43,6 +79,7 @@ void NestedDissection
         Separator& rootSep,
         NodeInfo& rootInfo,
   const BisectCtrl& ctrl=BisectCtrl() );
+// TODO(poulson): Not built until DistGraph has been ported
 void NestedDissection
 ( const DistGraph& graph,
         DistMap& map,
@@ -57,6 +94,7 @@ void NaturalNestedDissection
         Separator& rootSep,
         NodeInfo& info,
         Int cutoff );
+// TODO(poulson): Not built until DistGraph has been ported
 void NaturalNestedDissection
 ( Int nx, Int ny, Int nz,
   const DistGraph& graph,
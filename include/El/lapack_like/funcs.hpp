@@ -42,6 +42,40 @@ struct SquareRootCtrl
     bool progress=false;
 };
 
+template<typename Real>
+struct ExpTimesCtrl
+{
+    // The maximum degree of the truncated Taylor series on each step
+    Int maxDegree=55;
+    // If zero, the unit roundoff is used
+    Real tol=Real(0);
+    // Shift A by trace(A)/n before forming the Taylor series?
+    bool shift=true;
+    bool progress=false;
+};
+
+// Exponential
+// ===========
+// Overwrite A with exp(A) via scaling and squaring of a Pade approximant
+template<typename Field>
+void Exp( Matrix<Field>& A );
+template<typename Field>
+void Exp( AbstractDistMatrix<Field>& A );
+
+// Overwrite B with exp(t A) B without forming exp(t A)
+template<typename Field>
+void ExpTimes
+( const Matrix<Field>& A,
+        Matrix<Field>& B,
+        Field t=Field(1),
+  const ExpTimesCtrl<Base<Field>>& ctrl=ExpTimesCtrl<Base<Field>>() );
+template<typename Field>
+void ExpTimes
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& B,
+        Field t=Field(1),
+  const ExpTimesCtrl<Base<Field>>& ctrl=ExpTimesCtrl<Base<Field>>() );
+
 // Hermitian function
 // ==================
 template<typename Field>
@@ -43,6 +43,97 @@ Base<F> TwoCondition( const Matrix<F>& A );
 template<typename F>
 Base<F> TwoCondition( const AbstractDistMatrix<F>& A );
 
+// Condition number estimates
+// --------------------------
+// Rather than forming inv(A) (or computing a full SVD), A is LU factored once
+// and || inv(A) || is estimated using solves against the factors: the one and
+// infinity norms via Higham and Tisseur's block generalization of Hager's
+// method, and the two norm via Lanczos bidiagonalization.
+template<typename F>
+Base<F> ConditionEstimate( const Matrix<F>& A, NormType type=ONE_NORM );
+template<typename F>
+Base<F> ConditionEstimate
+( const AbstractDistMatrix<F>& A, NormType type=ONE_NORM );
+
+template<typename F>
+Base<F> InfinityConditionEstimate( const Matrix<F>& A );
+template<typename F>
+Base<F> InfinityConditionEstimate( const AbstractDistMatrix<F>& A );
+
+template<typename F>
+Base<F> OneConditionEstimate( const Matrix<F>& A );
+template<typename F>
+Base<F> OneConditionEstimate( const AbstractDistMatrix<F>& A );
+
+template<typename F>
+Base<F> TwoConditionEstimate( const Matrix<F>& A );
+template<typename F>
+Base<F> TwoConditionEstimate( const AbstractDistMatrix<F>& A );
+
+// Estimates of the norms of inverses from existing factorizations, so that,
+// e.g., OneNorm(A)*lu::InverseOneNormEstimate(A,P) estimates the condition
+// number of the original A after LU(A,P) for the price of a few solves
+namespace lu {
+
+template<typename F>
+Base<F> InverseOneNormEstimate( const Matrix<F>& A, const Permutation& P );
+template<typename F>
+Base<F> InverseOneNormEstimate
+( const AbstractDistMatrix<F>& A, const DistPermutation& P );
+
+template<typename F>
+Base<F> InverseInfinityNormEstimate
+( const Matrix<F>& A, const Permutation& P );
+template<typename F>
+Base<F> InverseInfinityNormEstimate
+( const AbstractDistMatrix<F>& A, const DistPermutation& P );
+
+template<typename F>
+Base<F> InverseTwoNormEstimate( const Matrix<F>& A, const Permutation& P );
+template<typename F>
+Base<F> InverseTwoNormEstimate
+( const AbstractDistMatrix<F>& A, const DistPermutation& P );
+
+} // namespace lu
+
+namespace cholesky {
+
+// The one and infinity norms of the Hermitian inv(A) coincide
+template<typename F>
+Base<F> InverseOneNormEstimate( UpperOrLower uplo, const Matrix<F>& A );
+template<typename F>
+Base<F> InverseOneNormEstimate
+( UpperOrLower uplo, const AbstractDistMatrix<F>& A );
+
+} // namespace cholesky
+
+namespace qr {
+
+// A must be square
+template<typename F>
+Base<F> InverseOneNormEstimate
+( const Matrix<F>& A,
+  const Matrix<F>& householderScalars,
+  const Matrix<Base<F>>& signature );
+template<typename F>
+Base<F> InverseOneNormEstimate
+( const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& householderScalars,
+  const AbstractDistMatrix<Base<F>>& signature );
+
+template<typename F>
+Base<F> InverseInfinityNormEstimate
+( const Matrix<F>& A,
+  const Matrix<F>& householderScalars,
+  const Matrix<Base<F>>& signature );
+template<typename F>
+Base<F> InverseInfinityNormEstimate
+( const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& householderScalars,
+  const AbstractDistMatrix<Base<F>>& signature );
+
+} // namespace qr
+
 // Determinant
 // ===========
 template<typename F>
@@ -383,6 +474,40 @@ Base<F> SymmetricTwoNormEstimate
 ( UpperOrLower uplo, const AbstractDistMatrix<F>& A,
   Base<F> tol=1e-6, Int maxIts=1000 );
 
+// Largest singular values via Lanczos bidiagonalization
+// -----------------------------------------------------
+// Golub-Kahan-Lanczos with full reorthogonalization, which only requires
+// products with A and A^H and typically converges to the leading k singular
+// values long before the basis reaches min(m,n) vectors
+template<typename Real>
+struct LanczosSVDCtrl
+{
+    // Stop once the residual of each of the leading k Ritz values is below
+    // tol times the largest Ritz value
+    Real tol=Pow(limits::Epsilon<Real>(),Real(0.5));
+    // If zero, the basis may grow to min(m,n) vectors
+    Int maxBasisSize=0;
+    bool progress=false;
+};
+
+template<typename F>
+void LanczosSingularValues
+( const Matrix<F>& A, Int k, Matrix<Base<F>>& s,
+  const LanczosSVDCtrl<Base<F>>& ctrl=LanczosSVDCtrl<Base<F>>() );
+template<typename F>
+void LanczosSingularValues
+( const AbstractDistMatrix<F>& A, Int k, AbstractDistMatrix<Base<F>>& s,
+  const LanczosSVDCtrl<Base<F>>& ctrl=LanczosSVDCtrl<Base<F>>() );
+
+template<typename F>
+Base<F> KyFanNormEstimate
+( const Matrix<F>& A, Int k,
+  const LanczosSVDCtrl<Base<F>>& ctrl=LanczosSVDCtrl<Base<F>>() );
+template<typename F>
+Base<F> KyFanNormEstimate
+( const AbstractDistMatrix<F>& A, Int k,
+  const LanczosSVDCtrl<Base<F>>& ctrl=LanczosSVDCtrl<Base<F>>() );
+
 // Trace
 // =====
 template<typename T>
@@ -301,6 +301,13 @@ struct DCCtrl
     // eigenvectors with the outer singular vectors? This should only be
     // disabled for academic reasons.
     bool exploitStructure = true;
+
+    // Execute the sequential algorithm as OpenMP tasks? The two subproblems
+    // of each split of height greater than 'taskCutoff' are then solved
+    // concurrently, and the secular equations and eigenvector updates of each
+    // merge are spread over the team. This has no effect without OpenMP.
+    bool parallelTasks = false;
+    Int taskCutoff = 256;
 };
 
 // Cf. Section 4 of Gu and Eisenstat's "A Divide-and-Conquer Algorithm for the
@@ -325,13 +332,50 @@ enum DCCombinedColumnType {
 };
 const Int NUM_DC_COMBINED_COLUMN_TYPES = 4;
 
+struct MRRRInfo
+{
+    // The number of clusters which required a new representation
+    Int numClusters=0;
+    // The deepest level of the representation tree
+    Int maxDepth=0;
+    // The number of eigenvectors which were explicitly reorthogonalized after
+    // exceeding 'maxDepth' (each such vector should be rare)
+    Int numReorthogonalized=0;
+};
+
+// Cf. Dhillon, Parlett, and Voemel's "The Design and Implementation of the
+// MRRR Algorithm" [CITATION] and LAPACK's {s,d}stemr [CITATION]. This control
+// structure only affects the native implementation, which is used for the
+// datatypes not supported by PMRRR/LAPACK (and for all datatypes if 'native'
+// is true).
+template<typename Real>
+struct MRRRCtrl
+{
+    // Use the native implementation even when PMRRR/LAPACK support the
+    // datatype
+    bool native = false;
+
+    // Neighboring eigenvalues whose relative separation is below this
+    // threshold are treated as a cluster and resolved with a new relatively
+    // robust representation
+    Real minRelGap = Real(1)/Real(1000);
+
+    // The maximum depth of the representation tree. Clusters which remain
+    // at this depth have their eigenvectors explicitly orthogonalized.
+    Int maxDepth = 10;
+
+    // The maximum number of Rayleigh quotient corrections of each eigenvalue
+    // during the computation of its eigenvector
+    Int maxRQIIter = 10;
+};
+
 } // namespace herm_tridiag_eig
 
 struct HermitianTridiagEigInfo
 {
     herm_tridiag_eig::QRInfo qrInfo;
     herm_tridiag_eig::DCInfo dcInfo;
-    // TODO(poulson): MRRR info
+    herm_tridiag_eig::MRRRInfo mrrrInfo;
 };
 
 enum HermitianTridiagEigAlg {
@@ -353,7 +397,7 @@ struct HermitianTridiagEigCtrl
     HermitianTridiagEigAlg alg=HERM_TRIDIAG_EIG_MRRR;
     herm_tridiag_eig::QRCtrl qrCtrl;
     herm_tridiag_eig::DCCtrl<Real> dcCtrl;
-    // TODO(poulson): MRRR ctrl
+    herm_tridiag_eig::MRRRCtrl<Real> mrrrCtrl;
 };
 
 // Compute eigenvalues
@@ -405,6 +449,12 @@ struct HermitianSDCCtrl
     Real tol=Real(0);
     Real spreadFactor=Real(1e-6);
     bool progress=false;
+
+    // Split with the QDWH-eig approach of Nakatsukasa and Higham, which reads
+    // the split point off of the trace of the spectral projector and finds its
+    // range with randomized subspace iteration, rather than with a randomized
+    // URV of the entire projector
+    bool subspaceIteration=true;
 };
 
 template<typename Field>
@@ -833,6 +883,7 @@ template<typename Real>
 struct SchurCtrl
 {
     bool useSDC=false;
+    HessenbergCtrl hessCtrl;
     HessenbergSchurCtrl hessSchurCtrl;
     SDCCtrl<Real> sdcCtrl;
     bool time=false;
@@ -1073,6 +1124,13 @@ struct DCCtrl
     // singular vectors with the outer singular vectors? This should only be
     // disabled for academic reasons.
     bool exploitStructure = true;
+
+    // Execute the sequential algorithm as OpenMP tasks? The two subproblems
+    // of each split of height greater than 'taskCutoff' are then solved
+    // concurrently, and the secular equations and singular vector updates of
+    // each merge are spread over the team. This has no effect without OpenMP.
+    bool parallelTasks = false;
+    Int taskCutoff = 256;
 };
 
 // Cf. Section 4 of Gu and Eisenstat's "A Divide-and-Conquer Algorithm for the
@@ -1212,6 +1270,26 @@ BidiagSVD
 struct SVDInfo
 {
     BidiagSVDInfo bidiagSVDInfo;
+    Int numJacobiSweeps=0;
+};
+
+template<typename Real>
+struct JacobiSVDCtrl
+{
+    // The number of columns in each block; if zero, the blocksize is chosen so
+    // that each round has at least as many block pairs as there are processes
+    Int blocksize=0;
+
+    Int maxSweeps=30;
+
+    // Two columns are considered orthogonal once the cosine of the angle
+    // between them is at most 'tol'; if zero, sqrt(m) eps is used
+    Real tol=Real(0);
+
+    // Run the iteration on R^H from a column-pivoted QR factorization
+    bool precondition=true;
+
+    bool progress=false;
 };
 
 template<typename Real>
@@ -1238,6 +1316,23 @@ struct SVDCtrl
     double fullChanRatio=1.5;
 
     BidiagSVDCtrl<Real> bidiagSVDCtrl;
+
+    // QDWH-SVD
+    // --------
+    // Compute the polar decomposition A = U_p H with QDWH and then the
+    // eigendecomposition of H with spectral divide and conquer, which avoids
+    // bidiagonalization altogether. Only thin and compact SVDs are supported.
+    bool useQDWH=false;
+    QDWHCtrl qdwhCtrl;
+    HermitianSDCCtrl<Real> sdcCtrl;
+
+    // Blocked one-sided Jacobi
+    // ------------------------
+    // Orthogonalize pairs of column blocks against each other in round-robin
+    // order, which is accurate for graded matrices and needs only Gemm-based
+    // Gram computations. Only thin and compact SVDs are supported.
+    bool useJacobi=false;
+    JacobiSVDCtrl<Real> jacobiCtrl;
 };
 
 // Compute the singular values
@@ -50,6 +50,15 @@
 #endif
 #endif
 
+#if defined(EL_ENABLE_HALF)
+#ifndef PROTO_HALF
+# define PROTO_HALF PROTO_REAL(Half)
+#endif
+#ifndef PROTO_BFLOAT16
+# define PROTO_BFLOAT16 PROTO_REAL(BFloat16)
+#endif
+#endif
+
 #ifndef PROTO_COMPLEX
 # define PROTO_COMPLEX(T) PROTO(T)
 #endif
@@ -110,6 +119,10 @@ PROTO_QUAD
 #if defined(EL_ENABLE_BIGFLOAT) && defined(HYDROGEN_HAVE_MPC)
 PROTO_BIGFLOAT
 #endif
+#if defined(EL_ENABLE_HALF)
+PROTO_HALF
+PROTO_BFLOAT16
+#endif
 #endif
 
 #if !defined(EL_NO_COMPLEX_PROTO)
@@ -144,6 +157,8 @@ PROTO_COMPLEX_BIGFLOAT
 #undef PROTO_QUADDOUBLE
 #undef PROTO_QUAD
 #undef PROTO_BIGFLOAT
+#undef PROTO_HALF
+#undef PROTO_BFLOAT16
 
 #undef PROTO_COMPLEX
 #undef PROTO_COMPLEX_FLOAT
@@ -158,6 +173,7 @@ PROTO_COMPLEX_BIGFLOAT
 #undef EL_ENABLE_QUAD
 #undef EL_ENABLE_BIGINT
 #undef EL_ENABLE_BIGFLOAT
+#undef EL_ENABLE_HALF
 
 #undef EL_NO_INT_PROTO
 #undef EL_NO_REAL_PROTO
@@ -162,6 +162,8 @@ template<typename T>
 void Zeros( AbstractMatrix<T>& A, Int m, Int n );
 template<typename T>
 void Zeros( AbstractDistMatrix<T>& A, Int m, Int n );
+template<typename T>
+void Zeros( SparseMatrix<T>& A, Int m, Int n );
 
 // Integral equations
 // ==================
@@ -0,0 +1,62 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+
+namespace El {
+
+namespace {
+
+template<typename T>
+void WidenMatrix( const Matrix<T>& A, Matrix<float>& B )
+{
+    EL_DEBUG_CSE
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.Resize( height, width );
+    const Int ldA = A.LDim();
+    const Int ldB = B.LDim();
+    const T* ABuf = A.LockedBuffer();
+    float* BBuf = B.Buffer();
+    EL_PARALLEL_FOR
+    for( Int j=0; j<width; ++j )
+        Widen( height, &ABuf[j*ldA], &BBuf[j*ldB] );
+}
+
+template<typename T>
+void NarrowMatrix( const Matrix<float>& A, Matrix<T>& B )
+{
+    EL_DEBUG_CSE
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.Resize( height, width );
+    const Int ldA = A.LDim();
+    const Int ldB = B.LDim();
+    const float* ABuf = A.LockedBuffer();
+    T* BBuf = B.Buffer();
+    EL_PARALLEL_FOR
+    for( Int j=0; j<width; ++j )
+        Narrow( height, &ABuf[j*ldA], &BBuf[j*ldB] );
+}
+
+} // anonymous namespace
+
+void Copy( const Matrix<Half>& A, Matrix<float>& B )
+{ WidenMatrix( A, B ); }
+
+void Copy( const Matrix<float>& A, Matrix<Half>& B )
+{ NarrowMatrix( A, B ); }
+
+void Copy( const Matrix<BFloat16>& A, Matrix<float>& B )
+{ WidenMatrix( A, B ); }
+
+void Copy( const Matrix<float>& A, Matrix<BFloat16>& B )
+{ NarrowMatrix( A, B ); }
+
+} // namespace El
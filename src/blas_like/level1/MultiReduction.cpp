@@ -0,0 +1,459 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+
+namespace El {
+
+namespace {
+
+// The number of real slots used to reduce each entry of type Field
+template<typename Field>
+constexpr Int FieldSize() { return IsComplex<Field>::value ? 2 : 1; }
+
+template<typename Field>
+void PackField( const Field& alpha, Base<Field>* buf )
+{
+    buf[0] = RealPart(alpha);
+    if( IsComplex<Field>::value )
+        buf[1] = ImagPart(alpha);
+}
+
+template<typename Field>
+Field UnpackField( const Base<Field>* buf )
+{
+    Field alpha = buf[0];
+    if( IsComplex<Field>::value )
+        SetImagPart( alpha, buf[1] );
+    return alpha;
+}
+
+template<typename Field>
+void AssertConformal
+( const AbstractDistMatrix<Field>& A, const AbstractDistMatrix<Field>& B )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError("Matrices must be the same size");
+    AssertSameGrids( A, B );
+    if( A.DistData().colDist != B.DistData().colDist ||
+        A.DistData().rowDist != B.DistData().rowDist )
+        LogicError("A and B must have the same distribution");
+    if( A.ColAlign() != B.ColAlign() || A.RowAlign() != B.RowAlign() )
+        LogicError("Matrices must be aligned");
+    if( A.BlockHeight() != B.BlockHeight() ||
+        A.BlockWidth() != B.BlockWidth() )
+        LogicError("A and B must have the same block size");
+}
+
+// Each entry of the combined reduction is a (scale,value) pair stored as a
+// complex number. Sums use unit scales, maxima use zero values, and the
+// two-norms use (scale,scaledSquare) pairs, so that a single commutative
+// operation resolves all of them at once.
+template<typename Real>
+Complex<Real> CombinePairs( const Complex<Real>& a, const Complex<Real>& b )
+{
+    const Real aScale = RealPart(a), bScale = RealPart(b);
+    if( aScale == bScale )
+        return Complex<Real>( aScale, ImagPart(a)+ImagPart(b) );
+    const Complex<Real>& large = ( aScale > bScale ? a : b );
+    const Complex<Real>& small = ( aScale > bScale ? b : a );
+    const Real relScale = RealPart(small)/RealPart(large);
+    return Complex<Real>
+    ( RealPart(large), ImagPart(large)+ImagPart(small)*relScale*relScale );
+}
+
+template<typename Real>
+void CombinePairsFunc
+( void* inVoid, void* outVoid, int* lengthPtr, mpi::Datatype* datatype )
+EL_NO_EXCEPT
+{
+    auto inData  = static_cast<const Complex<Real>*>(inVoid);
+    auto outData = static_cast<      Complex<Real>*>(outVoid);
+    const int length = *lengthPtr;
+    for( int j=0; j<length; ++j )
+        outData[j] = CombinePairs( inData[j], outData[j] );
+}
+
+// Packed pairs are combined with a dedicated operation (freed by the caller
+// once the request completes) so that the reduction may be left in flight
+template<typename Real>
+void StartPairReduction
+( Complex<Real>* buf, int count, mpi::Comm comm,
+  mpi::Op& op, bool& createdOp, mpi::Request<Complex<Real>>& request,
+  std::true_type )
+{
+    mpi::Create( (mpi::UserFunction*)CombinePairsFunc<Real>, true, op );
+    createdOp = true;
+    mpi::IAllReduce( buf, count, op, comm, request );
+}
+
+// Serialized pairs fall back to the (blocking) user-defined reductions
+template<typename Real>
+void StartPairReduction
+( Complex<Real>* buf, int count, mpi::Comm comm,
+  mpi::Op& op, bool& createdOp, mpi::Request<Complex<Real>>& request,
+  std::false_type )
+{
+    request.backend = MPI_REQUEST_NULL;
+    if( count == 0 || mpi::Size(comm) == 1 )
+        return;
+    mpi::AllReduce
+    ( buf, count,
+      []( const Complex<Real>& a, const Complex<Real>& b )
+      { return CombinePairs( a, b ); },
+      true, comm );
+}
+
+} // anonymous namespace
+
+template<typename Field>
+Int MultiReduction<Field>::Register
+( ReductionType type,
+  const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>* B )
+{
+    EL_DEBUG_CSE
+    if( inFlight_ )
+        LogicError("Cannot register a reduction while one is in flight");
+    if( B != nullptr )
+        AssertConformal( A, *B );
+
+    const bool columnwise =
+      ( type == REDUCE_COLUMN_DOTS || type == REDUCE_COLUMN_TWO_NORMS );
+    const mpi::Comm comm = ( columnwise ? A.ColComm() : A.DistComm() );
+    if( reductions_.empty() )
+    {
+        comm_ = comm;
+        crossComm_ = A.CrossComm();
+        root_ = A.Root();
+        participating_ = A.Participating();
+    }
+    // The batch is resolved by one collective, which can only span a single
+    // communicator; reductions over other communicators (e.g., the column
+    // reductions of a matrix next to its scalar reductions) need a separate
+    // MultiReduction
+    else if( comm != comm_ || A.CrossComm() != crossComm_ ||
+             A.Root() != root_ )
+        LogicError
+        ("All of the reductions of a MultiReduction must share a "
+         "communicator; use a separate MultiReduction for the others");
+
+    Reduction reduction;
+    reduction.type = type;
+    reduction.A = &A;
+    reduction.B = B;
+    reductions_.push_back( reduction );
+    reduced_ = false;
+    return reductions_.size()-1;
+}
+
+template<typename Field>
+Int MultiReduction<Field>::AddDot
+( const AbstractDistMatrix<Field>& A, const AbstractDistMatrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    return Register( REDUCE_DOT, A, &B );
+}
+
+template<typename Field>
+Int MultiReduction<Field>::AddFrobeniusNorm
+( const AbstractDistMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    return Register( REDUCE_FROBENIUS_NORM, A, nullptr );
+}
+
+template<typename Field>
+Int MultiReduction<Field>::AddMaxAbs( const AbstractDistMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    return Register( REDUCE_MAX_ABS, A, nullptr );
+}
+
+template<typename Field>
+Int MultiReduction<Field>::AddColumnDots
+( const AbstractDistMatrix<Field>& A, const AbstractDistMatrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    return Register( REDUCE_COLUMN_DOTS, A, &B );
+}
+
+template<typename Field>
+Int MultiReduction<Field>::AddColumnTwoNorms
+( const AbstractDistMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    return Register( REDUCE_COLUMN_TWO_NORMS, A, nullptr );
+}
+
+template<typename Field>
+void MultiReduction<Field>::StartReduce()
+{
+    EL_DEBUG_CSE
+    if( inFlight_ )
+        LogicError("A reduction is already in flight");
+    const Int fieldSize = FieldSize<Field>();
+
+    // Lay out the pairs with the scalar reductions first so that only they
+    // need to be broadcast over the cross communicator
+    Int numPairs=0;
+    for( const bool scalarPass : { true, false } )
+    {
+        for( auto& reduction : reductions_ )
+        {
+            const bool columnwise =
+              ( reduction.type == REDUCE_COLUMN_DOTS ||
+                reduction.type == REDUCE_COLUMN_TWO_NORMS );
+            if( columnwise == scalarPass )
+                continue;
+            reduction.num =
+              ( columnwise && participating_ ? reduction.A->LocalWidth() : 1 );
+            if( columnwise && !participating_ )
+                reduction.num = 0;
+            reduction.offset = numPairs;
+            if( reduction.type == REDUCE_DOT ||
+                reduction.type == REDUCE_COLUMN_DOTS )
+                numPairs += fieldSize*reduction.num;
+            else
+                numPairs += reduction.num;
+        }
+        if( scalarPass )
+            numScalarPairs_ = numPairs;
+    }
+    pairs_.Resize( numPairs, 1 );
+    Zero( pairs_ );
+
+    // Form the local contributions with a single pass over each argument
+    if( participating_ )
+    {
+        Complex<Real>* pairBuf = pairs_.Buffer();
+        Real packed[2];
+        for( auto& reduction : reductions_ )
+        {
+            const auto& A = *reduction.A;
+            const Int localHeight = A.LocalHeight();
+            const Int localWidth = A.LocalWidth();
+            const Field* ABuf = A.LockedBuffer();
+            const Int ALDim = A.LDim();
+            const bool columnwise =
+              ( reduction.type == REDUCE_COLUMN_DOTS ||
+                reduction.type == REDUCE_COLUMN_TWO_NORMS );
+            Complex<Real>* buf = &pairBuf[reduction.offset];
+            switch( reduction.type )
+            {
+            case REDUCE_DOT:
+            case REDUCE_COLUMN_DOTS:
+            {
+                const Field* BBuf = reduction.B->LockedBuffer();
+                const Int BLDim = reduction.B->LDim();
+                Field innerProd = 0;
+                for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                {
+                    if( columnwise )
+                        innerProd = 0;
+                    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                        innerProd += Conj(ABuf[iLoc+jLoc*ALDim])*
+                                          BBuf[iLoc+jLoc*BLDim];
+                    if( columnwise )
+                    {
+                        PackField( innerProd, packed );
+                        for( Int k=0; k<fieldSize; ++k )
+                            buf[jLoc*fieldSize+k] =
+                              Complex<Real>( Real(1), packed[k] );
+                    }
+                }
+                if( !columnwise )
+                {
+                    PackField( innerProd, packed );
+                    for( Int k=0; k<fieldSize; ++k )
+                        buf[k] = Complex<Real>( Real(1), packed[k] );
+                }
+                break;
+            }
+            case REDUCE_FROBENIUS_NORM:
+            case REDUCE_COLUMN_TWO_NORMS:
+            {
+                Real scale = 0;
+                Real scaledSquare = 1;
+                for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                {
+                    if( columnwise )
+                    {
+                        scale = 0;
+                        scaledSquare = 1;
+                    }
+                    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                        UpdateScaledSquare
+                        ( ABuf[iLoc+jLoc*ALDim], scale, scaledSquare );
+                    if( columnwise )
+                        buf[jLoc] = Complex<Real>( scale, scaledSquare );
+                }
+                if( !columnwise )
+                    buf[0] = Complex<Real>( scale, scaledSquare );
+                break;
+            }
+            case REDUCE_MAX_ABS:
+            {
+                Real value = 0;
+                for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                        value = Max(value,Abs(ABuf[iLoc+jLoc*ALDim]));
+                buf[0] = Complex<Real>( value, Real(0) );
+                break;
+            }
+            }
+        }
+
+        // Combine the inner products, maximum magnitudes, and scaled squares
+        // with a single reduction
+        StartPairReduction
+        ( pairs_.Buffer(), numPairs, comm_, op_, createdOp_, request_,
+          std::integral_constant<bool,IsPacked<Real>::value>() );
+    }
+    inFlight_ = true;
+    reduced_ = false;
+}
+
+template<typename Field>
+void MultiReduction<Field>::FinishReduce()
+{
+    EL_DEBUG_CSE
+    if( !inFlight_ )
+        LogicError("No reduction is in flight");
+    if( participating_ )
+        mpi::Wait( request_ );
+    if( createdOp_ )
+    {
+        mpi::Free( op_ );
+        createdOp_ = false;
+    }
+    inFlight_ = false;
+
+    if( mpi::Size(crossComm_) > 1 )
+        mpi::Broadcast( pairs_.Buffer(), numScalarPairs_, root_, crossComm_ );
+
+    const Int fieldSize = FieldSize<Field>();
+    const Complex<Real>* pairBuf = pairs_.LockedBuffer();
+    Real packed[2];
+    for( auto& reduction : reductions_ )
+    {
+        const Int num = reduction.num;
+        const Complex<Real>* buf = &pairBuf[reduction.offset];
+        switch( reduction.type )
+        {
+        case REDUCE_DOT:
+        case REDUCE_COLUMN_DOTS:
+            reduction.fieldResults.Resize( num, 1 );
+            for( Int j=0; j<num; ++j )
+            {
+                for( Int k=0; k<fieldSize; ++k )
+                    packed[k] = ImagPart(buf[j*fieldSize+k]);
+                reduction.fieldResults(j) = UnpackField<Field>( packed );
+            }
+            break;
+        case REDUCE_FROBENIUS_NORM:
+        case REDUCE_COLUMN_TWO_NORMS:
+            reduction.realResults.Resize( num, 1 );
+            for( Int j=0; j<num; ++j )
+                reduction.realResults(j) =
+                  RealPart(buf[j])*Sqrt(ImagPart(buf[j]));
+            break;
+        case REDUCE_MAX_ABS:
+            reduction.realResults.Resize( num, 1 );
+            reduction.realResults(0) = RealPart(buf[0]);
+            break;
+        }
+    }
+    reduced_ = true;
+}
+
+template<typename Field>
+void MultiReduction<Field>::Reduce()
+{
+    EL_DEBUG_CSE
+    StartReduce();
+    FinishReduce();
+}
+
+template<typename Field>
+auto MultiReduction<Field>::Result( Int index, ReductionType type ) const
+-> const Reduction&
+{
+    EL_DEBUG_CSE
+    if( index < 0 || index >= Int(reductions_.size()) )
+        LogicError("Invalid reduction index ",index);
+    if( !reduced_ )
+        LogicError("The reductions have not been completed");
+    const auto& reduction = reductions_[index];
+    if( reduction.type != type )
+        LogicError("Reduction ",index," is of a different type");
+    return reduction;
+}
+
+template<typename Field>
+Field MultiReduction<Field>::Dot( Int index ) const
+{
+    EL_DEBUG_CSE
+    return Result( index, REDUCE_DOT ).fieldResults(0);
+}
+
+template<typename Field>
+Base<Field> MultiReduction<Field>::FrobeniusNorm( Int index ) const
+{
+    EL_DEBUG_CSE
+    return Result( index, REDUCE_FROBENIUS_NORM ).realResults(0);
+}
+
+template<typename Field>
+Base<Field> MultiReduction<Field>::MaxAbs( Int index ) const
+{
+    EL_DEBUG_CSE
+    return Result( index, REDUCE_MAX_ABS ).realResults(0);
+}
+
+template<typename Field>
+const Matrix<Field>& MultiReduction<Field>::ColumnDots( Int index ) const
+{
+    EL_DEBUG_CSE
+    return Result( index, REDUCE_COLUMN_DOTS ).fieldResults;
+}
+
+template<typename Field>
+const Matrix<Base<Field>>&
+MultiReduction<Field>::ColumnTwoNorms( Int index ) const
+{
+    EL_DEBUG_CSE
+    return Result( index, REDUCE_COLUMN_TWO_NORMS ).realResults;
+}
+
+template<typename Field>
+Int MultiReduction<Field>::NumReductions() const EL_NO_EXCEPT
+{ return reductions_.size(); }
+
+template<typename Field>
+void MultiReduction<Field>::Clear()
+{
+    EL_DEBUG_CSE
+    if( inFlight_ )
+        LogicError("Cannot clear a MultiReduction while it is in flight");
+    reductions_.clear();
+    reduced_ = false;
+}
+
+#define PROTO(Field) \
+  template class MultiReduction<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
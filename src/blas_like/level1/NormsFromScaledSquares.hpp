@@ -11,22 +11,15 @@
 
 namespace El {
 
+// Rescale each local scaled sum of squares relative to the maximum scale
 template<typename Real>
-void NormsFromScaledSquares
+void EquilibrateScaledSquares
 ( const Matrix<Real>& localScales,
-        Matrix<Real>& localScaledSquares,
-        Matrix<Real>& normsLoc,
-        mpi::Comm comm )
+  const Matrix<Real>& scales,
+        Matrix<Real>& localScaledSquares )
 {
     EL_DEBUG_CSE
     const Int nLocal = localScales.Height();
-
-    // Find the maximum relative scales
-    Matrix<Real> scales( nLocal, 1 );
-    mpi::AllReduce
-    ( localScales.LockedBuffer(), scales.Buffer(), nLocal, mpi::MAX, comm );
-
-    // Equilibrate the local scaled sums
     for( Int jLoc=0; jLoc<nLocal; ++jLoc )
     {
         const Real scale = scales(jLoc);
@@ -39,6 +32,25 @@ void NormsFromScaledSquares
         else
             localScaledSquares(jLoc) = 0;
     }
+}
+
+template<typename Real>
+void NormsFromScaledSquares
+( const Matrix<Real>& localScales,
+        Matrix<Real>& localScaledSquares,
+        Matrix<Real>& normsLoc,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const Int nLocal = localScales.Height();
+
+    // Find the maximum relative scales
+    Matrix<Real> scales( nLocal, 1 );
+    mpi::AllReduce
+    ( localScales.LockedBuffer(), scales.Buffer(), nLocal, mpi::MAX, comm );
+
+    // Equilibrate the local scaled sums
+    EquilibrateScaledSquares( localScales, scales, localScaledSquares );
 
     // Combine the local contributions
     Matrix<Real> scaledSquares( nLocal, 1 );
@@ -0,0 +1,155 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+
+namespace El {
+
+// Since the diagonal blocks of the packed buffer share a square region (the
+// lower triangle of one overlaps the upper triangle of the other), each of
+// them is filled by adding the appropriate trapezoid into a zeroed buffer.
+
+template<typename T>
+void PackRFP( UpperOrLower uplo, const Matrix<T>& A, RFPMatrix<T>& APacked )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( A.Width() != n )
+        LogicError("Only square matrices can be packed in RFP format");
+    APacked.Resize( n );
+    Zero( APacked.Packed() );
+    const Int n1 = APacked.FirstSize();
+    auto ind1 = IR(0,n1);
+    auto ind2 = IR(n1,n);
+
+    auto APacked11 = APacked.Block11();
+    auto APacked21 = APacked.Block21();
+    auto APacked22 = APacked.Block22();
+    Matrix<T> AAdj;
+    if( uplo == LOWER )
+    {
+        AxpyTrapezoid( LOWER, T(1), A(ind1,ind1), APacked11 );
+        Copy( A(ind2,ind1), APacked21 );
+        Adjoint( A(ind2,ind2), AAdj );
+        AxpyTrapezoid( UPPER, T(1), AAdj, APacked22 );
+    }
+    else
+    {
+        Adjoint( A(ind1,ind1), AAdj );
+        AxpyTrapezoid( LOWER, T(1), AAdj, APacked11 );
+        Adjoint( A(ind1,ind2), APacked21 );
+        AxpyTrapezoid( UPPER, T(1), A(ind2,ind2), APacked22 );
+    }
+}
+
+template<typename T>
+void PackRFP
+( UpperOrLower uplo,
+  const AbstractDistMatrix<T>& APre,
+        DistRFPMatrix<T>& APacked )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Int n = A.Height();
+    if( A.Width() != n )
+        LogicError("Only square matrices can be packed in RFP format");
+    APacked.Packed().SetGrid( A.Grid() );
+    APacked.Resize( n );
+    Zero( APacked.Packed() );
+    const Int n1 = APacked.FirstSize();
+    auto ind1 = IR(0,n1);
+    auto ind2 = IR(n1,n);
+
+    auto APacked11 = APacked.Block11();
+    auto APacked21 = APacked.Block21();
+    auto APacked22 = APacked.Block22();
+    DistMatrix<T> AAdj( A.Grid() );
+    if( uplo == LOWER )
+    {
+        AxpyTrapezoid( LOWER, T(1), A(ind1,ind1), APacked11 );
+        Copy( A(ind2,ind1), APacked21 );
+        Adjoint( A(ind2,ind2), AAdj );
+        AxpyTrapezoid( UPPER, T(1), AAdj, APacked22 );
+    }
+    else
+    {
+        Adjoint( A(ind1,ind1), AAdj );
+        AxpyTrapezoid( LOWER, T(1), AAdj, APacked11 );
+        Adjoint( A(ind1,ind2), AAdj );
+        Copy( AAdj, APacked21 );
+        AxpyTrapezoid( UPPER, T(1), A(ind2,ind2), APacked22 );
+    }
+}
+
+template<typename T>
+void UnpackRFP( const RFPMatrix<T>& APacked, Matrix<T>& A )
+{
+    EL_DEBUG_CSE
+    const Int n = APacked.Height();
+    const Int n1 = APacked.FirstSize();
+    auto ind1 = IR(0,n1);
+    auto ind2 = IR(n1,n);
+    A.Resize( n, n );
+    Zero( A );
+
+    auto A11 = A( ind1, ind1 );
+    auto A21 = A( ind2, ind1 );
+    auto A22 = A( ind2, ind2 );
+    Matrix<T> A22Adj;
+    AxpyTrapezoid( LOWER, T(1), APacked.LockedBlock11(), A11 );
+    Copy( APacked.LockedBlock21(), A21 );
+    Adjoint( APacked.LockedBlock22(), A22Adj );
+    AxpyTrapezoid( LOWER, T(1), A22Adj, A22 );
+    MakeHermitian( LOWER, A );
+}
+
+template<typename T>
+void UnpackRFP( const DistRFPMatrix<T>& APacked, AbstractDistMatrix<T>& APre )
+{
+    EL_DEBUG_CSE
+    DistMatrixWriteProxy<T,T,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+    EL_DEBUG_ONLY(AssertSameGrids( A, APacked.LockedPacked() ))
+    const Int n = APacked.Height();
+    const Int n1 = APacked.FirstSize();
+    auto ind1 = IR(0,n1);
+    auto ind2 = IR(n1,n);
+    A.Resize( n, n );
+    Zero( A );
+
+    auto A11 = A( ind1, ind1 );
+    auto A21 = A( ind2, ind1 );
+    auto A22 = A( ind2, ind2 );
+    DistMatrix<T> A22Adj( A.Grid() );
+    AxpyTrapezoid( LOWER, T(1), APacked.LockedBlock11(), A11 );
+    Copy( APacked.LockedBlock21(), A21 );
+    Adjoint( APacked.LockedBlock22(), A22Adj );
+    AxpyTrapezoid( LOWER, T(1), A22Adj, A22 );
+    MakeHermitian( LOWER, A );
+}
+
+#define PROTO(T) \
+  template void PackRFP \
+  ( UpperOrLower uplo, const Matrix<T>& A, RFPMatrix<T>& APacked ); \
+  template void PackRFP \
+  ( UpperOrLower uplo, const AbstractDistMatrix<T>& A, \
+    DistRFPMatrix<T>& APacked ); \
+  template void UnpackRFP( const RFPMatrix<T>& APacked, Matrix<T>& A ); \
+  template void UnpackRFP \
+  ( const DistRFPMatrix<T>& APacked, AbstractDistMatrix<T>& A );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
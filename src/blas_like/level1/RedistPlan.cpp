@@ -0,0 +1,386 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+
+namespace El {
+
+namespace {
+
+// Switch to point-to-point messages when no process has more than this
+// fraction of the grid as neighbors
+const Int pointToPointRatio = 8;
+
+// The VC rank of the member of the redundant root of A which owns each rank of
+// the distribution communicator of A
+template<typename T>
+vector<int> DistToVC( const AbstractDistMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    const int distSize = mpi::Size( A.DistComm() );
+    vector<int> distToVC( distSize );
+    for( int distRank=0; distRank<distSize; ++distRank )
+        distToVC[distRank] =
+          g.CoordsToVC( A.ColDist(), A.RowDist(), distRank, A.Root(), 0 );
+    return distToVC;
+}
+
+} // anonymous namespace
+
+template<typename T>
+RedistPlan<T>::RedistPlan() { }
+
+template<typename T>
+RedistPlan<T>::RedistPlan
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    Build( A, B );
+}
+
+template<typename T>
+void RedistPlan<T>::Empty()
+{
+    EL_DEBUG_CSE
+    built_ = false;
+    pointToPoint_ = false;
+    haveLocal_ = false;
+    height_ = width_ = 0;
+    SwapClear( sendRowRuns_ );
+    SwapClear( sendColRuns_ );
+    SwapClear( recvRowRuns_ );
+    SwapClear( recvColRuns_ );
+    SwapClear( sendNeighbors_ );
+    SwapClear( recvNeighbors_ );
+    SwapClear( sendCounts_ );
+    SwapClear( sendDispls_ );
+    SwapClear( recvCounts_ );
+    SwapClear( recvDispls_ );
+    SwapClear( sendBuf_ );
+    SwapClear( recvBuf_ );
+    SwapClear( localBuf_ );
+    SwapClear( requests_ );
+}
+
+template<typename T>
+vector<vector<typename RedistPlan<T>::Run>>
+RedistPlan<T>::OwnerRuns( const vector<int>& owners, int numOwners )
+{
+    EL_DEBUG_CSE
+    vector<vector<Run>> runs( numOwners );
+    const Int numIndices = owners.size();
+    for( Int index=0; index<numIndices; ++index )
+    {
+        auto& ownerRuns = runs[owners[index]];
+        if( !ownerRuns.empty() )
+        {
+            Run& run = ownerRuns.back();
+            if( run.count == 1 )
+            {
+                run.stride = index - run.start;
+                run.count = 2;
+                continue;
+            }
+            if( index == run.start+run.count*run.stride )
+            {
+                ++run.count;
+                continue;
+            }
+        }
+        ownerRuns.push_back( Run{index,1,1} );
+    }
+    return runs;
+}
+
+template<typename T>
+template<typename Function>
+void RedistPlan<T>::ForEachEntry
+( const vector<Run>& rowRuns, const vector<Run>& colRuns, Function func )
+{
+    for( const Run& colRun : colRuns )
+    {
+        for( Int t=0; t<colRun.count; ++t )
+        {
+            const Int jLoc = colRun.start + t*colRun.stride;
+            for( const Run& rowRun : rowRuns )
+                for( Int s=0; s<rowRun.count; ++s )
+                    func( rowRun.start+s*rowRun.stride, jLoc );
+        }
+    }
+}
+
+template<typename T>
+void RedistPlan<T>::Build
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    if( A.Grid() != B.Grid() )
+        LogicError("Redistribution plans require A and B to share a grid");
+    if( A.GetLocalDevice() != Device::CPU ||
+        B.GetLocalDevice() != Device::CPU )
+        LogicError("Redistribution plans are only supported on the CPU");
+    Empty();
+
+    const Grid& g = A.Grid();
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.Resize( height, width );
+
+    height_ = height;
+    width_ = width;
+    distA_ = A.DistData();
+    distB_ = B.DistData();
+    built_ = true;
+    if( !g.InGrid() )
+        return;
+    comm_ = g.VCComm();
+    const int commSize = mpi::Size( comm_ );
+    const int commRank = mpi::Rank( comm_ );
+
+    auto runCounts = []( const vector<vector<Run>>& runs )
+    {
+        vector<Int> counts( runs.size(), 0 );
+        for( size_t owner=0; owner<runs.size(); ++owner )
+            for( const Run& run : runs[owner] )
+                counts[owner] += run.count;
+        return counts;
+    };
+
+    // Determine the destination of each of our entries of A
+    // ======================================================
+    // Only the redundant root of A sends and only the redundant root of B
+    // receives (the latter then broadcasts over its redundant communicator).
+    // Our local rows (columns) of A are grouped by their row (column) owner
+    // in B, so the entries destined for each process of B are the product of
+    // one group of rows and one group of columns.
+    sendCounts_.resize( commSize, 0 );
+    if( A.Participating() && A.RedundantRank() == 0 )
+    {
+        const int colStrideB = B.ColStride();
+        const int rowStrideB = B.RowStride();
+        const auto distBToVC = DistToVC( B );
+
+        vector<int> owners( A.LocalHeight() );
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            owners[iLoc] = B.RowOwner(A.GlobalRow(iLoc));
+        sendRowRuns_ = OwnerRuns( owners, colStrideB );
+        owners.resize( A.LocalWidth() );
+        for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+            owners[jLoc] = B.ColOwner(A.GlobalCol(jLoc));
+        sendColRuns_ = OwnerRuns( owners, rowStrideB );
+
+        const auto rowCounts = runCounts( sendRowRuns_ );
+        const auto colCounts = runCounts( sendColRuns_ );
+        for( int colOwner=0; colOwner<rowStrideB; ++colOwner )
+        {
+            for( int rowOwner=0; rowOwner<colStrideB; ++rowOwner )
+            {
+                const Int count = rowCounts[rowOwner]*colCounts[colOwner];
+                if( count == 0 )
+                    continue;
+                const int q = distBToVC[rowOwner+colStrideB*colOwner];
+                if( q == commRank )
+                {
+                    localSend_ = Neighbor{q,rowOwner,colOwner};
+                    haveLocal_ = true;
+                }
+                else
+                {
+                    sendCounts_[q] = count;
+                    sendNeighbors_.push_back( Neighbor{q,rowOwner,colOwner} );
+                }
+            }
+        }
+    }
+    const Int totalSend = Scan( sendCounts_, sendDispls_ );
+
+    // Determine the source of each of our entries of B
+    // ================================================
+    // Each source packs the entries destined for us in column-major order,
+    // which coincides with the column-major order of our local entries
+    recvCounts_.resize( commSize, 0 );
+    Int numLocal = 0;
+    if( B.Participating() && B.RedundantRank() == 0 )
+    {
+        const int colStrideA = A.ColStride();
+        const int rowStrideA = A.RowStride();
+        const auto distAToVC = DistToVC( A );
+
+        vector<int> owners( B.LocalHeight() );
+        for( Int iLoc=0; iLoc<B.LocalHeight(); ++iLoc )
+            owners[iLoc] = A.RowOwner(B.GlobalRow(iLoc));
+        recvRowRuns_ = OwnerRuns( owners, colStrideA );
+        owners.resize( B.LocalWidth() );
+        for( Int jLoc=0; jLoc<B.LocalWidth(); ++jLoc )
+            owners[jLoc] = A.ColOwner(B.GlobalCol(jLoc));
+        recvColRuns_ = OwnerRuns( owners, rowStrideA );
+
+        const auto rowCounts = runCounts( recvRowRuns_ );
+        const auto colCounts = runCounts( recvColRuns_ );
+        for( int colOwner=0; colOwner<rowStrideA; ++colOwner )
+        {
+            for( int rowOwner=0; rowOwner<colStrideA; ++rowOwner )
+            {
+                const Int count = rowCounts[rowOwner]*colCounts[colOwner];
+                if( count == 0 )
+                    continue;
+                const int q = distAToVC[rowOwner+colStrideA*colOwner];
+                if( q == commRank )
+                {
+                    localRecv_ = Neighbor{q,rowOwner,colOwner};
+                    numLocal = count;
+                }
+                else
+                {
+                    recvCounts_[q] = count;
+                    recvNeighbors_.push_back( Neighbor{q,rowOwner,colOwner} );
+                }
+            }
+        }
+    }
+    const Int totalRecv = Scan( recvCounts_, recvDispls_ );
+    EL_DEBUG_ONLY(
+      if( haveLocal_ != (numLocal != 0) )
+          LogicError("Redistribution plan has unmatched local entries");
+      if( numLocal+totalRecv !=
+          (B.Participating() && B.RedundantRank() == 0 ?
+           B.LocalHeight()*B.LocalWidth() : 0) )
+          LogicError("Redistribution plan does not cover B");
+    )
+
+    // Decide how to exchange
+    // ======================
+    const int numNeighbors =
+      Max( sendNeighbors_.size(), recvNeighbors_.size() );
+    const int maxNeighbors = mpi::AllReduce( numNeighbors, mpi::MAX, comm_ );
+    pointToPoint_ = ( pointToPointRatio*maxNeighbors <= commSize );
+    if( pointToPoint_ )
+        requests_.resize( sendNeighbors_.size()+recvNeighbors_.size() );
+
+    FastResize( sendBuf_, totalSend );
+    FastResize( recvBuf_, totalRecv );
+    FastResize( localBuf_, numLocal );
+}
+
+template<typename T>
+bool RedistPlan<T>::Matches
+( const AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<T>& B ) const
+{
+    EL_DEBUG_CSE
+    return built_ &&
+           A.Height() == height_ && A.Width() == width_ &&
+           B.Height() == height_ && B.Width() == width_ &&
+           A.DistData() == distA_ && B.DistData() == distB_;
+}
+
+template<typename T>
+void RedistPlan<T>::Execute
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    if( !Matches( A, B ) )
+        Build( A, B );
+    if( !A.Grid().InGrid() )
+        return;
+
+    const T* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    T* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+
+    // Copy the entries which do not need to be communicated
+    if( haveLocal_ )
+    {
+        Int off = 0;
+        ForEachEntry
+        ( sendRowRuns_[localSend_.rowOwner], sendColRuns_[localSend_.colOwner],
+          [&]( Int iLoc, Int jLoc )
+          { localBuf_[off++] = ABuf[iLoc+jLoc*ALDim]; } );
+        off = 0;
+        ForEachEntry
+        ( recvRowRuns_[localRecv_.rowOwner], recvColRuns_[localRecv_.colOwner],
+          [&]( Int iLoc, Int jLoc )
+          { BBuf[iLoc+jLoc*BLDim] = localBuf_[off++]; } );
+    }
+
+    // Pack
+    const Int numSendNeighbors = sendNeighbors_.size();
+    EL_PARALLEL_FOR
+    for( Int k=0; k<numSendNeighbors; ++k )
+    {
+        const Neighbor& neighbor = sendNeighbors_[k];
+        T* sendBuf = &sendBuf_[sendDispls_[neighbor.rank]];
+        ForEachEntry
+        ( sendRowRuns_[neighbor.rowOwner], sendColRuns_[neighbor.colOwner],
+          [&]( Int iLoc, Int jLoc )
+          { *sendBuf++ = ABuf[iLoc+jLoc*ALDim]; } );
+    }
+
+    // Exchange
+    if( pointToPoint_ )
+    {
+        Int numRequests = 0;
+        for( const Neighbor& neighbor : recvNeighbors_ )
+        {
+            const int q = neighbor.rank;
+            mpi::IRecv
+            ( &recvBuf_[recvDispls_[q]], recvCounts_[q], q, comm_,
+              requests_[numRequests++] );
+        }
+        for( const Neighbor& neighbor : sendNeighbors_ )
+        {
+            const int q = neighbor.rank;
+            mpi::ISend
+            ( &sendBuf_[sendDispls_[q]], sendCounts_[q], q, comm_,
+              requests_[numRequests++] );
+        }
+        mpi::WaitAll( numRequests, requests_.data() );
+    }
+    else
+        mpi::AllToAll
+        ( sendBuf_.data(), sendCounts_.data(), sendDispls_.data(),
+          recvBuf_.data(), recvCounts_.data(), recvDispls_.data(), comm_ );
+
+    // Unpack
+    const Int numRecvNeighbors = recvNeighbors_.size();
+    EL_PARALLEL_FOR
+    for( Int k=0; k<numRecvNeighbors; ++k )
+    {
+        const Neighbor& neighbor = recvNeighbors_[k];
+        const T* recvBuf = &recvBuf_[recvDispls_[neighbor.rank]];
+        ForEachEntry
+        ( recvRowRuns_[neighbor.rowOwner], recvColRuns_[neighbor.colOwner],
+          [&]( Int iLoc, Int jLoc )
+          { BBuf[iLoc+jLoc*BLDim] = *recvBuf++; } );
+    }
+
+    if( B.Participating() && B.RedundantSize() > 1 )
+        El::Broadcast( B, B.RedundantComm(), 0 );
+}
+
+template<typename T>
+Int RedistPlan<T>::NumSendNeighbors() const EL_NO_EXCEPT
+{ return sendNeighbors_.size(); }
+
+template<typename T>
+Int RedistPlan<T>::NumRecvNeighbors() const EL_NO_EXCEPT
+{ return recvNeighbors_.size(); }
+
+#define PROTO(T) \
+  template class RedistPlan<T>;
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -13,6 +13,7 @@
 #include "./Gemm/NT.hpp"
 #include "./Gemm/TN.hpp"
 #include "./Gemm/TT.hpp"
+#include "./Gemm/Block.hpp"
 
 namespace El
 {
@@ -185,6 +186,28 @@ void Gemm
 {
     EL_DEBUG_CSE
     C *= beta;
+
+    // Avoid redistributing conformally-blocked [MC,MR] block matrices (which
+    // only exist on the CPU)
+    if(alg != GEMM_CANNON &&
+       A.Wrap() == BLOCK && A.ColDist() == MC && A.RowDist() == MR &&
+       A.GetLocalDevice() == Device::CPU &&
+       B.Wrap() == BLOCK && B.ColDist() == MC && B.RowDist() == MR &&
+       B.GetLocalDevice() == Device::CPU &&
+       C.Wrap() == BLOCK && C.ColDist() == MC && C.RowDist() == MR &&
+       C.GetLocalDevice() == Device::CPU)
+    {
+        const auto& ABlock =
+          static_cast<const DistMatrix<T,MC,MR,BLOCK>&>(A);
+        const auto& BBlock =
+          static_cast<const DistMatrix<T,MC,MR,BLOCK>&>(B);
+        auto& CBlock = static_cast<DistMatrix<T,MC,MR,BLOCK>&>(C);
+        if(gemm::BlockSUMMAConformal(orientA, orientB, ABlock, BBlock, CBlock))
+        {
+            gemm::BlockSUMMA(orientA, orientB, alpha, ABlock, BBlock, CBlock);
+            return;
+        }
+    }
     if(orientA == NORMAL && orientB == NORMAL)
     {
         if(alg == GEMM_CANNON)
@@ -221,6 +244,17 @@ void Gemm
     Gemm(orientA, orientB, alpha, A, B, T(0), C, alg);
 }
 
+template<typename T>
+std::future<void> Gemm
+(Orientation orientA, Orientation orientB,
+  T alpha, const Matrix<T>& A, const Matrix<T>& B,
+  T beta,        Matrix<T>& C, CPUStream& stream)
+{
+    EL_DEBUG_CSE
+    return stream.Enqueue
+        ([=,&A,&B,&C]() { Gemm(orientA, orientB, alpha, A, B, beta, C); });
+}
+
 template<typename T>
 void LocalGemm
 (Orientation orientA, Orientation orientB,
@@ -376,6 +410,10 @@ template void Gemm(Orientation orientA, Orientation orientB,
     T alpha, const Matrix<T,Device::CPU>& A, \
              const Matrix<T,Device::CPU>& B, \
                    Matrix<T,Device::CPU>& C); \
+  template std::future<void> Gemm \
+  (Orientation orientA, Orientation orientB, \
+    T alpha, const Matrix<T>& A, const Matrix<T>& B, \
+    T beta,        Matrix<T>& C, CPUStream& stream); \
   template void Gemm \
   (Orientation orientA, Orientation orientB, \
     T alpha, const AbstractDistMatrix<T>& A, \
@@ -402,6 +440,7 @@ template void Gemm(Orientation orientA, Orientation orientB,
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGINT
 #define EL_ENABLE_BIGFLOAT
+#define EL_ENABLE_HALF
 #include <El/macros/Instantiate.h>
 
 } // namespace El
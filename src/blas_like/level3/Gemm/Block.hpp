@@ -0,0 +1,134 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// Block-cyclic SUMMA
+// ==================
+// When A, B, and C are each in an [MC,MR] block distribution and the
+// blockings agree along each shared dimension (the alignments need not
+// agree), the stationary-C variant of SUMMA can sweep directly over the
+// distribution blocks of the summation dimension. Each step then only
+// broadcasts one block row/column of A and B within the process rows and
+// columns, as in PBLAS, rather than redistributing all three operands to and
+// from the elemental distribution.
+
+template<typename T>
+bool BlockSUMMAConformal
+( Orientation orientA, Orientation orientB,
+  const DistMatrix<T,MC,MR,BLOCK>& A,
+  const DistMatrix<T,MC,MR,BLOCK>& B,
+  const DistMatrix<T,MC,MR,BLOCK>& C )
+{
+    const bool normalA = ( orientA == NORMAL );
+    const bool normalB = ( orientB == NORMAL );
+
+    const Int outerBlockA = ( normalA ? A.BlockHeight() : A.BlockWidth() );
+    const Int outerCutA = ( normalA ? A.ColCut() : A.RowCut() );
+    const Int innerBlockA = ( normalA ? A.BlockWidth() : A.BlockHeight() );
+    const Int innerCutA = ( normalA ? A.RowCut() : A.ColCut() );
+
+    const Int outerBlockB = ( normalB ? B.BlockWidth() : B.BlockHeight() );
+    const Int outerCutB = ( normalB ? B.RowCut() : B.ColCut() );
+    const Int innerBlockB = ( normalB ? B.BlockHeight() : B.BlockWidth() );
+    const Int innerCutB = ( normalB ? B.ColCut() : B.RowCut() );
+
+    return outerBlockA == C.BlockHeight() && outerCutA == C.ColCut() &&
+           outerBlockB == C.BlockWidth()  && outerCutB == C.RowCut() &&
+           innerBlockA == innerBlockB     && innerCutA == innerCutB;
+}
+
+// C := alpha op(A) op(B) + C
+template<typename T>
+void BlockSUMMA
+( Orientation orientA, Orientation orientB,
+  T alpha,
+  const DistMatrix<T,MC,MR,BLOCK>& A,
+  const DistMatrix<T,MC,MR,BLOCK>& B,
+        DistMatrix<T,MC,MR,BLOCK>& C )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( A, B, C );
+      if( !BlockSUMMAConformal( orientA, orientB, A, B, C ) )
+          LogicError("The blockings of A, B, and C do not conform");
+    )
+    const Grid& g = C.Grid();
+    const bool normalA = ( orientA == NORMAL );
+    const bool normalB = ( orientB == NORMAL );
+    const Int sumDim = ( normalA ? A.Width() : A.Height() );
+    const Int bsize = ( normalA ? A.BlockWidth() : A.BlockHeight() );
+    const Int cut = ( normalA ? A.RowCut() : A.ColCut() );
+
+    // Temporary distributions
+    DistMatrix<T,MC,  STAR,BLOCK> A1_MC_STAR(g);
+    DistMatrix<T,STAR,MR,  BLOCK> A1_STAR_MR(g);
+    DistMatrix<T,STAR,MC,  BLOCK> A1_STAR_MC(g);
+    DistMatrix<T,STAR,MR,  BLOCK> B1_STAR_MR(g);
+    DistMatrix<T,MC,  STAR,BLOCK> B1_MC_STAR(g);
+    DistMatrix<T,MR,  STAR,BLOCK> B1_MR_STAR(g);
+
+    A1_MC_STAR.AlignWith( C );
+    A1_STAR_MR.AlignWith( A );
+    A1_STAR_MC.AlignWith( C );
+    B1_STAR_MR.AlignWith( C );
+    B1_MC_STAR.AlignWith( B );
+    B1_MR_STAR.AlignWith( C );
+
+    Int k = 0;
+    while( k < sumDim )
+    {
+        // Only sweep over whole distribution blocks
+        const Int nb = Min( bsize-Mod(cut+k,bsize), sumDim-k );
+        const Range<Int> ind1( k, k+nb );
+
+        if( normalA )
+        {
+            auto A1 = A( ALL, ind1 );
+            A1_MC_STAR = A1;
+        }
+        else
+        {
+            auto A1 = A( ind1, ALL );
+            A1_STAR_MR = A1;
+            A1_STAR_MC = A1_STAR_MR;
+        }
+
+        if( normalB )
+        {
+            auto B1 = B( ind1, ALL );
+            B1_STAR_MR = B1;
+        }
+        else
+        {
+            auto B1 = B( ALL, ind1 );
+            B1_MC_STAR = B1;
+            B1_MR_STAR = B1_MC_STAR;
+        }
+
+        if( normalA && normalB )
+            LocalGemm
+            ( NORMAL, NORMAL, alpha, A1_MC_STAR, B1_STAR_MR, T(1), C );
+        else if( normalA )
+            LocalGemm
+            ( NORMAL, orientB, alpha, A1_MC_STAR, B1_MR_STAR, T(1), C );
+        else if( normalB )
+            LocalGemm
+            ( orientA, NORMAL, alpha, A1_STAR_MC, B1_STAR_MR, T(1), C );
+        else
+            LocalGemm
+            ( orientA, orientB, alpha, A1_STAR_MC, B1_MR_STAR, T(1), C );
+
+        k += nb;
+    }
+}
+
+} // namespace gemm
+} // namespace El
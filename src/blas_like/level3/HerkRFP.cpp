@@ -0,0 +1,98 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/blas_like/level3.hpp>
+
+namespace El {
+
+// With op(A) = [A1; A2] partitioned conformally with C,
+//
+//   C11 := alpha A1 A1^H + beta C11  (lower triangle of Block11),
+//   C21 := alpha A2 A1^H + beta C21  (Block21),
+//   C22 := alpha A2 A2^H + beta C22  (upper triangle of Block22, which holds
+//                                     the conjugate-transpose of C22).
+
+template<typename T>
+void Herk
+( Orientation orientation,
+  Base<T> alpha, const Matrix<T>& A, Base<T> beta, RFPMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    const bool normal = ( orientation == NORMAL );
+    const Int n = C.Height();
+    if( (normal ? A.Height() : A.Width()) != n )
+        LogicError("Nonconformal Herk");
+    const Int n1 = C.FirstSize();
+    auto ind1 = IR(0,n1);
+    auto ind2 = IR(n1,n);
+
+    auto A1 = ( normal ? A(ind1,ALL) : A(ALL,ind1) );
+    auto A2 = ( normal ? A(ind2,ALL) : A(ALL,ind2) );
+    auto C11 = C.Block11();
+    auto C21 = C.Block21();
+    auto C22 = C.Block22();
+    Herk( LOWER, orientation, alpha, A1, beta, C11 );
+    if( normal )
+        Gemm( NORMAL, ADJOINT, T(alpha), A2, A1, T(beta), C21 );
+    else
+        Gemm( ADJOINT, NORMAL, T(alpha), A2, A1, T(beta), C21 );
+    Herk( UPPER, orientation, alpha, A2, beta, C22 );
+}
+
+template<typename T>
+void Herk
+( Orientation orientation,
+  Base<T> alpha, const AbstractDistMatrix<T>& APre,
+  Base<T> beta,        DistRFPMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( APre, C.LockedPacked() ))
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+
+    const bool normal = ( orientation == NORMAL );
+    const Int n = C.Height();
+    if( (normal ? A.Height() : A.Width()) != n )
+        LogicError("Nonconformal Herk");
+    const Int n1 = C.FirstSize();
+    auto ind1 = IR(0,n1);
+    auto ind2 = IR(n1,n);
+
+    auto A1 = ( normal ? A(ind1,ALL) : A(ALL,ind1) );
+    auto A2 = ( normal ? A(ind2,ALL) : A(ALL,ind2) );
+    auto C11 = C.Block11();
+    auto C21 = C.Block21();
+    auto C22 = C.Block22();
+    Herk( LOWER, orientation, alpha, A1, beta, C11 );
+    if( normal )
+        Gemm( NORMAL, ADJOINT, T(alpha), A2, A1, T(beta), C21 );
+    else
+        Gemm( ADJOINT, NORMAL, T(alpha), A2, A1, T(beta), C21 );
+    Herk( UPPER, orientation, alpha, A2, beta, C22 );
+}
+
+#define PROTO(T) \
+  template void Herk \
+  ( Orientation orientation, \
+    Base<T> alpha, const Matrix<T>& A, \
+    Base<T> beta, RFPMatrix<T>& C ); \
+  template void Herk \
+  ( Orientation orientation, \
+    Base<T> alpha, const AbstractDistMatrix<T>& A, \
+    Base<T> beta, DistRFPMatrix<T>& C );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
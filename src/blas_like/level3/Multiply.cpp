@@ -0,0 +1,97 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/blas_like/level3.hpp>
+
+namespace El {
+
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const SparseMatrix<T>& A,
+           const Matrix<T>& X,
+  T beta,        Matrix<T>& Y )
+{
+    EL_DEBUG_CSE
+    A.AssertConsistent();
+    EL_DEBUG_ONLY(
+      if( X.Width() != Y.Width() )
+          LogicError("X and Y must have the same width");
+      if( orientation == NORMAL )
+      {
+          if( A.Height() != Y.Height() || A.Width() != X.Height() )
+              LogicError("A, X, and Y did not conform");
+      }
+      else
+      {
+          if( A.Width() != Y.Height() || A.Height() != X.Height() )
+              LogicError("A, X, and Y did not conform");
+      }
+    )
+    const Int m = A.Height();
+    const Int numRHS = X.Width();
+    const Int* offsetBuf = A.LockedOffsetBuffer();
+    const Int* colBuf = A.LockedTargetBuffer();
+    const T* valBuf = A.LockedValueBuffer();
+    const T* XBuf = X.LockedBuffer();
+          T* YBuf = Y.Buffer();
+    const Int ldX = X.LDim();
+    const Int ldY = Y.LDim();
+
+    Scale( beta, Y );
+    if( orientation == NORMAL )
+    {
+        // Each row of A contributes to a single row of Y, so the rows can be
+        // processed independently
+        EL_PARALLEL_FOR
+        for( Int i=0; i<m; ++i )
+        {
+            for( Int j=0; j<numRHS; ++j )
+            {
+                T sum = 0;
+                for( Int e=offsetBuf[i]; e<offsetBuf[i+1]; ++e )
+                    sum += valBuf[e]*XBuf[colBuf[e]+j*ldX];
+                YBuf[i+j*ldY] += alpha*sum;
+            }
+        }
+    }
+    else
+    {
+        const bool conjugate = ( orientation == ADJOINT );
+        for( Int j=0; j<numRHS; ++j )
+        {
+            for( Int i=0; i<m; ++i )
+            {
+                const T alphaX = alpha*XBuf[i+j*ldX];
+                for( Int e=offsetBuf[i]; e<offsetBuf[i+1]; ++e )
+                {
+                    const T value = conjugate ? Conj(valBuf[e]) : valBuf[e];
+                    YBuf[colBuf[e]+j*ldY] += value*alphaX;
+                }
+            }
+        }
+    }
+}
+
+#define PROTO(T) \
+  template void Multiply \
+  ( Orientation orientation, \
+    T alpha, const SparseMatrix<T>& A, \
+             const Matrix<T>& X, \
+    T beta,        Matrix<T>& Y );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
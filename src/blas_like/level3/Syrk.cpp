@@ -14,6 +14,7 @@
 #include "./Syrk/LT.hpp"
 #include "./Syrk/UN.hpp"
 #include "./Syrk/UT.hpp"
+#include "./Syrk/Block.hpp"
 
 namespace El {
 
@@ -74,6 +75,23 @@ void Syrk
 {
     EL_DEBUG_CSE
     ScaleTrapezoid( beta, uplo, C );
+
+    // Avoid redistributing conformally-blocked [MC,MR] block matrices (which
+    // only exist on the CPU)
+    if( A.Wrap() == BLOCK && A.ColDist() == MC && A.RowDist() == MR &&
+        A.GetLocalDevice() == Device::CPU &&
+        C.Wrap() == BLOCK && C.ColDist() == MC && C.RowDist() == MR &&
+        C.GetLocalDevice() == Device::CPU )
+    {
+        const auto& ABlock = static_cast<const DistMatrix<T,MC,MR,BLOCK>&>(A);
+        auto& CBlock = static_cast<DistMatrix<T,MC,MR,BLOCK>&>(C);
+        if( syrk::BlockConformal( orientation, ABlock, CBlock ) )
+        {
+            syrk::Block( uplo, orientation, alpha, ABlock, CBlock, conjugate );
+            return;
+        }
+    }
+
     if( uplo == LOWER && orientation == NORMAL )
         syrk::LN( alpha, A, C, conjugate );
     else if( uplo == LOWER )
@@ -0,0 +1,91 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace syrk {
+
+// The rank-k update can operate directly on [MC,MR] block distributions if
+// the row and column blockings of C coincide and the blocking of the
+// non-summed dimension of A matches them (alignments are arbitrary)
+template<typename T>
+bool BlockConformal
+( Orientation orientation,
+  const DistMatrix<T,MC,MR,BLOCK>& A,
+  const DistMatrix<T,MC,MR,BLOCK>& C )
+{
+    const bool normal = ( orientation == NORMAL );
+    const Int outerBlock = ( normal ? A.BlockHeight() : A.BlockWidth() );
+    const Int outerCut = ( normal ? A.ColCut() : A.RowCut() );
+    return C.BlockHeight() == C.BlockWidth() && C.ColCut() == C.RowCut() &&
+           outerBlock == C.BlockHeight() && outerCut == C.ColCut();
+}
+
+// C := alpha op(A) op(A)^{T/H} + C, where op(A) is A for NORMAL orientations
+// and A^{T/H} otherwise
+template<typename T>
+void Block
+( UpperOrLower uplo, Orientation orientation,
+  T alpha,
+  const DistMatrix<T,MC,MR,BLOCK>& A,
+        DistMatrix<T,MC,MR,BLOCK>& C,
+  bool conjugate=false )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( A, C );
+      if( !BlockConformal( orientation, A, C ) )
+          LogicError("The blockings of A and C do not conform");
+    )
+    const Grid& g = C.Grid();
+    const bool normal = ( orientation == NORMAL );
+    const Orientation orientB = ( conjugate ? ADJOINT : TRANSPOSE );
+    const Int r = ( normal ? A.Width() : A.Height() );
+    const Int bsize = ( normal ? A.BlockWidth() : A.BlockHeight() );
+    const Int cut = ( normal ? A.RowCut() : A.ColCut() );
+
+    // Temporary distributions
+    DistMatrix<T,STAR,MR,  BLOCK> A1_STAR_MR(g);
+    DistMatrix<T,MC,  STAR,BLOCK> X1_MC_STAR(g);
+    DistMatrix<T,MR,  STAR,BLOCK> X1_MR_STAR(g);
+
+    A1_STAR_MR.AlignWith( C );
+    X1_MC_STAR.AlignWith( C );
+    X1_MR_STAR.AlignWith( C );
+
+    Int k = 0;
+    while( k < r )
+    {
+        const Int nb = Min( bsize-Mod(cut+k,bsize), r-k );
+        const Range<Int> ind1( k, k+nb );
+
+        // Form X1 := op(A)(:,ind1) in both [MC,* ] and [MR,* ] distributions
+        if( normal )
+        {
+            auto A1 = A( ALL, ind1 );
+            X1_MC_STAR = A1;
+            X1_MR_STAR = X1_MC_STAR;
+        }
+        else
+        {
+            auto A1 = A( ind1, ALL );
+            A1_STAR_MR = A1;
+            Transpose( A1_STAR_MR, X1_MR_STAR, conjugate );
+            X1_MC_STAR = X1_MR_STAR;
+        }
+
+        // C := C + alpha X1 X1^{T/H}, where
+        //   op(A) op(A)^T = X1 X1^T and op(A) op(A)^H = X1 X1^H
+        LocalTrrk( uplo, orientB, alpha, X1_MC_STAR, X1_MR_STAR, T(1), C );
+
+        k += nb;
+    }
+}
+
+} // namespace syrk
+} // namespace El
@@ -148,7 +148,12 @@ void Trrk
     Orientation orientA, Orientation orientB, \
     T alpha, const DistMatrix<T,STAR,MC  >& A, \
              const DistMatrix<T,MR,  STAR>& B, \
-    T beta,        DistMatrix<T>& C );
+    T beta,        DistMatrix<T>& C ); \
+  template void LocalTrrk \
+  ( UpperOrLower uplo, Orientation orientB, \
+    T alpha, const DistMatrix<T,MC,STAR,BLOCK>& A, \
+             const DistMatrix<T,MR,STAR,BLOCK>& B, \
+    T beta,        DistMatrix<T,MC,MR,  BLOCK>& C );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -884,6 +884,83 @@ void LocalTrrk
     }
 }
 
+// Distributed C := alpha A B^{T/H} + beta C for block distributions, where
+// the row and column blockings of C coincide so that each diagonal block of C
+// is stored contiguously on a single process
+template<typename T>
+void LocalTrrk
+( UpperOrLower uplo,
+  Orientation orientationOfB,
+  T alpha, const DistMatrix<T,MC,STAR,BLOCK>& A,
+           const DistMatrix<T,MR,STAR,BLOCK>& B,
+  T beta,        DistMatrix<T,MC,MR,  BLOCK>& C )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( A, B, C );
+      if( A.Height() != C.Height() || B.Height() != C.Width() ||
+          A.Width() != B.Width() )
+          LogicError
+          ("Nonconformal LocalTrrk:\n",
+           DimsString(A,"A"),"\n",DimsString(B,"B"),"\n",DimsString(C,"C"));
+      if( C.BlockHeight() != C.BlockWidth() || C.ColCut() != C.RowCut() )
+          LogicError("C must have matching row and column blockings");
+      if( A.BlockHeight() != C.BlockHeight() || A.ColCut() != C.ColCut() ||
+          A.ColAlign() != C.ColAlign() )
+          LogicError("A's rows must be blocked and aligned with C's rows");
+      if( B.BlockHeight() != C.BlockWidth() || B.ColCut() != C.RowCut() ||
+          B.ColAlign() != C.RowAlign() )
+          LogicError("B's rows must be blocked and aligned with C's columns");
+    )
+    ScaleTrapezoid( beta, uplo, C );
+    if( !C.Participating() )
+        return;
+
+    const Int n = C.Width();
+    const Int bsize = C.BlockWidth();
+    const Int cut = C.RowCut();
+    const Int rowStride = C.RowStride();
+    const Int localHeight = C.LocalHeight();
+    const Int numBlocks = ( n == 0 ? 0 : (n+cut+bsize-1)/bsize );
+
+    const auto& ALoc = A.LockedMatrix();
+    const auto& BLoc = B.LockedMatrix();
+    auto& CLoc = C.Matrix();
+    for( Int block=Mod(C.RowRank()-C.RowAlign(),rowStride); block<numBlocks;
+         block+=rowStride )
+    {
+        const Int jBeg = Max( block*bsize-cut, Int(0) );
+        const Int jEnd = Min( (block+1)*bsize-cut, n );
+        const Int jLocBeg = C.LocalColOffset( jBeg );
+        const auto indLocCols = IR( jLocBeg, jLocBeg+(jEnd-jBeg) );
+
+        // The rows of the diagonal block (if we own them)
+        const Int iLocBeg = C.LocalRowOffset( jBeg );
+        const Int iLocEnd = C.LocalRowOffset( jEnd );
+        const auto indLocRows = IR( iLocBeg, iLocEnd );
+
+        if( iLocEnd > iLocBeg )
+        {
+            auto CDiag = CLoc( indLocRows, indLocCols );
+            Trrk
+            ( uplo, NORMAL, orientationOfB,
+              alpha, ALoc(indLocRows,ALL), BLoc(indLocCols,ALL),
+              T(1), CDiag );
+        }
+
+        const auto indLocOff =
+          ( uplo == LOWER ? IR(iLocEnd,localHeight) : IR(0,iLocBeg) );
+        if( indLocOff.end > indLocOff.beg )
+        {
+            auto COff = CLoc( indLocOff, indLocCols );
+            Gemm
+            ( NORMAL, orientationOfB,
+              alpha, ALoc(indLocOff,ALL), BLoc(indLocCols,ALL),
+              T(1), COff );
+        }
+    }
+}
+
 } // namespace El
 
 #endif // ifndef EL_TRRK_LOCAL_HPP
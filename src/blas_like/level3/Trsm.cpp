@@ -19,6 +19,8 @@
 #include "./Trsm/RLT.hpp"
 #include "./Trsm/RUN.hpp"
 #include "./Trsm/RUT.hpp"
+#include "./Trsm/Block.hpp"
+#include "./Trsm/Pipelined.hpp"
 
 namespace El {
 
@@ -94,6 +96,33 @@ void Trsm
     )
     B *= alpha;
 
+    // Avoid redistributing conformally-blocked [MC,MR] block matrices (which
+    // only exist on the CPU)
+    if( A.Wrap() == BLOCK && A.ColDist() == MC && A.RowDist() == MR &&
+        A.GetLocalDevice() == Device::CPU &&
+        B.Wrap() == BLOCK && B.ColDist() == MC && B.RowDist() == MR &&
+        B.GetLocalDevice() == Device::CPU )
+    {
+        const auto& ABlock = static_cast<const DistMatrix<F,MC,MR,BLOCK>&>(A);
+        auto& BBlock = static_cast<DistMatrix<F,MC,MR,BLOCK>&>(B);
+        if( trsm::BlockConformal( side, ABlock, BBlock ) )
+        {
+            trsm::Block
+            ( side, uplo, orientation, diag, ABlock, BBlock, checkIfSingular );
+            return;
+        }
+    }
+
+    // Avoid a chain of latency-bound collectives for a few right-hand sides
+    // (only on request)
+    if( alg == TRSM_PIPELINED )
+    {
+        if( side == RIGHT )
+            LogicError("TRSM_PIPELINED only supports side == LEFT");
+        trsm::Pipelined( uplo, orientation, diag, A, B, checkIfSingular );
+        return;
+    }
+
     // Call the single right-hand side algorithm if appropriate
     if( side == LEFT && B.Width() == 1 )
     {
@@ -375,6 +404,25 @@ void Trsm
     }
 }
 
+template<typename F>
+std::future<void> Trsm
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  F alpha,
+  const Matrix<F>& A,
+        Matrix<F>& B,
+  CPUStream& stream,
+  bool checkIfSingular )
+{
+    EL_DEBUG_CSE
+    return stream.Enqueue
+    ( [=,&A,&B]()
+      { Trsm
+        ( side, uplo, orientation, diag, alpha, A, B, checkIfSingular ); } );
+}
+
 template<typename F>
 void LocalTrsm
 ( LeftOrRight side,
@@ -408,6 +456,16 @@ void LocalTrsm
     const Matrix<F>& A, \
           Matrix<F>& B, \
     bool checkIfSingular ); \
+  template std::future<void> Trsm \
+  ( LeftOrRight side, \
+    UpperOrLower uplo, \
+    Orientation orientation, \
+    UnitOrNonUnit diag, \
+    F alpha, \
+    const Matrix<F>& A, \
+          Matrix<F>& B, \
+    CPUStream& stream, \
+    bool checkIfSingular ); \
   template void Trsm \
   ( LeftOrRight side, \
     UpperOrLower uplo, \
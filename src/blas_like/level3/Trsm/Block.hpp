@@ -0,0 +1,161 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace trsm {
+
+// The triangular solve can operate directly on [MC,MR] block distributions
+// if the row and column blockings of A coincide and match the blocking of
+// the dimension of B which A is applied to (alignments are arbitrary)
+template<typename F>
+bool BlockConformal
+( LeftOrRight side,
+  const DistMatrix<F,MC,MR,BLOCK>& A,
+  const DistMatrix<F,MC,MR,BLOCK>& B )
+{
+    const Int blockB = ( side == LEFT ? B.BlockHeight() : B.BlockWidth() );
+    const Int cutB = ( side == LEFT ? B.ColCut() : B.RowCut() );
+    return A.BlockHeight() == A.BlockWidth() && A.ColCut() == A.RowCut() &&
+           A.BlockHeight() == blockB && A.ColCut() == cutB;
+}
+
+// Solve op(A) X = B or X op(A) = B, overwriting B with X, by sweeping over the
+// diagonal blocks of the distribution of A in the order implied by the
+// (effective) triangle of op(A)
+template<typename F>
+void Block
+( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
+  UnitOrNonUnit diag,
+  const DistMatrix<F,MC,MR,BLOCK>& A,
+        DistMatrix<F,MC,MR,BLOCK>& B,
+  bool checkIfSingular=false )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( A, B );
+      if( !BlockConformal( side, A, B ) )
+          LogicError("The blockings of A and B do not conform");
+    )
+    const Grid& g = B.Grid();
+    const Int n = A.Height();
+    const Int bsize = A.BlockHeight();
+    const Int cut = A.ColCut();
+    const bool onLeft = ( side == LEFT );
+    const bool normal = ( orientation == NORMAL );
+
+    // Whether the triangle of op(A) is lower (so that the sweep is forward)
+    const bool forward = ( (uplo == LOWER) == (onLeft == normal) );
+    // Whether the off-diagonal updates use a block column of A rather than a
+    // block row
+    const bool colPanel = ( onLeft == normal );
+
+    // Temporary distributions
+    DistMatrix<F,STAR,STAR,BLOCK> A11_STAR_STAR(g);
+    DistMatrix<F,MC,  STAR,BLOCK> P_MC_STAR(g);
+    DistMatrix<F,MR,  STAR,BLOCK> P_MR_STAR(g);
+    DistMatrix<F,STAR,MC,  BLOCK> P_STAR_MC(g);
+    DistMatrix<F,STAR,MR,  BLOCK> P_STAR_MR(g);
+    DistMatrix<F,MC,  STAR,BLOCK> B1_MC_STAR(g);
+    DistMatrix<F,STAR,MR,  BLOCK> B1_STAR_MR(g);
+
+    if( onLeft )
+        B1_STAR_MR.AlignWith( B );
+    else
+        B1_MC_STAR.AlignWith( B );
+
+    Int k = ( forward ? 0 : n );
+    while( forward ? k < n : k > 0 )
+    {
+        Int kBeg, kEnd;
+        if( forward )
+        {
+            kBeg = k;
+            kEnd = Min( k+bsize-Mod(cut+k,bsize), n );
+        }
+        else
+        {
+            kBeg = (k-1) - Mod(cut+k-1,bsize);
+            kEnd = k;
+        }
+        const Range<Int> ind1( kBeg, kEnd );
+        const Range<Int> indR = ( forward ? IR(kEnd,n) : IR(0,kBeg) );
+
+        auto A11 = A( ind1, ind1 );
+        A11_STAR_STAR = A11;
+
+        auto P = ( colPanel ? A( indR, ind1 ) : A( ind1, indR ) );
+        if( onLeft )
+        {
+            auto B1 = B( ind1, ALL );
+            auto BR = B( indR, ALL );
+
+            B1_STAR_MR = B1;
+            Trsm
+            ( LEFT, uplo, orientation, diag,
+              F(1), A11_STAR_STAR.LockedMatrix(), B1_STAR_MR.Matrix(),
+              checkIfSingular );
+            B1 = B1_STAR_MR;
+
+            // BR := BR - op(A)(indR,ind1) B1
+            if( colPanel )
+            {
+                P_MC_STAR.AlignWith( BR );
+                P_MC_STAR = P;
+                LocalGemm
+                ( NORMAL, NORMAL, F(-1), P_MC_STAR, B1_STAR_MR, F(1), BR );
+            }
+            else
+            {
+                P_STAR_MR.AlignWith( P );
+                P_STAR_MR = P;
+                P_STAR_MC.AlignWith( BR );
+                P_STAR_MC = P_STAR_MR;
+                LocalGemm
+                ( orientation, NORMAL,
+                  F(-1), P_STAR_MC, B1_STAR_MR, F(1), BR );
+            }
+        }
+        else
+        {
+            auto B1 = B( ALL, ind1 );
+            auto BR = B( ALL, indR );
+
+            B1_MC_STAR = B1;
+            Trsm
+            ( RIGHT, uplo, orientation, diag,
+              F(1), A11_STAR_STAR.LockedMatrix(), B1_MC_STAR.Matrix(),
+              checkIfSingular );
+            B1 = B1_MC_STAR;
+
+            // BR := BR - B1 op(A)(ind1,indR)
+            if( colPanel )
+            {
+                P_MC_STAR.AlignWith( P );
+                P_MC_STAR = P;
+                P_MR_STAR.AlignWith( BR );
+                P_MR_STAR = P_MC_STAR;
+                LocalGemm
+                ( NORMAL, orientation,
+                  F(-1), B1_MC_STAR, P_MR_STAR, F(1), BR );
+            }
+            else
+            {
+                P_STAR_MR.AlignWith( BR );
+                P_STAR_MR = P;
+                LocalGemm
+                ( NORMAL, NORMAL, F(-1), B1_MC_STAR, P_STAR_MR, F(1), BR );
+            }
+        }
+
+        k = ( forward ? kEnd : kBeg );
+    }
+}
+
+} // namespace trsm
+} // namespace El
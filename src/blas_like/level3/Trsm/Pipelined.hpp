@@ -0,0 +1,412 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_TRSM_PIPELINED_HPP
+#define EL_TRSM_PIPELINED_HPP
+
+namespace El {
+namespace trsm {
+
+// Solve op(A) X = B for a narrow B with A in an [MC,MR] distribution.
+//
+// The blocked algorithms redistribute each diagonal block and reduce its
+// updates with collectives over the whole grid, so that, with one or a few
+// right-hand sides, every solve is a long chain of latency-bound collectives.
+// Here each diagonal block is instead solved by a single root (the roots cycle
+// through the grid) and all other communication is point-to-point:
+//
+//  1. The diagonal blocks are sent to their roots up front, off of the
+//     critical path.
+//  2. The root sends each process in its process row (column, for the
+//     transposed solves) the entries of the new piece of the solution which
+//     its process column (row) needs, and these are forwarded down the
+//     process columns (rows).
+//  3. Each process first updates the partial sums of the *next* diagonal
+//     block, which are summed along process rows (columns) into the next
+//     root's process column (row) and then along it into the next root, and
+//     only afterwards applies the rest of its update, so that the next
+//     root's solve overlaps with the trailing updates of all other processes.
+//
+// B is gathered once at the start and the solution is reassembled with a
+// single summation at the end.
+template<typename F>
+void Pipelined
+( UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  const AbstractDistMatrix<F>& APre,
+        AbstractDistMatrix<F>& BPre,
+  bool checkIfSingular )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( APre, BPre );
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+      if( APre.Height() != BPre.Height() )
+          LogicError("Nonconformal Trsm");
+    )
+    const Int n = APre.Height();
+    const Int numRHS = BPre.Width();
+    if( n == 0 || numRHS == 0 )
+        return;
+
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const auto& ALoc = A.LockedMatrix();
+    const mpi::Comm comm = A.DistComm();
+    const int commRank = A.DistRank();
+    const int commSize = mpi::Size( comm );
+    const int colStride = A.ColStride();
+    const int rowStride = A.RowStride();
+
+    // Only the root of each diagonal block sees it in full, so the check for
+    // singularity must be made collectively before any messages are posted
+    if( checkIfSingular && diag != UNIT )
+    {
+        int singular = 0;
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            if( A.IsLocalCol(i) && ALoc(iLoc,A.LocalCol(i)) == F(0) )
+                singular = 1;
+        }
+        singular = mpi::AllReduce( singular, mpi::MAX, comm );
+        if( singular )
+            throw SingularMatrixException();
+    }
+
+    DistMatrix<F,STAR,STAR> X( BPre );
+    auto& XLoc = X.Matrix();
+
+    // The partial sums of op(A) X are indexed by the rows of A if the
+    // orientation is NORMAL and by its columns otherwise, and the entries of
+    // the solution which they consume by the other dimension
+    const bool normal = ( orientation == NORMAL );
+    const bool forward = ( (uplo == LOWER) == normal );
+    const int partStride = ( normal ? colStride : rowStride );
+    const int solStride = ( normal ? rowStride : colStride );
+    const int partRank = ( normal ? A.ColRank() : A.RowRank() );
+    const int solRank = ( normal ? A.RowRank() : A.ColRank() );
+    const int partAlign = ( normal ? A.ColAlign() : A.RowAlign() );
+    const int solAlign = ( normal ? A.RowAlign() : A.ColAlign() );
+    auto partOffset = [&]( Int i, int owner )
+      { return normal ? A.LocalRowOffset(i,owner)
+                      : A.LocalColOffset(i,owner); };
+    auto solOffset = [&]( Int j, int owner )
+      { return normal ? A.LocalColOffset(j,owner)
+                      : A.LocalRowOffset(j,owner); };
+    auto rankOf = [&]( int partOwner, int solOwner )
+      { return normal ? partOwner + solOwner*colStride
+                      : solOwner + partOwner*colStride; };
+
+    const Int bsize = Blocksize();
+    const Int numBlocks = (n+bsize-1) / bsize;
+    auto blockAt = [&]( Int step )
+      { return forward ? step : numBlocks-1-step; };
+    auto blockBeg = [&]( Int k ) { return k*bsize; };
+    auto blockEnd = [&]( Int k ) { return Min((k+1)*bsize,n); };
+    auto rootOf = [&]( Int k ) { return int(k % commSize); };
+    auto rootPart = [&]( Int k )
+      { return normal ? rootOf(k) % colStride : rootOf(k) / colStride; };
+    auto rootSol = [&]( Int k )
+      { return normal ? rootOf(k) / colStride : rootOf(k) % colStride; };
+
+    // Every message between a given pair of processes with a given tag is
+    // sent and received in the order of the steps
+    const int diagTag = 0, partTag = 1, leadTag = 2, solTag = 3, fwdTag = 4;
+
+    // Keep the send buffers alive until all of the sends have completed
+    std::deque<Matrix<F>> sendBufs;
+    std::deque<mpi::Request<F>> sendRequests;
+    auto post = [&]( const Matrix<F>& buf, int to, int tag )
+      {
+          sendRequests.emplace_back();
+          mpi::TaggedISend
+          ( buf.LockedBuffer(), buf.Height()*buf.Width(), to, tag, comm,
+            sendRequests.back() );
+      };
+
+    // Send the diagonal blocks to their roots
+    vector<vector<Matrix<F>>> diagPieces( numBlocks );
+    vector<vector<mpi::Request<F>>> diagRequests( numBlocks );
+    for( Int k=0; k<numBlocks; ++k )
+    {
+        const Int k0 = blockBeg(k);
+        const Int k1 = blockEnd(k);
+        const int root = rootOf(k);
+        if( root == commRank )
+        {
+            diagPieces[k].resize( commSize );
+            diagRequests[k].reserve( commSize );
+            for( int q=0; q<commSize; ++q )
+            {
+                const int rowOwner = q % colStride;
+                const int colOwner = q / colStride;
+                const Int localHeight =
+                  A.LocalRowOffset(k1,rowOwner) - A.LocalRowOffset(k0,rowOwner);
+                const Int localWidth =
+                  A.LocalColOffset(k1,colOwner) - A.LocalColOffset(k0,colOwner);
+                if( localHeight == 0 || localWidth == 0 )
+                    continue;
+                auto& piece = diagPieces[k][q];
+                if( q == commRank )
+                {
+                    piece = ALoc
+                      ( IR(A.LocalRowOffset(k0),A.LocalRowOffset(k1)),
+                        IR(A.LocalColOffset(k0),A.LocalColOffset(k1)) );
+                }
+                else
+                {
+                    piece.Resize( localHeight, localWidth );
+                    diagRequests[k].emplace_back();
+                    mpi::TaggedIRecv
+                    ( piece.Buffer(), localHeight*localWidth, q, diagTag, comm,
+                      diagRequests[k].back() );
+                }
+            }
+        }
+        else
+        {
+            const Range<Int> ind1( A.LocalRowOffset(k0), A.LocalRowOffset(k1) );
+            const Range<Int> ind2( A.LocalColOffset(k0), A.LocalColOffset(k1) );
+            if( ind1.end > ind1.beg && ind2.end > ind2.beg )
+            {
+                sendBufs.emplace_back();
+                sendBufs.back() = ALoc(ind1,ind2);
+                post( sendBufs.back(), root, diagTag );
+            }
+        }
+    }
+
+    // Z(partBeg:partEnd) -= op(A)(partBeg:partEnd,k0:k1) x_k, where xLoc holds
+    // the entries of x_k which this process needs
+    Matrix<F> Z( normal ? A.LocalHeight() : A.LocalWidth(), numRHS );
+    Zero( Z );
+    auto update = [&]
+      ( Int partBeg, Int partEnd, Int k0, Int k1, const Matrix<F>& xLoc )
+      {
+          const Range<Int> partInd
+            ( partOffset(partBeg,partRank), partOffset(partEnd,partRank) );
+          const Range<Int> solInd
+            ( solOffset(k0,solRank), solOffset(k1,solRank) );
+          if( partInd.end == partInd.beg || solInd.end == solInd.beg )
+              return;
+          auto ZSub = Z( partInd, ALL );
+          if( normal )
+              Gemm
+              ( NORMAL, NORMAL,
+                F(-1), ALoc(partInd,solInd), xLoc, F(1), ZSub );
+          else
+              Gemm
+              ( orientation, NORMAL,
+                F(-1), ALoc(solInd,partInd), xLoc, F(1), ZSub );
+      };
+
+    Matrix<F> Akk, partial, summand, xLoc, rootPartial;
+    for( Int step=0; step<numBlocks; ++step )
+    {
+        const Int k = blockAt(step);
+        const Int k0 = blockBeg(k);
+        const Int k1 = blockEnd(k);
+        const Int nb = k1-k0;
+        const int root = rootOf(k);
+        const int partRoot = rootPart(k);
+        const int solRoot = rootSol(k);
+        const bool lastStep = ( step == numBlocks-1 );
+
+        if( root == commRank )
+        {
+            // Sum the partial sums from the leaders of the process rows
+            if( step != 0 )
+            {
+                for( int a=0; a<partStride; ++a )
+                {
+                    const Int count = partOffset(k1,a) - partOffset(k0,a);
+                    if( count == 0 )
+                        continue;
+                    if( a == partRoot )
+                    {
+                        partial = rootPartial;
+                    }
+                    else
+                    {
+                        partial.Resize( count, numRHS );
+                        mpi::TaggedRecv
+                        ( partial.Buffer(), count*numRHS, rankOf(a,solRoot),
+                          leadTag, comm );
+                    }
+                    const Int first =
+                      Shift(a,partAlign,partStride) +
+                      partOffset(k0,a)*partStride;
+                    for( Int j=0; j<numRHS; ++j )
+                        for( Int i=0; i<count; ++i )
+                            XLoc(first+i*partStride,j) += partial(i,j);
+                }
+            }
+
+            // Assemble the diagonal block and solve against it
+            if( !diagRequests[k].empty() )
+                mpi::WaitAll
+                ( int(diagRequests[k].size()), diagRequests[k].data() );
+            Akk.Resize( nb, nb );
+            Zero( Akk );
+            for( int q=0; q<commSize; ++q )
+            {
+                const auto& piece = diagPieces[k][q];
+                const int rowOwner = q % colStride;
+                const int colOwner = q / colStride;
+                const Int i0 =
+                  Shift(rowOwner,A.ColAlign(),colStride) +
+                  A.LocalRowOffset(k0,rowOwner)*colStride;
+                const Int j0 =
+                  Shift(colOwner,A.RowAlign(),rowStride) +
+                  A.LocalColOffset(k0,colOwner)*rowStride;
+                for( Int jLoc=0; jLoc<piece.Width(); ++jLoc )
+                    for( Int iLoc=0; iLoc<piece.Height(); ++iLoc )
+                        Akk(i0-k0+iLoc*colStride,j0-k0+jLoc*rowStride) =
+                          piece(iLoc,jLoc);
+            }
+            auto Xk = XLoc( IR(k0,k1), ALL );
+            Trsm( LEFT, uplo, orientation, diag, F(1), Akk, Xk, false );
+
+            // Send the new piece of the solution along the root's process row
+            if( !lastStep )
+            {
+                for( int b=0; b<solStride; ++b )
+                {
+                    const Int count = solOffset(k1,b) - solOffset(k0,b);
+                    const int target = rankOf(partRoot,b);
+                    if( count == 0 || target == commRank )
+                        continue;
+                    const Int first =
+                      Shift(b,solAlign,solStride) + solOffset(k0,b)*solStride;
+                    sendBufs.emplace_back( count, numRHS );
+                    auto& piece = sendBufs.back();
+                    for( Int j=0; j<numRHS; ++j )
+                        for( Int i=0; i<count; ++i )
+                            piece(i,j) = XLoc(first+i*solStride,j);
+                    post( piece, target, solTag );
+                }
+            }
+        }
+        if( lastStep )
+            break;
+
+        // Receive (and forward down the process column) the entries of the
+        // new piece of the solution that this process needs
+        const Int solCount = solOffset(k1,solRank) - solOffset(k0,solRank);
+        if( solCount != 0 )
+        {
+            if( partRank == partRoot )
+            {
+                sendBufs.emplace_back( solCount, numRHS );
+                auto& piece = sendBufs.back();
+                if( root == commRank )
+                {
+                    const Int first =
+                      Shift(solRank,solAlign,solStride) +
+                      solOffset(k0,solRank)*solStride;
+                    for( Int j=0; j<numRHS; ++j )
+                        for( Int i=0; i<solCount; ++i )
+                            piece(i,j) = XLoc(first+i*solStride,j);
+                }
+                else
+                {
+                    mpi::TaggedRecv
+                    ( piece.Buffer(), solCount*numRHS, root, solTag, comm );
+                }
+                for( int a=0; a<partStride; ++a )
+                    if( a != partRoot )
+                        post( piece, rankOf(a,solRank), fwdTag );
+                xLoc = piece;
+            }
+            else
+            {
+                xLoc.Resize( solCount, numRHS );
+                mpi::TaggedRecv
+                ( xLoc.Buffer(), solCount*numRHS, rankOf(partRoot,solRank),
+                  fwdTag, comm );
+            }
+        }
+
+        // Update and sum the partial sums of the next diagonal block first
+        const Int l = blockAt(step+1);
+        const Int l0 = blockBeg(l);
+        const Int l1 = blockEnd(l);
+        if( solCount != 0 )
+            update( l0, l1, k0, k1, xLoc );
+        const Int partBeg = partOffset(l0,partRank);
+        const Int partCount = partOffset(l1,partRank) - partBeg;
+        if( partCount != 0 )
+        {
+            const int nextPartRoot = rootPart(l);
+            const int nextSolRoot = rootSol(l);
+            partial = Z( IR(partBeg,partBeg+partCount), ALL );
+            if( solRank == nextSolRoot )
+            {
+                summand.Resize( partCount, numRHS );
+                for( int b=0; b<solStride; ++b )
+                {
+                    if( b == nextSolRoot )
+                        continue;
+                    mpi::TaggedRecv
+                    ( summand.Buffer(), partCount*numRHS, rankOf(partRank,b),
+                      partTag, comm );
+                    partial += summand;
+                }
+                if( partRank == nextPartRoot )
+                {
+                    rootPartial = partial;
+                }
+                else
+                {
+                    sendBufs.emplace_back();
+                    sendBufs.back() = partial;
+                    post
+                    ( sendBufs.back(), rankOf(nextPartRoot,nextSolRoot),
+                      leadTag );
+                }
+            }
+            else
+            {
+                sendBufs.emplace_back();
+                sendBufs.back() = partial;
+                post( sendBufs.back(), rankOf(partRank,nextSolRoot), partTag );
+            }
+        }
+
+        // Apply the rest of the update
+        if( solCount != 0 )
+        {
+            if( forward )
+                update( l1, n, k0, k1, xLoc );
+            else
+                update( 0, l0, k0, k1, xLoc );
+        }
+    }
+    for( auto& request : sendRequests )
+        mpi::Wait( request );
+
+    // Each block of the solution is only known to its root
+    for( Int k=0; k<numBlocks; ++k )
+    {
+        if( rootOf(k) != commRank )
+        {
+            auto Xk = XLoc( IR(blockBeg(k),blockEnd(k)), ALL );
+            Zero( Xk );
+        }
+    }
+    AllReduce( XLoc, comm );
+    Copy( X, BPre );
+}
+
+} // namespace trsm
+} // namespace El
+
+#endif // ifndef EL_TRSM_PIPELINED_HPP
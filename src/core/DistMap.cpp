@@ -241,6 +241,22 @@ void InvertMap( const vector<Int>& map, vector<Int>& inverseMap )
         inverseMap[map[i]] = i;
 }
 
+void EnsurePermutation( const vector<Int>& map )
+{
+    EL_DEBUG_CSE
+    const Int numSources = map.size();
+    vector<bool> hit( numSources, false );
+    for( Int s=0; s<numSources; ++s )
+    {
+        const Int target = map[s];
+        if( target < 0 || target >= numSources )
+            LogicError("Index ",target," was out of bounds [0,",numSources,")");
+        if( hit[target] )
+            LogicError("Index ",target," was hit more than once");
+        hit[target] = true;
+    }
+}
+
 void InvertMap( const DistMap& map, DistMap& inverseMap )
 {
     EL_DEBUG_CSE
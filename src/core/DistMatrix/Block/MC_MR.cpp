@@ -277,6 +277,7 @@ int BDM::PartialUnionRowRank() const EL_NO_EXCEPT
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGINT
 #define EL_ENABLE_BIGFLOAT
+#define EL_ENABLE_HALF
 #include <El/macros/Instantiate.h>
 
 } // namespace El
@@ -84,12 +84,7 @@ template <typename T, Device D>
 BDM& BDM::operator=( const DistMatrix<T,MR,STAR,BLOCK,D>& A )
 {
     EL_DEBUG_CSE
-    DistMatrix<T,VR,STAR,BLOCK,D> A_VR_STAR( A );
-    DistMatrix<T,VC,STAR,BLOCK,D> A_VC_STAR( this->Grid() );
-    A_VC_STAR.AlignColsWith(*this);
-    A_VC_STAR = A_VR_STAR;
-    A_VR_STAR.Empty();
-    *this = A_VC_STAR;
+    copy::ColwiseBlockExchange( A, *this );
     return *this;
 }
 
@@ -300,6 +295,7 @@ int BDM::PartialUnionRowRank() const EL_NO_EXCEPT
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGINT
 #define EL_ENABLE_BIGFLOAT
+#define EL_ENABLE_HALF
 #include <El/macros/Instantiate.h>
 
 } // namespace El
@@ -57,8 +57,7 @@ template <typename T, Device D>
 BDM& BDM::operator=( const DistMatrix<T,STAR,MR,BLOCK,D>& A )
 {
     EL_DEBUG_CSE
-    // TODO: More efficient implementation
-    copy::GeneralPurpose( A, *this );
+    copy::RowwiseBlockExchange( A, *this );
     return *this;
 }
 
@@ -292,6 +291,7 @@ int BDM::PartialUnionRowRank() const EL_NO_EXCEPT
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGINT
 #define EL_ENABLE_BIGFLOAT
+#define EL_ENABLE_HALF
 #include <El/macros/Instantiate.h>
 
 } // namespace El
@@ -102,16 +102,7 @@ template <typename T, Device D>
 BDM& BDM::operator=( const DistMatrix<T,STAR,MC,BLOCK,D>& A )
 {
     EL_DEBUG_CSE
-    DistMatrix<T,STAR,VC,BLOCK,D> A_STAR_VC( A );
-    DistMatrix<T,STAR,VR,BLOCK,D> A_STAR_VR( this->Grid() );
-    A_STAR_VR.AlignRowsWith(*this);
-    A_STAR_VR = A_STAR_VC;
-    A_STAR_VC.Empty();
-
-    DistMatrix<T,MC,MR,BLOCK,D> A_MC_MR( A_STAR_VR );
-    A_STAR_VR.Empty();
-
-    *this = A_MC_MR;
+    copy::RowwiseBlockExchange( A, *this );
     return *this;
 }
 
@@ -307,6 +298,7 @@ int BDM::PartialUnionRowRank() const EL_NO_EXCEPT
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGINT
 #define EL_ENABLE_BIGFLOAT
+#define EL_ENABLE_HALF
 #include <El/macros/Instantiate.h>
 
 } // namespace El
@@ -822,6 +822,7 @@ ElementalMatrix<T>::ShallowSwap( ElementalMatrix<T>& A )
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGINT
 #define EL_ENABLE_BIGFLOAT
+#define EL_ENABLE_HALF
 #include <El/macros/Instantiate.h>
 
 } // namespace El
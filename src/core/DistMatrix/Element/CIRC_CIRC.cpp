@@ -215,6 +215,7 @@ DistMatrix<double,COLDIST,ROWDIST,ELEMENT,Device::GPU>::operator=(
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGINT
 #define EL_ENABLE_BIGFLOAT
+#define EL_ENABLE_HALF
 #include <El/macros/Instantiate.h>
 
 } // namespace El
@@ -347,6 +347,7 @@ DistMatrix<double,COLDIST,ROWDIST,ELEMENT,Device::CPU>::operator=(
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGINT
 #define EL_ENABLE_BIGFLOAT
+#define EL_ENABLE_HALF
 #include <El/macros/Instantiate.h>
 
 } // namespace El
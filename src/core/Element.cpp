@@ -70,6 +70,12 @@ template<>
 string TypeName<BigFloat>()
 { return string("BigFloat"); }
 #endif
+template<>
+string TypeName<Half>()
+{ return string("Half"); }
+template<>
+string TypeName<BFloat16>()
+{ return string("BFloat16"); }
 
 // Basic element manipulation and I/O
 // ==================================
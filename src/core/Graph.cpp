@@ -0,0 +1,292 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <algorithm>
+
+namespace El {
+
+// Constructors and destructors
+// ============================
+
+Graph::Graph()
+: sourceOffsets_(1,0)
+{ }
+
+Graph::Graph( Int numSources )
+: Graph( numSources, numSources )
+{ }
+
+Graph::Graph( Int numSources, Int numTargets )
+: Graph()
+{
+    EL_DEBUG_CSE
+    Resize( numSources, numTargets );
+}
+
+Graph::Graph( const Graph& graph )
+{
+    EL_DEBUG_CSE
+    *this = graph;
+}
+
+Graph::~Graph() { }
+
+// Assignment and reconfiguration
+// ==============================
+
+const Graph& Graph::operator=( const Graph& graph )
+{
+    EL_DEBUG_CSE
+    numSources_ = graph.numSources_;
+    numTargets_ = graph.numTargets_;
+    consistent_ = graph.consistent_;
+    sources_ = graph.sources_;
+    targets_ = graph.targets_;
+    markedForRemoval_ = graph.markedForRemoval_;
+    sourceOffsets_ = graph.sourceOffsets_;
+    return *this;
+}
+
+void Graph::Empty( bool freeMemory )
+{
+    EL_DEBUG_CSE
+    numSources_ = 0;
+    numTargets_ = 0;
+    if( freeMemory )
+    {
+        SwapClear( sources_ );
+        SwapClear( targets_ );
+    }
+    else
+    {
+        sources_.resize( 0 );
+        targets_.resize( 0 );
+    }
+    markedForRemoval_.clear();
+    sourceOffsets_.assign( 1, 0 );
+    consistent_ = true;
+}
+
+void Graph::SoftEmpty()
+{
+    EL_DEBUG_CSE
+    sources_.resize( 0 );
+    targets_.resize( 0 );
+    markedForRemoval_.clear();
+    sourceOffsets_.assign( numSources_+1, 0 );
+    consistent_ = true;
+}
+
+void Graph::Resize( Int numVertices )
+{ Resize( numVertices, numVertices ); }
+
+void Graph::Resize( Int numSources, Int numTargets )
+{
+    EL_DEBUG_CSE
+    if( numSources < 0 || numTargets < 0 )
+        LogicError("Invalid graph dimensions: ",numSources," x ",numTargets);
+    if( numSources_ == numSources && numTargets == numTargets_ )
+        return;
+    numSources_ = numSources;
+    numTargets_ = numTargets;
+    SoftEmpty();
+}
+
+void Graph::Reserve( Int numEdges )
+{
+    EL_DEBUG_CSE
+    sources_.reserve( numEdges );
+    targets_.reserve( numEdges );
+}
+
+void Graph::Connect( Int source, Int target )
+{
+    EL_DEBUG_CSE
+    QueueConnection( source, target );
+    ProcessQueues();
+}
+
+void Graph::Disconnect( Int source, Int target )
+{
+    EL_DEBUG_CSE
+    QueueDisconnection( source, target );
+    ProcessQueues();
+}
+
+void Graph::QueueConnection( Int source, Int target )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( source < 0 || source >= numSources_ )
+          LogicError
+          ("Source ",source," was out of bounds [0,",numSources_,")");
+      if( target < 0 || target >= numTargets_ )
+          LogicError
+          ("Target ",target," was out of bounds [0,",numTargets_,")");
+    )
+    sources_.push_back( source );
+    targets_.push_back( target );
+    consistent_ = false;
+}
+
+void Graph::QueueDisconnection( Int source, Int target )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    markedForRemoval_.insert( pair<Int,Int>(source,target) );
+    consistent_ = false;
+}
+
+void Graph::ProcessQueues()
+{
+    EL_DEBUG_CSE
+    if( consistent_ )
+        return;
+
+    const Int numQueued = sources_.size();
+    vector<pair<Int,Int>> pairs( numQueued );
+    for( Int e=0; e<numQueued; ++e )
+        pairs[e] = pair<Int,Int>( sources_[e], targets_[e] );
+    std::sort( pairs.begin(), pairs.end() );
+    pairs.erase( std::unique( pairs.begin(), pairs.end() ), pairs.end() );
+
+    Int numEdges = 0;
+    for( const auto& edge : pairs )
+    {
+        if( markedForRemoval_.count(edge) )
+            continue;
+        sources_[numEdges] = edge.first;
+        targets_[numEdges] = edge.second;
+        ++numEdges;
+    }
+    sources_.resize( numEdges );
+    targets_.resize( numEdges );
+    markedForRemoval_.clear();
+
+    ComputeSourceOffsets();
+    consistent_ = true;
+}
+
+void Graph::ForceNumEdges( Int numEdges )
+{
+    EL_DEBUG_CSE
+    sources_.resize( numEdges );
+    targets_.resize( numEdges );
+    consistent_ = false;
+}
+
+void Graph::ForceConsistency( bool consistent ) EL_NO_EXCEPT
+{ consistent_ = consistent; }
+
+// Queries
+// =======
+
+Int Graph::NumSources() const EL_NO_EXCEPT { return numSources_; }
+Int Graph::NumTargets() const EL_NO_EXCEPT { return numTargets_; }
+Int Graph::NumEdges() const EL_NO_EXCEPT { return sources_.size(); }
+Int Graph::Capacity() const EL_NO_EXCEPT { return sources_.capacity(); }
+bool Graph::Consistent() const EL_NO_EXCEPT { return consistent_; }
+
+Int Graph::Source( Int edge ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( edge < 0 || edge >= Int(sources_.size()) )
+          LogicError("Edge number out of bounds");
+    )
+    return sources_[edge];
+}
+
+Int Graph::Target( Int edge ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( edge < 0 || edge >= Int(targets_.size()) )
+          LogicError("Edge number out of bounds");
+    )
+    return targets_[edge];
+}
+
+Int Graph::SourceOffset( Int source ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( source < 0 || source > numSources_ )
+          LogicError("Source ",source," out of bounds");
+      AssertConsistent();
+    )
+    return sourceOffsets_[source];
+}
+
+Int Graph::Offset( Int source, Int target ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const Int* targetBuf = targets_.data();
+    const Int thisOff = SourceOffset( source );
+    const Int nextOff = SourceOffset( source+1 );
+    auto it = std::lower_bound( targetBuf+thisOff, targetBuf+nextOff, target );
+    return it - targetBuf;
+}
+
+Int Graph::NumConnections( Int source ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    return SourceOffset(source+1) - SourceOffset(source);
+}
+
+bool Graph::EdgeExists( Int source, Int target ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const Int index = Offset( source, target );
+    return index < SourceOffset(source+1) && targets_[index] == target;
+}
+
+Int* Graph::SourceBuffer() EL_NO_EXCEPT { return sources_.data(); }
+Int* Graph::TargetBuffer() EL_NO_EXCEPT { return targets_.data(); }
+Int* Graph::OffsetBuffer() EL_NO_EXCEPT { return sourceOffsets_.data(); }
+
+const Int* Graph::LockedSourceBuffer() const EL_NO_EXCEPT
+{ return sources_.data(); }
+const Int* Graph::LockedTargetBuffer() const EL_NO_EXCEPT
+{ return targets_.data(); }
+const Int* Graph::LockedOffsetBuffer() const EL_NO_EXCEPT
+{ return sourceOffsets_.data(); }
+
+void Graph::AssertConsistent() const
+{
+    if( !consistent_ )
+        LogicError("Graph was not consistent; run ProcessQueues()");
+}
+
+// Auxiliary routines
+// ==================
+
+void Graph::ComputeSourceOffsets()
+{
+    EL_DEBUG_CSE
+    const Int numEdges = sources_.size();
+    sourceOffsets_.resize( numSources_+1 );
+    Int source = 0;
+    sourceOffsets_[0] = 0;
+    for( Int e=0; e<numEdges; ++e )
+    {
+        EL_DEBUG_ONLY(
+          if( sources_[e] < source )
+              LogicError("Sources were not properly sorted");
+        )
+        while( source < sources_[e] )
+            sourceOffsets_[++source] = e;
+    }
+    while( source < numSources_ )
+        sourceOffsets_[++source] = numEdges;
+}
+
+} // namespace El
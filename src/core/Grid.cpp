@@ -72,6 +72,135 @@ int Grid::DefaultHeight( int gridSize ) EL_NO_EXCEPT
     return gridHeight;
 }
 
+GridTraffic GemmGridTraffic( Int m, Int n, Int k, Int blocksize )
+{
+    EL_DEBUG_CSE
+    if( blocksize <= 0 )
+        LogicError("Blocksize must be positive");
+    // Panels of A are spread over MRComm and panels of B over MCComm
+    GridTraffic traffic;
+    traffic.colWords = double(k)*double(n);
+    traffic.rowWords = double(m)*double(k);
+    const Int numPanels = (Max(k,Int(1))+blocksize-1) / blocksize;
+    traffic.colMessages = traffic.rowMessages = numPanels;
+    return traffic;
+}
+
+GridTraffic PanelGridTraffic( Int m, Int n, Int blocksize )
+{
+    EL_DEBUG_CSE
+    if( blocksize <= 0 )
+        LogicError("Blocksize must be positive");
+    // Each panel column requires a reduction within the process column, while
+    // the trailing updates spread the L21 (U12) panels over MRComm (MCComm)
+    const double minDim = Min(m,n);
+    const Int numPanels = (Max(Min(m,n),Int(1))+blocksize-1) / blocksize;
+    GridTraffic traffic;
+    traffic.colWords = n*minDim - minDim*minDim/2;
+    traffic.rowWords = m*minDim - minDim*minDim/2;
+    traffic.colMessages = minDim + numPanels;
+    traffic.rowMessages = numPanels;
+    return traffic;
+}
+
+namespace {
+
+// The largest number of nodes spanned by any process column (or row, if
+// 'cols' is false) when node-major position t holds the process at grid
+// coordinates (t % height, t / height) if 'colsOnNode' and
+// (t / width, t % width) otherwise
+int MaxNodesSpanned
+( int gridSize, int height, int nodeSize, bool colsOnNode, bool cols )
+{
+    const int width = gridSize / height;
+    const int numComms = ( cols ? width : height );
+    vector<int> lastNode( numComms, -1 ), numNodes( numComms, 0 );
+    for( int t=0; t<gridSize; ++t )
+    {
+        const int mcRank = ( colsOnNode ? t % height : t / width );
+        const int mrRank = ( colsOnNode ? t / height : t % width );
+        const int comm = ( cols ? mrRank : mcRank );
+        const int node = t / nodeSize;
+        // Positions are visited in order, so the nodes never decrease
+        if( node != lastNode[comm] )
+        {
+            lastNode[comm] = node;
+            ++numNodes[comm];
+        }
+    }
+    return *std::max_element( numNodes.begin(), numNodes.end() );
+}
+
+// A two-level model of a collective over 'commSize' processes spread evenly
+// over 'numNodes' nodes in which each process receives 'words' words in
+// total over 'messages' rounds
+double CollectiveCost
+( double commSize, double numNodes, double words, double messages,
+  const GridNetwork& network )
+{
+    if( commSize <= 1 )
+        return 0;
+    const double perNode = commSize / numNodes;
+    const double latency =
+      std::log2(perNode)*network.intraLatency +
+      std::log2(numNodes)*network.interLatency;
+    const double wordTime =
+      (perNode-1)/commSize*network.intraWordTime +
+      (1-1/numNodes)*network.interWordTime;
+    return messages*latency + words*wordTime;
+}
+
+} // anonymous namespace
+
+double Grid::CommCost
+( int gridSize, int height, int nodeSize, bool colsOnNode,
+  const GridTraffic& traffic, const GridNetwork& network ) EL_NO_EXCEPT
+{
+    const int width = gridSize / height;
+    const int colNodes =
+      MaxNodesSpanned( gridSize, height, nodeSize, colsOnNode, true );
+    const int rowNodes =
+      MaxNodesSpanned( gridSize, height, nodeSize, colsOnNode, false );
+    return CollectiveCost
+           ( height, colNodes, traffic.colWords/width, traffic.colMessages,
+             network ) +
+           CollectiveCost
+           ( width, rowNodes, traffic.rowWords/height, traffic.rowMessages,
+             network );
+}
+
+int Grid::TopologyAwareHeight
+( int gridSize, int nodeSize, const GridTraffic& traffic,
+  bool& colsOnNode, const GridNetwork& network ) EL_NO_EXCEPT
+{
+    // Break (near) ties in favor of the squarest grid
+    const double tol = 1e-12;
+    int bestHeight = DefaultHeight( gridSize );
+    colsOnNode = true;
+    double bestCost =
+      CommCost( gridSize, bestHeight, nodeSize, colsOnNode, traffic, network );
+    for( int height=1; height<=gridSize; ++height )
+    {
+        if( gridSize % height != 0 )
+            continue;
+        const int skew = Abs( height - gridSize/height );
+        const int bestSkew = Abs( bestHeight - gridSize/bestHeight );
+        for( bool cols : { true, false } )
+        {
+            const double cost =
+              CommCost( gridSize, height, nodeSize, cols, traffic, network );
+            if( cost < bestCost*(1-tol) ||
+                (cost <= bestCost*(1+tol) && skew < bestSkew) )
+            {
+                bestCost = cost;
+                bestHeight = height;
+                colsOnNode = cols;
+            }
+        }
+    }
+    return bestHeight;
+}
+
 Grid::Grid( mpi::Comm comm, GridOrder order )
 : haveViewers_(false), order_(order)
 {
@@ -110,6 +239,67 @@ Grid::Grid( mpi::Comm comm, int height, GridOrder order )
     SetUpGrid();
 }
 
+Grid::Grid
+( mpi::Comm comm, const GridTraffic& traffic, GridOrder order,
+  const GridNetwork& network )
+: haveViewers_(false), order_(order)
+{
+    EL_DEBUG_CSE
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    // Number the nodes by the order of their first ranks
+    mpi::Comm nodeComm, leaderComm;
+    mpi::SplitShared( comm, commRank, nodeComm );
+    const int nodeRank = mpi::Rank( nodeComm );
+    mpi::Split
+    ( comm, nodeRank == 0 ? 0 : mpi::UNDEFINED, commRank, leaderComm );
+    int node = 0;
+    if( nodeRank == 0 )
+    {
+        node = mpi::Rank( leaderComm );
+        mpi::Free( leaderComm );
+    }
+    mpi::Broadcast( node, 0, nodeComm );
+    int myNodeInfo[3] = { node, nodeRank, mpi::Size(nodeComm) };
+    mpi::Free( nodeComm );
+    vector<int> nodeInfo( 3*commSize );
+    mpi::AllGather( myNodeInfo, 3, nodeInfo.data(), 3, comm );
+    const int nodeSize = nodeInfo[2];
+    bool regular = true;
+    for( int q=0; q<commSize; ++q )
+        if( nodeInfo[3*q+2] != nodeSize )
+            regular = false;
+
+    // Order the viewing communicator by the rank in the cartesian
+    // communicator built by SetUpGrid
+    int key = commRank;
+    if( regular )
+    {
+        bool colsOnNode;
+        height_ =
+          TopologyAwareHeight
+          ( commSize, nodeSize, traffic, colsOnNode, network );
+        const int width = commSize / height_;
+        const int t = node*nodeSize + nodeRank;
+        const int mcRank = ( colsOnNode ? t % height_ : t / width );
+        const int mrRank = ( colsOnNode ? t / height_ : t % width );
+        key = ( order == COLUMN_MAJOR ? mcRank + mrRank*height_
+                                      : mrRank + mcRank*width );
+    }
+    else
+        height_ = DefaultHeight( commSize );
+
+    mpi::Split( comm, 0, key, viewingComm_ );
+    mpi::CommGroup( viewingComm_, viewingGroup_ );
+    size_ = mpi::Size( viewingComm_ );
+
+    // All processes own the grid, so we have to trivially split viewingGroup_
+    owningGroup_ = viewingGroup_;
+
+    SetUpGrid();
+}
+
 void Grid::SetUpGrid()
 {
     EL_DEBUG_CSE
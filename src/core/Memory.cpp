@@ -0,0 +1,107 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#ifdef HYDROGEN_HAVE_NUMA
+#include <numa.h>
+#endif
+
+namespace {
+
+unsigned defaultCPUMemoryMode = El::CPU_MEMORY_DEFAULT;
+
+}
+
+namespace El {
+
+unsigned DefaultCPUMemoryMode() EL_NO_EXCEPT
+{ return ::defaultCPUMemoryMode; }
+
+void SetDefaultCPUMemoryMode( unsigned mode )
+{
+    EL_DEBUG_CSE
+#ifndef HYDROGEN_HAVE_CUDA
+    if( mode == CPU_MEMORY_PINNED )
+        LogicError("Page-locked memory requires CUDA");
+#endif
+    if( mode >= CPU_MEMORY_BOUND &&
+        int(mode-CPU_MEMORY_BOUND) >= numa::NumDomains() )
+        LogicError
+        ("Cannot bind to NUMA domain ",mode-CPU_MEMORY_BOUND," of ",
+         numa::NumDomains());
+    ::defaultCPUMemoryMode = mode;
+}
+
+namespace numa {
+
+bool Available() EL_NO_EXCEPT
+{
+#ifdef HYDROGEN_HAVE_NUMA
+    return numa_available() >= 0;
+#else
+    return false;
+#endif
+}
+
+int NumDomains() EL_NO_EXCEPT
+{
+#ifdef HYDROGEN_HAVE_NUMA
+    if( Available() )
+        return numa_max_node() + 1;
+#endif
+    return 1;
+}
+
+void* Allocate( size_t numBytes, unsigned mode )
+{
+    void* ptr = nullptr;
+#ifdef HYDROGEN_HAVE_NUMA
+    if( Available() )
+    {
+        if( mode == CPU_MEMORY_INTERLEAVED )
+            ptr = numa_alloc_interleaved( numBytes );
+        else if( mode >= CPU_MEMORY_BOUND )
+        {
+            const int domain = mode - CPU_MEMORY_BOUND;
+            if( domain >= NumDomains() )
+                LogicError
+                ("Cannot bind to NUMA domain ",domain," of ",NumDomains());
+            ptr = numa_alloc_onnode( numBytes, domain );
+        }
+        else
+            // The pages are untouched, so the default (local) policy yields
+            // first-touch placement
+            ptr = numa_alloc( numBytes );
+        if( ptr == nullptr )
+            throw std::bad_alloc();
+        return ptr;
+    }
+#endif
+    // Large requests are served by fresh (untouched) pages from the system
+    ptr = ::operator new( numBytes );
+    return ptr;
+}
+
+void Free( void* ptr, size_t numBytes ) EL_NO_EXCEPT
+{
+    if( ptr == nullptr )
+        return;
+#ifdef HYDROGEN_HAVE_NUMA
+    if( Available() )
+    {
+        numa_free( ptr, numBytes );
+        return;
+    }
+#endif
+    ::operator delete( ptr );
+}
+
+} // namespace numa
+
+} // namespace El
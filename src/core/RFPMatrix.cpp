@@ -0,0 +1,310 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+namespace El {
+
+namespace rfp {
+
+// The dimensions of the packed buffer and the rows and columns of each of
+// its blocks for an n x n matrix (see the description in RFPMatrix.hpp)
+
+inline Int PackedHeight( Int n ) EL_NO_EXCEPT
+{ return ( n % 2 == 0 ? n+1 : n ); }
+
+inline Int PackedWidth( Int n ) EL_NO_EXCEPT
+{ return n - n/2; }
+
+inline Range<Int> Rows11( Int n ) EL_NO_EXCEPT
+{
+    const Int offset = ( n % 2 == 0 ? 1 : 0 );
+    return IR(offset,offset+n-n/2);
+}
+
+inline Range<Int> Rows21( Int n ) EL_NO_EXCEPT
+{
+    const Int offset = ( n % 2 == 0 ? 1 : 0 );
+    return IR(offset+n-n/2,offset+n);
+}
+
+inline Range<Int> Rows22( Int n ) EL_NO_EXCEPT
+{ return IR(0,n/2); }
+
+inline Range<Int> Cols22( Int n ) EL_NO_EXCEPT
+{ return IR(n-2*(n/2),n-n/2); }
+
+// Return the location of entry (i,j), with i >= j, of the lower triangle
+// within the packed buffer, and whether it is stored conjugated
+inline bool PackedLocation
+( Int n, Int i, Int j, Int& iPacked, Int& jPacked ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_ONLY(
+      if( i < j || j < 0 || i >= n )
+          LogicError("Invalid lower-triangular entry (",i,",",j,")");
+    )
+    const Int n1 = n - n/2;
+    const Int n2 = n/2;
+    if( j < n1 )
+    {
+        iPacked = i + ( n % 2 == 0 ? 1 : 0 );
+        jPacked = j;
+        return false;
+    }
+    else
+    {
+        iPacked = j - n1;
+        jPacked = i - n2;
+        return true;
+    }
+}
+
+} // namespace rfp
+
+// RFPMatrix
+// =========
+
+template<typename T>
+RFPMatrix<T>::RFPMatrix() { }
+
+template<typename T>
+RFPMatrix<T>::RFPMatrix( Int n )
+{
+    EL_DEBUG_CSE
+    Resize( n );
+}
+
+template<typename T>
+RFPMatrix<T>::RFPMatrix( const RFPMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    *this = A;
+}
+
+template<typename T>
+RFPMatrix<T>::~RFPMatrix() { }
+
+template<typename T>
+const RFPMatrix<T>& RFPMatrix<T>::operator=( const RFPMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    n_ = A.n_;
+    packed_ = A.packed_;
+    return *this;
+}
+
+template<typename T>
+void RFPMatrix<T>::Empty( bool freeMemory )
+{
+    EL_DEBUG_CSE
+    n_ = 0;
+    packed_.Empty( freeMemory );
+}
+
+template<typename T>
+void RFPMatrix<T>::Resize( Int n )
+{
+    EL_DEBUG_CSE
+    if( n < 0 )
+        LogicError("Invalid RFP matrix size: ",n);
+    n_ = n;
+    packed_.Resize( rfp::PackedHeight(n), rfp::PackedWidth(n) );
+}
+
+template<typename T>
+Int RFPMatrix<T>::Height() const EL_NO_EXCEPT { return n_; }
+template<typename T>
+Int RFPMatrix<T>::Width() const EL_NO_EXCEPT { return n_; }
+template<typename T>
+Int RFPMatrix<T>::FirstSize() const EL_NO_EXCEPT { return n_ - n_/2; }
+template<typename T>
+Int RFPMatrix<T>::SecondSize() const EL_NO_EXCEPT { return n_/2; }
+
+template<typename T>
+Matrix<T>& RFPMatrix<T>::Packed() EL_NO_EXCEPT { return packed_; }
+template<typename T>
+const Matrix<T>& RFPMatrix<T>::LockedPacked() const EL_NO_EXCEPT
+{ return packed_; }
+
+template<typename T>
+Matrix<T> RFPMatrix<T>::Block11()
+{ return View( packed_, rfp::Rows11(n_), IR(0,FirstSize()) ); }
+template<typename T>
+Matrix<T> RFPMatrix<T>::Block21()
+{ return View( packed_, rfp::Rows21(n_), IR(0,FirstSize()) ); }
+template<typename T>
+Matrix<T> RFPMatrix<T>::Block22()
+{ return View( packed_, rfp::Rows22(n_), rfp::Cols22(n_) ); }
+
+template<typename T>
+Matrix<T> RFPMatrix<T>::LockedBlock11() const
+{ return LockedView( packed_, rfp::Rows11(n_), IR(0,FirstSize()) ); }
+template<typename T>
+Matrix<T> RFPMatrix<T>::LockedBlock21() const
+{ return LockedView( packed_, rfp::Rows21(n_), IR(0,FirstSize()) ); }
+template<typename T>
+Matrix<T> RFPMatrix<T>::LockedBlock22() const
+{ return LockedView( packed_, rfp::Rows22(n_), rfp::Cols22(n_) ); }
+
+template<typename T>
+T RFPMatrix<T>::Get( Int i, Int j ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    if( i < j )
+        return Conj( Get( j, i ) );
+    Int iPacked, jPacked;
+    const bool conjugated = rfp::PackedLocation( n_, i, j, iPacked, jPacked );
+    const T value = packed_.Get( iPacked, jPacked );
+    return ( conjugated ? Conj(value) : value );
+}
+
+template<typename T>
+void RFPMatrix<T>::Set( Int i, Int j, T alpha ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    if( i < j )
+    {
+        Set( j, i, Conj(alpha) );
+        return;
+    }
+    Int iPacked, jPacked;
+    const bool conjugated = rfp::PackedLocation( n_, i, j, iPacked, jPacked );
+    packed_.Set( iPacked, jPacked, conjugated ? Conj(alpha) : alpha );
+}
+
+// DistRFPMatrix
+// =============
+
+template<typename T>
+DistRFPMatrix<T>::DistRFPMatrix( const El::Grid& grid )
+: packed_(grid)
+{ }
+
+template<typename T>
+DistRFPMatrix<T>::DistRFPMatrix( Int n, const El::Grid& grid )
+: packed_(grid)
+{
+    EL_DEBUG_CSE
+    Resize( n );
+}
+
+template<typename T>
+DistRFPMatrix<T>::DistRFPMatrix( const DistRFPMatrix<T>& A )
+: packed_(A.Grid())
+{
+    EL_DEBUG_CSE
+    *this = A;
+}
+
+template<typename T>
+DistRFPMatrix<T>::~DistRFPMatrix() { }
+
+template<typename T>
+const DistRFPMatrix<T>&
+DistRFPMatrix<T>::operator=( const DistRFPMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    n_ = A.n_;
+    packed_ = A.packed_;
+    return *this;
+}
+
+template<typename T>
+void DistRFPMatrix<T>::Empty( bool freeMemory )
+{
+    EL_DEBUG_CSE
+    n_ = 0;
+    packed_.Empty( freeMemory );
+}
+
+template<typename T>
+void DistRFPMatrix<T>::Resize( Int n )
+{
+    EL_DEBUG_CSE
+    if( n < 0 )
+        LogicError("Invalid RFP matrix size: ",n);
+    n_ = n;
+    packed_.Resize( rfp::PackedHeight(n), rfp::PackedWidth(n) );
+}
+
+template<typename T>
+Int DistRFPMatrix<T>::Height() const EL_NO_EXCEPT { return n_; }
+template<typename T>
+Int DistRFPMatrix<T>::Width() const EL_NO_EXCEPT { return n_; }
+template<typename T>
+Int DistRFPMatrix<T>::FirstSize() const EL_NO_EXCEPT { return n_ - n_/2; }
+template<typename T>
+Int DistRFPMatrix<T>::SecondSize() const EL_NO_EXCEPT { return n_/2; }
+template<typename T>
+const El::Grid& DistRFPMatrix<T>::Grid() const EL_NO_EXCEPT
+{ return packed_.Grid(); }
+
+template<typename T>
+DistMatrix<T>& DistRFPMatrix<T>::Packed() EL_NO_EXCEPT { return packed_; }
+template<typename T>
+const DistMatrix<T>& DistRFPMatrix<T>::LockedPacked() const EL_NO_EXCEPT
+{ return packed_; }
+
+template<typename T>
+DistMatrix<T> DistRFPMatrix<T>::Block11()
+{ return View( packed_, rfp::Rows11(n_), IR(0,FirstSize()) ); }
+template<typename T>
+DistMatrix<T> DistRFPMatrix<T>::Block21()
+{ return View( packed_, rfp::Rows21(n_), IR(0,FirstSize()) ); }
+template<typename T>
+DistMatrix<T> DistRFPMatrix<T>::Block22()
+{ return View( packed_, rfp::Rows22(n_), rfp::Cols22(n_) ); }
+
+template<typename T>
+DistMatrix<T> DistRFPMatrix<T>::LockedBlock11() const
+{ return LockedView( packed_, rfp::Rows11(n_), IR(0,FirstSize()) ); }
+template<typename T>
+DistMatrix<T> DistRFPMatrix<T>::LockedBlock21() const
+{ return LockedView( packed_, rfp::Rows21(n_), IR(0,FirstSize()) ); }
+template<typename T>
+DistMatrix<T> DistRFPMatrix<T>::LockedBlock22() const
+{ return LockedView( packed_, rfp::Rows22(n_), rfp::Cols22(n_) ); }
+
+template<typename T>
+T DistRFPMatrix<T>::Get( Int i, Int j ) const
+{
+    EL_DEBUG_CSE
+    if( i < j )
+        return Conj( Get( j, i ) );
+    Int iPacked, jPacked;
+    const bool conjugated = rfp::PackedLocation( n_, i, j, iPacked, jPacked );
+    const T value = packed_.Get( iPacked, jPacked );
+    return ( conjugated ? Conj(value) : value );
+}
+
+template<typename T>
+void DistRFPMatrix<T>::Set( Int i, Int j, T alpha )
+{
+    EL_DEBUG_CSE
+    if( i < j )
+    {
+        Set( j, i, Conj(alpha) );
+        return;
+    }
+    Int iPacked, jPacked;
+    const bool conjugated = rfp::PackedLocation( n_, i, j, iPacked, jPacked );
+    packed_.Set( iPacked, jPacked, conjugated ? Conj(alpha) : alpha );
+}
+
+#define PROTO(T) \
+  template class RFPMatrix<T>; \
+  template class DistRFPMatrix<T>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,297 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <algorithm>
+
+namespace El {
+
+// Constructors and destructors
+// ============================
+
+template<typename T>
+SparseMatrix<T>::SparseMatrix() { }
+
+template<typename T>
+SparseMatrix<T>::SparseMatrix( Int height, Int width )
+: graph_(height,width)
+{ }
+
+template<typename T>
+SparseMatrix<T>::SparseMatrix( const SparseMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    *this = A;
+}
+
+template<typename T>
+SparseMatrix<T>::~SparseMatrix() { }
+
+// Assignment and reconfiguration
+// ==============================
+
+template<typename T>
+const SparseMatrix<T>& SparseMatrix<T>::operator=( const SparseMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    graph_ = A.graph_;
+    vals_ = A.vals_;
+    return *this;
+}
+
+template<typename T>
+void SparseMatrix<T>::Empty( bool freeMemory )
+{
+    EL_DEBUG_CSE
+    graph_.Empty( freeMemory );
+    if( freeMemory )
+        SwapClear( vals_ );
+    else
+        vals_.resize( 0 );
+}
+
+template<typename T>
+void SparseMatrix<T>::SoftEmpty()
+{
+    EL_DEBUG_CSE
+    graph_.SoftEmpty();
+    vals_.resize( 0 );
+}
+
+template<typename T>
+void SparseMatrix<T>::Resize( Int height, Int width )
+{
+    EL_DEBUG_CSE
+    if( Height() == height && Width() == width )
+        return;
+    graph_.Resize( height, width );
+    vals_.resize( 0 );
+}
+
+template<typename T>
+void SparseMatrix<T>::Reserve( Int numEntries )
+{
+    EL_DEBUG_CSE
+    graph_.Reserve( numEntries );
+    vals_.reserve( numEntries );
+}
+
+template<typename T>
+void SparseMatrix<T>::Update( Int row, Int col, T value )
+{
+    EL_DEBUG_CSE
+    QueueUpdate( row, col, value );
+    ProcessQueues();
+}
+
+template<typename T>
+void SparseMatrix<T>::Zero( Int row, Int col )
+{
+    EL_DEBUG_CSE
+    QueueZero( row, col );
+    ProcessQueues();
+}
+
+template<typename T>
+void SparseMatrix<T>::QueueUpdate( Int row, Int col, T value )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    graph_.QueueConnection( row, col );
+    vals_.push_back( value );
+}
+
+template<typename T>
+void SparseMatrix<T>::QueueZero( Int row, Int col )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    graph_.QueueDisconnection( row, col );
+}
+
+template<typename T>
+void SparseMatrix<T>::ProcessQueues()
+{
+    EL_DEBUG_CSE
+    if( graph_.consistent_ )
+        return;
+
+    // Sort the entries by (row,column) and sum any duplicates
+    auto& sources = graph_.sources_;
+    auto& targets = graph_.targets_;
+    const Int numQueued = sources.size();
+    vector<Int> perm( numQueued );
+    for( Int e=0; e<numQueued; ++e )
+        perm[e] = e;
+    std::stable_sort
+    ( perm.begin(), perm.end(),
+      [&]( Int a, Int b )
+      { return sources[a] < sources[b] ||
+               (sources[a] == sources[b] && targets[a] < targets[b]); } );
+
+    vector<Int> newSources, newTargets;
+    vector<T> newVals;
+    newSources.reserve( numQueued );
+    newTargets.reserve( numQueued );
+    newVals.reserve( numQueued );
+    for( Int k=0; k<numQueued; ++k )
+    {
+        const Int e = perm[k];
+        const pair<Int,Int> entry( sources[e], targets[e] );
+        if( graph_.markedForRemoval_.count(entry) )
+            continue;
+        if( !newSources.empty() &&
+            newSources.back() == entry.first &&
+            newTargets.back() == entry.second )
+        {
+            newVals.back() += vals_[e];
+        }
+        else
+        {
+            newSources.push_back( entry.first );
+            newTargets.push_back( entry.second );
+            newVals.push_back( vals_[e] );
+        }
+    }
+    sources.swap( newSources );
+    targets.swap( newTargets );
+    vals_.swap( newVals );
+    graph_.markedForRemoval_.clear();
+
+    graph_.ComputeSourceOffsets();
+    graph_.consistent_ = true;
+}
+
+template<typename T>
+void SparseMatrix<T>::ForceNumEntries( Int numEntries )
+{
+    EL_DEBUG_CSE
+    graph_.ForceNumEdges( numEntries );
+    vals_.resize( numEntries );
+}
+
+template<typename T>
+void SparseMatrix<T>::ForceConsistency( bool consistent ) EL_NO_EXCEPT
+{ graph_.ForceConsistency( consistent ); }
+
+// Queries
+// =======
+
+template<typename T>
+Int SparseMatrix<T>::Height() const EL_NO_EXCEPT
+{ return graph_.NumSources(); }
+
+template<typename T>
+Int SparseMatrix<T>::Width() const EL_NO_EXCEPT
+{ return graph_.NumTargets(); }
+
+template<typename T>
+Int SparseMatrix<T>::NumEntries() const EL_NO_EXCEPT
+{ return graph_.NumEdges(); }
+
+template<typename T>
+Int SparseMatrix<T>::Capacity() const EL_NO_EXCEPT
+{ return graph_.Capacity(); }
+
+template<typename T>
+bool SparseMatrix<T>::Consistent() const EL_NO_EXCEPT
+{ return graph_.Consistent(); }
+
+template<typename T>
+El::Graph& SparseMatrix<T>::Graph() EL_NO_EXCEPT
+{ return graph_; }
+
+template<typename T>
+const El::Graph& SparseMatrix<T>::LockedGraph() const EL_NO_EXCEPT
+{ return graph_; }
+
+template<typename T>
+Int SparseMatrix<T>::Row( Int index ) const EL_NO_RELEASE_EXCEPT
+{ return graph_.Source( index ); }
+
+template<typename T>
+Int SparseMatrix<T>::Col( Int index ) const EL_NO_RELEASE_EXCEPT
+{ return graph_.Target( index ); }
+
+template<typename T>
+T SparseMatrix<T>::Value( Int index ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( index < 0 || index >= Int(vals_.size()) )
+          LogicError("Entry number out of bounds");
+    )
+    return vals_[index];
+}
+
+template<typename T>
+Int SparseMatrix<T>::RowOffset( Int row ) const EL_NO_RELEASE_EXCEPT
+{ return graph_.SourceOffset( row ); }
+
+template<typename T>
+Int SparseMatrix<T>::Offset( Int row, Int col ) const EL_NO_RELEASE_EXCEPT
+{ return graph_.Offset( row, col ); }
+
+template<typename T>
+Int SparseMatrix<T>::NumConnections( Int row ) const EL_NO_RELEASE_EXCEPT
+{ return graph_.NumConnections( row ); }
+
+template<typename T>
+T SparseMatrix<T>::Get( Int row, Int col ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const Int index = Offset( row, col );
+    if( index == RowOffset(row+1) || Col(index) != col )
+        return T(0);
+    return vals_[index];
+}
+
+template<typename T>
+Int* SparseMatrix<T>::SourceBuffer() EL_NO_EXCEPT
+{ return graph_.SourceBuffer(); }
+template<typename T>
+Int* SparseMatrix<T>::TargetBuffer() EL_NO_EXCEPT
+{ return graph_.TargetBuffer(); }
+template<typename T>
+Int* SparseMatrix<T>::OffsetBuffer() EL_NO_EXCEPT
+{ return graph_.OffsetBuffer(); }
+template<typename T>
+T* SparseMatrix<T>::ValueBuffer() EL_NO_EXCEPT
+{ return vals_.data(); }
+
+template<typename T>
+const Int* SparseMatrix<T>::LockedSourceBuffer() const EL_NO_EXCEPT
+{ return graph_.LockedSourceBuffer(); }
+template<typename T>
+const Int* SparseMatrix<T>::LockedTargetBuffer() const EL_NO_EXCEPT
+{ return graph_.LockedTargetBuffer(); }
+template<typename T>
+const Int* SparseMatrix<T>::LockedOffsetBuffer() const EL_NO_EXCEPT
+{ return graph_.LockedOffsetBuffer(); }
+template<typename T>
+const T* SparseMatrix<T>::LockedValueBuffer() const EL_NO_EXCEPT
+{ return vals_.data(); }
+
+template<typename T>
+void SparseMatrix<T>::AssertConsistent() const
+{
+    if( !graph_.Consistent() )
+        LogicError("Sparse matrix was not consistent; run ProcessQueues()");
+}
+
+#define PROTO(T) template class SparseMatrix<T>;
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,156 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+namespace {
+
+std::unique_ptr<El::CPUStream> progressStream;
+std::mutex progressStreamMutex;
+
+}
+
+namespace El {
+
+CPUStream::CPUStream( Int numThreads )
+: numThreads_(numThreads)
+{
+    EL_DEBUG_CSE
+    if( numThreads < 1 )
+        LogicError("Streams require at least one thread");
+    worker_ = std::thread( [this]() { Run(); } );
+}
+
+CPUStream::~CPUStream()
+{
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        stopping_ = true;
+    }
+    pending_.notify_one();
+    worker_.join();
+}
+
+Int CPUStream::NumThreads() const EL_NO_EXCEPT { return numThreads_; }
+
+void CPUStream::Launch( std::function<void()> function )
+{
+    EL_DEBUG_CSE
+    Push
+    ( [this,function]()
+      {
+          try { function(); }
+          catch( ... )
+          {
+              std::lock_guard<std::mutex> lock( mutex_ );
+              if( !error_ )
+                  error_ = std::current_exception();
+          }
+      } );
+}
+
+void CPUStream::Record( CPUEvent& event )
+{
+    EL_DEBUG_CSE
+    event.marker_ = Enqueue( [](){} ).share();
+}
+
+void CPUStream::Wait( const CPUEvent& event )
+{
+    EL_DEBUG_CSE
+    if( event.Query() )
+        return;
+    auto marker = event.marker_;
+    Push( [marker]() { marker.wait(); } );
+}
+
+void CPUStream::Synchronize()
+{
+    EL_DEBUG_CSE
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock( mutex_ );
+        idle_.wait( lock, [this]() { return queue_.empty() && !busy_; } );
+        std::swap( error, error_ );
+    }
+    if( error )
+        std::rethrow_exception( error );
+}
+
+bool CPUStream::Query() const
+{
+    std::lock_guard<std::mutex> lock( mutex_ );
+    return queue_.empty() && !busy_;
+}
+
+void CPUStream::Push( std::function<void()> function )
+{
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        if( stopping_ )
+            LogicError("Cannot enqueue work on a stream being destroyed");
+        queue_.push_back( std::move(function) );
+    }
+    pending_.notify_one();
+}
+
+void CPUStream::Run()
+{
+#ifdef EL_HYBRID
+    omp_set_num_threads( numThreads_ );
+#endif
+    std::unique_lock<std::mutex> lock( mutex_ );
+    while( true )
+    {
+        pending_.wait
+        ( lock, [this]() { return stopping_ || !queue_.empty(); } );
+        if( queue_.empty() )
+            break;
+        auto function = std::move(queue_.front());
+        queue_.pop_front();
+        busy_ = true;
+        lock.unlock();
+        // Exceptions are captured by the futures and by Launch
+        function();
+        lock.lock();
+        busy_ = false;
+        if( queue_.empty() )
+            idle_.notify_all();
+    }
+}
+
+CPUStream& ProgressStream()
+{
+    std::lock_guard<std::mutex> lock( ::progressStreamMutex );
+    if( !::progressStream )
+        ::progressStream.reset( new CPUStream );
+    return *::progressStream;
+}
+
+void DestroyProgressStream()
+{
+    std::lock_guard<std::mutex> lock( ::progressStreamMutex );
+    ::progressStream.reset();
+}
+
+namespace mpi {
+
+void AssertThreadSupport()
+{
+    // The calling thread keeps communicating while the stream does, so
+    // serialized support is not enough
+    if( QueryThread() < THREAD_MULTIPLE )
+        LogicError
+        ("MPI must be initialized with THREAD_MULTIPLE support to "
+         "communicate from a stream (e.g., by configuring with "
+         "Hydrogen_USE_MPI_THREAD_MULTIPLE=ON)");
+}
+
+} // namespace mpi
+
+} // namespace El
@@ -0,0 +1,180 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+namespace El {
+
+template<typename T>
+Workspace<T>::Workspace() { }
+
+template<typename T>
+Workspace<T>::Workspace( Int numEntries )
+{ Reserve( numEntries ); }
+
+template<typename T>
+void Workspace<T>::Reserve( Int numEntries )
+{
+    EL_DEBUG_CSE
+    if( numEntries < 0 )
+        LogicError("Cannot reserve a negative number of entries");
+    target_ = Max( target_, InUse()+numEntries );
+    if( numScopes_ == 0 )
+        Grow();
+}
+
+template<typename T>
+void Workspace<T>::Empty()
+{
+    EL_DEBUG_CSE
+    if( numScopes_ != 0 )
+        LogicError("Cannot empty a workspace with open scopes");
+    arena_.Empty();
+    offset_ = 0;
+    peak_ = 0;
+    target_ = 0;
+}
+
+template<typename T>
+Int Workspace<T>::Capacity() const EL_NO_EXCEPT
+{ return Int(arena_.Size()); }
+
+template<typename T>
+Int Workspace<T>::InUse() const EL_NO_EXCEPT
+{ return offset_ + overflowSize_; }
+
+template<typename T>
+Int Workspace<T>::Peak() const EL_NO_EXCEPT
+{ return peak_; }
+
+template<typename T>
+Int Workspace<T>::NumAllocations() const EL_NO_EXCEPT
+{ return numAllocations_; }
+
+template<typename T>
+T* Workspace<T>::Require( Int numEntries )
+{
+    EL_DEBUG_CSE
+    if( numScopes_ == 0 )
+        LogicError("Workspace entries must be required within a scope");
+    if( numEntries < 0 )
+        LogicError("Cannot require a negative number of entries");
+
+    T* buffer;
+    if( offset_+numEntries <= Capacity() )
+    {
+        buffer = arena_.Buffer() + offset_;
+        offset_ += numEntries;
+    }
+    else
+    {
+        // Earlier requests may still be attached, so the arena cannot move
+        overflow_.emplace_back( numEntries );
+        ++numAllocations_;
+        overflowSize_ += numEntries;
+        buffer = overflow_.back().Buffer();
+    }
+    peak_ = Max( peak_, InUse() );
+    return buffer;
+}
+
+template<typename T>
+void Workspace<T>::Attach( Matrix<T>& A, Int height, Int width )
+{
+    EL_DEBUG_CSE
+    const Int ldim = Max(height,Int(1));
+    A.Attach( height, width, Require(ldim*width), ldim );
+}
+
+template<typename T>
+void Workspace<T>::Attach( ElementalMatrix<T>& A, Int height, Int width )
+{
+    EL_DEBUG_CSE
+    // Drop any previous view (and its alignments) without freeing memory
+    A.Empty( false );
+    AttachLocal( A, height, width );
+}
+
+template<typename T>
+void Workspace<T>::Attach
+( ElementalMatrix<T>& A, Int height, Int width, const El::DistData& data )
+{
+    EL_DEBUG_CSE
+    A.Empty( false );
+    A.AlignWith( data );
+    AttachLocal( A, height, width );
+}
+
+template<typename T>
+void Workspace<T>::AttachLocal( ElementalMatrix<T>& A, Int height, Int width )
+{
+    EL_DEBUG_CSE
+    Int localHeight=0, localWidth=0;
+    if( A.Participating() )
+    {
+        localHeight = Length( height, A.ColShift(), A.ColStride() );
+        localWidth = Length( width, A.RowShift(), A.RowStride() );
+    }
+    const Int ldim = Max(localHeight,Int(1));
+    A.Attach
+    ( height, width, A.Grid(), A.ColAlign(), A.RowAlign(),
+      Require(ldim*localWidth), ldim, A.Root() );
+}
+
+template<typename T>
+void Workspace<T>::Release( Int offset, Int numOverflow )
+{
+    EL_DEBUG_CSE
+    offset_ = offset;
+    while( Int(overflow_.size()) > numOverflow )
+    {
+        overflowSize_ -= Int(overflow_.back().Size());
+        overflow_.pop_back();
+    }
+    --numScopes_;
+    if( numScopes_ == 0 )
+    {
+        // This is called from a destructor; if the regrowth fails, later
+        // requests are simply served from overflow blocks
+        try { Grow(); }
+        catch( std::bad_alloc& ) { }
+    }
+}
+
+template<typename T>
+void Workspace<T>::Grow()
+{
+    EL_DEBUG_CSE
+    const Int capacity = Max( peak_, target_ );
+    if( capacity > Capacity() )
+    {
+        arena_.Require( capacity );
+        ++numAllocations_;
+    }
+}
+
+template<typename T>
+Workspace<T>::Scope::Scope( Workspace<T>& workspace )
+: workspace_(workspace),
+  offset_(workspace.offset_),
+  numOverflow_(Int(workspace.overflow_.size()))
+{ ++workspace_.numScopes_; }
+
+template<typename T>
+Workspace<T>::Scope::~Scope()
+{ workspace_.Release( offset_, numOverflow_ ); }
+
+#define PROTO(T) template class Workspace<T>;
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
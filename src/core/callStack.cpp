@@ -13,7 +13,8 @@ namespace {
 
 // Debugging
 #ifndef EL_RELEASE
-  std::stack<std::string> callStack;
+  // Each thread (e.g., the worker of a CPUStream) has its own stack
+  thread_local std::stack<std::string> callStack;
   bool tracingEnabled = false;
 #endif // !EL_RELEASE
 
@@ -8,6 +8,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include "./imports/mpi_hierarchical.hpp"
 
 #include <algorithm>
 #include <set>
@@ -48,6 +49,11 @@ void PrintConfig( ostream& os )
 #else
       "  Hybrid mode:                  NO\n"
 #endif
+#ifdef HYDROGEN_HAVE_NUMA
+      "  Have libnuma:                 YES\n"
+#else
+      "  Have libnuma:                 NO\n"
+#endif
 #ifdef EL_HAVE_QT5
       "  Have Qt5:                     YES\n"
 #else
@@ -161,6 +167,10 @@ void Initialize( int& argc, char**& argv )
             cerr << "WARNING: Could not achieve THREAD_MULTIPLE support."
                  << endl;
         }
+#elif defined(EL_USE_MPI_THREAD_MULTIPLE)
+        // Allow communication from CPU streams concurrently with the calling
+        // thread (streams check the provided level before communicating)
+        mpi::InitializeThread( argc, argv, mpi::THREAD_MULTIPLE );
 #else
         mpi::Initialize( argc, argv );
 #endif
@@ -222,9 +232,15 @@ void Finalize()
         delete ::args;
         ::args = 0;
 
+        // Drain any outstanding requests before tearing down MPI
+        DestroyProgressStream();
+
         Grid::FinalizeDefault();
         Grid::FinalizeTrivial();
 
+        // Free the node-level communicators and shared windows
+        mpi::hierarchical::Finalize();
+
         // Destroy the types and ops
         mpi::DestroyCustom();
 
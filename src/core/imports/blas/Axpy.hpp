@@ -53,6 +53,16 @@ template void Axpy
   const Int& alpha,
   const Int* x, BlasInt incx,
         Int* y, BlasInt incy );
+template void Axpy
+( BlasInt n,
+  const Half& alpha,
+  const Half* x, BlasInt incx,
+        Half* y, BlasInt incy );
+template void Axpy
+( BlasInt n,
+  const BFloat16& alpha,
+  const BFloat16* x, BlasInt incx,
+        BFloat16* y, BlasInt incy );
 #ifdef HYDROGEN_HAVE_QD
 template void Axpy
 ( BlasInt n,
@@ -44,6 +44,14 @@ template void Copy
 ( BlasInt n,
   const Int* x, BlasInt incx,
         Int* y, BlasInt incy );
+template void Copy
+( BlasInt n,
+  const Half* x, BlasInt incx,
+        Half* y, BlasInt incy );
+template void Copy
+( BlasInt n,
+  const BFloat16* x, BlasInt incx,
+        BFloat16* y, BlasInt incy );
 #ifdef HYDROGEN_HAVE_QD
 template void Copy
 ( BlasInt n,
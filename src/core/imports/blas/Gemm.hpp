@@ -513,5 +513,119 @@ void Gemm
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
 
+namespace {
+
+template<typename T>
+void WidenBlock
+( BlasInt height, BlasInt width,
+  const T* A, BlasInt ALDim, float* AFloat )
+{
+    for( BlasInt j=0; j<width; ++j )
+        Widen( height, &A[j*ALDim], &AFloat[j*height] );
+}
+
+// The 16-bit formats are multiplied by widening blocks of the operands into
+// single-precision workspace and handing them to sgemm, so that every product
+// and the entire length-k accumulation happen in float and each entry of C
+// is rounded to 16 bits exactly once.
+template<typename T>
+void WidenedGemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+  const T& beta,
+        T* C, BlasInt CLDim )
+{
+    EL_DEBUG_CSE
+    const bool normalA = ( std::toupper(transA) == 'N' );
+    const bool normalB = ( std::toupper(transB) == 'N' );
+    const BlasInt blocksize = 256;
+    const float alphaFloat = alpha;
+    const float betaFloat = beta;
+
+    std::vector<float> AFloat, BFloat, CFloat;
+    for( BlasInt j=0; j<n; j+=blocksize )
+    {
+        const BlasInt nb = Min(blocksize,n-j);
+
+        CFloat.resize( m*nb );
+        for( BlasInt jj=0; jj<nb; ++jj )
+        {
+            const T* cCol = &C[(j+jj)*CLDim];
+            float* cFloatCol = &CFloat[jj*m];
+            if( betaFloat == 0.f )
+                for( BlasInt i=0; i<m; ++i )
+                    cFloatCol[i] = 0;
+            else
+                for( BlasInt i=0; i<m; ++i )
+                    cFloatCol[i] = betaFloat*float(cCol[i]);
+        }
+
+        for( BlasInt l=0; l<k; l+=blocksize )
+        {
+            const BlasInt kb = Min(blocksize,k-l);
+
+            // Widen the kb-wide panel of op(A) and the kb x nb block of op(B)
+            if( normalA )
+            {
+                AFloat.resize( m*kb );
+                WidenBlock( m, kb, &A[l*ALDim], ALDim, AFloat.data() );
+            }
+            else
+            {
+                AFloat.resize( kb*m );
+                WidenBlock( kb, m, &A[l], ALDim, AFloat.data() );
+            }
+            if( normalB )
+            {
+                BFloat.resize( kb*nb );
+                WidenBlock( kb, nb, &B[l+j*BLDim], BLDim, BFloat.data() );
+            }
+            else
+            {
+                BFloat.resize( nb*kb );
+                WidenBlock( nb, kb, &B[j+l*BLDim], BLDim, BFloat.data() );
+            }
+
+            Gemm
+            ( transA, transB, m, nb, kb,
+              alphaFloat,
+              AFloat.data(), Max(normalA ? m : kb,1),
+              BFloat.data(), Max(normalB ? kb : nb,1),
+              1.f,
+              CFloat.data(), Max(m,1) );
+        }
+
+        for( BlasInt jj=0; jj<nb; ++jj )
+            Narrow( m, &CFloat[jj*m], &C[(j+jj)*CLDim] );
+    }
+}
+
+} // anonymous namespace
+
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const Half& alpha,
+  const Half* A, BlasInt ALDim,
+  const Half* B, BlasInt BLDim,
+  const Half& beta,
+        Half* C, BlasInt CLDim )
+{ WidenedGemm( transA, transB, m, n, k, alpha, A, ALDim, B, BLDim,
+               beta, C, CLDim ); }
+
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const BFloat16& alpha,
+  const BFloat16* A, BlasInt ALDim,
+  const BFloat16* B, BlasInt BLDim,
+  const BFloat16& beta,
+        BFloat16* C, BlasInt CLDim )
+{ WidenedGemm( transA, transB, m, n, k, alpha, A, ALDim, B, BLDim,
+               beta, C, CLDim ); }
+
 } // namespace blas
 } // namespace El
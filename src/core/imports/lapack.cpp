@@ -342,6 +342,14 @@ template void Copy
 ( char uplo, BlasInt m, BlasInt n,
   const Int* A, BlasInt lda,
         Int* B, BlasInt ldb );
+template void Copy
+( char uplo, BlasInt m, BlasInt n,
+  const Half* A, BlasInt lda,
+        Half* B, BlasInt ldb );
+template void Copy
+( char uplo, BlasInt m, BlasInt n,
+  const BFloat16* A, BlasInt lda,
+        BFloat16* B, BlasInt ldb );
 #ifdef HYDROGEN_HAVE_QD
 template void Copy
 ( char uplo, BlasInt m, BlasInt n,
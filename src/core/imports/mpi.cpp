@@ -13,6 +13,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include "./mpi_hierarchical.hpp"
 
 typedef unsigned char* UCP;
 
@@ -225,6 +226,20 @@ void Split( Comm comm, int color, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT
     EL_CHECK_MPI_NO_DATA( MPI_Comm_split( comm.comm, color, key, &newComm.comm ) );
 }
 
+void SplitShared( Comm comm, int key, Comm& nodeComm ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#if MPI_VERSION >= 3
+    EL_CHECK_MPI_NO_DATA
+    ( MPI_Comm_split_type
+      ( comm.comm, MPI_COMM_TYPE_SHARED, key, MPI_INFO_NULL,
+        &nodeComm.comm ) );
+#else
+    EL_CHECK_MPI_NO_DATA
+    ( MPI_Comm_split( comm.comm, Rank(comm), key, &nodeComm.comm ) );
+#endif
+}
+
 void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
@@ -1116,6 +1131,8 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     if( Size(comm) == 1 || count == 0 )
         return;
+    if( hierarchical::Broadcast( buf, sizeof(Real)*count, root, comm ) )
+        return;
     EL_CHECK_MPI( MPI_Bcast( buf, count, TypeMap<Real>(), root, comm.comm ) );
 }
 
@@ -1125,7 +1142,10 @@ void Broadcast( Complex<Real>* buf, int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
-    if( Size(comm) == 1 )
+    if( Size(comm) == 1 || count == 0 )
+        return;
+    if( hierarchical::Broadcast
+        ( buf, sizeof(Complex<Real>)*count, root, comm ) )
         return;
 #ifdef EL_AVOID_COMPLEX_MPI
     EL_CHECK_MPI( MPI_Bcast( buf, 2*count, TypeMap<Real>(), root, comm.comm ) );
@@ -1467,6 +1487,8 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    if( hierarchical::AllGather( sbuf, rbuf, sizeof(Real)*rc, comm ) )
+        return;
 #ifdef EL_USE_BYTE_ALLGATHERS
     EL_CHECK_MPI
     ( MPI_Allgather
@@ -1491,6 +1513,8 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    if( hierarchical::AllGather( sbuf, rbuf, sizeof(Complex<Real>)*rc, comm ) )
+        return;
 #ifdef EL_USE_BYTE_ALLGATHERS
     EL_CHECK_MPI
     ( MPI_Allgather
@@ -1811,6 +1835,8 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    if( hierarchical::AllToAll( sbuf, rbuf, sizeof(Real)*sc, comm ) )
+        return;
     EL_CHECK_MPI
     ( MPI_Alltoall
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1825,6 +1851,8 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    if( hierarchical::AllToAll( sbuf, rbuf, sizeof(Complex<Real>)*sc, comm ) )
+        return;
 #ifdef EL_AVOID_COMPLEX_MPI
     EL_CHECK_MPI
     ( MPI_Alltoall
@@ -2362,6 +2390,50 @@ void AllReduce( T* buf, int count, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { AllReduce( buf, count, SUM, comm ); }
 
+namespace {
+
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+template<typename T>
+void IAllReduceHelper
+( T* buf, int count, Op op, Comm comm, Request<T>& request, std::true_type )
+{
+    MPI_Op opC = NativeOp<T>( op );
+    EL_CHECK_MPI
+    ( EL_NONBLOCKING_COLL(Iallreduce)
+      ( MPI_IN_PLACE, buf, count, TypeMap<T>(), opC, comm.comm,
+        &request.backend ) );
+}
+#endif
+
+template<typename T>
+void IAllReduceHelper
+( T* buf, int count, Op op, Comm comm, Request<T>& request, std::false_type )
+{ AllReduce( buf, count, op, comm ); }
+
+} // anonymous namespace
+
+// When non-blocking collectives are unavailable (or the datatype is not
+// packed), the reduction is performed immediately and a null request is
+// returned. A single template (dispatching on the datatype) is used so that
+// the explicit instantiations for complex types are unambiguous.
+template<typename T>
+void IAllReduce( T* buf, int count, Op op, Comm comm, Request<T>& request )
+{
+    EL_DEBUG_CSE
+    request.backend = MPI_REQUEST_NULL;
+    if( count == 0 || Size(comm) == 1 )
+        return;
+#if !defined(EL_HAVE_NONBLOCKING_COLLECTIVES)
+    typedef std::false_type UseNonblocking;
+#elif defined(EL_AVOID_COMPLEX_MPI)
+    typedef std::integral_constant
+      <bool,IsPacked<T>::value && !IsComplex<T>::value> UseNonblocking;
+#else
+    typedef std::integral_constant<bool,IsPacked<T>::value> UseNonblocking;
+#endif
+    IAllReduceHelper( buf, count, op, comm, request, UseNonblocking() );
+}
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void ReduceScatter( Real* sbuf, Real* rbuf, int rc, Op op, Comm comm )
@@ -2370,6 +2442,9 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     if( rc == 0 )
         return;
+    if( hierarchical::ReduceScatter
+        ( sbuf, rbuf, rc, TypeMap<Real>(), NativeOp<Real>(op), comm ) )
+        return;
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
     const int commRank = Rank( comm );
@@ -2396,6 +2471,16 @@ EL_NO_RELEASE_EXCEPT
     EL_DEBUG_CSE
     if( rc == 0 )
         return;
+#ifdef EL_AVOID_COMPLEX_MPI
+    if( hierarchical::ReduceScatter
+        ( sbuf, rbuf, 2*rc, TypeMap<Real>(), NativeOp<Real>(op), comm ) )
+        return;
+#else
+    if( hierarchical::ReduceScatter
+        ( sbuf, rbuf, rc, TypeMap<Complex<Real>>(),
+          NativeOp<Complex<Real>>(op), comm ) )
+        return;
+#endif
 
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
@@ -2856,6 +2941,25 @@ EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(VerifySendsAndRecvs( sendCounts, recvCounts, comm ))
+    if( IsPacked<T>::value && HierarchicalCollectives() )
+    {
+        const int commSize = Size( comm );
+        vector<int> sendByteCounts(commSize), sendByteDispls(commSize),
+                    recvByteCounts(commSize), recvByteDispls(commSize);
+        for( int q=0; q<commSize; ++q )
+        {
+            sendByteCounts[q] = sizeof(T)*sendCounts[q];
+            sendByteDispls[q] = sizeof(T)*sendDispls[q];
+            recvByteCounts[q] = sizeof(T)*recvCounts[q];
+            recvByteDispls[q] = sizeof(T)*recvDispls[q];
+        }
+        if( hierarchical::AllToAll
+            ( sendBuffer.data(),
+              sendByteCounts.data(), sendByteDispls.data(),
+              recvBuffer.data(),
+              recvByteCounts.data(), recvByteDispls.data(), comm ) )
+            return;
+    }
 #ifdef EL_USE_CUSTOM_ALLTOALLV
     const int commSize = Size( comm );
     int numSends=0,numRecvs=0;
@@ -3042,6 +3146,8 @@ EL_NO_RELEASE_EXCEPT
   EL_NO_RELEASE_EXCEPT; \
   template void AllReduce( T* buf, int count, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IAllReduce \
+  ( T* buf, int count, Op op, Comm comm, Request<T>& request ); \
   template void ReduceScatter( T* sbuf, T* rbuf, int rc, Op op, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void ReduceScatter( T* sbuf, T* rbuf, int rc, Comm comm ) \
@@ -3096,6 +3202,12 @@ MPI_PROTO(ValueInt<double>)
 MPI_PROTO(ValueInt<Complex<double>>)
 MPI_PROTO(Entry<double>)
 MPI_PROTO(Entry<Complex<double>>)
+MPI_PROTO(Half)
+MPI_PROTO(ValueInt<Half>)
+MPI_PROTO(Entry<Half>)
+MPI_PROTO(BFloat16)
+MPI_PROTO(ValueInt<BFloat16>)
+MPI_PROTO(Entry<BFloat16>)
 #ifdef HYDROGEN_HAVE_QD
 MPI_PROTO(DoubleDouble)
 MPI_PROTO(QuadDouble)
@@ -3145,6 +3257,7 @@ MPI_PROTO(Entry<Complex<BigFloat>>)
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGINT
 #define EL_ENABLE_BIGFLOAT
+#define EL_ENABLE_HALF
 #include <El/macros/Instantiate.h>
 
 } // namespace mpi
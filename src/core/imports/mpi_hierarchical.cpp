@@ -0,0 +1,513 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include "./mpi_hierarchical.hpp"
+
+#include <algorithm>
+#include <mutex>
+
+// Device buffers cannot be staged through host shared memory
+#if MPI_VERSION >= 3 && !defined(HYDROGEN_HAVE_CUDA_AWARE_MPI)
+# define EL_HIERARCHICAL_SUPPORTED
+#endif
+
+namespace {
+
+#ifdef EL_USE_HIERARCHICAL_COLLECTIVES
+bool hierarchicalCollectives = true;
+#else
+bool hierarchicalCollectives = false;
+#endif
+
+}
+
+namespace El {
+namespace mpi {
+
+void SetHierarchicalCollectives( bool enable ) EL_NO_EXCEPT
+{ ::hierarchicalCollectives = enable; }
+
+bool HierarchicalCollectives() EL_NO_EXCEPT
+{ return ::hierarchicalCollectives; }
+
+namespace hierarchical {
+
+#ifdef EL_HIERARCHICAL_SUPPORTED
+
+namespace {
+
+// The node-level decomposition of a communicator, which is cached as an
+// attribute of the communicator (and freed along with it)
+struct Hierarchy
+{
+    bool applicable=false;
+    MPI_Comm comm=MPI_COMM_NULL;
+
+    MPI_Comm nodeComm=MPI_COMM_NULL, leaderComm=MPI_COMM_NULL;
+    int nodeRank=0, nodeSize=1;
+    int node=0, numNodes=1;
+
+    // The shared segment is allocated by the leader and grown on demand
+    MPI_Win window=MPI_WIN_NULL;
+    byte* segment=nullptr;
+    size_t capacity=0;
+
+    int CommRank() const { return node*nodeSize + nodeRank; }
+    bool Leader() const { return nodeRank == 0; }
+};
+
+int keyval = MPI_KEYVAL_INVALID;
+// Attached to MPI_COMM_SELF so that the windows are also released if MPI is
+// finalized directly, as its attributes are deleted first by MPI_Finalize
+int finalizeKeyval = MPI_KEYVAL_INVALID;
+std::mutex registryMutex;
+// The hierarchies in order of creation
+vector<Hierarchy*> registry;
+
+inline size_t Align( size_t numBytes )
+{
+    const size_t alignment = 64;
+    return ((numBytes+alignment-1)/alignment)*alignment;
+}
+
+void FreeHierarchy( Hierarchy* h )
+{
+    if( h->window != MPI_WIN_NULL )
+    {
+        MPI_Win_unlock_all( h->window );
+        MPI_Win_free( &h->window );
+    }
+    if( h->leaderComm != MPI_COMM_NULL )
+        MPI_Comm_free( &h->leaderComm );
+    if( h->nodeComm != MPI_COMM_NULL )
+        MPI_Comm_free( &h->nodeComm );
+    {
+        std::lock_guard<std::mutex> lock( registryMutex );
+        auto it = std::find( registry.begin(), registry.end(), h );
+        if( it != registry.end() )
+            registry.erase( it );
+    }
+    delete h;
+}
+
+int DeleteAttribute( MPI_Comm, int, void* attribute, void* )
+{
+    FreeHierarchy( static_cast<Hierarchy*>(attribute) );
+    return MPI_SUCCESS;
+}
+
+void FreeHierarchies()
+{
+    if( keyval == MPI_KEYVAL_INVALID )
+        return;
+    // Deleting in the reverse order of creation keeps the (collective)
+    // frees of the windows consistently ordered across processes
+    vector<Hierarchy*> hierarchies;
+    {
+        std::lock_guard<std::mutex> lock( registryMutex );
+        hierarchies = registry;
+    }
+    for( auto it=hierarchies.rbegin(); it!=hierarchies.rend(); ++it )
+        MPI_Comm_delete_attr( (*it)->comm, keyval );
+    MPI_Comm_free_keyval( &keyval );
+}
+
+int FinalizeAttribute( MPI_Comm, int, void*, void* )
+{
+    FreeHierarchies();
+    return MPI_SUCCESS;
+}
+
+// Return the (collectively constructed) hierarchy of the communicator if the
+// ranks of each node are contiguous and every node has the same number of
+// them, and null otherwise
+Hierarchy* Get( Comm comm )
+{
+    if( !HierarchicalCollectives() )
+        return nullptr;
+    int commSize, commRank;
+    MPI_Comm_size( comm.comm, &commSize );
+    if( commSize == 1 )
+        return nullptr;
+    MPI_Comm_rank( comm.comm, &commRank );
+    {
+        std::lock_guard<std::mutex> lock( registryMutex );
+        if( keyval == MPI_KEYVAL_INVALID )
+            MPI_Comm_create_keyval
+            ( MPI_COMM_NULL_COPY_FN, DeleteAttribute, &keyval, nullptr );
+        if( finalizeKeyval == MPI_KEYVAL_INVALID )
+        {
+            MPI_Comm_create_keyval
+            ( MPI_COMM_NULL_COPY_FN, FinalizeAttribute, &finalizeKeyval,
+              nullptr );
+            MPI_Comm_set_attr( MPI_COMM_SELF, finalizeKeyval, nullptr );
+        }
+    }
+    void* attribute;
+    int found;
+    MPI_Comm_get_attr( comm.comm, keyval, &attribute, &found );
+    if( found )
+    {
+        auto h = static_cast<Hierarchy*>(attribute);
+        return h->applicable ? h : nullptr;
+    }
+
+    auto h = new Hierarchy;
+    h->comm = comm.comm;
+    MPI_Comm_split_type
+    ( comm.comm, MPI_COMM_TYPE_SHARED, commRank, MPI_INFO_NULL,
+      &h->nodeComm );
+    MPI_Comm_rank( h->nodeComm, &h->nodeRank );
+    MPI_Comm_size( h->nodeComm, &h->nodeSize );
+    MPI_Comm_split
+    ( comm.comm, h->Leader() ? 0 : MPI_UNDEFINED, commRank, &h->leaderComm );
+    int nodeInfo[2] = { 0, 0 };
+    if( h->Leader() )
+    {
+        MPI_Comm_rank( h->leaderComm, &nodeInfo[0] );
+        MPI_Comm_size( h->leaderComm, &nodeInfo[1] );
+    }
+    MPI_Bcast( nodeInfo, 2, MPI_INT, 0, h->nodeComm );
+    h->node = nodeInfo[0];
+    h->numNodes = nodeInfo[1];
+
+    // Every rank checks the same table, so the decision is uniform
+    const int info[3] = { h->node, h->nodeRank, h->nodeSize };
+    vector<int> infos( 3*commSize );
+    MPI_Allgather( info, 3, MPI_INT, infos.data(), 3, MPI_INT, comm.comm );
+    const int nodeSize = infos[2];
+    h->applicable = ( nodeSize > 1 && commSize % nodeSize == 0 );
+    for( int q=0; q<commSize; ++q )
+        if( infos[3*q] != q/nodeSize || infos[3*q+1] != q%nodeSize ||
+            infos[3*q+2] != nodeSize )
+            h->applicable = false;
+    if( !h->applicable )
+    {
+        if( h->leaderComm != MPI_COMM_NULL )
+            MPI_Comm_free( &h->leaderComm );
+        MPI_Comm_free( &h->nodeComm );
+    }
+
+    {
+        std::lock_guard<std::mutex> lock( registryMutex );
+        registry.push_back( h );
+    }
+    MPI_Comm_set_attr( comm.comm, keyval, h );
+    return h->applicable ? h : nullptr;
+}
+
+// Order all load/stores to the segment before the barrier with those after
+void NodeBarrier( Hierarchy& h )
+{
+    if( h.window != MPI_WIN_NULL )
+        MPI_Win_sync( h.window );
+    MPI_Barrier( h.nodeComm );
+    if( h.window != MPI_WIN_NULL )
+        MPI_Win_sync( h.window );
+}
+
+// Every collective begins with a barrier so that the segment is not
+// overwritten (or reallocated) while it is still being read from by the
+// previous one. All ranks of the node must request the same size.
+byte* Reserve( Hierarchy& h, size_t numBytes )
+{
+    NodeBarrier( h );
+    if( numBytes <= h.capacity )
+        return h.segment;
+    const size_t capacity = Max( numBytes, 2*h.capacity );
+    if( h.window != MPI_WIN_NULL )
+    {
+        MPI_Win_unlock_all( h.window );
+        MPI_Win_free( &h.window );
+    }
+    void* base;
+    MPI_Win_allocate_shared
+    ( MPI_Aint(h.Leader() ? capacity : 0), 1, MPI_INFO_NULL, h.nodeComm,
+      &base, &h.window );
+    MPI_Aint size;
+    int dispUnit;
+    MPI_Win_shared_query( h.window, 0, &size, &dispUnit, &base );
+    MPI_Win_lock_all( MPI_MODE_NOCHECK, h.window );
+    h.segment = static_cast<byte*>(base);
+    h.capacity = capacity;
+    return h.segment;
+}
+
+} // anonymous namespace
+
+bool AllGather( const void* sbuf, void* rbuf, size_t numBytes, Comm comm )
+{
+    EL_DEBUG_CSE
+    Hierarchy* h = Get( comm );
+    if( h == nullptr )
+        return false;
+    const int nodeSize = h->nodeSize;
+    const size_t totalBytes = numBytes*nodeSize*h->numNodes;
+
+    // Each node assembles the contributions of its ranks in place, and the
+    // leaders exchange whole nodes
+    byte* segment = Reserve( *h, totalBytes );
+    std::memcpy( &segment[h->CommRank()*numBytes], sbuf, numBytes );
+    NodeBarrier( *h );
+    if( h->Leader() && h->numNodes > 1 )
+        MPI_Allgather
+        ( MPI_IN_PLACE, 0, MPI_DATATYPE_NULL,
+          segment, int(nodeSize*numBytes), MPI_BYTE, h->leaderComm );
+    NodeBarrier( *h );
+    std::memcpy( rbuf, segment, totalBytes );
+    return true;
+}
+
+bool Broadcast( void* buf, size_t numBytes, int root, Comm comm )
+{
+    EL_DEBUG_CSE
+    Hierarchy* h = Get( comm );
+    if( h == nullptr )
+        return false;
+    const bool isRoot = ( h->CommRank() == root );
+
+    byte* segment = Reserve( *h, numBytes );
+    if( isRoot )
+        std::memcpy( segment, buf, numBytes );
+    NodeBarrier( *h );
+    if( h->Leader() && h->numNodes > 1 )
+        MPI_Bcast
+        ( segment, int(numBytes), MPI_BYTE, root/h->nodeSize, h->leaderComm );
+    NodeBarrier( *h );
+    if( !isRoot )
+        std::memcpy( buf, segment, numBytes );
+    return true;
+}
+
+bool AllToAll( const void* sbuf, void* rbuf, size_t numBytes, Comm comm )
+{
+    EL_DEBUG_CSE
+    Hierarchy* h = Get( comm );
+    if( h == nullptr )
+        return false;
+    const int nodeSize = h->nodeSize;
+    const int numNodes = h->numNodes;
+    const int nodeRank = h->nodeRank;
+    const size_t nodeBytes = size_t(numNodes)*nodeSize*nodeSize*numBytes;
+    const size_t blockBytes = nodeSize*nodeSize*numBytes;
+
+    // The send area is ordered by (destination node, source rank in node,
+    // destination rank in node) so that the leader can send each node a
+    // contiguous block; the receive area is ordered by (source node, source
+    // rank in node, destination rank in node)
+    byte* segment = Reserve( *h, 2*Align(nodeBytes) );
+    byte* sendArea = segment;
+    byte* recvArea = &segment[Align(nodeBytes)];
+    auto sendBuf = static_cast<const byte*>(sbuf);
+    auto recvBuf = static_cast<byte*>(rbuf);
+    for( int m=0; m<numNodes; ++m )
+        std::memcpy
+        ( &sendArea[(size_t(m)*nodeSize+nodeRank)*nodeSize*numBytes],
+          &sendBuf[size_t(m)*nodeSize*numBytes], nodeSize*numBytes );
+    NodeBarrier( *h );
+    if( h->Leader() )
+        MPI_Alltoall
+        ( sendArea, int(blockBytes), MPI_BYTE,
+          recvArea, int(blockBytes), MPI_BYTE, h->leaderComm );
+    NodeBarrier( *h );
+    for( int n=0; n<numNodes; ++n )
+        for( int l=0; l<nodeSize; ++l )
+        {
+            const size_t source = size_t(n)*nodeSize + l;
+            std::memcpy
+            ( &recvBuf[source*numBytes],
+              &recvArea[(source*nodeSize+nodeRank)*numBytes], numBytes );
+        }
+    return true;
+}
+
+bool AllToAll
+( const void* sbuf, const int* scs, const int* sds,
+        void* rbuf, const int* rcs, const int* rds, Comm comm )
+{
+    EL_DEBUG_CSE
+    Hierarchy* h = Get( comm );
+    if( h == nullptr )
+        return false;
+    const int nodeSize = h->nodeSize;
+    const int numNodes = h->numNodes;
+    const int nodeRank = h->nodeRank;
+    const int commSize = nodeSize*numNodes;
+
+    // Each rank knows what it will receive, so the node totals (and, once
+    // they are shared, the layout of the receive area) follow without any
+    // inter-node exchange of counts
+    long long totals[2] = { 0, 0 };
+    for( int q=0; q<commSize; ++q )
+    {
+        totals[0] += scs[q];
+        totals[1] += rcs[q];
+    }
+    MPI_Allreduce
+    ( MPI_IN_PLACE, totals, 2, MPI_LONG_LONG, MPI_SUM, h->nodeComm );
+    const size_t tableBytes = Align( sizeof(int)*nodeSize*commSize );
+    const size_t sendBytes = Align( totals[0] );
+    byte* segment =
+      Reserve( *h, 2*tableBytes + sendBytes + Align(totals[1]) );
+    int* sendTable = reinterpret_cast<int*>(segment);
+    int* recvTable = reinterpret_cast<int*>(&segment[tableBytes]);
+    byte* sendArea = &segment[2*tableBytes];
+    byte* recvArea = &segment[2*tableBytes+sendBytes];
+    std::memcpy( &sendTable[nodeRank*commSize], scs, sizeof(int)*commSize );
+    std::memcpy( &recvTable[nodeRank*commSize], rcs, sizeof(int)*commSize );
+    NodeBarrier( *h );
+
+    // Pack the send area by (destination node, source rank in node,
+    // destination rank in node)
+    auto sendBuf = static_cast<const byte*>(sbuf);
+    vector<int> nodeSendCounts(numNodes,0), nodeSendDispls(numNodes);
+    size_t offset = 0;
+    for( int m=0; m<numNodes; ++m )
+    {
+        nodeSendDispls[m] = int(offset);
+        for( int l=0; l<nodeSize; ++l )
+            for( int lDest=0; lDest<nodeSize; ++lDest )
+            {
+                const int dest = m*nodeSize + lDest;
+                const int count = sendTable[l*commSize+dest];
+                if( l == nodeRank )
+                    std::memcpy( &sendArea[offset], &sendBuf[sds[dest]], count );
+                offset += count;
+                nodeSendCounts[m] += count;
+            }
+    }
+    NodeBarrier( *h );
+
+    if( h->Leader() )
+    {
+        vector<int> nodeRecvCounts(numNodes,0), nodeRecvDispls(numNodes);
+        int recvOffset = 0;
+        for( int n=0; n<numNodes; ++n )
+        {
+            nodeRecvDispls[n] = recvOffset;
+            for( int l=0; l<nodeSize; ++l )
+                for( int lDest=0; lDest<nodeSize; ++lDest )
+                    nodeRecvCounts[n] +=
+                      recvTable[lDest*commSize+n*nodeSize+l];
+            recvOffset += nodeRecvCounts[n];
+        }
+        MPI_Alltoallv
+        ( sendArea, nodeSendCounts.data(), nodeSendDispls.data(), MPI_BYTE,
+          recvArea, nodeRecvCounts.data(), nodeRecvDispls.data(), MPI_BYTE,
+          h->leaderComm );
+    }
+    NodeBarrier( *h );
+
+    // The receive area is ordered by (source node, source rank in node,
+    // destination rank in node)
+    auto recvBuf = static_cast<byte*>(rbuf);
+    offset = 0;
+    for( int n=0; n<numNodes; ++n )
+        for( int l=0; l<nodeSize; ++l )
+        {
+            const int source = n*nodeSize + l;
+            for( int lDest=0; lDest<nodeSize; ++lDest )
+            {
+                const int count = recvTable[lDest*commSize+source];
+                if( lDest == nodeRank )
+                    std::memcpy( &recvBuf[rds[source]], &recvArea[offset], count );
+                offset += count;
+            }
+        }
+    return true;
+}
+
+bool ReduceScatter
+( const void* sbuf, void* rbuf, int rc,
+  MPI_Datatype type, MPI_Op op, Comm comm )
+{
+    EL_DEBUG_CSE
+    // The node-local reduction combines the contributions in rank order
+    // only for commutative operations
+    int commutative;
+    MPI_Op_commutative( op, &commutative );
+    if( !commutative )
+        return false;
+    Hierarchy* h = Get( comm );
+    if( h == nullptr )
+        return false;
+    const int nodeSize = h->nodeSize;
+    const int nodeRank = h->nodeRank;
+    const size_t commSize = size_t(nodeSize)*h->numNodes;
+    int typeSize;
+    MPI_Type_size( type, &typeSize );
+    const size_t numBytes = size_t(rc)*typeSize;
+    const size_t contribBytes = Align( commSize*numBytes );
+
+    byte* segment =
+      Reserve( *h, nodeSize*contribBytes + Align(nodeSize*numBytes) );
+    byte* resultArea = &segment[nodeSize*contribBytes];
+    std::memcpy
+    ( &segment[nodeRank*contribBytes], sbuf, commSize*numBytes );
+    NodeBarrier( *h );
+
+    // Each rank of the node reduces one slice of the contributions into the
+    // contribution of the leader
+    const size_t size = commSize*rc;
+    const size_t chunk = (size+nodeSize-1) / nodeSize;
+    const size_t start = Min( chunk*nodeRank, size );
+    const size_t end = Min( chunk*(nodeRank+1), size );
+    if( end > start )
+        for( int l=1; l<nodeSize; ++l )
+            MPI_Reduce_local
+            ( &segment[l*contribBytes+start*typeSize],
+              &segment[start*typeSize], int(end-start), type, op );
+    NodeBarrier( *h );
+    if( h->Leader() )
+        MPI_Reduce_scatter_block
+        ( segment, resultArea, nodeSize*rc, type, op, h->leaderComm );
+    NodeBarrier( *h );
+    std::memcpy( rbuf, &resultArea[nodeRank*numBytes], numBytes );
+    return true;
+}
+
+void Finalize()
+{
+    EL_DEBUG_CSE
+    FreeHierarchies();
+    if( finalizeKeyval != MPI_KEYVAL_INVALID )
+    {
+        MPI_Comm_delete_attr( MPI_COMM_SELF, finalizeKeyval );
+        MPI_Comm_free_keyval( &finalizeKeyval );
+    }
+}
+
+#else // ifdef EL_HIERARCHICAL_SUPPORTED
+
+bool AllGather( const void* sbuf, void* rbuf, size_t numBytes, Comm comm )
+{ return false; }
+
+bool Broadcast( void* buf, size_t numBytes, int root, Comm comm )
+{ return false; }
+
+bool AllToAll( const void* sbuf, void* rbuf, size_t numBytes, Comm comm )
+{ return false; }
+
+bool AllToAll
+( const void* sbuf, const int* scs, const int* sds,
+        void* rbuf, const int* rcs, const int* rds, Comm comm )
+{ return false; }
+
+bool ReduceScatter
+( const void* sbuf, void* rbuf, int rc,
+  MPI_Datatype type, MPI_Op op, Comm comm )
+{ return false; }
+
+void Finalize() { }
+
+#endif // ifdef EL_HIERARCHICAL_SUPPORTED
+
+} // namespace hierarchical
+} // namespace mpi
+} // namespace El
@@ -0,0 +1,49 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IMPORTS_MPI_HIERARCHICAL_HPP
+#define EL_IMPORTS_MPI_HIERARCHICAL_HPP
+
+namespace El {
+namespace mpi {
+namespace hierarchical {
+
+// Byte-level two-level collectives over communicators whose ranks are laid
+// out node-by-node with the same number of ranks on each node. One leader per
+// node performs the inter-node exchange directly out of (and into) a shared
+// window, which the other ranks on the node fill and read.
+//
+// Each routine returns false, without communicating, if hierarchical
+// collectives are disabled or do not apply to the communicator; the decision
+// is the same on every rank of the communicator.
+
+bool AllGather
+( const void* sbuf, void* rbuf, size_t numBytes, Comm comm );
+
+bool Broadcast( void* buf, size_t numBytes, int root, Comm comm );
+
+bool AllToAll
+( const void* sbuf, void* rbuf, size_t numBytes, Comm comm );
+
+// The counts and displacements are in units of bytes
+bool AllToAll
+( const void* sbuf, const int* scs, const int* sds,
+        void* rbuf, const int* rcs, const int* rds, Comm comm );
+
+bool ReduceScatter
+( const void* sbuf, void* rbuf, int rc,
+  MPI_Datatype type, MPI_Op op, Comm comm );
+
+// Release the cached node communicators and shared windows
+void Finalize();
+
+} // namespace hierarchical
+} // namespace mpi
+} // namespace El
+
+#endif // ifndef EL_IMPORTS_MPI_HIERARCHICAL_HPP
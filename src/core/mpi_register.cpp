@@ -126,6 +126,7 @@ template struct Types<long long int>; // Avoid conflict with Int
 #define EL_ENABLE_QUAD
 #define EL_ENABLE_BIGINT
 #define EL_ENABLE_BIGFLOAT
+#define EL_ENABLE_HALF
 #include <El/macros/Instantiate.h>
 
 // TODO(poulson): ValueInt<Real> user functions and ops
@@ -1020,6 +1021,37 @@ void CreateCustom() EL_NO_RELEASE_EXCEPT
     CreateMinLocPairOp<Quad>();
 #endif
 
+    // Half and BFloat16
+    // =================
+    // NOTE: Both are sent as opaque pairs of bytes, so every reduction
+    //       (including MPI_SUM) must go through a user-defined operation,
+    //       which widens each entry to float before combining them
+    CreateContiguous<Half>( sizeof(Half), MPI_BYTE );
+    CreateValueIntType<Half>();
+    CreateEntryType<Half>();
+    CreateUserOps<Half>();
+    CreateMaxOp<Half>();
+    CreateMinOp<Half>();
+    CreateSumOp<Half>();
+    CreateProdOp<Half>();
+    CreateMaxLocOp<Half>();
+    CreateMinLocOp<Half>();
+    CreateMaxLocPairOp<Half>();
+    CreateMinLocPairOp<Half>();
+
+    CreateContiguous<BFloat16>( sizeof(BFloat16), MPI_BYTE );
+    CreateValueIntType<BFloat16>();
+    CreateEntryType<BFloat16>();
+    CreateUserOps<BFloat16>();
+    CreateMaxOp<BFloat16>();
+    CreateMinOp<BFloat16>();
+    CreateSumOp<BFloat16>();
+    CreateProdOp<BFloat16>();
+    CreateMaxLocOp<BFloat16>();
+    CreateMinLocOp<BFloat16>();
+    CreateMaxLocPairOp<BFloat16>();
+    CreateMinLocPairOp<BFloat16>();
+
 #ifdef HYDROGEN_HAVE_MPC
     // BigFloat
     // ========
@@ -1072,6 +1104,8 @@ void DestroyCustom() EL_NO_RELEASE_EXCEPT
     DestroyFamily<Int>();
     DestroyScalarFamily<float>();
     DestroyScalarFamily<double>();
+    DestroyFamily<Half>();
+    DestroyFamily<BFloat16>();
 #ifdef HYDROGEN_HAVE_QD
     DestroyScalarFamily<DoubleDouble>();
     DestroyScalarFamily<QuadDouble>();
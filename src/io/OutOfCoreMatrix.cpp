@@ -0,0 +1,270 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <cstdio>
+
+namespace El {
+
+namespace {
+
+const std::streamoff metaBytes = 3*sizeof(Int);
+
+template<typename T>
+void ReadLocal
+( const string& filename, std::streamoff offset,
+  Int localHeight, Int localWidth, T* buffer, Int ldim )
+{
+    if( localHeight == 0 || localWidth == 0 )
+        return;
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file.seekg( offset );
+    if( ldim == localHeight )
+        file.read( (char*)buffer, localHeight*localWidth*sizeof(T) );
+    else
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            file.read( (char*)&buffer[jLoc*ldim], localHeight*sizeof(T) );
+    if( !file )
+        RuntimeError("Could not read panel from ",filename);
+}
+
+template<typename T>
+void WriteLocal
+( const string& filename, std::streamoff offset,
+  Int localHeight, Int localWidth, const T* buffer, Int ldim )
+{
+    if( localHeight == 0 || localWidth == 0 )
+        return;
+    std::fstream file
+    ( filename.c_str(), std::ios::binary | std::ios::in | std::ios::out );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file.seekp( offset );
+    if( ldim == localHeight )
+        file.write( (const char*)buffer, localHeight*localWidth*sizeof(T) );
+    else
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            file.write
+            ( (const char*)&buffer[jLoc*ldim], localHeight*sizeof(T) );
+    if( !file )
+        RuntimeError("Could not write panel to ",filename);
+}
+
+} // anonymous namespace
+
+template<typename T>
+OutOfCoreMatrix<T>::OutOfCoreMatrix
+( const El::Grid& grid, string directory, string basename )
+: grid_(&grid)
+{
+    EL_DEBUG_CSE
+    if( grid.InGrid() )
+        filename_ = BuildString
+          (directory,"/",basename,"-",grid.VCRank(),".",FileExtension(BINARY));
+}
+
+template<typename T>
+OutOfCoreMatrix<T>::OutOfCoreMatrix
+( Int height, Int width, Int panelWidth,
+  const El::Grid& grid, string directory, string basename )
+: OutOfCoreMatrix( grid, directory, basename )
+{
+    EL_DEBUG_CSE
+    Resize( height, width, panelWidth );
+}
+
+template<typename T>
+OutOfCoreMatrix<T>::~OutOfCoreMatrix()
+{
+    if( !filename_.empty() && !offsets_.empty() )
+        std::remove( filename_.c_str() );
+}
+
+template<typename T>
+void OutOfCoreMatrix<T>::Resize( Int height, Int width, Int panelWidth )
+{
+    EL_DEBUG_CSE
+    if( height < 0 || width < 0 )
+        LogicError("Invalid dimensions: ",height," x ",width);
+    if( panelWidth <= 0 )
+        LogicError("Panel width must be positive");
+    height_ = height;
+    width_ = width;
+    panelWidth_ = panelWidth;
+
+    const El::Grid& grid = *grid_;
+    SwapClear( offsets_ );
+    if( !grid.InGrid() )
+        return;
+
+    const Int numPanels = NumPanels();
+    const Int localHeight = Length( height, grid.MCRank(), grid.MCSize() );
+    offsets_.resize( numPanels+1 );
+    offsets_[0] = metaBytes;
+    for( Int k=0; k<numPanels; ++k )
+    {
+        const Range<Int> cols = PanelRange( k );
+        const Int localWidth =
+          Length( cols.end-cols.beg, grid.MRRank(), grid.MRSize() );
+        offsets_[k+1] = offsets_[k] + localHeight*localWidth*sizeof(T);
+    }
+
+    std::ofstream file
+    ( filename_.c_str(), std::ios::binary | std::ios::trunc );
+    if( !file.is_open() )
+        RuntimeError("Could not create ",filename_);
+    file.write( (const char*)&height, sizeof(Int) );
+    file.write( (const char*)&width, sizeof(Int) );
+    file.write( (const char*)&panelWidth, sizeof(Int) );
+    // Reserve the entire extent of the file
+    if( offsets_[numPanels] > metaBytes )
+    {
+        file.seekp( offsets_[numPanels]-1 );
+        file.put( 0 );
+    }
+    if( !file )
+        RuntimeError("Could not reserve ",offsets_[numPanels]," bytes for ",
+                     filename_);
+}
+
+template<typename T>
+Int OutOfCoreMatrix<T>::Height() const EL_NO_EXCEPT { return height_; }
+
+template<typename T>
+Int OutOfCoreMatrix<T>::Width() const EL_NO_EXCEPT { return width_; }
+
+template<typename T>
+Int OutOfCoreMatrix<T>::PanelWidth() const EL_NO_EXCEPT
+{ return panelWidth_; }
+
+template<typename T>
+Int OutOfCoreMatrix<T>::NumPanels() const EL_NO_EXCEPT
+{ return panelWidth_ == 0 ? 0 : (width_+panelWidth_-1) / panelWidth_; }
+
+template<typename T>
+Range<Int> OutOfCoreMatrix<T>::PanelRange( Int k ) const EL_NO_EXCEPT
+{ return Range<Int>( k*panelWidth_, Min((k+1)*panelWidth_,width_) ); }
+
+template<typename T>
+const El::Grid& OutOfCoreMatrix<T>::Grid() const EL_NO_EXCEPT
+{ return *grid_; }
+
+template<typename T>
+const string& OutOfCoreMatrix<T>::Filename() const EL_NO_EXCEPT
+{ return filename_; }
+
+template<typename T>
+void OutOfCoreMatrix<T>::PreparePanel( Int k, DistMatrix<T>& panel ) const
+{
+    EL_DEBUG_CSE
+    if( k < 0 || k >= NumPanels() )
+        LogicError("Panel ",k," is out of bounds");
+    if( panel.Grid() != *grid_ )
+        panel.SetGrid( *grid_ );
+    const Range<Int> cols = PanelRange( k );
+    panel.AlignAndResize( 0, 0, height_, cols.end-cols.beg, true );
+}
+
+template<typename T>
+void OutOfCoreMatrix<T>::AssertPanel
+( Int k, const AbstractDistMatrix<T>& panel ) const
+{
+    EL_DEBUG_CSE
+    if( k < 0 || k >= NumPanels() )
+        LogicError("Panel ",k," is out of bounds");
+    const Range<Int> cols = PanelRange( k );
+    if( panel.Height() != height_ || panel.Width() != cols.end-cols.beg )
+        LogicError
+        ("Panel ",k," should be ",height_," x ",cols.end-cols.beg,
+         " but was ",panel.Height()," x ",panel.Width());
+}
+
+template<typename T>
+void OutOfCoreMatrix<T>::ReadPanel( Int k, DistMatrix<T>& panel ) const
+{
+    EL_DEBUG_CSE
+    ReadPanelAsync( k, panel ).get();
+}
+
+template<typename T>
+void OutOfCoreMatrix<T>::WritePanel
+( Int k, const AbstractDistMatrix<T>& panel )
+{
+    EL_DEBUG_CSE
+    AssertPanel( k, panel );
+    if( panel.Grid() == *grid_ && panel.ColDist() == MC &&
+        panel.RowDist() == MR && panel.Wrap() == ELEMENT &&
+        panel.ColAlign() == 0 && panel.RowAlign() == 0 &&
+        panel.Root() == 0 && panel.GetLocalDevice() == Device::CPU )
+    {
+        auto& panelCast = static_cast<const DistMatrix<T>&>(panel);
+        WritePanelAsync( k, panelCast ).get();
+    }
+    else
+    {
+        DistMatrix<T> panelCopy(*grid_);
+        PreparePanel( k, panelCopy );
+        Copy( panel, panelCopy );
+        WritePanelAsync( k, panelCopy ).get();
+    }
+}
+
+template<typename T>
+std::future<void>
+OutOfCoreMatrix<T>::ReadPanelAsync( Int k, DistMatrix<T>& panel ) const
+{
+    EL_DEBUG_CSE
+    PreparePanel( k, panel );
+    if( offsets_.empty() )
+        return std::async( std::launch::deferred, [](){} );
+    const string filename = filename_;
+    const std::streamoff offset = offsets_[k];
+    const Int localHeight = panel.LocalHeight();
+    const Int localWidth = panel.LocalWidth();
+    T* buffer = panel.Buffer();
+    const Int ldim = panel.LDim();
+    return std::async
+    ( std::launch::async,
+      [=]()
+      { ReadLocal( filename, offset, localHeight, localWidth, buffer, ldim ); }
+    );
+}
+
+template<typename T>
+std::future<void>
+OutOfCoreMatrix<T>::WritePanelAsync( Int k, const DistMatrix<T>& panel )
+{
+    EL_DEBUG_CSE
+    AssertPanel( k, panel );
+    if( panel.ColAlign() != 0 || panel.RowAlign() != 0 )
+        LogicError("Asynchronously-written panels must have zero alignments");
+    if( offsets_.empty() )
+        return std::async( std::launch::deferred, [](){} );
+    const string filename = filename_;
+    const std::streamoff offset = offsets_[k];
+    const Int localHeight = panel.LocalHeight();
+    const Int localWidth = panel.LocalWidth();
+    const T* buffer = panel.LockedBuffer();
+    const Int ldim = panel.LDim();
+    return std::async
+    ( std::launch::async,
+      [=]()
+      { WriteLocal( filename, offset, localHeight, localWidth, buffer, ldim ); }
+    );
+}
+
+#define PROTO(T) template class OutOfCoreMatrix<T>;
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#include <El/macros/Instantiate.h>
+
+} // namespace El
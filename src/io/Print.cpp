@@ -86,6 +86,43 @@ void Print
     }
 }
 
+// Sparse
+// ======
+void Print( const Graph& graph, string title, ostream& os )
+{
+    EL_DEBUG_CSE
+    graph.AssertConsistent();
+    ostringstream msg;
+    if( title != "" )
+        msg << title << endl;
+    const Int numEdges = graph.NumEdges();
+    const Int* srcBuf = graph.LockedSourceBuffer();
+    const Int* tgtBuf = graph.LockedTargetBuffer();
+    for( Int e=0; e<numEdges; ++e )
+        msg << srcBuf[e] << " " << tgtBuf[e] << "\n";
+    msg << endl;
+    os << msg.str();
+}
+
+template<typename T>
+void Print( const SparseMatrix<T>& A, string title, ostream& os )
+{
+    EL_DEBUG_CSE
+    A.AssertConsistent();
+    ostringstream msg;
+    if( title != "" )
+        msg << title << endl;
+    ConfigurePrecision<T>( msg );
+    const Int numEntries = A.NumEntries();
+    const Int* srcBuf = A.LockedSourceBuffer();
+    const Int* tgtBuf = A.LockedTargetBuffer();
+    const T* valBuf = A.LockedValueBuffer();
+    for( Int s=0; s<numEntries; ++s )
+        msg << srcBuf[s] << " " << tgtBuf[s] << " " << valBuf[s] << "\n";
+    msg << endl;
+    os << msg.str();
+}
+
 // Utilities
 // =========
 
@@ -115,7 +152,9 @@ void Print( const vector<T>& x, string title, ostream& os )
   template void Print \
   ( const Matrix<T>& A, string title, ostream& os ); \
   template void Print \
-  ( const AbstractDistMatrix<T>& A, string title, ostream& os );
+  ( const AbstractDistMatrix<T>& A, string title, ostream& os ); \
+  template void Print \
+  ( const SparseMatrix<T>& A, string title, ostream& os );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
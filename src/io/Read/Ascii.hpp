@@ -14,115 +14,118 @@
 #include <sstream>
 #include <string>
 
+#include "./Text.hpp"
+
 namespace El {
 namespace read {
 
+// The number of values on the first data line of the buffer (zero if none)
 template<typename T>
-inline void
-Ascii( Matrix<T>& A, string const& filename )
+Int AsciiWidth( const text::LineBlocks& blocks )
 {
-    EL_DEBUG_CSE
-    std::ifstream file( filename.c_str() );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
-
-    // Walk through the file once to both count the number of rows and
-    // columns and to ensure that the number of columns is consistent
-    Int height=0, width=0;
-    std::string line;
-    for ( ;; )
+    const Int numBlocks = blocks.bounds.size()-1;
+    const char* end = blocks.bounds[numBlocks];
+    for( const char* p=blocks.bounds[0]; p<end; p=text::NextLine(p,end) )
     {
-        if (!std::getline( file, line ))
-            break;
-
-        std::stringstream lineStream( line );
-        Int numCols=0;
+        if( !text::IsDataLine(p) )
+            continue;
+        Int width = 0;
         T value;
-        while( lineStream >> value ) ++numCols;
-        if( numCols != 0 )
-        {
-            if( numCols != width && width != 0 )
-                LogicError("Inconsistent number of columns");
-            else
-                width = numCols;
-            ++height;
-        }
+        while( text::Parse( p, value ) )
+            ++width;
+        return width;
     }
-    file.clear();
-    file.seekg(0,file.beg);
+    return 0;
+}
 
-    // Resize the matrix and then read it
-    A.Resize( height, width );
-    Int i=0;
-    for ( ;; )
+// Each data line holds a row of the matrix
+template<typename T>
+void AsciiLine
+( Int width, const char* p, Int i, vector<Entry<T>>& entries )
+{
+    T value;
+    for( Int j=0; j<width; ++j )
     {
-        if (!std::getline(file, line))
-            break;
-
-        std::stringstream lineStream( line );
-        Int j=0;
-        T value;
-        while( lineStream >> value )
-        {
-            A.Set( i, j, value );
-            ++j;
-        }
-        ++i;
+        if( !text::Parse( p, value ) )
+            LogicError("Inconsistent number of columns");
+        entries.push_back( Entry<T>{i,j,value} );
     }
+    if( text::AtValue(p) )
+        LogicError("Inconsistent number of columns");
 }
 
 template<typename T>
 inline void
-Ascii( AbstractDistMatrix<T>& A, string const& filename )
+Ascii( Matrix<T>& A, string const& filename )
 {
     EL_DEBUG_CSE
-    std::ifstream file( filename.c_str() );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
+    const string buffer =
+      text::ReadLines( filename, 0, text::FileSize(filename) );
+    const auto blocks = text::SplitLines( buffer );
+    const Int width = AsciiWidth<T>( blocks );
+    const auto entries =
+      text::ParseLines<T>
+      ( blocks, 0,
+        [&]( const char* p, Int i, vector<Entry<T>>& lineEntries )
+        { AsciiLine( width, p, i, lineEntries ); } );
 
-    // Walk through the file once to both count the number of rows and
-    // columns and to ensure that the number of columns is consistent
-    Int height=0, width=0;
-    string line;
-    for ( ;; )
-    {
-        if (!std::getline(file, line))
-            break;
+    // Every entry is set exactly once
+    A.Resize( blocks.numLines, width );
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    const Int numEntries = entries.size();
+    EL_PARALLEL_FOR
+    for( Int k=0; k<numEntries; ++k )
+        ABuf[entries[k].i+entries[k].j*ALDim] = entries[k].value;
+}
 
-        std::stringstream lineStream( line );
-        Int numCols=0;
-        T value;
-        while( lineStream >> value ) ++numCols;
-        if( numCols != 0 )
-        {
-            if( numCols != width && width != 0 )
-                LogicError("Inconsistent number of columns");
-            else
-                width = numCols;
-            ++height;
-        }
-    }
-    file.clear();
-    file.seekg(0,file.beg);
+// Each process parses the rows beginning within its share of the file and
+// then pushes the entries to their owners with a single exchange
+template<typename T>
+inline void
+Ascii( AbstractDistMatrix<T>& A, string const& filename )
+{
+    EL_DEBUG_CSE
+    mpi::Comm comm = A.Grid().ViewingComm();
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
 
-    // Resize the matrix and then read in our local portion
-    A.Resize( height, width );
-    Int i=0;
-    for ( ;; )
-    {
-        if (!std::getline(file, line))
-            break;
+    const Int fileSize = text::FileSize( filename );
+    const string buffer =
+      text::ReadLines
+      ( filename,
+        (fileSize*commRank)/commSize, (fileSize*(commRank+1))/commSize );
+    const auto blocks = text::SplitLines( buffer );
+    const Int firstRow =
+      mpi::Scan( blocks.numLines, mpi::SUM, comm ) - blocks.numLines;
+    const Int height = mpi::AllReduce( blocks.numLines, comm );
 
-        std::stringstream lineStream( line );
-        Int j=0;
-        T value;
-        while( lineStream >> value )
-        {
-            A.Set( i, j, value );
-            ++j;
-        }
-        ++i;
+    // Ensure that every process reaches the exchange or throws
+    vector<Entry<T>> entries;
+    Int width = 0;
+    string error;
+    try
+    {
+        const Int localWidth = AsciiWidth<T>( blocks );
+        width = mpi::AllReduce( localWidth, mpi::MAX, comm );
+        entries =
+          text::ParseLines<T>
+          ( blocks, firstRow,
+            [&]( const char* p, Int i, vector<Entry<T>>& lineEntries )
+            { AsciiLine( width, p, i, lineEntries ); } );
     }
+    catch( std::exception& e ) { error = e.what(); }
+    if( mpi::AllReduce( int(!error.empty()), mpi::MAX, comm ) )
+        LogicError
+        (error.empty() ? string("Another process could not parse ")+filename
+                       : error);
+
+    Zeros( A, height, width );
+    A.Reserve( entries.size() );
+    for( const auto& entry : entries )
+        A.QueueUpdate( entry );
+    SwapClear( entries );
+    A.ProcessQueues();
 }
 
 } // namespace read
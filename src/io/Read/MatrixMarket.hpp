@@ -9,14 +9,23 @@
 #ifndef EL_READ_MATRIXMARKET_HPP
 #define EL_READ_MATRIXMARKET_HPP
 
+#include "./Text.hpp"
+
 namespace El {
 namespace read {
 
-template<typename T>
-void MatrixMarket( Matrix<T>& A, const string filename )
+struct MatrixMarketHeader
+{
+    bool isMatrix, isArray, isComplex, isPattern;
+    bool isGeneral, isSymmetric, isSkewSymmetric, isHermitian;
+    Int m, n, numNonzero;
+    // The byte offset of the first entry
+    Int dataBegin;
+};
+
+inline MatrixMarketHeader ReadMatrixMarketHeader( const string& filename )
 {
     EL_DEBUG_CSE
-    typedef Base<T> Real;
     std::ifstream file( filename.c_str() );
     if( !file.is_open() )
         RuntimeError("Could not open ",filename);
@@ -44,34 +53,36 @@ void MatrixMarket( Matrix<T>& A, const string filename )
     }
     // Ensure that the header components are individually valid
     // --------------------------------------------------------
-    const bool isMatrix = ( object == string("matrix") );
-    const bool isArray = ( format == string("array") );
-    const bool isComplex = ( field == string("complex") );
-    const bool isPattern = ( field == string("pattern") );
-    const bool isGeneral = ( symmetry == string("general") );
-    const bool isSymmetric = ( symmetry == string("symmetric") );
-    const bool isSkewSymmetric = ( symmetry == string("skew-symmetric") );
-    const bool isHermitian = ( symmetry == string("hermitian") );
-    if( !isMatrix && object != string("vector") )
+    MatrixMarketHeader header;
+    header.isMatrix = ( object == string("matrix") );
+    header.isArray = ( format == string("array") );
+    header.isComplex = ( field == string("complex") );
+    header.isPattern = ( field == string("pattern") );
+    header.isGeneral = ( symmetry == string("general") );
+    header.isSymmetric = ( symmetry == string("symmetric") );
+    header.isSkewSymmetric = ( symmetry == string("skew-symmetric") );
+    header.isHermitian = ( symmetry == string("hermitian") );
+    if( !header.isMatrix && object != string("vector") )
         RuntimeError("Invalid Matrix Market object: ",object);
-    if( !isArray && format != string("coordinate") )
+    if( !header.isArray && format != string("coordinate") )
         RuntimeError("Invalid Matrix Market format: ",format);
-    if( !isComplex && !isPattern &&
+    if( !header.isComplex && !header.isPattern &&
         field != string("real") &&
         field != string("double") &&
         field != string("integer") )
         RuntimeError("Invalid Matrix Market field: ",field);
-    if( !isGeneral && !isSymmetric && !isSkewSymmetric && !isHermitian )
+    if( !header.isGeneral && !header.isSymmetric &&
+        !header.isSkewSymmetric && !header.isHermitian )
         RuntimeError("Invalid Matrix Market symmetry: ",symmetry);
     // Ensure that the components are consistent
     // -----------------------------------------
-    if( isArray && isPattern )
+    if( header.isArray && header.isPattern )
         RuntimeError("Pattern field requires coordinate format");
     // NOTE: This constraint is only enforced because of the note located at
     //       http://people.sc.fsu.edu/~jburkardt/data/mm/mm.html
-    if( isSkewSymmetric && isPattern )
+    if( header.isSkewSymmetric && header.isPattern )
         RuntimeError("Pattern field incompatible with skew-symmetry");
-    if( isHermitian && !isComplex )
+    if( header.isHermitian && !header.isComplex )
         RuntimeError("Hermitian symmetry requires complex data");
 
     // Skip the comment lines
@@ -79,157 +90,182 @@ void MatrixMarket( Matrix<T>& A, const string filename )
     while( file.peek() == '%' )
         std::getline( file, line );
 
-    int m, n;
+    // Read in the dimensions (and the number of nonzeros)
+    // ===================================================
     if( !std::getline( file, line ) )
         RuntimeError("Could not extract the size line");
-    if( isArray )
-    {
-        // Read in the matrix dimensions
-        // =============================
-        if( isMatrix )
-        {
-            std::stringstream lineStream( line );
-            if( !(lineStream >> m) )
-                RuntimeError("Missing matrix height: ",line);
-            if( !(lineStream >> n) )
-                RuntimeError("Missing matrix width: ",line);
-        }
-        else
-        {
-            std::stringstream lineStream( line );
-            if( !(lineStream >> m) )
-                RuntimeError("Missing vector height: ",line);
-            n = 1;
-        }
-
-        // Resize the matrix
-        // =================
-        Zeros( A, m, n );
+    std::stringstream lineStream( line );
+    if( !(lineStream >> header.m) )
+        RuntimeError("Missing ",(header.isMatrix?"matrix":"vector"),
+                     " height: ",line);
+    header.n = 1;
+    if( header.isMatrix && !(lineStream >> header.n) )
+        RuntimeError("Missing matrix width: ",line);
+    if( header.isArray )
+        header.numNonzero = header.m*header.n;
+    else if( !(lineStream >> header.numNonzero) )
+        RuntimeError("Missing nonzeros entry: ",line);
+    header.dataBegin = file.tellg();
+    if( header.dataBegin < 0 )
+        header.dataBegin = text::FileSize( filename );
+    return header;
+}
 
-        // Now read in the data
-        // ====================
-        Real realPart, imagPart;
-        for( Int j=0; j<n; ++j )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                if( !std::getline( file, line ) )
-                    RuntimeError("Could not get entry (",i,",",j,")");
-                std::stringstream lineStream( line );
-                if( !(lineStream >> realPart) )
-                    RuntimeError
-                    ("Could not extract real part of entry (",i,",",j,")");
-                A.SetRealPart( i, j, realPart );
-                if( isComplex )
-                {
-                    if( !(lineStream >> imagPart) )
-                        RuntimeError
-                        ("Could not extract imag part of entry (",i,",",j,")");
-                    A.SetImagPart( i, j, imagPart );
-                }
-            }
-        }
+// Append the entries described by the given data line (the 'line'-th of the
+// file). Since only the lower triangle of a matrix with symmetry is used, the
+// mirrored entries are appended as well, and the diagonal of a Hermitian
+// matrix is forced to be real.
+template<typename T>
+void MatrixMarketLine
+( const MatrixMarketHeader& header, const char* p, Int line,
+  vector<Entry<T>>& entries )
+{
+    typedef Base<T> Real;
+    Int i, j;
+    if( header.isArray )
+    {
+        i = line % header.m;
+        j = line / header.m;
     }
     else
     {
-        // Read in the matrix dimensions and number of nonzeros
-        // ====================================================
-        int numNonzero;
-        if( isMatrix )
+        if( !text::Parse( p, i ) )
+            RuntimeError("Could not extract row coordinate of nonzero ",line);
+        --i; // convert from Fortran to C indexing
+        if( header.isMatrix )
         {
-            std::stringstream lineStream( line );
-            if( !(lineStream >> m) )
-                RuntimeError("Missing matrix height: ",line);
-            if( !(lineStream >> n) )
-                RuntimeError("Missing matrix width: ",line);
-            if( !(lineStream >> numNonzero) )
-                RuntimeError("Missing nonzeros entry: ",line);
+            if( !text::Parse( p, j ) )
+                RuntimeError
+                ("Could not extract col coordinate of nonzero ",line);
+            --j;
         }
         else
-        {
-            std::stringstream lineStream( line );
-            if( !(lineStream >> m) )
-                RuntimeError("Missing vector height: ",line);
-            n = 1;
-            if( !(lineStream >> numNonzero) )
-                RuntimeError("Missing nonzeros entry: ",line);
-        }
-
-        // Create a matrix of zeros
-        // ========================
-        Zeros( A, m, n );
+            j = 0;
+        if( i < 0 || i >= header.m || j < 0 || j >= header.n )
+            RuntimeError
+            ("Nonzero ",line," at (",i,",",j,") is outside of the ",
+             header.m," x ",header.n," matrix");
+    }
 
-        // Fill in the nonzero entries
-        // ===========================
-        int i, j;
+    T value(1);
+    if( !header.isPattern )
+    {
         Real realPart, imagPart;
-        for( Int k=0; k<numNonzero; ++k )
+        if( !text::Parse( p, realPart ) )
+            RuntimeError
+            ("Could not extract real part of entry (",i,",",j,")");
+        value = realPart;
+        if( header.isComplex )
         {
-            if( !std::getline( file, line ) )
-                RuntimeError("Could not get nonzero ",k);
-            std::stringstream lineStream( line );
-            if( !(lineStream >> i) )
-                RuntimeError("Could not extract row coordinate of nonzero ",k);
-            --i; // convert from Fortran to C indexing
-            if( isMatrix )
-            {
-                if( !(lineStream >> j) )
-                    RuntimeError
-                    ("Could not extract col coordinate of nonzero ",k);
-                --j;
-            }
-            else
-                j = 0;
-
-            if( isPattern )
-            {
-                A.Set( i, j, T(1) );
-            }
-            else
-            {
-                if( !(lineStream >> realPart) )
-                    RuntimeError
-                    ("Could not extract real part of entry (",i,",",j,")");
-                A.UpdateRealPart( i, j, realPart );
-                if( isComplex )
-                {
-                    if( !(lineStream >> imagPart) )
-                        RuntimeError
-                        ("Could not extract imag part of entry (",i,",",j,")");
-                    A.UpdateImagPart( i, j, imagPart );
-                }
-            }
+            if( !text::Parse( p, imagPart ) )
+                RuntimeError
+                ("Could not extract imag part of entry (",i,",",j,")");
+            SetImagPart( value, imagPart );
         }
     }
 
-    if( isSymmetric )
-        MakeSymmetric( LOWER, A );
-    if( isHermitian )
-        MakeHermitian( LOWER, A );
+    if( header.isGeneral )
+    {
+        entries.push_back( Entry<T>{i,j,value} );
+        return;
+    }
+    if( i < j )
+        return;
+    if( i == j )
+    {
+        if( header.isHermitian )
+            value = RealPart(value);
+        entries.push_back( Entry<T>{i,j,value} );
+        return;
+    }
+    entries.push_back( Entry<T>{i,j,value} );
     // I'm not certain of what the MM standard is for complex skew-symmetry,
     // so I'll default to assuming no conjugation
-    const bool conjugateSkew = false;
-    if( isSkewSymmetric )
+    if( header.isHermitian )
+        value = Conj(value);
+    else if( header.isSkewSymmetric )
+        value = -value;
+    entries.push_back( Entry<T>{j,i,value} );
+}
+
+template<typename T>
+void MatrixMarket( Matrix<T>& A, const string filename )
+{
+    EL_DEBUG_CSE
+    const auto header = ReadMatrixMarketHeader( filename );
+    const string buffer =
+      text::ReadLines( filename, header.dataBegin, text::FileSize(filename) );
+    const auto blocks = text::SplitLines( buffer );
+    if( blocks.numLines != header.numNonzero )
+        RuntimeError
+        ("Expected ",header.numNonzero," entries but found ",blocks.numLines);
+    auto entries =
+      text::ParseLines<T>
+      ( blocks, 0,
+        [&]( const char* p, Int line, vector<Entry<T>>& lineEntries )
+        { MatrixMarketLine( header, p, line, lineEntries ); } );
+
+    Zeros( A, header.m, header.n );
+    if( header.isPattern )
+    {
+        for( const auto& entry : entries )
+            A.Set( entry );
+    }
+    else
     {
-        MakeSymmetric( LOWER, A, conjugateSkew );
-        ScaleTrapezoid( T(-1), UPPER, A, 1 );
+        for( const auto& entry : entries )
+            A.Update( entry );
     }
 }
 
+// Each process reads and parses the lines beginning within its share of the
+// file and then pushes the entries to their owners with a single exchange
 template<typename T>
 void MatrixMarket( AbstractDistMatrix<T>& A, const string filename )
 {
     EL_DEBUG_CSE
-    // TODO: Use a WriteProxy instead
-    DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( A.Grid() );
-    if( A_CIRC_CIRC.CrossRank() == A_CIRC_CIRC.Root() )
+    const auto header = ReadMatrixMarketHeader( filename );
+    mpi::Comm comm = A.Grid().ViewingComm();
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    const Int dataSize = text::FileSize( filename ) - header.dataBegin;
+    const string buffer =
+      text::ReadLines
+      ( filename,
+        header.dataBegin + (dataSize*commRank)/commSize,
+        header.dataBegin + (dataSize*(commRank+1))/commSize );
+    const auto blocks = text::SplitLines( buffer );
+    const Int firstLine =
+      mpi::Scan( blocks.numLines, mpi::SUM, comm ) - blocks.numLines;
+    const Int numLines = mpi::AllReduce( blocks.numLines, comm );
+    if( numLines != header.numNonzero )
+        RuntimeError
+        ("Expected ",header.numNonzero," entries but found ",numLines);
+
+    // Ensure that every process reaches the exchange or throws
+    vector<Entry<T>> entries;
+    string error;
+    try
     {
-        MatrixMarket( A_CIRC_CIRC.Matrix(), filename );
-        A_CIRC_CIRC.Resize
-        ( A_CIRC_CIRC.Matrix().Height(), A_CIRC_CIRC.Matrix().Width() );
+        entries =
+          text::ParseLines<T>
+          ( blocks, firstLine,
+            [&]( const char* p, Int line, vector<Entry<T>>& lineEntries )
+            { MatrixMarketLine( header, p, line, lineEntries ); } );
     }
-    A_CIRC_CIRC.MakeSizeConsistent();
-    Copy( A_CIRC_CIRC, A );
+    catch( std::exception& e ) { error = e.what(); }
+    if( mpi::AllReduce( int(!error.empty()), mpi::MAX, comm ) )
+        RuntimeError
+        (error.empty() ? string("Another process could not parse ")+filename
+                       : error);
+
+    Zeros( A, header.m, header.n );
+    A.Reserve( entries.size() );
+    for( const auto& entry : entries )
+        A.QueueUpdate( entry );
+    SwapClear( entries );
+    A.ProcessQueues();
 }
 
 } // namespace read
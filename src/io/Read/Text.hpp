@@ -0,0 +1,309 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_READ_TEXT_HPP
+#define EL_READ_TEXT_HPP
+
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace El {
+namespace read {
+namespace text {
+
+// Chunked, multithreaded parsing of line-oriented text files. A file is split
+// into byte ranges (e.g., one per process); each range is read with a single
+// request and owns the lines which begin within it. The lines of a range are
+// then split between the threads, which parse numbers with the C library
+// conversions rather than through a stream per line.
+
+inline Int FileSize( const string& filename )
+{
+    std::ifstream file( filename.c_str(), std::ios::binary | std::ios::ate );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    return Int(file.tellg());
+}
+
+// Return the lines of the file which begin within the byte range [begin,end)
+inline string ReadLines( const string& filename, Int begin, Int end )
+{
+    EL_DEBUG_CSE
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file.seekg( 0, file.end );
+    const Int fileSize = file.tellg();
+    end = Min( end, fileSize );
+    if( begin >= end )
+        return string();
+
+    // Start one byte early so that a line beginning exactly at 'begin' can be
+    // recognized by the preceding newline
+    const Int start = ( begin > 0 ? begin-1 : 0 );
+    string buffer( end-start, '\0' );
+    file.seekg( start );
+    if( !file.read( &buffer[0], end-start ) )
+        RuntimeError("Could not read bytes ",start," to ",end," of ",filename);
+
+    // Finish the last line, which may extend past the end of the range
+    const Int chunkSize = 1 << 16;
+    Int pos = end;
+    while( buffer.back() != '\n' && pos < fileSize )
+    {
+        const Int extra = Min( chunkSize, fileSize-pos );
+        const size_t oldSize = buffer.size();
+        buffer.resize( oldSize+extra );
+        if( !file.read( &buffer[oldSize], extra ) )
+            RuntimeError("Could not read bytes ",pos," to ",pos+extra);
+        pos += extra;
+        const size_t newline = buffer.find( '\n', oldSize );
+        if( newline != string::npos )
+            buffer.resize( newline+1 );
+    }
+
+    // Drop the remainder of the line which began before the range
+    if( begin > 0 )
+    {
+        const size_t newline = buffer.find( '\n' );
+        if( newline == string::npos )
+            return string();
+        buffer.erase( 0, newline+1 );
+    }
+    return buffer;
+}
+
+inline const char* SkipBlanks( const char* p ) EL_NO_EXCEPT
+{
+    while( *p == ' ' || *p == '\t' || *p == '\r' )
+        ++p;
+    return p;
+}
+
+inline const char* NextLine( const char* p, const char* end ) EL_NO_EXCEPT
+{
+    auto newline =
+      static_cast<const char*>(std::memchr( p, '\n', end-p ));
+    return ( newline == nullptr ? end : newline+1 );
+}
+
+// Lines which are blank or begin with '%' hold no data
+inline bool IsDataLine( const char* p ) EL_NO_EXCEPT
+{
+    p = SkipBlanks( p );
+    return *p != '\n' && *p != '\0' && *p != '%';
+}
+
+// The buffer split on line boundaries into one block per thread, along with
+// the number of data lines preceding each block
+struct LineBlocks
+{
+    vector<const char*> bounds;
+    vector<Int> offsets;
+    Int numLines=0;
+};
+
+inline LineBlocks SplitLines( const string& buffer )
+{
+    EL_DEBUG_CSE
+    Int numBlocks = 1;
+#ifdef _OPENMP
+    numBlocks = omp_get_max_threads();
+#endif
+    const char* begin = buffer.data();
+    const char* end = begin + buffer.size();
+    numBlocks = Max( Min( numBlocks, Int(buffer.size()/4096) ), Int(1) );
+
+    LineBlocks blocks;
+    blocks.bounds.resize( numBlocks+1 );
+    blocks.bounds[0] = begin;
+    for( Int t=1; t<numBlocks; ++t )
+    {
+        const char* guess = begin + (buffer.size()*t)/numBlocks;
+        blocks.bounds[t] =
+          std::max( blocks.bounds[t-1], NextLine( guess-1, end ) );
+    }
+    blocks.bounds[numBlocks] = end;
+
+    blocks.offsets.resize( numBlocks+1, 0 );
+    EL_PARALLEL_FOR
+    for( Int t=0; t<numBlocks; ++t )
+    {
+        Int numLines = 0;
+        for( const char* p=blocks.bounds[t]; p<blocks.bounds[t+1];
+             p=NextLine(p,end) )
+            if( IsDataLine(p) )
+                ++numLines;
+        blocks.offsets[t+1] = numLines;
+    }
+    for( Int t=0; t<numBlocks; ++t )
+        blocks.offsets[t+1] += blocks.offsets[t];
+    blocks.numLines = blocks.offsets[numBlocks];
+    return blocks;
+}
+
+// Call parseLine( p, line, entries ) for every data line, in parallel over the
+// blocks, where 'line' counts the data lines from 'firstLine'
+template<typename T,class LineParser>
+vector<Entry<T>> ParseLines
+( const LineBlocks& blocks, Int firstLine, const LineParser& parseLine )
+{
+    EL_DEBUG_CSE
+    const Int numBlocks = blocks.bounds.size()-1;
+    const char* end = blocks.bounds[numBlocks];
+    vector<vector<Entry<T>>> blockEntries( numBlocks );
+    vector<std::exception_ptr> errors( numBlocks );
+    EL_PARALLEL_FOR
+    for( Int t=0; t<numBlocks; ++t )
+    {
+        try
+        {
+            Int line = firstLine + blocks.offsets[t];
+            for( const char* p=blocks.bounds[t]; p<blocks.bounds[t+1];
+                 p=NextLine(p,end) )
+                if( IsDataLine(p) )
+                    parseLine( p, line++, blockEntries[t] );
+        }
+        catch( ... ) { errors[t] = std::current_exception(); }
+    }
+    for( const auto& error : errors )
+        if( error )
+            std::rethrow_exception( error );
+
+    Int numEntries = 0;
+    for( const auto& entries : blockEntries )
+        numEntries += entries.size();
+    vector<Entry<T>> entries;
+    entries.reserve( numEntries );
+    for( auto& block : blockEntries )
+    {
+        entries.insert( entries.end(), block.begin(), block.end() );
+        SwapClear( block );
+    }
+    return entries;
+}
+
+// Parse the next value on the current line, advancing past it. Returns false
+// if the line has no more (valid) values.
+
+inline bool AtValue( const char*& p ) EL_NO_EXCEPT
+{
+    p = SkipBlanks( p );
+    return *p != '\n' && *p != '\0';
+}
+
+template<typename T,
+         typename=EnableIf<std::is_integral<T>>>
+bool Parse( const char*& p, T& value )
+{
+    if( !AtValue(p) )
+        return false;
+    char* next;
+    const long long parsed = std::strtoll( p, &next, 10 );
+    if( next == p )
+        return false;
+    value = T(parsed);
+    p = next;
+    return true;
+}
+
+inline bool Parse( const char*& p, float& value )
+{
+    if( !AtValue(p) )
+        return false;
+    char* next;
+    value = std::strtof( p, &next );
+    if( next == p )
+        return false;
+    p = next;
+    return true;
+}
+
+inline bool Parse( const char*& p, double& value )
+{
+    if( !AtValue(p) )
+        return false;
+    char* next;
+    value = std::strtod( p, &next );
+    if( next == p )
+        return false;
+    p = next;
+    return true;
+}
+
+// Extended-precision types fall back to their stream extraction operators
+template<typename T,
+         typename=DisableIf<std::is_integral<T>>,
+         typename=void>
+bool Parse( const char*& p, T& value )
+{
+    if( !AtValue(p) )
+        return false;
+    const char* q = p;
+    while( *q != ' ' && *q != '\t' && *q != '\r' && *q != '\n' &&
+           *q != '\0' && *q != ',' && *q != ')' )
+        ++q;
+    std::istringstream stream( string( p, q ) );
+    if( !(stream >> value) )
+        return false;
+    // Only advance past the characters which were extracted
+    const std::streamoff used = stream.tellg();
+    p = ( used < 0 ? q : p+used );
+    return true;
+}
+
+// One of "re", "re+imi" (as printed by Elemental), or "(re,im)"
+template<typename Real>
+bool Parse( const char*& p, Complex<Real>& value )
+{
+    if( !AtValue(p) )
+        return false;
+    Real realPart, imagPart=0;
+    const char* q = p;
+    if( *q == '(' )
+    {
+        ++q;
+        if( !Parse( q, realPart ) )
+            return false;
+        q = SkipBlanks( q );
+        if( *q != ',' )
+            return false;
+        ++q;
+        if( !Parse( q, imagPart ) )
+            return false;
+        q = SkipBlanks( q );
+        if( *q != ')' )
+            return false;
+        ++q;
+    }
+    else
+    {
+        if( !Parse( q, realPart ) )
+            return false;
+        if( *q == '+' )
+        {
+            ++q;
+            if( !Parse( q, imagPart ) || *q != 'i' )
+                return false;
+            ++q;
+        }
+    }
+    value = Complex<Real>( realPart, imagPart );
+    p = q;
+    return true;
+}
+
+} // namespace text
+} // namespace read
+} // namespace El
+
+#endif // ifndef EL_READ_TEXT_HPP
@@ -61,11 +61,24 @@ void HermitianTridiag
         herm_tridiag::UpperBlocked( A, householderScalars );
 }
 
+template<typename F> 
+void HermitianTridiag
+( UpperOrLower uplo,
+  AbstractDistMatrix<F>& A,
+  AbstractDistMatrix<F>& householderScalars,
+  const HermitianTridiagCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    Workspace<F> workspace;
+    HermitianTridiag( uplo, A, householderScalars, workspace, ctrl );
+}
+
 template<typename F> 
 void HermitianTridiag
 ( UpperOrLower uplo,
   AbstractDistMatrix<F>& APre,
   AbstractDistMatrix<F>& householderScalarsPre,
+  Workspace<F>& workspace,
   const HermitianTridiagCtrl<F>& ctrl )
 {
     EL_DEBUG_CSE
@@ -77,11 +90,13 @@ void HermitianTridiag
     auto& householderScalars = householderScalarsProx.Get();
 
     const Grid& grid = A.Grid();
+    workspace.Reserve( herm_tridiag::WorkspaceSize( uplo, A, ctrl ) );
     if( ctrl.approach == HERMITIAN_TRIDIAG_NORMAL )
     {
         // Use the pipelined algorithm for nonsquare meshes
         if( uplo == LOWER )
-            herm_tridiag::LowerBlocked( A, householderScalars, ctrl.symvCtrl );
+            herm_tridiag::LowerBlocked
+            ( A, householderScalars, ctrl.symvCtrl, workspace );
         else
             herm_tridiag::UpperBlocked( A, householderScalars, ctrl.symvCtrl );
     }
@@ -150,7 +165,7 @@ void HermitianTridiag
         {
             if( uplo == LOWER )
                 herm_tridiag::LowerBlocked
-                ( A, householderScalars, ctrl.symvCtrl );
+                ( A, householderScalars, ctrl.symvCtrl, workspace );
             else
                 herm_tridiag::UpperBlocked
                 ( A, householderScalars, ctrl.symvCtrl );
@@ -158,8 +173,53 @@ void HermitianTridiag
     }
 }
 
+// The reduction is driven by Hemv/Her2k updates of trailing submatrices which
+// straddle the blocks of the packed format, so the matrix is temporarily
+// unpacked into O(n^2) dense storage and the reflectors (and tridiagonal) are
+// then packed back into the lower triangle
+template<typename F>
+void HermitianTridiag( RFPMatrix<F>& A, Matrix<F>& householderScalars )
+{
+    EL_DEBUG_CSE
+    Matrix<F> AFull;
+    UnpackRFP( A, AFull );
+    HermitianTridiag( LOWER, AFull, householderScalars );
+    PackRFP( LOWER, AFull, A );
+}
+
+template<typename F>
+void HermitianTridiag
+( DistRFPMatrix<F>& A,
+  AbstractDistMatrix<F>& householderScalars,
+  const HermitianTridiagCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrix<F> AFull( A.Grid() );
+    UnpackRFP( A, AFull );
+    HermitianTridiag( LOWER, AFull, householderScalars, ctrl );
+    PackRFP( LOWER, AFull, A );
+}
+
 namespace herm_tridiag {
 
+template<typename F>
+Int WorkspaceSize
+( UpperOrLower uplo,
+  const AbstractDistMatrix<F>& A,
+  const HermitianTridiagCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = A.Grid();
+    const bool normal =
+      ctrl.approach == HERMITIAN_TRIDIAG_NORMAL ||
+      (ctrl.approach == HERMITIAN_TRIDIAG_DEFAULT &&
+       grid.Height() != grid.Width());
+    if( uplo == LOWER && normal )
+        return LowerBlockedWorkspaceSize( A.Height(), grid );
+    else
+        return 0;
+}
+
 template<typename F>
 void ExplicitCondensed( UpperOrLower uplo, Matrix<F>& A )
 {
@@ -199,6 +259,23 @@ void ExplicitCondensed
     AbstractDistMatrix<F>& A, \
     AbstractDistMatrix<F>& householderScalars, \
     const HermitianTridiagCtrl<F>& ctrl ); \
+  template void HermitianTridiag \
+  ( UpperOrLower uplo, \
+    AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& householderScalars, \
+    Workspace<F>& workspace, \
+    const HermitianTridiagCtrl<F>& ctrl ); \
+  template void HermitianTridiag \
+  ( RFPMatrix<F>& A, \
+    Matrix<F>& householderScalars ); \
+  template void HermitianTridiag \
+  ( DistRFPMatrix<F>& A, \
+    AbstractDistMatrix<F>& householderScalars, \
+    const HermitianTridiagCtrl<F>& ctrl ); \
+  template Int herm_tridiag::WorkspaceSize \
+  ( UpperOrLower uplo, \
+    const AbstractDistMatrix<F>& A, \
+    const HermitianTridiagCtrl<F>& ctrl ); \
   template void herm_tridiag::ExplicitCondensed \
   ( UpperOrLower uplo, Matrix<F>& A ); \
   template void herm_tridiag::ExplicitCondensed \
@@ -57,6 +57,28 @@ void LowerBlocked( Matrix<F>& A, Matrix<F>& householderScalars )
     }
 }
 
+// An upper bound on the workspace entries that any process draws on
+inline Int LowerBlockedWorkspaceSize( Int n, const Grid& g )
+{
+    const Int nb = Min(Blocksize(),n);
+    const Int r = g.Height();
+    const Int c = g.Width();
+    const Int p = g.Size();
+    const Int maxLocalHeightMC = MaxLength(n,r);
+    const Int maxLocalHeightMR = MaxLength(n,c);
+    // The panels of W[MC,MR], [A W][MC,* ], and [A W][MR,* ]
+    const Int panelSize =
+      MaxWorkspaceSize( n, nb, r, c ) +
+      2*MaxWorkspaceSize( n, nb, r ) + 2*MaxWorkspaceSize( n, nb, c );
+    // The temporaries of a single step of LowerPanel
+    const Int stepSize =
+      3*MaxWorkspaceSize( n, 1, r ) + 3*MaxWorkspaceSize( n, 1, c ) +
+      2*MaxWorkspaceSize( nb, 1, c ) +
+      (2*maxLocalHeightMC+1) + (r+1)*mpi::Pad(2*MaxLength(n,p)) +
+      2*(2*MaxLength(nb,c)+maxLocalHeightMR) + 4*maxLocalHeightMC;
+    return panelSize + (n/r+1) + stepSize;
+}
+
 // TODO(poulson):
 // If there is only a single MPI process, fall down to the sequential
 // implementation.
@@ -64,7 +86,8 @@ template<typename F>
 void LowerBlocked
 ( AbstractDistMatrix<F>& APre,
   AbstractDistMatrix<F>& householderScalarsPre, 
-  const SymvCtrl<F>& ctrl )
+  const SymvCtrl<F>& ctrl,
+  Workspace<F>& workspace )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -115,21 +138,18 @@ void LowerBlocked
 
         if( A22.Height() > 0 )
         {
-            WPan.AlignWith( A11 );
-            WPan.Resize( n-k, nb );
-            APan_MC_STAR.AlignWith( A11 );
-            APan_MC_STAR.Resize( n-k, nb );
-            WPan_MC_STAR.AlignWith( A11 );
-            WPan_MC_STAR.Resize( n-k, nb );
-            APan_MR_STAR.AlignWith( A11 );
-            APan_MR_STAR.Resize( n-k, nb );
-            WPan_MR_STAR.AlignWith( A11 );
-            WPan_MR_STAR.Resize( n-k, nb );
+            typename Workspace<F>::Scope scope( workspace );
+            const auto A11Data = A11.DistData();
+            workspace.Attach( WPan, n-k, nb, A11Data );
+            workspace.Attach( APan_MC_STAR, n-k, nb, A11Data );
+            workspace.Attach( WPan_MC_STAR, n-k, nb, A11Data );
+            workspace.Attach( APan_MR_STAR, n-k, nb, A11Data );
+            workspace.Attach( WPan_MR_STAR, n-k, nb, A11Data );
 
             LowerPanel
             ( ABR, WPan, householderScalars1,
               APan_MC_STAR, APan_MR_STAR, 
-              WPan_MC_STAR, WPan_MR_STAR, ctrl );
+              WPan_MC_STAR, WPan_MR_STAR, ctrl, workspace );
 
             auto A21_MC_STAR = APan_MC_STAR( ind2-k, ind1-k );
             auto A21_MR_STAR = APan_MR_STAR( ind2-k, ind1-k );
@@ -21,7 +21,8 @@ void LowerPanel
   DistMatrix<F,MR,STAR>& B_MR_STAR,
   DistMatrix<F,MC,STAR>& W_MC_STAR,
   DistMatrix<F,MR,STAR>& W_MR_STAR,
-  const SymvCtrl<F>& ctrl )
+  const SymvCtrl<F>& ctrl,
+  Workspace<F>& workspace )
 {
     EL_DEBUG_CSE
     const Int n = A.Height();
@@ -55,8 +56,10 @@ void LowerPanel
     e.AlignCols( A.DiagonalAlign(-1) );
     e.Resize( nW, 1 );
 
-    vector<F> w21LastBuf;
-    FastResize( w21LastBuf, n/r+1 );
+    // w21LastBuf persists across iterations, while the remaining temporaries
+    // are drawn from the workspace anew in each iteration
+    typename Workspace<F>::Scope panelScope( workspace );
+    F* w21LastBuf = workspace.Require( n/r+1 );
 
     DistMatrix<F> w21Last(g);
     DistMatrix<F,MC,STAR> a21_MC(g), a21B_MC(g),
@@ -92,13 +95,12 @@ void LowerPanel
 
         auto tau1     = t( ind1, ALL );
         auto epsilon1 = e( ind1, ALL );
-           
-        a21_MC.AlignWith( A22 );
-        a21_MR.AlignWith( A22 );
-        p21_MC.AlignWith( A22 );
-        a21_MC.Resize( n-(k+1), 1 );
-        a21_MR.Resize( n-(k+1), 1 );
-        p21_MC.Resize( n-(k+1), 1 );
+
+        typename Workspace<F>::Scope scope( workspace );
+        const auto A22Data = A22.DistData();
+        workspace.Attach( a21_MC, n-(k+1), 1, A22Data );
+        workspace.Attach( a21_MR, n-(k+1), 1, A22Data );
+        workspace.Attach( p21_MC, n-(k+1), 1, A22Data );
 
         // View the portions of a21[MC,* ] and p21[MC,* ] below the current
         // panel's square
@@ -143,27 +145,26 @@ void LowerPanel
         if( k == 0 )
         {
             const Int a21LocalHeight = a21.LocalHeight();
-            vector<F> rowBcastBuf;
-            FastResize( rowBcastBuf, a21LocalHeight+1 );
+            F* rowBcastBuf = workspace.Require( a21LocalHeight+1 );
 
             if( thisIsMyCol )
             {
                 // Pack the broadcast buffer with a21 and tau
-                MemCopy( rowBcastBuf.data(), a21.Buffer(), a21LocalHeight );
+                MemCopy( rowBcastBuf, a21.Buffer(), a21LocalHeight );
                 rowBcastBuf[a21LocalHeight] = tau;
             }
             // Broadcast a21 and tau across the process row
             mpi::Broadcast
-            ( rowBcastBuf.data(), 
+            ( rowBcastBuf, 
               a21LocalHeight+1, a21.RowAlign(), g.RowComm() );
             // Store a21[MC] into its DistMatrix class and also store a copy
             // for the next iteration
-            MemCopy( a21_MC.Buffer(), rowBcastBuf.data(), a21LocalHeight );
+            MemCopy( a21_MC.Buffer(), rowBcastBuf, a21LocalHeight );
             // Store a21[MC] into B[MC,* ]
             const Int B_MC_STAR_Off = B_MC_STAR.LocalHeight()-a21LocalHeight;
             MemCopy
             ( B_MC_STAR.Buffer(B_MC_STAR_Off,0), 
-              rowBcastBuf.data(),
+              rowBcastBuf,
               B_MC_STAR.LocalHeight()-B_MC_STAR_Off );
             // Store tau
             tau = rowBcastBuf[a21LocalHeight];
@@ -181,33 +182,32 @@ void LowerPanel
         {
             const Int a21LocalHeight = a21.LocalHeight();
             const Int w21LastLocalHeight = aB1.LocalHeight();
-            vector<F> rowBcastBuf;
-            FastResize( rowBcastBuf, a21LocalHeight+w21LastLocalHeight+1 );
+            F* rowBcastBuf =
+              workspace.Require( a21LocalHeight+w21LastLocalHeight+1 );
             if( thisIsMyCol ) 
             {
                 // Pack the broadcast buffer with a21, w21Last, and tau
-                MemCopy( rowBcastBuf.data(), a21.Buffer(), a21LocalHeight );
+                MemCopy( rowBcastBuf, a21.Buffer(), a21LocalHeight );
                 MemCopy
                 ( &rowBcastBuf[a21LocalHeight], 
-                  w21LastBuf.data(), w21LastLocalHeight );
+                  w21LastBuf, w21LastLocalHeight );
                 rowBcastBuf[a21LocalHeight+w21LastLocalHeight] = tau;
             }
             // Broadcast a21, w21Last, and tau across the process row
             mpi::Broadcast
-            ( rowBcastBuf.data(), 
+            ( rowBcastBuf, 
               a21LocalHeight+w21LastLocalHeight+1, 
               a21.RowAlign(), g.RowComm() );
             // Store a21[MC] into its DistMatrix class 
-            MemCopy( a21_MC.Buffer(), rowBcastBuf.data(), a21LocalHeight );
+            MemCopy( a21_MC.Buffer(), rowBcastBuf, a21LocalHeight );
             // Store a21[MC] into B[MC,* ]
             const Int B_MC_STAR_Off = B_MC_STAR.LocalHeight()-a21LocalHeight;
             MemCopy
             ( B_MC_STAR.Buffer(B_MC_STAR_Off,A00.Width()), 
-              rowBcastBuf.data(),
+              rowBcastBuf,
               B_MC_STAR.LocalHeight()-B_MC_STAR_Off );
             // Store w21Last[MC] into its DistMatrix class
-            w21Last_MC.AlignWith( alpha11 );
-            w21Last_MC.Resize( n-k, 1 );
+            workspace.Attach( w21Last_MC, n-k, 1, alpha11.DistData() );
             MemCopy
             ( w21Last_MC.Buffer(), 
               &rowBcastBuf[a21LocalHeight], w21LastLocalHeight );
@@ -256,8 +256,7 @@ void LowerPanel
             const Int recvRankRM = 
                 (recvRankCM/r)+c*(recvRankCM%r);
 
-            vector<F> transBuf;
-            FastResize( transBuf, (r+1)*portionSize );
+            F* transBuf = workspace.Require( (r+1)*portionSize );
             F* sendBuf = &transBuf[0];
             F* recvBuf = &transBuf[r*portionSize];
 
@@ -294,8 +293,7 @@ void LowerPanel
               sendBuf, portionSize, g.ColComm() );
 
             // Unpack
-            w21Last_MR.AlignWith( alpha11 );
-            w21Last_MR.Resize( n-k, 1 );
+            workspace.Attach( w21Last_MR, n-k, 1, alpha11.DistData() );
             for( Int row=0; row<r; ++row )
             {
                 // Unpack into w21Last[MR]
@@ -354,15 +352,15 @@ void LowerPanel
         //   p21[MC] := tril(A22)[MC,MR] a21[MR]
         //   q21[MR] := tril(A22,-1)'[MR,MC] a21[MC]
         Zero( p21_MC );
-        q21_MR.AlignWith( A22 );
-        Zeros( q21_MR, a21.Height(), 1 );
+        workspace.Attach( q21_MR, a21.Height(), 1, A22Data );
+        Zero( q21_MR );
         symv::LocalColAccumulate
         ( LOWER, F(1), A22, a21_MC, a21_MR, p21_MC, q21_MR, true, ctrl );
 
-        x01_MR.AlignWith( W20B );
-        y01_MR.AlignWith( W20B );
-        Zeros( x01_MR, W20B.Width(), 1 );
-        Zeros( y01_MR, W20B.Width(), 1 );
+        workspace.Attach( x01_MR, W20B.Width(), 1, W20B.DistData() );
+        workspace.Attach( y01_MR, W20B.Width(), 1, W20B.DistData() );
+        Zero( x01_MR );
+        Zero( y01_MR );
         LocalGemv( ADJOINT, F(1), W20B, a21B_MC, F(0), x01_MR );
         LocalGemv( ADJOINT, F(1), A20B, a21B_MC, F(0), y01_MR );
 
@@ -371,11 +369,11 @@ void LowerPanel
         {
             const Int x01LocalHeight = x01_MR.LocalHeight();
             const Int q21LocalHeight = q21_MR.LocalHeight();
-            vector<F> colSumSendBuf, colSumRecvBuf;
-            FastResize( colSumSendBuf, 2*x01LocalHeight+q21LocalHeight );
-            FastResize( colSumRecvBuf, 2*x01LocalHeight+q21LocalHeight );
+            const Int colSumSize = 2*x01LocalHeight+q21LocalHeight;
+            F* colSumSendBuf = workspace.Require( colSumSize );
+            F* colSumRecvBuf = workspace.Require( colSumSize );
             MemCopy
-            ( colSumSendBuf.data(), x01_MR.Buffer(), x01LocalHeight );
+            ( colSumSendBuf, x01_MR.Buffer(), x01LocalHeight );
             MemCopy
             ( &colSumSendBuf[x01LocalHeight],
               y01_MR.Buffer(), x01LocalHeight );
@@ -383,11 +381,11 @@ void LowerPanel
             ( &colSumSendBuf[2*x01LocalHeight],
               q21_MR.Buffer(), q21LocalHeight );
             mpi::AllReduce
-            ( colSumSendBuf.data(), colSumRecvBuf.data(),
+            ( colSumSendBuf, colSumRecvBuf,
               2*x01LocalHeight+q21LocalHeight, g.ColComm() );
             MemCopy
             ( x01_MR.Buffer(), 
-              colSumRecvBuf.data(), x01LocalHeight );
+              colSumRecvBuf, x01LocalHeight );
             MemCopy
             ( y01_MR.Buffer(), 
               &colSumRecvBuf[x01LocalHeight], x01LocalHeight );
@@ -405,13 +403,12 @@ void LowerPanel
             // combine the Reduce to one of p21[MC] with the redistribution 
             // of q21[MR,* ] -> q21[MC,MR] to the next process column.
             const Int localHeight = p21_MC.LocalHeight();
-            vector<F> reduceToOneSendBuf, reduceToOneRecvBuf;
-            FastResize( reduceToOneSendBuf, 2*localHeight );
-            FastResize( reduceToOneRecvBuf, 2*localHeight );
+            F* reduceToOneSendBuf = workspace.Require( 2*localHeight );
+            F* reduceToOneRecvBuf = workspace.Require( 2*localHeight );
 
             // Pack p21[MC]
             MemCopy
-            ( reduceToOneSendBuf.data(), p21_MC.Buffer(), localHeight );
+            ( reduceToOneSendBuf, p21_MC.Buffer(), localHeight );
 
             // Fill in contributions to q21[MC,MR] from q21[MR,* ]
             const bool contributing = 
@@ -469,7 +466,7 @@ void LowerPanel
             const Int nextProcessRow = (alpha11.ColAlign()+1) % r;
             const Int nextProcessCol = (alpha11.RowAlign()+1) % c;
             mpi::Reduce
-            ( reduceToOneSendBuf.data(), reduceToOneRecvBuf.data(),
+            ( reduceToOneSendBuf, reduceToOneRecvBuf,
               2*localHeight, nextProcessCol, g.RowComm() );
             if( g.Col() == nextProcessCol )
             {
@@ -484,7 +481,7 @@ void LowerPanel
                 // We know a priori that the first element of a21 is one.
                 const F* a21_MC_Buf = a21_MC.Buffer();
                 F myDotProduct = blas::Dot
-                    ( localHeight, reduceToOneRecvBuf.data(), 1, 
+                    ( localHeight, reduceToOneRecvBuf, 1, 
                                    a21_MC_Buf,                1 );
                 F sendBuf[2], recvBuf[2];
                 sendBuf[0] = myDotProduct;
@@ -509,13 +506,12 @@ void LowerPanel
             // w21[MC] and w21[MR] so that we may place them into W[MC,* ]
             // and W[MR,* ]
             const Int localHeight = p21_MC.LocalHeight();
-            vector<F> allReduceSendBuf, allReduceRecvBuf;
-            FastResize( allReduceSendBuf, 2*localHeight );
-            FastResize( allReduceRecvBuf, 2*localHeight );
+            F* allReduceSendBuf = workspace.Require( 2*localHeight );
+            F* allReduceRecvBuf = workspace.Require( 2*localHeight );
 
             // Pack p21[MC]
             MemCopy
-            ( allReduceSendBuf.data(), p21_MC.Buffer(), localHeight );
+            ( allReduceSendBuf, p21_MC.Buffer(), localHeight );
 
             // Fill in contributions to q21[MC] from q21[MR]
             const bool contributing = 
@@ -571,7 +567,7 @@ void LowerPanel
                 MemZero( &allReduceSendBuf[localHeight], localHeight );
 
             mpi::AllReduce
-            ( allReduceSendBuf.data(), allReduceRecvBuf.data(),
+            ( allReduceSendBuf, allReduceRecvBuf,
               2*localHeight, g.RowComm() );
 
             // Combine the second half into the first half        
@@ -583,7 +579,7 @@ void LowerPanel
             // Finish computing w21.
             const F* a21_MC_Buf = a21_MC.Buffer();
             F myDotProduct = blas::Dot
-                ( localHeight, allReduceRecvBuf.data(), 1, 
+                ( localHeight, allReduceRecvBuf, 1, 
                                a21_MC_Buf,              1 );
             const F dotProduct = mpi::AllReduce( myDotProduct, g.ColComm() );
 
@@ -10,6 +10,7 @@
 
 #include "./Hessenberg/LowerBlocked.hpp"
 #include "./Hessenberg/UpperBlocked.hpp"
+#include "./Hessenberg/TwoStage.hpp"
 #include "./Hessenberg/ApplyQ.hpp"
 #include "./Hessenberg/FormQ.hpp"
 
@@ -44,11 +45,30 @@ void Hessenberg
 namespace hessenberg {
 
 template<typename F>
-void ExplicitCondensed( UpperOrLower uplo, Matrix<F>& A )
+void ExplicitCondensed
+( UpperOrLower uplo, Matrix<F>& A, const HessenbergCtrl& ctrl )
 {
     EL_DEBUG_CSE
     Matrix<F> householderScalars;
-    Hessenberg( uplo, A, householderScalars );
+    if( ctrl.approach == HESSENBERG_TWO_STAGE )
+    {
+        // The lower-Hessenberg form of A is the adjoint of the
+        // upper-Hessenberg form of A^H
+        Matrix<F> bulgeReflectors, bulgeScalars;
+        if( uplo == LOWER )
+        {
+            Matrix<F> AAdj;
+            Adjoint( A, AAdj );
+            TwoStage( AAdj, householderScalars, bulgeReflectors, bulgeScalars,
+              ctrl );
+            Adjoint( AAdj, A );
+        }
+        else
+            TwoStage( A, householderScalars, bulgeReflectors, bulgeScalars,
+              ctrl );
+    }
+    else
+        Hessenberg( uplo, A, householderScalars );
     if( uplo == LOWER )
         MakeTrapezoidal( LOWER, A, 1 );
     else
@@ -56,11 +76,30 @@ void ExplicitCondensed( UpperOrLower uplo, Matrix<F>& A )
 }
 
 template<typename F> 
-void ExplicitCondensed( UpperOrLower uplo, AbstractDistMatrix<F>& A )
+void ExplicitCondensed
+( UpperOrLower uplo, AbstractDistMatrix<F>& A, const HessenbergCtrl& ctrl )
 {
     EL_DEBUG_CSE
-    DistMatrix<F,STAR,STAR> householderScalars(A.Grid());
-    Hessenberg( uplo, A, householderScalars );
+    const Grid& g = A.Grid();
+    DistMatrix<F,STAR,STAR> householderScalars(g);
+    if( ctrl.approach == HESSENBERG_TWO_STAGE )
+    {
+        DistMatrix<F> bulgeReflectors(g);
+        DistMatrix<F,STAR,STAR> bulgeScalars(g);
+        if( uplo == LOWER )
+        {
+            DistMatrix<F> AAdj(g);
+            Adjoint( A, AAdj );
+            TwoStage( AAdj, householderScalars, bulgeReflectors, bulgeScalars,
+              ctrl );
+            Adjoint( AAdj, A );
+        }
+        else
+            TwoStage( A, householderScalars, bulgeReflectors, bulgeScalars,
+              ctrl );
+    }
+    else
+        Hessenberg( uplo, A, householderScalars );
     if( uplo == LOWER )
         MakeTrapezoidal( LOWER, A, 1 );
     else
@@ -79,9 +118,22 @@ void ExplicitCondensed( UpperOrLower uplo, AbstractDistMatrix<F>& A )
     AbstractDistMatrix<F>& A, \
     AbstractDistMatrix<F>& householderScalars ); \
   template void hessenberg::ExplicitCondensed \
-  ( UpperOrLower uplo, Matrix<F>& A ); \
+  ( UpperOrLower uplo, Matrix<F>& A, const HessenbergCtrl& ctrl ); \
   template void hessenberg::ExplicitCondensed \
-  ( UpperOrLower uplo, AbstractDistMatrix<F>& A ); \
+  ( UpperOrLower uplo, AbstractDistMatrix<F>& A, \
+    const HessenbergCtrl& ctrl ); \
+  template void hessenberg::TwoStage \
+  ( Matrix<F>& A, \
+    Matrix<F>& householderScalars, \
+    Matrix<F>& bulgeReflectors, \
+    Matrix<F>& bulgeScalars, \
+    const HessenbergCtrl& ctrl ); \
+  template void hessenberg::TwoStage \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& householderScalars, \
+    AbstractDistMatrix<F>& bulgeReflectors, \
+    AbstractDistMatrix<F>& bulgeScalars, \
+    const HessenbergCtrl& ctrl ); \
   template void hessenberg::ApplyQ \
   ( LeftOrRight side, UpperOrLower uplo, Orientation orientation, \
     const Matrix<F>& A, \
@@ -101,6 +153,32 @@ void ExplicitCondensed( UpperOrLower uplo, AbstractDistMatrix<F>& A )
   ( UpperOrLower uplo, \
     const AbstractDistMatrix<F>& A, \
     const AbstractDistMatrix<F>& householderScalars, \
+          AbstractDistMatrix<F>& Q ); \
+  template void hessenberg::ApplyQ \
+  ( LeftOrRight side, Orientation orientation, \
+    const Matrix<F>& A, \
+    const Matrix<F>& householderScalars, \
+    const Matrix<F>& bulgeReflectors, \
+    const Matrix<F>& bulgeScalars, \
+          Matrix<F>& B ); \
+  template void hessenberg::ApplyQ \
+  ( LeftOrRight side, Orientation orientation, \
+    const AbstractDistMatrix<F>& A, \
+    const AbstractDistMatrix<F>& householderScalars, \
+    const AbstractDistMatrix<F>& bulgeReflectors, \
+    const AbstractDistMatrix<F>& bulgeScalars, \
+          AbstractDistMatrix<F>& B ); \
+  template void hessenberg::FormQ \
+  ( const Matrix<F>& A, \
+    const Matrix<F>& householderScalars, \
+    const Matrix<F>& bulgeReflectors, \
+    const Matrix<F>& bulgeScalars, \
+          Matrix<F>& Q ); \
+  template void hessenberg::FormQ \
+  ( const AbstractDistMatrix<F>& A, \
+    const AbstractDistMatrix<F>& householderScalars, \
+    const AbstractDistMatrix<F>& bulgeReflectors, \
+    const AbstractDistMatrix<F>& bulgeScalars, \
           AbstractDistMatrix<F>& Q );
 
 #define EL_NO_INT_PROTO
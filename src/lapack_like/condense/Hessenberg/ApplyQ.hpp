@@ -9,6 +9,8 @@
 #ifndef EL_HESSENBERG_APPLYQ_HPP
 #define EL_HESSENBERG_APPLYQ_HPP
 
+#include "./TwoStage.hpp"
+
 namespace El {
 namespace hessenberg {
 
@@ -66,6 +68,171 @@ void ApplyQ
     }
 }
 
+// Q = Q1 Q2, where Q1 is formed from the stage-one reflectors stored below the
+// 'bandwidth' subdiagonal of A and Q2 is the product, over the groups of
+// sweeps in increasing order, of the block reflectors of each step of the group
+// in decreasing order.
+
+template<typename F>
+void ApplyQ
+( LeftOrRight side, Orientation orientation,
+  const Matrix<F>& A,
+  const Matrix<F>& householderScalars,
+  const Matrix<F>& bulgeReflectors,
+  const Matrix<F>& bulgeScalars,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int bandwidth = bulgeReflectors.Height();
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
+    const Conjugation conjugation = ( normal ? CONJUGATED : UNCONJUGATED );
+    const bool stageOneFirst = ( normal != onLeft );
+
+    if( stageOneFirst )
+        ApplyPackedReflectors
+        ( side, LOWER, VERTICAL, direction, conjugation, -bandwidth,
+          A, householderScalars, B );
+
+    vector<Int> groupOffsets(1,0);
+    for( Int j0=0; j0<n-2; j0+=bandwidth )
+    {
+        const Int j1 = Min(j0+bandwidth,n-2);
+        Int numGroup = 0;
+        for( Int j=j0; j<j1; ++j )
+            numGroup += NumBulgeSteps( n, bandwidth, j );
+        groupOffsets.push_back( groupOffsets.back()+numGroup );
+    }
+    const Int numGroups = groupOffsets.size()-1;
+
+    vector<Int> stepOffsets;
+    Matrix<F> V, blockScalars;
+    for( Int groupIter=0; groupIter<numGroups; ++groupIter )
+    {
+        const Int group =
+          ( stageOneFirst ? groupIter : numGroups-1-groupIter );
+        const Int j0 = group*bandwidth;
+        const Int j1 = Min(j0+bandwidth,n-2);
+        const Int numSteps = NumBulgeSteps( n, bandwidth, j0 );
+        stepOffsets.resize( numSteps+1 );
+        stepOffsets[0] = groupOffsets[group];
+        for( Int k=0; k<numSteps; ++k )
+            stepOffsets[k+1] = stepOffsets[k] +
+              NumBulgeBlockReflectors( n, bandwidth, j0, j1, k );
+
+        for( Int stepIter=0; stepIter<numSteps; ++stepIter )
+        {
+            const Int k = ( stageOneFirst ? numSteps-1-stepIter : stepIter );
+            const Int s = j0+1+k*bandwidth;
+            const Int numBlock = stepOffsets[k+1]-stepOffsets[k];
+            const Int height = Min(n-s,numBlock-1+bandwidth);
+            FormBulgeBlock
+            ( stepOffsets[k], numBlock, height, bulgeReflectors, bulgeScalars,
+              V, blockScalars );
+            auto BBlock =
+              ( onLeft ? B( IR(s,s+height), ALL ) : B( ALL, IR(s,s+height) ) );
+            ApplyPackedReflectors
+            ( side, LOWER, VERTICAL, direction, conjugation, 0,
+              V, blockScalars, BBlock );
+        }
+    }
+
+    if( !stageOneFirst )
+        ApplyPackedReflectors
+        ( side, LOWER, VERTICAL, direction, conjugation, -bandwidth,
+          A, householderScalars, B );
+}
+
+template<typename F>
+void ApplyQ
+( LeftOrRight side, Orientation orientation,
+  const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& householderScalars,
+  const AbstractDistMatrix<F>& bulgeReflectorsPre,
+  const AbstractDistMatrix<F>& bulgeScalarsPre,
+        AbstractDistMatrix<F>& BPre )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<F,F,MC,MR> bulgeReflectorsProx( bulgeReflectorsPre );
+    DistMatrixReadProxy<F,F,STAR,STAR> bulgeScalarsProx( bulgeScalarsPre );
+    DistMatrixReadWriteProxy<F,F,MC,MR> BProx( BPre );
+    auto& bulgeReflectors = bulgeReflectorsProx.GetLocked();
+    auto& bulgeScalars = bulgeScalarsProx.GetLocked();
+    auto& B = BProx.Get();
+
+    const Grid& g = B.Grid();
+    const Int n = A.Height();
+    const Int bandwidth = bulgeReflectors.Height();
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
+    const Conjugation conjugation = ( normal ? CONJUGATED : UNCONJUGATED );
+    const bool stageOneFirst = ( normal != onLeft );
+
+    if( stageOneFirst )
+        ApplyPackedReflectors
+        ( side, LOWER, VERTICAL, direction, conjugation, -bandwidth,
+          A, householderScalars, B );
+
+    vector<Int> groupOffsets(1,0);
+    for( Int j0=0; j0<n-2; j0+=bandwidth )
+    {
+        const Int j1 = Min(j0+bandwidth,n-2);
+        Int numGroup = 0;
+        for( Int j=j0; j<j1; ++j )
+            numGroup += NumBulgeSteps( n, bandwidth, j );
+        groupOffsets.push_back( groupOffsets.back()+numGroup );
+    }
+    const Int numGroups = groupOffsets.size()-1;
+
+    vector<Int> stepOffsets;
+    DistMatrix<F,STAR,STAR> reflectors_STAR_STAR(g), V_STAR_STAR(g),
+      blockScalars_STAR_STAR(g);
+    for( Int groupIter=0; groupIter<numGroups; ++groupIter )
+    {
+        const Int group =
+          ( stageOneFirst ? groupIter : numGroups-1-groupIter );
+        const Int j0 = group*bandwidth;
+        const Int j1 = Min(j0+bandwidth,n-2);
+        const Int numSteps = NumBulgeSteps( n, bandwidth, j0 );
+        stepOffsets.resize( numSteps+1 );
+        stepOffsets[0] = groupOffsets[group];
+        for( Int k=0; k<numSteps; ++k )
+            stepOffsets[k+1] = stepOffsets[k] +
+              NumBulgeBlockReflectors( n, bandwidth, j0, j1, k );
+
+        for( Int stepIter=0; stepIter<numSteps; ++stepIter )
+        {
+            const Int k = ( stageOneFirst ? numSteps-1-stepIter : stepIter );
+            const Int s = j0+1+k*bandwidth;
+            const Int numBlock = stepOffsets[k+1]-stepOffsets[k];
+            const Int height = Min(n-s,numBlock-1+bandwidth);
+            const Range<Int> blockInd( stepOffsets[k], stepOffsets[k+1] );
+
+            reflectors_STAR_STAR = bulgeReflectors( ALL, blockInd );
+            V_STAR_STAR.Resize( height, numBlock );
+            blockScalars_STAR_STAR.Resize( numBlock, 1 );
+            FormBulgeBlock
+            ( 0, numBlock, height,
+              reflectors_STAR_STAR.LockedMatrix(),
+              bulgeScalars.LockedMatrix()( blockInd, ALL ),
+              V_STAR_STAR.Matrix(), blockScalars_STAR_STAR.Matrix() );
+            auto BBlock =
+              ( onLeft ? B( IR(s,s+height), ALL ) : B( ALL, IR(s,s+height) ) );
+            ApplyPackedReflectors
+            ( side, LOWER, VERTICAL, direction, conjugation, 0,
+              V_STAR_STAR, blockScalars_STAR_STAR, BBlock );
+        }
+    }
+
+    if( !stageOneFirst )
+        ApplyPackedReflectors
+        ( side, LOWER, VERTICAL, direction, conjugation, -bandwidth,
+          A, householderScalars, B );
+}
+
 } // namespace hessenberg
 } // namespace El
 
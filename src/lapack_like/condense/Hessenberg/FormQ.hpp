@@ -40,6 +40,36 @@ void FormQ
     ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
 }
 
+template<typename F>
+void FormQ
+( const Matrix<F>& A,
+  const Matrix<F>& householderScalars,
+  const Matrix<F>& bulgeReflectors,
+  const Matrix<F>& bulgeScalars,
+        Matrix<F>& Q )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    Identity( Q, n, n );
+    ApplyQ
+    ( LEFT, NORMAL, A, householderScalars, bulgeReflectors, bulgeScalars, Q );
+}
+
+template<typename F>
+void FormQ
+( const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& householderScalars,
+  const AbstractDistMatrix<F>& bulgeReflectors,
+  const AbstractDistMatrix<F>& bulgeScalars,
+        AbstractDistMatrix<F>& Q )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    Identity( Q, n, n );
+    ApplyQ
+    ( LEFT, NORMAL, A, householderScalars, bulgeReflectors, bulgeScalars, Q );
+}
+
 } // namespace hessenberg
 } // namespace El
 
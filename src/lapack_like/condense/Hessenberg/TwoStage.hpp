@@ -0,0 +1,595 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HESSENBERG_TWOSTAGE_HPP
+#define EL_HESSENBERG_TWOSTAGE_HPP
+
+namespace El {
+namespace hessenberg {
+
+// The two-stage reduction first reduces A to upper-Hessenberg form with
+// 'bandwidth' subdiagonals (stage one), almost entirely with Level 3 updates,
+// and then chases bulges to annihilate all but the first subdiagonal
+// (stage two).
+//
+// The reflector used to zero column c of the band during sweep j is generated
+// at step k, and applied to rows/columns [j+1+k*bandwidth,
+// j+1+(k+1)*bandwidth). The stage-two reflectors are stored as the columns of
+// a bandwidth x numBulge matrix, with unit diagonal entries stored explicitly.
+// Consecutive sweeps are grouped into blocks of 'bandwidth' sweeps and, within
+// each group, the reflectors are ordered by step and then by sweep so that the
+// reflectors of each step of a group are contiguous and can be applied as a
+// single block reflector.
+
+inline Int ClampBandwidth( Int n, Int bandwidth )
+{
+    if( bandwidth <= 0 )
+        bandwidth = Blocksize();
+    return Max( Min(bandwidth,n-1), 1 );
+}
+
+// The number of steps of sweep j
+inline Int NumBulgeSteps( Int n, Int bandwidth, Int j )
+{
+    if( bandwidth <= 1 || j >= n-2 )
+        return 0;
+    return (n-2-j+bandwidth-1) / bandwidth;
+}
+
+inline Int NumBulgeReflectors( Int n, Int bandwidth )
+{
+    Int numBulge = 0;
+    for( Int j=0; j<n-2; ++j )
+        numBulge += NumBulgeSteps( n, bandwidth, j );
+    return numBulge;
+}
+
+// The number of reflectors of the sweeps in [j0,j1) that exist at step k
+inline Int NumBulgeBlockReflectors( Int n, Int bandwidth, Int j0, Int j1, Int k )
+{
+    Int numBlock = 0;
+    for( Int j=j0; j<j1; ++j )
+        if( NumBulgeSteps(n,bandwidth,j) > k )
+            ++numBlock;
+    return numBlock;
+}
+
+// Pack the reflectors [offset,offset+numBlock) into the lower trapezoid of V,
+// with the i'th reflector starting in row i
+template<typename F>
+void FormBulgeBlock
+( Int offset, Int numBlock, Int height,
+  const Matrix<F>& bulgeReflectors,
+  const Matrix<F>& bulgeScalars,
+        Matrix<F>& V,
+        Matrix<F>& householderScalars )
+{
+    EL_DEBUG_CSE
+    const Int bandwidth = bulgeReflectors.Height();
+    Zeros( V, height, numBlock );
+    householderScalars.Resize( numBlock, 1 );
+    for( Int i=0; i<numBlock; ++i )
+    {
+        const Int len = Min(bandwidth,height-i);
+        for( Int t=0; t<len; ++t )
+            V(i+t,i) = bulgeReflectors(t,offset+i);
+        householderScalars(i) = bulgeScalars(offset+i);
+    }
+}
+
+// X := (I - tau v v^H) X
+template<typename F>
+void ApplyBulgeReflectorFromLeft( const F* v, const F& tau, Matrix<F>& X )
+{
+    const Int m = X.Height();
+    const Int n = X.Width();
+    const Int XLDim = X.LDim();
+    F* XBuf = X.Buffer();
+    EL_PARALLEL_FOR
+    for( Int j=0; j<n; ++j )
+    {
+        F* x = &XBuf[j*XLDim];
+        F gamma = 0;
+        for( Int i=0; i<m; ++i )
+            gamma += Conj(v[i])*x[i];
+        gamma *= tau;
+        for( Int i=0; i<m; ++i )
+            x[i] -= gamma*v[i];
+    }
+}
+
+// X := X (I - tau v v^H)^H
+template<typename F>
+void ApplyBulgeReflectorFromRight( const F* v, const F& tau, Matrix<F>& X )
+{
+    const Int m = X.Height();
+    const Int n = X.Width();
+    const Int XLDim = X.LDim();
+    F* XBuf = X.Buffer();
+    EL_PARALLEL_FOR
+    for( Int i=0; i<m; ++i )
+    {
+        F gamma = 0;
+        for( Int j=0; j<n; ++j )
+            gamma += XBuf[i+j*XLDim]*v[j];
+        gamma *= Conj(tau);
+        for( Int j=0; j<n; ++j )
+            XBuf[i+j*XLDim] -= gamma*Conj(v[j]);
+    }
+}
+
+template<typename F>
+void ReduceToBand
+( Matrix<F>& A, Matrix<F>& householderScalars, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    householderScalars.Resize( Max(n-bandwidth,0), 1 );
+
+    Matrix<Base<F>> signature;
+    for( Int k=0; k<n-bandwidth; k+=bandwidth )
+    {
+        const Int nb = Min(bandwidth,n-bandwidth-k);
+        const Range<Int> ind1( k, k+nb ),
+                         indB( k+bandwidth, n ),
+                         ind2( k+nb, n );
+
+        auto AB1 = A( indB, ind1 );
+        auto AB2 = A( indB, ind2 );
+        auto ALB = A( ALL,  indB );
+        auto householderScalars1 = householderScalars( ind1, ALL );
+
+        // Factor the panel below the band and remove the sign normalization
+        // of its triangular factor so that it is the result of applying the
+        // reflectors
+        QR( AB1, householderScalars1, signature );
+        auto RB1 = AB1( IR(0,nb), ALL );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, signature, RB1 );
+
+        // AB2 := Q^H AB2 and ALB := ALB Q
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, FORWARD, UNCONJUGATED, 0,
+          AB1, householderScalars1, AB2 );
+        ApplyPackedReflectors
+        ( RIGHT, LOWER, VERTICAL, FORWARD, CONJUGATED, 0,
+          AB1, householderScalars1, ALB );
+    }
+}
+
+template<typename F>
+void ReduceToBand
+( AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& householderScalarsPre,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( APre, householderScalarsPre ))
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,STAR,STAR>
+      householderScalarsProx( householderScalarsPre );
+    auto& A = AProx.Get();
+    auto& householderScalars = householderScalarsProx.Get();
+
+    const Int n = A.Height();
+    householderScalars.Resize( Max(n-bandwidth,0), 1 );
+
+    DistMatrix<Base<F>,STAR,STAR> signature( A.Grid() );
+    for( Int k=0; k<n-bandwidth; k+=bandwidth )
+    {
+        const Int nb = Min(bandwidth,n-bandwidth-k);
+        const Range<Int> ind1( k, k+nb ),
+                         indB( k+bandwidth, n ),
+                         ind2( k+nb, n );
+
+        auto AB1 = A( indB, ind1 );
+        auto AB2 = A( indB, ind2 );
+        auto ALB = A( ALL,  indB );
+        auto householderScalars1 = householderScalars( ind1, ALL );
+
+        QR( AB1, householderScalars1, signature );
+        auto RB1 = AB1( IR(0,nb), ALL );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, signature, RB1 );
+
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, FORWARD, UNCONJUGATED, 0,
+          AB1, householderScalars1, AB2 );
+        ApplyPackedReflectors
+        ( RIGHT, LOWER, VERTICAL, FORWARD, CONJUGATED, 0,
+          AB1, householderScalars1, ALB );
+    }
+}
+
+// Chase the bulges of a band upper-Hessenberg matrix (whose entries below the
+// band are zero). The updates from the right of the rows above each group of
+// sweeps do not interact with the chase and are deferred to the end of the
+// group, where they are applied as block reflectors.
+template<typename F>
+void ChaseBulges
+( Matrix<F>& A,
+  Int bandwidth,
+  Matrix<F>& bulgeReflectors,
+  Matrix<F>& bulgeScalars )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int numBulge = NumBulgeReflectors( n, bandwidth );
+    Zeros( bulgeReflectors, bandwidth, numBulge );
+    Zeros( bulgeScalars, numBulge, 1 );
+    if( numBulge == 0 )
+        return;
+
+    vector<Int> stepOffsets;
+    Matrix<F> V, householderScalars;
+    Int groupOffset = 0;
+    for( Int j0=0; j0<n-2; j0+=bandwidth )
+    {
+        const Int j1 = Min(j0+bandwidth,n-2);
+        const Int numSteps = NumBulgeSteps( n, bandwidth, j0 );
+        stepOffsets.resize( numSteps+1 );
+        stepOffsets[0] = groupOffset;
+        for( Int k=0; k<numSteps; ++k )
+            stepOffsets[k+1] = stepOffsets[k] +
+              NumBulgeBlockReflectors( n, bandwidth, j0, j1, k );
+
+        for( Int j=j0; j<j1; ++j )
+        {
+            const Int numSweepSteps = NumBulgeSteps( n, bandwidth, j );
+            for( Int k=0; k<numSweepSteps; ++k )
+            {
+                const Int a = j+1+k*bandwidth;
+                const Int len = Min(bandwidth,n-a);
+                const Int c = ( k==0 ? j : a-bandwidth );
+                const Int offset = stepOffsets[k]+(j-j0);
+
+                // Annihilate A(a+1:a+len,c)
+                auto aB = A( IR(a+1,a+len), IR(c) );
+                const F tau = LeftReflector( A(a,c), aB );
+                F* v = bulgeReflectors.Buffer(0,offset);
+                v[0] = F(1);
+                for( Int t=1; t<len; ++t )
+                    v[t] = aB(t-1);
+                bulgeScalars(offset) = tau;
+                Zero( aB );
+
+                auto ALeft = A( IR(a,a+len), IR(c+1,n) );
+                ApplyBulgeReflectorFromLeft( v, tau, ALeft );
+
+                auto ARight =
+                  A( IR(j0+1,Min(n,a+len+bandwidth)), IR(a,a+len) );
+                ApplyBulgeReflectorFromRight( v, tau, ARight );
+            }
+        }
+
+        // Apply the deferred updates to the rows above the group
+        auto ATop = A( IR(0,j0+1), ALL );
+        for( Int k=numSteps-1; k>=0; --k )
+        {
+            const Int s = j0+1+k*bandwidth;
+            const Int numBlock = stepOffsets[k+1]-stepOffsets[k];
+            const Int height = Min(n-s,numBlock-1+bandwidth);
+            FormBulgeBlock
+            ( stepOffsets[k], numBlock, height, bulgeReflectors, bulgeScalars,
+              V, householderScalars );
+            auto ATopBlock = ATop( ALL, IR(s,s+height) );
+            ApplyPackedReflectors
+            ( RIGHT, LOWER, VERTICAL, FORWARD, CONJUGATED, 0,
+              V, householderScalars, ATopBlock );
+        }
+        groupOffset = stepOffsets[numSteps];
+    }
+}
+
+// Chase the bulges of sweep j of a distributed band upper-Hessenberg matrix.
+//
+// Step k of the sweep acts on the index range R_k = [a_k,a_k+len_k), with
+// a_k = j+1+k*bandwidth, and its reflector only depends upon the first column
+// of the band (for k=0) or upon the block A(R_k,R_{k-1}), which no earlier
+// step of the sweep modifies other than through the update from the right of
+// step k-1. Every process therefore gathers these blocks once and redundantly
+// generates all of the reflectors of the sweep. Since the updates from the
+// left act on disjoint rows, and those from the right on disjoint columns,
+// they can then each be applied with a single reduction. The annihilated
+// columns are overwritten afterwards.
+template<typename F>
+void ChaseBulgeSweep
+( DistMatrix<F>& A,
+  Int bandwidth,
+  Int j,
+  const vector<Int>& stepOffsets,
+  Int sweepOffset,
+  Matrix<F>& groupReflectors,
+  Matrix<F>& groupScalars )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int numSteps = NumBulgeSteps( n, bandwidth, j );
+    if( numSteps == 0 )
+        return;
+    const Int j0 = j - sweepOffset;
+
+    // Gather the first column of the band and the blocks A(R_{k+1},R_k)
+    Matrix<F> blocks;
+    Zeros( blocks, bandwidth, 1+(numSteps-1)*bandwidth );
+    {
+        auto x = A( IR(j+1,Min(j+1+bandwidth,n)), IR(j) );
+        for( Int jLoc=0; jLoc<x.LocalWidth(); ++jLoc )
+            for( Int iLoc=0; iLoc<x.LocalHeight(); ++iLoc )
+                blocks(x.GlobalRow(iLoc),0) = x.GetLocal(iLoc,jLoc);
+    }
+    for( Int k=0; k<numSteps-1; ++k )
+    {
+        const Int a = j+1+k*bandwidth;
+        const Int lenNext = Min(bandwidth,n-a-bandwidth);
+        auto B = A( IR(a+bandwidth,a+bandwidth+lenNext), IR(a,a+bandwidth) );
+        for( Int jLoc=0; jLoc<B.LocalWidth(); ++jLoc )
+        {
+            const Int jBlock = 1+k*bandwidth+B.GlobalCol(jLoc);
+            for( Int iLoc=0; iLoc<B.LocalHeight(); ++iLoc )
+                blocks(B.GlobalRow(iLoc),jBlock) = B.GetLocal(iLoc,jLoc);
+        }
+    }
+    mpi::AllReduce
+    ( blocks.Buffer(), blocks.Height()*blocks.Width(), A.DistComm() );
+
+    // Redundantly generate the reflectors of the sweep
+    vector<F> betas( numSteps );
+    Matrix<F> x;
+    Copy( blocks( IR(0,Min(bandwidth,n-j-1)), IR(0) ), x );
+    for( Int k=0; k<numSteps; ++k )
+    {
+        const Int a = j+1+k*bandwidth;
+        const Int len = Min(bandwidth,n-a);
+        const Int offset = stepOffsets[k]+sweepOffset;
+
+        auto xB = x( IR(1,len), ALL );
+        const F tau = LeftReflector( x(0), xB );
+        betas[k] = x(0);
+        groupReflectors(0,offset) = F(1);
+        for( Int t=1; t<len; ++t )
+            groupReflectors(t,offset) = x(t);
+        groupScalars(offset) = tau;
+
+        if( k < numSteps-1 )
+        {
+            // x := B_k (I - tau v v^H)^H e_0
+            const Int lenNext = Min(bandwidth,n-a-bandwidth);
+            auto B =
+              blocks( IR(0,lenNext), IR(1+k*bandwidth,1+(k+1)*bandwidth) );
+            auto v = groupReflectors( IR(0,len), IR(offset) );
+            Copy( B( ALL, IR(0) ), x );
+            Gemv( NORMAL, -Conj(tau), B, v, F(1), x );
+        }
+    }
+
+    // ALeft_k := (I - tau_k v_k v_k^H) ALeft_k, with ALeft_k = A(R_k,c_k:n)
+    vector<Int> vOffsets(numSteps+1,0), zOffsets(numSteps+1,0);
+    for( Int k=0; k<numSteps; ++k )
+    {
+        const Int a = j+1+k*bandwidth;
+        const Int len = Min(bandwidth,n-a);
+        const Int c = ( k==0 ? j : a-bandwidth );
+        auto ALeft = A( IR(a,a+len), IR(c,n) );
+        vOffsets[k+1] = vOffsets[k] + ALeft.LocalHeight();
+        zOffsets[k+1] = zOffsets[k] + ALeft.LocalWidth();
+    }
+    Matrix<F> vLocs, zLocs;
+    Zeros( vLocs, vOffsets[numSteps], 1 );
+    Zeros( zLocs, zOffsets[numSteps], 1 );
+    for( Int k=0; k<numSteps; ++k )
+    {
+        const Int a = j+1+k*bandwidth;
+        const Int len = Min(bandwidth,n-a);
+        const Int c = ( k==0 ? j : a-bandwidth );
+        const Int offset = stepOffsets[k]+sweepOffset;
+        auto ALeft = A( IR(a,a+len), IR(c,n) );
+        auto vLoc = vLocs( IR(vOffsets[k],vOffsets[k+1]), ALL );
+        auto zLoc = zLocs( IR(zOffsets[k],zOffsets[k+1]), ALL );
+        for( Int iLoc=0; iLoc<vLoc.Height(); ++iLoc )
+            vLoc(iLoc) = groupReflectors(ALeft.GlobalRow(iLoc),offset);
+        Gemv( ADJOINT, F(1), ALeft.LockedMatrix(), vLoc, F(0), zLoc );
+    }
+    mpi::AllReduce( zLocs.Buffer(), zLocs.Height(), A.ColComm() );
+    for( Int k=0; k<numSteps; ++k )
+    {
+        const Int a = j+1+k*bandwidth;
+        const Int len = Min(bandwidth,n-a);
+        const Int c = ( k==0 ? j : a-bandwidth );
+        const Int offset = stepOffsets[k]+sweepOffset;
+        auto ALeft = A( IR(a,a+len), IR(c,n) );
+        auto vLoc = vLocs( IR(vOffsets[k],vOffsets[k+1]), ALL );
+        auto zLoc = zLocs( IR(zOffsets[k],zOffsets[k+1]), ALL );
+        Ger( -groupScalars(offset), vLoc, zLoc, ALeft.Matrix() );
+    }
+
+    // ARight_k := ARight_k (I - tau_k v_k v_k^H)^H
+    for( Int k=0; k<numSteps; ++k )
+    {
+        const Int a = j+1+k*bandwidth;
+        const Int len = Min(bandwidth,n-a);
+        auto ARight = A( IR(j0+1,Min(n,a+len+bandwidth)), IR(a,a+len) );
+        vOffsets[k+1] = vOffsets[k] + ARight.LocalWidth();
+        zOffsets[k+1] = zOffsets[k] + ARight.LocalHeight();
+    }
+    Zeros( vLocs, vOffsets[numSteps], 1 );
+    Zeros( zLocs, zOffsets[numSteps], 1 );
+    for( Int k=0; k<numSteps; ++k )
+    {
+        const Int a = j+1+k*bandwidth;
+        const Int len = Min(bandwidth,n-a);
+        const Int offset = stepOffsets[k]+sweepOffset;
+        auto ARight = A( IR(j0+1,Min(n,a+len+bandwidth)), IR(a,a+len) );
+        auto vLoc = vLocs( IR(vOffsets[k],vOffsets[k+1]), ALL );
+        auto zLoc = zLocs( IR(zOffsets[k],zOffsets[k+1]), ALL );
+        for( Int jLoc=0; jLoc<vLoc.Height(); ++jLoc )
+            vLoc(jLoc) = groupReflectors(ARight.GlobalCol(jLoc),offset);
+        Gemv( NORMAL, F(1), ARight.LockedMatrix(), vLoc, F(0), zLoc );
+    }
+    mpi::AllReduce( zLocs.Buffer(), zLocs.Height(), A.RowComm() );
+    for( Int k=0; k<numSteps; ++k )
+    {
+        const Int a = j+1+k*bandwidth;
+        const Int len = Min(bandwidth,n-a);
+        const Int offset = stepOffsets[k]+sweepOffset;
+        auto ARight = A( IR(j0+1,Min(n,a+len+bandwidth)), IR(a,a+len) );
+        auto vLoc = vLocs( IR(vOffsets[k],vOffsets[k+1]), ALL );
+        auto zLoc = zLocs( IR(zOffsets[k],zOffsets[k+1]), ALL );
+        Ger( -Conj(groupScalars(offset)), zLoc, vLoc, ARight.Matrix() );
+    }
+
+    // Overwrite the annihilated columns
+    for( Int k=0; k<numSteps; ++k )
+    {
+        const Int a = j+1+k*bandwidth;
+        const Int len = Min(bandwidth,n-a);
+        const Int c = ( k==0 ? j : a-bandwidth );
+        for( Int t=0; t<len; ++t )
+            A.Set( a+t, c, t==0 ? betas[k] : F(0) );
+    }
+}
+
+// The distributed analogue of the above, where each sweep is chased with a
+// fixed number of collectives (see ChaseBulgeSweep)
+template<typename F>
+void ChaseBulges
+( DistMatrix<F>& A,
+  Int bandwidth,
+  DistMatrix<F>& bulgeReflectors,
+  DistMatrix<F,STAR,STAR>& bulgeScalars )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    const Int numBulge = NumBulgeReflectors( n, bandwidth );
+    Zeros( bulgeReflectors, bandwidth, numBulge );
+    Zeros( bulgeScalars, numBulge, 1 );
+    if( numBulge == 0 )
+        return;
+
+    DistMatrix<F,STAR,STAR> V_STAR_STAR(g), householderScalars_STAR_STAR(g);
+
+    // Every process keeps a redundant copy of the reflectors of the current
+    // group so that the deferred updates need no communication to form them
+    Matrix<F> groupReflectors, groupScalars;
+
+    vector<Int> stepOffsets;
+    Int groupOffset = 0;
+    for( Int j0=0; j0<n-2; j0+=bandwidth )
+    {
+        const Int j1 = Min(j0+bandwidth,n-2);
+        const Int numSteps = NumBulgeSteps( n, bandwidth, j0 );
+        stepOffsets.resize( numSteps+1 );
+        stepOffsets[0] = 0;
+        for( Int k=0; k<numSteps; ++k )
+            stepOffsets[k+1] = stepOffsets[k] +
+              NumBulgeBlockReflectors( n, bandwidth, j0, j1, k );
+        const Int numGroup = stepOffsets[numSteps];
+        Zeros( groupReflectors, bandwidth, numGroup );
+        Zeros( groupScalars, numGroup, 1 );
+
+        for( Int j=j0; j<j1; ++j )
+            ChaseBulgeSweep
+            ( A, bandwidth, j, stepOffsets, j-j0,
+              groupReflectors, groupScalars );
+
+        // Apply the deferred updates to the rows above the group
+        auto ATop = A( IR(0,j0+1), ALL );
+        for( Int k=numSteps-1; k>=0; --k )
+        {
+            const Int s = j0+1+k*bandwidth;
+            const Int numBlock = stepOffsets[k+1]-stepOffsets[k];
+            const Int height = Min(n-s,numBlock-1+bandwidth);
+            V_STAR_STAR.Resize( height, numBlock );
+            householderScalars_STAR_STAR.Resize( numBlock, 1 );
+            FormBulgeBlock
+            ( stepOffsets[k], numBlock, height, groupReflectors, groupScalars,
+              V_STAR_STAR.Matrix(), householderScalars_STAR_STAR.Matrix() );
+            auto ATopBlock = ATop( ALL, IR(s,s+height) );
+            ApplyPackedReflectors
+            ( RIGHT, LOWER, VERTICAL, FORWARD, CONJUGATED, 0,
+              V_STAR_STAR, householderScalars_STAR_STAR, ATopBlock );
+        }
+
+        // Store the reflectors of the group
+        auto bulgeGroup =
+          bulgeReflectors( ALL, IR(groupOffset,groupOffset+numGroup) );
+        for( Int jLoc=0; jLoc<bulgeGroup.LocalWidth(); ++jLoc )
+        {
+            const Int jGroup = bulgeGroup.GlobalCol(jLoc);
+            for( Int iLoc=0; iLoc<bulgeGroup.LocalHeight(); ++iLoc )
+                bulgeGroup.SetLocal
+                ( iLoc, jLoc,
+                  groupReflectors(bulgeGroup.GlobalRow(iLoc),jGroup) );
+        }
+        for( Int t=0; t<numGroup; ++t )
+            bulgeScalars.SetLocal( groupOffset+t, 0, groupScalars(t) );
+        groupOffset += numGroup;
+    }
+}
+
+template<typename F>
+void TwoStage
+( Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  Matrix<F>& bulgeReflectors,
+  Matrix<F>& bulgeScalars,
+  const HessenbergCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int bandwidth = ClampBandwidth( n, ctrl.bandwidth );
+    ReduceToBand( A, householderScalars, bandwidth );
+
+    // Temporarily move the stage-one reflectors out of the band so that the
+    // bulges can be chased through the (zero) entries below it
+    Matrix<F> stageOneReflectors( A );
+    MakeTrapezoidal( LOWER, stageOneReflectors, -bandwidth-1 );
+    MakeTrapezoidal( UPPER, A, -bandwidth );
+
+    ChaseBulges( A, bandwidth, bulgeReflectors, bulgeScalars );
+
+    Axpy( F(1), stageOneReflectors, A );
+}
+
+template<typename F>
+void TwoStage
+( AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& householderScalars,
+  AbstractDistMatrix<F>& bulgeReflectorsPre,
+  AbstractDistMatrix<F>& bulgeScalarsPre,
+  const HessenbergCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( APre, householderScalars, bulgeReflectorsPre,
+                       bulgeScalarsPre )
+    )
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,MC,MR> bulgeReflectorsProx( bulgeReflectorsPre );
+    DistMatrixWriteProxy<F,F,STAR,STAR> bulgeScalarsProx( bulgeScalarsPre );
+    auto& A = AProx.Get();
+    auto& bulgeReflectors = bulgeReflectorsProx.Get();
+    auto& bulgeScalars = bulgeScalarsProx.Get();
+
+    const Int n = A.Height();
+    const Int bandwidth = ClampBandwidth( n, ctrl.bandwidth );
+    ReduceToBand( A, householderScalars, bandwidth );
+
+    DistMatrix<F> stageOneReflectors( A );
+    MakeTrapezoidal( LOWER, stageOneReflectors, -bandwidth-1 );
+    MakeTrapezoidal( UPPER, A, -bandwidth );
+
+    ChaseBulges( A, bandwidth, bulgeReflectors, bulgeScalars );
+
+    Axpy( F(1), stageOneReflectors, A );
+}
+
+} // namespace hessenberg
+} // namespace El
+
+#endif // ifndef EL_HESSENBERG_TWOSTAGE_HPP
@@ -0,0 +1,378 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace ls {
+
+namespace sketch {
+
+// Every routine below acts on the locally-owned rows of A (and of the
+// right-hand sides) and sums the contributions of the other owners over
+// 'comm', which is mpi::COMM_SELF in the sequential case.
+
+template<typename F>
+Base<F> TwoNorm( const Matrix<F>& uLoc, mpi::Comm comm )
+{
+    const Base<F> localNorm = FrobeniusNorm( uLoc );
+    return Sqrt( mpi::AllReduce( localNorm*localNorm, comm ) );
+}
+
+// Overwrite SA with the s x n sketch of the rows of A in ALoc
+template<typename F>
+void Form
+( const Matrix<F>& ALoc, Int s, Matrix<F>& SA, mpi::Comm comm,
+  const SketchedLeastSquaresCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int mLoc = ALoc.Height();
+    const Int n = ALoc.Width();
+    Zeros( SA, s, n );
+
+    if( ctrl.sketch == GAUSSIAN_SKETCH )
+    {
+        // Generate the columns of S for a block of rows at a time so that
+        // S is never stored in full
+        const Int bsize = Max( Blocksize(), s );
+        Matrix<F> SLoc;
+        for( Int i=0; i<mLoc; i+=bsize )
+        {
+            const Int nb = Min(bsize,mLoc-i);
+            Gaussian( SLoc, s, nb, F(0), Real(1)/Sqrt(Real(s)) );
+            auto A1 = ALoc( IR(i,i+nb), ALL );
+            Gemm( NORMAL, NORMAL, F(1), SLoc, A1, F(1), SA );
+        }
+    }
+    else if( ctrl.sketch == SPARSE_SKETCH )
+    {
+        const Int sparsity = Min( Max( ctrl.sparsity, Int(1) ), s );
+        const Real scale = Real(1)/Sqrt(Real(sparsity));
+
+        // The random generator is not thread-safe, so the destinations and
+        // signs of each local row are drawn up front
+        vector<Int> targets( mLoc*sparsity );
+        vector<Real> signs( mLoc*sparsity );
+        for( Int k=0; k<mLoc*sparsity; ++k )
+        {
+            targets[k] = SampleUniform( Int(0), s );
+            signs[k] = ( BooleanCoinFlip() ? scale : -scale );
+        }
+
+        // Each thread owns whole columns of the sketch and streams through
+        // the corresponding (contiguous) columns of A
+        EL_PARALLEL_FOR
+        for( Int j=0; j<n; ++j )
+        {
+            const F* aCol = ALoc.LockedBuffer(0,j);
+            F* saCol = SA.Buffer(0,j);
+            for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+            {
+                const F alpha = aCol[iLoc];
+                const Int* rowTargets = &targets[iLoc*sparsity];
+                const Real* rowSigns = &signs[iLoc*sparsity];
+                for( Int k=0; k<sparsity; ++k )
+                    saCol[rowTargets[k]] += rowSigns[k]*alpha;
+            }
+        }
+    }
+    else
+        LogicError("Unrecognized sketch type");
+
+    mpi::AllReduce( SA.Buffer(), s*n, comm );
+}
+
+template<typename F>
+void CheckTriangle( const Matrix<F>& R )
+{
+    EL_DEBUG_CSE
+    const Int n = R.Height();
+    for( Int j=0; j<n; ++j )
+        if( R.Get(j,j) == F(0) )
+            RuntimeError
+            ("The sketch was rank-deficient; the direct solver should be used");
+}
+
+// Solve min_x || A x - b ||_2 by running LSQR on the right-preconditioned
+// problem min_y || A inv(R) y - b ||_2 and setting x := inv(R) y.
+// Returns the number of iterations.
+template<typename F>
+Int LSQR
+( const Matrix<F>& ALoc,
+  const Matrix<F>& R,
+  const Matrix<F>& bLoc,
+        Matrix<F>& x,
+  mpi::Comm comm,
+  const SketchedLeastSquaresCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = ALoc.Width();
+
+    Matrix<F> u, v, w, z;
+
+    // u := M v - alpha u, where M = A inv(R)
+    auto applyM = [&]( Real alpha )
+    {
+        z = v;
+        Trsv( UPPER, NORMAL, NON_UNIT, R, z );
+        Gemv( NORMAL, F(1), ALoc, z, F(-alpha), u );
+    };
+    // v := M^H u - beta v
+    auto applyMAdj = [&]( Real beta )
+    {
+        Gemv( ADJOINT, F(1), ALoc, u, z );
+        mpi::AllReduce( z.Buffer(), n, comm );
+        Trsv( UPPER, ADJOINT, NON_UNIT, R, z );
+        v *= -beta;
+        v += z;
+    };
+
+    Zeros( x, n, 1 );
+    u = bLoc;
+    Real beta = TwoNorm( u, comm );
+    const Real bNorm = beta;
+    if( beta == Real(0) )
+        return 0;
+    u *= Real(1)/beta;
+
+    Zeros( v, n, 1 );
+    applyMAdj( Real(0) );
+    Real alpha = FrobeniusNorm( v );
+    if( alpha == Real(0) )
+        return 0;
+    v *= Real(1)/alpha;
+
+    w = v;
+    Real phiBar = beta, rhoBar = alpha;
+    Real MNormSquared = 0;
+    Int numIts = 0;
+    while( true )
+    {
+        ++numIts;
+
+        // Continue the Golub-Kahan bidiagonalization of M
+        applyM( alpha );
+        beta = TwoNorm( u, comm );
+        if( beta > Real(0) )
+            u *= Real(1)/beta;
+        MNormSquared += alpha*alpha + beta*beta;
+        applyMAdj( beta );
+        alpha = FrobeniusNorm( v );
+        if( alpha > Real(0) )
+            v *= Real(1)/alpha;
+
+        // Apply the next plane rotation to the bidiagonal
+        const Real rho = SafeNorm( rhoBar, beta );
+        const Real c = rhoBar / rho;
+        const Real sn = beta / rho;
+        const Real theta = sn*alpha;
+        rhoBar = -c*alpha;
+        const Real phi = c*phiBar;
+        phiBar = sn*phiBar;
+
+        // Update the (preconditioned) solution and the search direction
+        Axpy( phi/rho, w, x );
+        w *= -theta/rho;
+        w += v;
+
+        // Test for convergence using the estimates from Paige and Saunders
+        const Real MNorm = Sqrt( MNormSquared );
+        const Real rNorm = phiBar;
+        const Real MAdjRNorm = phiBar*alpha*Abs(c);
+        const Real xNorm = FrobeniusNorm( x );
+        if( ctrl.progress )
+            Output
+            ("iter ",numIts,": || r ||_2 = ",rNorm,
+             ", || M^H r ||_2 = ",MAdjRNorm);
+        if( rNorm <= ctrl.tol*(bNorm+MNorm*xNorm) ||
+            MAdjRNorm <= ctrl.tol*MNorm*rNorm )
+            break;
+        if( numIts == ctrl.maxIts )
+            RuntimeError("LSQR did not converge within ",numIts," iterations");
+    }
+    Trsv( UPPER, NORMAL, NON_UNIT, R, x );
+    return numIts;
+}
+
+template<typename F>
+void Solve
+( const Matrix<F>& ALoc,
+  const Matrix<F>& R,
+  const Matrix<F>& BLoc,
+        Matrix<F>& X,
+  mpi::Comm comm,
+  const SketchedLeastSquaresCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = ALoc.Width();
+    const Int numRHS = BLoc.Width();
+    Zeros( X, n, numRHS );
+    Matrix<F> x;
+    for( Int j=0; j<numRHS; ++j )
+    {
+        const Int numIts = LSQR( ALoc, R, BLoc(ALL,IR(j)), x, comm, ctrl );
+        if( ctrl.progress )
+            Output("LSQR converged in ",numIts," iterations");
+        auto xj = X( ALL, IR(j) );
+        xj = x;
+    }
+}
+
+template<typename Real>
+Int SketchSize( Int n, const SketchedLeastSquaresCtrl<Real>& ctrl )
+{
+    return Max( Int(Ceil(ctrl.oversample*n)), n );
+}
+
+} // namespace sketch
+
+} // namespace ls
+
+template<typename F>
+void LeastSquares
+( Orientation orientation,
+  const Matrix<F>& A,
+  const Matrix<F>& B,
+        Matrix<F>& X,
+  const SketchedLeastSquaresCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int s = ls::sketch::SketchSize( n, ctrl );
+    if( orientation != NORMAL || s >= m )
+    {
+        LeastSquares( orientation, A, B, X );
+        return;
+    }
+    mpi::Comm comm = mpi::COMM_SELF;
+
+    Timer timer;
+    if( ctrl.time )
+        timer.Start();
+    Matrix<F> R;
+    ls::sketch::Form( A, s, R, comm, ctrl );
+    if( ctrl.time )
+    {
+        Output("Sketch: ",timer.Stop()," secs");
+        timer.Start();
+    }
+    qr::ExplicitTriang( R );
+    ls::sketch::CheckTriangle( R );
+    if( ctrl.time )
+    {
+        Output("QR:     ",timer.Stop()," secs");
+        timer.Start();
+    }
+    ls::sketch::Solve( A, R, B, X, comm, ctrl );
+    if( ctrl.time )
+        Output("LSQR:   ",timer.Stop()," secs");
+}
+
+template<typename F>
+void LeastSquares
+( Orientation orientation,
+  const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& B,
+        AbstractDistMatrix<F>& X,
+  const SketchedLeastSquaresCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int s = ls::sketch::SketchSize( n, ctrl );
+    if( orientation != NORMAL || s >= m )
+    {
+        LeastSquares( orientation, A, B, X );
+        return;
+    }
+    const Grid& g = A.Grid();
+
+    // Distributing whole rows of A (and B) means that multiplication by A
+    // needs no communication and the adjoint multiply only needs a sum of
+    // n entries over the process grid
+    DistMatrix<F,VC,STAR> A_VC_STAR( A );
+    DistMatrix<F,VC,STAR> B_VC_STAR(g);
+    B_VC_STAR.AlignWith( A_VC_STAR );
+    B_VC_STAR = B;
+    mpi::Comm comm = A_VC_STAR.DistComm();
+
+    Timer timer;
+    if( ctrl.time )
+    {
+        mpi::Barrier( g.Comm() );
+        if( g.Rank() == 0 )
+            timer.Start();
+    }
+    DistMatrix<F,STAR,STAR> R_STAR_STAR(g);
+    R_STAR_STAR.Resize( s, n );
+    ls::sketch::Form
+    ( A_VC_STAR.LockedMatrix(), s, R_STAR_STAR.Matrix(), comm, ctrl );
+    if( ctrl.time )
+    {
+        mpi::Barrier( g.Comm() );
+        if( g.Rank() == 0 )
+        {
+            Output("Sketch: ",timer.Stop()," secs");
+            timer.Start();
+        }
+    }
+
+    // Factor the sketch over the entire grid
+    DistMatrix<F> R( R_STAR_STAR );
+    qr::ExplicitTriang( R );
+    R_STAR_STAR = R;
+    ls::sketch::CheckTriangle( R_STAR_STAR.LockedMatrix() );
+    if( ctrl.time )
+    {
+        mpi::Barrier( g.Comm() );
+        if( g.Rank() == 0 )
+        {
+            Output("QR:     ",timer.Stop()," secs");
+            timer.Start();
+        }
+    }
+
+    // Every process redundantly carries the n-vectors of LSQR
+    DistMatrix<F,STAR,STAR> X_STAR_STAR(g);
+    X_STAR_STAR.Resize( n, B.Width() );
+    auto lsqrCtrl = ctrl;
+    lsqrCtrl.progress = ctrl.progress && g.Rank() == 0;
+    ls::sketch::Solve
+    ( A_VC_STAR.LockedMatrix(), R_STAR_STAR.LockedMatrix(),
+      B_VC_STAR.LockedMatrix(), X_STAR_STAR.Matrix(), comm, lsqrCtrl );
+    Copy( X_STAR_STAR, X );
+    if( ctrl.time )
+    {
+        mpi::Barrier( g.Comm() );
+        if( g.Rank() == 0 )
+            Output("LSQR:   ",timer.Stop()," secs");
+    }
+}
+
+#define PROTO(F) \
+  template void LeastSquares \
+  ( Orientation orientation, \
+    const Matrix<F>& A, \
+    const Matrix<F>& B, \
+          Matrix<F>& X, \
+    const SketchedLeastSquaresCtrl<Base<F>>& ctrl ); \
+  template void LeastSquares \
+  ( Orientation orientation, \
+    const AbstractDistMatrix<F>& A, \
+    const AbstractDistMatrix<F>& B, \
+          AbstractDistMatrix<F>& X, \
+    const SketchedLeastSquaresCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -14,6 +14,10 @@
 #include "./Cholesky/ReverseUpperVariant3.hpp"
 #include "./Cholesky/PivotedLowerVariant3.hpp"
 #include "./Cholesky/PivotedUpperVariant3.hpp"
+#include "./Cholesky/Block.hpp"
+#include "./Cholesky/Tile.hpp"
+#include "./Cholesky/OutOfCore.hpp"
+#include "./Cholesky/RFP.hpp"
 #include "./Cholesky/SolveAfter.hpp"
 
 #include "./Cholesky/LowerMod.hpp"
@@ -99,16 +103,54 @@ void Cholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack )
     if( scalapack )
     {
         cholesky::ScaLAPACKHelper( uplo, A );
+        return;
     }
-    else
+    Workspace<F> workspace;
+    Cholesky( uplo, A, workspace );
+}
+
+template<typename F>
+void Cholesky
+( UpperOrLower uplo, AbstractDistMatrix<F>& A, Workspace<F>& workspace )
+{
+    EL_DEBUG_CSE
+    // Avoid redistributing conformally-blocked [MC,MR] block matrices (which
+    // only exist on the CPU)
+    if( A.Wrap() == BLOCK && A.ColDist() == MC && A.RowDist() == MR &&
+        A.GetLocalDevice() == Device::CPU )
     {
-        if( uplo == LOWER )
-            cholesky::LowerVariant3Blocked( A );
-        else
-            cholesky::UpperVariant3Blocked( A );
+        auto& ABlock = static_cast<DistMatrix<F,MC,MR,BLOCK>&>(A);
+        if( cholesky::BlockConformal( ABlock ) )
+        {
+            if( uplo == LOWER )
+                cholesky::LowerBlock( ABlock );
+            else
+                cholesky::UpperBlock( ABlock );
+            return;
+        }
     }
+
+    workspace.Reserve( cholesky::WorkspaceSize( uplo, A ) );
+    if( uplo == LOWER )
+        cholesky::LowerVariant3Blocked( A, workspace );
+    else
+        cholesky::UpperVariant3Blocked( A, workspace );
 }
 
+namespace cholesky {
+
+template<typename F>
+Int WorkspaceSize( UpperOrLower uplo, const AbstractDistMatrix<F>& A )
+{
+    EL_DEBUG_CSE
+    if( uplo == LOWER )
+        return LowerVariant3WorkspaceSize( A.Height(), A.Grid() );
+    else
+        return UpperVariant3WorkspaceSize( A.Height(), A.Grid() );
+}
+
+} // namespace cholesky
+
 template<typename F> 
 void Cholesky
 ( UpperOrLower uplo, AbstractDistMatrix<F>& A, DistPermutation& p )
@@ -125,6 +167,20 @@ void Cholesky
 ( UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A )
 { Cholesky( uplo, A.Matrix() ); }
 
+template<typename F>
+void Cholesky( RFPMatrix<F>& A )
+{
+    EL_DEBUG_CSE
+    cholesky::RFP( A );
+}
+
+template<typename F>
+void Cholesky( DistRFPMatrix<F>& A )
+{
+    EL_DEBUG_CSE
+    cholesky::RFP( A );
+}
+
 template<typename F> 
 void ReverseCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A )
 {
@@ -207,6 +263,10 @@ void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& APre )
   template void Cholesky( UpperOrLower uplo, Matrix<F>& A ); \
   template void Cholesky \
   ( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack ); \
+  template void Cholesky \
+  ( UpperOrLower uplo, AbstractDistMatrix<F>& A, Workspace<F>& workspace ); \
+  template Int cholesky::WorkspaceSize \
+  ( UpperOrLower uplo, const AbstractDistMatrix<F>& A ); \
   template void Cholesky( UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A ); \
   template void ReverseCholesky( UpperOrLower uplo, Matrix<F>& A ); \
   template void ReverseCholesky \
@@ -242,19 +302,43 @@ void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& APre )
   ( UpperOrLower uplo, Orientation orientation, \
     const AbstractDistMatrix<F>& A, \
     const DistPermutation& p, \
-          AbstractDistMatrix<F>& B ); 
+          AbstractDistMatrix<F>& B ); \
+  template void cholesky::Tile \
+  ( UpperOrLower uplo, Matrix<F>& A, Int tileSize ); \
+  template void Cholesky( RFPMatrix<F>& A ); \
+  template void Cholesky( DistRFPMatrix<F>& A ); \
+  template void cholesky::SolveAfter \
+  ( Orientation orientation, \
+    const RFPMatrix<F>& A, \
+          Matrix<F>& B ); \
+  template void cholesky::SolveAfter \
+  ( Orientation orientation, \
+    const DistRFPMatrix<F>& A, \
+          AbstractDistMatrix<F>& B );
 
-#define PROTO(F) \
+#define PROTO_OUT_OF_CORE(F) \
+  template void Cholesky( UpperOrLower uplo, OutOfCoreMatrix<F>& A ); \
+  template void cholesky::SolveAfter \
+  ( UpperOrLower uplo, Orientation orientation, \
+    const OutOfCoreMatrix<F>& A, \
+          AbstractDistMatrix<F>& B );
+
+#define PROTO_EXTENDED(F) \
   PROTO_BASE(F) \
+  PROTO_OUT_OF_CORE(F)
+
+#define PROTO(F) \
+  PROTO_EXTENDED(F) \
   template void HPSDCholesky( UpperOrLower uplo, Matrix<F>& A ); \
   template void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A );
 
-#define PROTO_DOUBLEDOUBLE PROTO_BASE(DoubleDouble)
-#define PROTO_QUADDOUBLE PROTO_BASE(QuadDouble)
-#define PROTO_COMPLEX_DOUBLEDOUBLE PROTO_BASE(Complex<DoubleDouble>)
-#define PROTO_COMPLEX_QUADDOUBLE PROTO_BASE(Complex<QuadDouble>)
-#define PROTO_QUAD PROTO_BASE(Quad)
-#define PROTO_COMPLEX_QUAD PROTO_BASE(Complex<Quad>)
+#define PROTO_DOUBLEDOUBLE PROTO_EXTENDED(DoubleDouble)
+#define PROTO_QUADDOUBLE PROTO_EXTENDED(QuadDouble)
+#define PROTO_COMPLEX_DOUBLEDOUBLE PROTO_EXTENDED(Complex<DoubleDouble>)
+#define PROTO_COMPLEX_QUADDOUBLE PROTO_EXTENDED(Complex<QuadDouble>)
+#define PROTO_QUAD PROTO_EXTENDED(Quad)
+#define PROTO_COMPLEX_QUAD PROTO_EXTENDED(Complex<Quad>)
+// BigFloat is not supported out-of-core since its data is not contiguous
 #define PROTO_BIGFLOAT PROTO_BASE(BigFloat)
 #define PROTO_COMPLEX_BIGFLOAT PROTO_BASE(Complex<BigFloat>)
 
@@ -0,0 +1,137 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CHOLESKY_BLOCK_HPP
+#define EL_CHOLESKY_BLOCK_HPP
+
+namespace El {
+namespace cholesky {
+
+// The right-looking factorization can operate directly on an [MC,MR] block
+// distribution when its row and column blockings coincide, so that each
+// diagonal block of the distribution is a diagonal block of the sweep
+template<typename F>
+bool BlockConformal( const DistMatrix<F,MC,MR,BLOCK>& A )
+{
+    return A.BlockHeight() == A.BlockWidth() && A.ColCut() == A.RowCut();
+}
+
+template<typename F>
+void LowerBlock( DistMatrix<F,MC,MR,BLOCK>& A )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+      if( !BlockConformal( A ) )
+          LogicError("The row and column blockings of A must coincide");
+    )
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    const Int bsize = A.BlockHeight();
+    const Int cut = A.ColCut();
+
+    DistMatrix<F,STAR,STAR,BLOCK> A11_STAR_STAR(g);
+    DistMatrix<F,MC,  STAR,BLOCK> A21_MC_STAR(g);
+    DistMatrix<F,MR,  STAR,BLOCK> A21_MR_STAR(g);
+
+    Int k = 0;
+    while( k < n )
+    {
+        const Int nb = Min( bsize-Mod(cut+k,bsize), n-k );
+        const Range<Int> ind1( k,    k+nb ),
+                         ind2( k+nb, n    );
+
+        auto A11 = A( ind1, ind1 );
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+
+        A11_STAR_STAR = A11;
+        Cholesky( LOWER, A11_STAR_STAR.Matrix() );
+        A11 = A11_STAR_STAR;
+
+        // Only the process column owning A21 performs the panel solve
+        if( A21.LocalWidth() != 0 )
+            Trsm
+            ( RIGHT, LOWER, ADJOINT, NON_UNIT,
+              F(1), A11_STAR_STAR.LockedMatrix(), A21.Matrix() );
+
+        A21_MC_STAR.AlignWith( A22 );
+        A21_MC_STAR = A21;
+        A21_MR_STAR.AlignWith( A22 );
+        A21_MR_STAR = A21_MC_STAR;
+
+        // A22 := A22 - A21[MC,* ] (A21[MR,* ])^H
+        LocalTrrk
+        ( LOWER, ADJOINT, F(-1), A21_MC_STAR, A21_MR_STAR, F(1), A22 );
+
+        k += nb;
+    }
+}
+
+template<typename F>
+void UpperBlock( DistMatrix<F,MC,MR,BLOCK>& A )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+      if( !BlockConformal( A ) )
+          LogicError("The row and column blockings of A must coincide");
+    )
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    const Int bsize = A.BlockHeight();
+    const Int cut = A.ColCut();
+
+    DistMatrix<F,STAR,STAR,BLOCK> A11_STAR_STAR(g);
+    DistMatrix<F,STAR,MR,  BLOCK> A12_STAR_MR(g);
+    DistMatrix<F,MC,  STAR,BLOCK> A12Adj_MC_STAR(g);
+    DistMatrix<F,MR,  STAR,BLOCK> A12Adj_MR_STAR(g);
+
+    Int k = 0;
+    while( k < n )
+    {
+        const Int nb = Min( bsize-Mod(cut+k,bsize), n-k );
+        const Range<Int> ind1( k,    k+nb ),
+                         ind2( k+nb, n    );
+
+        auto A11 = A( ind1, ind1 );
+        auto A12 = A( ind1, ind2 );
+        auto A22 = A( ind2, ind2 );
+
+        A11_STAR_STAR = A11;
+        Cholesky( UPPER, A11_STAR_STAR.Matrix() );
+        A11 = A11_STAR_STAR;
+
+        // Only the process row owning A12 performs the panel solve
+        if( A12.LocalHeight() != 0 )
+            Trsm
+            ( LEFT, UPPER, ADJOINT, NON_UNIT,
+              F(1), A11_STAR_STAR.LockedMatrix(), A12.Matrix() );
+
+        A12_STAR_MR.AlignWith( A22 );
+        A12_STAR_MR = A12;
+        A12Adj_MR_STAR.AlignWith( A22 );
+        Adjoint( A12_STAR_MR, A12Adj_MR_STAR );
+        A12Adj_MC_STAR.AlignWith( A22 );
+        A12Adj_MC_STAR = A12Adj_MR_STAR;
+
+        // A22 := A22 - (A12^H[MC,* ]) (A12^H[MR,* ])^H
+        LocalTrrk
+        ( UPPER, ADJOINT,
+          F(-1), A12Adj_MC_STAR, A12Adj_MR_STAR, F(1), A22 );
+
+        k += nb;
+    }
+}
+
+} // namespace cholesky
+} // namespace El
+
+#endif // ifndef EL_CHOLESKY_BLOCK_HPP
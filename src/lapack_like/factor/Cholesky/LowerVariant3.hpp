@@ -67,8 +67,22 @@ void LowerVariant3Blocked( Matrix<F>& A )
     }
 }
 
+// An upper bound on the workspace entries that any process draws on
+inline Int LowerVariant3WorkspaceSize( Int n, const Grid& grid )
+{
+    const Int nb = Min(Blocksize(),n);
+    const Int r = grid.Height();
+    const Int c = grid.Width();
+    const Int p = grid.Size();
+    return MaxWorkspaceSize( nb, nb ) +
+           2*MaxWorkspaceSize( n-nb, nb, p ) +
+           MaxWorkspaceSize( nb, n-nb, 1, r ) +
+           MaxWorkspaceSize( nb, n-nb, 1, c );
+}
+
 template<typename F>
-void LowerVariant3Blocked( AbstractDistMatrix<F>& APre )
+void LowerVariant3Blocked
+( AbstractDistMatrix<F>& APre, Workspace<F>& workspace )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -99,19 +113,23 @@ void LowerVariant3Blocked( AbstractDistMatrix<F>& APre )
         auto A21 = A( ind2, ind1 );
         auto A22 = A( ind2, ind2 );
 
+        typename Workspace<F>::Scope scope( workspace );
+        const auto A22Data = A22.DistData();
+        workspace.Attach( A11_STAR_STAR, nb, nb );
+        workspace.Attach( A21_VC_STAR, n-(k+nb), nb, A22Data );
+        workspace.Attach( A21_VR_STAR, n-(k+nb), nb, A22Data );
+        workspace.Attach( A21Trans_STAR_MC, nb, n-(k+nb), A22Data );
+        workspace.Attach( A21Adj_STAR_MR, nb, n-(k+nb), A22Data );
+
         A11_STAR_STAR = A11;
         Cholesky( LOWER, A11_STAR_STAR );
         A11 = A11_STAR_STAR;
 
-        A21_VC_STAR.AlignWith( A22 );
         A21_VC_STAR = A21;
         LocalTrsm
         ( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11_STAR_STAR, A21_VC_STAR );
 
-        A21_VR_STAR.AlignWith( A22 );
         A21_VR_STAR = A21_VC_STAR;
-        A21Trans_STAR_MC.AlignWith( A22 );
-        A21Adj_STAR_MR.AlignWith( A22 );
         Transpose( A21_VC_STAR, A21Trans_STAR_MC );
         Adjoint( A21_VR_STAR, A21Adj_STAR_MR );
 
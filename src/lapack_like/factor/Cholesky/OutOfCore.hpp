@@ -0,0 +1,199 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CHOLESKY_OUTOFCORE_HPP
+#define EL_CHOLESKY_OUTOFCORE_HPP
+
+#include "../OutOfCore.hpp"
+
+namespace El {
+namespace cholesky {
+
+template<typename F>
+void LowerOutOfCore( OutOfCoreMatrix<F>& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+
+    // A(k:n,k) -= L(k:n,j) L(k,j)^H
+    auto update =
+      [&]( DistMatrix<F>& Pj, Int j, DistMatrix<F>& Pk, Int k )
+      {
+          const Range<Int> indK = A.PanelRange( k );
+          const Range<Int> ind1( indK.beg, indK.end ), ind2( indK.end, n );
+          auto Lj1 = Pj( ind1, ALL );
+          auto Lj2 = Pj( ind2, ALL );
+          auto A11 = Pk( ind1, ALL );
+          auto A21 = Pk( ind2, ALL );
+          Herk( LOWER, NORMAL, Real(-1), Lj1, Real(1), A11 );
+          Gemm( NORMAL, ADJOINT, F(-1), Lj2, Lj1, F(1), A21 );
+      };
+    auto factor =
+      [&]( DistMatrix<F>& Pk, Int k )
+      {
+          const Range<Int> indK = A.PanelRange( k );
+          const Range<Int> ind1( indK.beg, indK.end ), ind2( indK.end, n );
+          auto A11 = Pk( ind1, ALL );
+          auto A21 = Pk( ind2, ALL );
+          Cholesky( LOWER, A11 );
+          Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11, A21 );
+      };
+    ooc::LeftLooking( A, A.NumPanels(), update, factor );
+}
+
+template<typename F>
+void UpperOutOfCore( OutOfCoreMatrix<F>& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+
+    // U(j,k) := inv(U(j,j))^H (A(j,k) - U(0:j,j)^H U(0:j,k)), which requires
+    // the previous panels to be streamed in increasing order
+    auto update =
+      [&]( DistMatrix<F>& Pj, Int j, DistMatrix<F>& Pk, Int k )
+      {
+          const Range<Int> indJ = A.PanelRange( j );
+          const Range<Int> ind0( 0, indJ.beg ), ind1( indJ.beg, indJ.end );
+          auto U0j = Pj( ind0, ALL );
+          auto U1j = Pj( ind1, ALL );
+          auto A0k = Pk( ind0, ALL );
+          auto A1k = Pk( ind1, ALL );
+          if( indJ.beg > 0 )
+              Gemm( ADJOINT, NORMAL, F(-1), U0j, A0k, F(1), A1k );
+          Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), U1j, A1k );
+      };
+    auto factor =
+      [&]( DistMatrix<F>& Pk, Int k )
+      {
+          const Range<Int> indK = A.PanelRange( k );
+          const Range<Int> ind0( 0, indK.beg ), ind1( indK.beg, indK.end );
+          auto U01 = Pk( ind0, ALL );
+          auto A11 = Pk( ind1, ALL );
+          if( indK.beg > 0 )
+              Herk( UPPER, ADJOINT, Real(-1), U01, Real(1), A11 );
+          Cholesky( UPPER, A11 );
+      };
+    ooc::LeftLooking( A, A.NumPanels(), update, factor );
+}
+
+template<typename F>
+void SolveAfter
+( UpperOrLower uplo,
+  Orientation orientation,
+  const OutOfCoreMatrix<F>& A,
+        AbstractDistMatrix<F>& BPre )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    if( A.Height() != BPre.Height() )
+        LogicError("A and B must be the same height");
+    if( A.Grid() != BPre.Grid() )
+        LogicError("A and B must be distributed over the same grid");
+    const Int n = A.Height();
+    const Int numPanels = A.NumPanels();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> BProx( BPre );
+    auto& B = BProx.Get();
+
+    if( orientation == TRANSPOSE )
+        Conjugate( B );
+    if( uplo == LOWER )
+    {
+        // B := inv(L) B
+        ooc::PanelStream<F> forward( A, ooc::PanelSequence(0,numPanels) );
+        while( !forward.Done() )
+        {
+            Int k;
+            auto& Pk = forward.Next( k );
+            const Range<Int> indK = A.PanelRange( k );
+            const Range<Int> ind1( indK.beg, indK.end ), ind2( indK.end, n );
+            auto L11 = Pk( ind1, ALL );
+            auto L21 = Pk( ind2, ALL );
+            auto B1 = B( ind1, ALL );
+            auto B2 = B( ind2, ALL );
+            Trsm( LEFT, LOWER, NORMAL, NON_UNIT, F(1), L11, B1 );
+            Gemm( NORMAL, NORMAL, F(-1), L21, B1, F(1), B2 );
+        }
+
+        // B := inv(L)^H B
+        ooc::PanelStream<F>
+          backward( A, ooc::PanelSequence(0,numPanels,true) );
+        while( !backward.Done() )
+        {
+            Int k;
+            auto& Pk = backward.Next( k );
+            const Range<Int> indK = A.PanelRange( k );
+            const Range<Int> ind1( indK.beg, indK.end ), ind2( indK.end, n );
+            auto L11 = Pk( ind1, ALL );
+            auto L21 = Pk( ind2, ALL );
+            auto B1 = B( ind1, ALL );
+            auto B2 = B( ind2, ALL );
+            Gemm( ADJOINT, NORMAL, F(-1), L21, B2, F(1), B1 );
+            Trsm( LEFT, LOWER, ADJOINT, NON_UNIT, F(1), L11, B1 );
+        }
+    }
+    else
+    {
+        // B := inv(U)^H B
+        ooc::PanelStream<F> forward( A, ooc::PanelSequence(0,numPanels) );
+        while( !forward.Done() )
+        {
+            Int k;
+            auto& Pk = forward.Next( k );
+            const Range<Int> indK = A.PanelRange( k );
+            const Range<Int> ind0( 0, indK.beg ), ind1( indK.beg, indK.end );
+            auto U01 = Pk( ind0, ALL );
+            auto U11 = Pk( ind1, ALL );
+            auto B0 = B( ind0, ALL );
+            auto B1 = B( ind1, ALL );
+            if( indK.beg > 0 )
+                Gemm( ADJOINT, NORMAL, F(-1), U01, B0, F(1), B1 );
+            Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), U11, B1 );
+        }
+
+        // B := inv(U) B
+        ooc::PanelStream<F>
+          backward( A, ooc::PanelSequence(0,numPanels,true) );
+        while( !backward.Done() )
+        {
+            Int k;
+            auto& Pk = backward.Next( k );
+            const Range<Int> indK = A.PanelRange( k );
+            const Range<Int> ind0( 0, indK.beg ), ind1( indK.beg, indK.end );
+            auto U01 = Pk( ind0, ALL );
+            auto U11 = Pk( ind1, ALL );
+            auto B0 = B( ind0, ALL );
+            auto B1 = B( ind1, ALL );
+            Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), U11, B1 );
+            if( indK.beg > 0 )
+                Gemm( NORMAL, NORMAL, F(-1), U01, B1, F(1), B0 );
+        }
+    }
+    if( orientation == TRANSPOSE )
+        Conjugate( B );
+}
+
+} // namespace cholesky
+
+template<typename F>
+void Cholesky( UpperOrLower uplo, OutOfCoreMatrix<F>& A )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Can only compute Cholesky factor of square matrices");
+    if( uplo == LOWER )
+        cholesky::LowerOutOfCore( A );
+    else
+        cholesky::UpperOutOfCore( A );
+}
+
+} // namespace El
+
+#endif // ifndef EL_CHOLESKY_OUTOFCORE_HPP
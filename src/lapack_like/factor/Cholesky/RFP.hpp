@@ -0,0 +1,116 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CHOLESKY_RFP_HPP
+#define EL_CHOLESKY_RFP_HPP
+
+namespace El {
+namespace cholesky {
+
+// The lower Cholesky factor is computed in place as in LAPACK's xPFTRF:
+//
+//   L11 L11^H = A11,
+//   L21       = A21 inv(L11)^H,
+//   U22^H U22 = A22 - L21 L21^H,
+//
+// where U22 = L22^H is stored in the upper triangle of Block22.
+
+template<typename F>
+void RFP( RFPMatrix<F>& A )
+{
+    EL_DEBUG_CSE
+    auto A11 = A.Block11();
+    auto A21 = A.Block21();
+    auto A22 = A.Block22();
+    Cholesky( LOWER, A11 );
+    Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11, A21 );
+    Herk( UPPER, NORMAL, Base<F>(-1), A21, Base<F>(1), A22 );
+    Cholesky( UPPER, A22 );
+}
+
+template<typename F>
+void RFP( DistRFPMatrix<F>& A )
+{
+    EL_DEBUG_CSE
+    auto A11 = A.Block11();
+    auto A21 = A.Block21();
+    auto A22 = A.Block22();
+    Cholesky( LOWER, A11 );
+    Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11, A21 );
+    Herk( UPPER, NORMAL, Base<F>(-1), A21, Base<F>(1), A22 );
+    Cholesky( UPPER, A22 );
+}
+
+template<typename F>
+void SolveAfter
+( Orientation orientation,
+  const RFPMatrix<F>& A,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != B.Height() )
+        LogicError("A and B must be the same height");
+    const Int n = A.Height();
+    const Int n1 = A.FirstSize();
+    auto L11 = A.LockedBlock11();
+    auto L21 = A.LockedBlock21();
+    auto U22 = A.LockedBlock22();
+    auto B1 = B( IR(0,n1), ALL );
+    auto B2 = B( IR(n1,n), ALL );
+
+    if( orientation == TRANSPOSE )
+        Conjugate( B );
+    // B := inv(L) B
+    Trsm( LEFT, LOWER, NORMAL, NON_UNIT, F(1), L11, B1 );
+    Gemm( NORMAL, NORMAL, F(-1), L21, B1, F(1), B2 );
+    Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), U22, B2 );
+    // B := inv(L)^H B
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), U22, B2 );
+    Gemm( ADJOINT, NORMAL, F(-1), L21, B2, F(1), B1 );
+    Trsm( LEFT, LOWER, ADJOINT, NON_UNIT, F(1), L11, B1 );
+    if( orientation == TRANSPOSE )
+        Conjugate( B );
+}
+
+template<typename F>
+void SolveAfter
+( Orientation orientation,
+  const DistRFPMatrix<F>& A,
+        AbstractDistMatrix<F>& BPre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( A.LockedPacked(), BPre ))
+    if( A.Height() != BPre.Height() )
+        LogicError("A and B must be the same height");
+    DistMatrixReadWriteProxy<F,F,MC,MR> BProx( BPre );
+    auto& B = BProx.Get();
+
+    const Int n = A.Height();
+    const Int n1 = A.FirstSize();
+    auto L11 = A.LockedBlock11();
+    auto L21 = A.LockedBlock21();
+    auto U22 = A.LockedBlock22();
+    auto B1 = B( IR(0,n1), ALL );
+    auto B2 = B( IR(n1,n), ALL );
+
+    if( orientation == TRANSPOSE )
+        Conjugate( B );
+    Trsm( LEFT, LOWER, NORMAL, NON_UNIT, F(1), L11, B1 );
+    Gemm( NORMAL, NORMAL, F(-1), L21, B1, F(1), B2 );
+    Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), U22, B2 );
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), U22, B2 );
+    Gemm( ADJOINT, NORMAL, F(-1), L21, B2, F(1), B1 );
+    Trsm( LEFT, LOWER, ADJOINT, NON_UNIT, F(1), L11, B1 );
+    if( orientation == TRANSPOSE )
+        Conjugate( B );
+}
+
+} // namespace cholesky
+} // namespace El
+
+#endif // ifndef EL_CHOLESKY_RFP_HPP
@@ -0,0 +1,209 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CHOLESKY_TILE_HPP
+#define EL_CHOLESKY_TILE_HPP
+
+#include "../TileTasks.hpp"
+
+namespace El {
+namespace cholesky {
+
+// Each tile of the referenced triangle of A is a node of the DAG, and
+// tile (i,j) is overwritten by exactly one chain of kernels:
+//
+//   POTRF(k):   A(k,k) := chol(A(k,k))
+//   TRSM(i,k):  A(i,k) := A(i,k) inv(A(k,k))^H             (after POTRF(k))
+//   HERK(j,k):  A(j,j) := A(j,j) - A(j,k) A(j,k)^H          (after TRSM(j,k))
+//   GEMM(i,j,k):A(i,j) := A(i,j) - A(i,k) A(j,k)^H   (after TRSM(i,k),TRSM(j,k))
+//
+// so that the factorization of tile k+1 may begin as soon as its own
+// updates from step k complete rather than after the entire trailing update.
+
+template<typename F>
+void LowerTile( Matrix<F>& A, Int tileSize )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Int numTiles = tile::NumTiles( n, tileSize );
+#ifdef EL_HYBRID
+    if( !omp_in_parallel() )
+    {
+        // Launch a team and spawn the DAG from a single thread
+        #pragma omp parallel
+        #pragma omp single
+        LowerTile( A, tileSize );
+        return;
+    }
+
+    // Dependency tokens
+    vector<char> tokens( numTiles*numTiles );
+    char* tok = tokens.data();
+#endif
+    auto tileInd = [&]( Int k ) { return tile::TileRange( k, tileSize, n ); };
+    tile::TaskErrors errors;
+
+    for( Int k=0; k<numTiles; ++k )
+    {
+#ifdef EL_HYBRID
+        #pragma omp task default(shared) firstprivate(k) \
+          depend(inout:tok[k+k*numTiles])
+#endif
+        errors.Run( [&,k]() {
+            auto Akk = A( tileInd(k), tileInd(k) );
+            El::Cholesky( LOWER, Akk );
+        });
+
+        for( Int i=k+1; i<numTiles; ++i )
+        {
+#ifdef EL_HYBRID
+            #pragma omp task default(shared) firstprivate(i,k) \
+              depend(in:tok[k+k*numTiles]) depend(inout:tok[i+k*numTiles])
+#endif
+            errors.Run( [&,i,k]() {
+                auto Akk = A( tileInd(k), tileInd(k) );
+                auto Aik = A( tileInd(i), tileInd(k) );
+                Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), Akk, Aik );
+            });
+        }
+
+        for( Int j=k+1; j<numTiles; ++j )
+        {
+#ifdef EL_HYBRID
+            #pragma omp task default(shared) firstprivate(j,k) \
+              depend(in:tok[j+k*numTiles]) depend(inout:tok[j+j*numTiles])
+#endif
+            errors.Run( [&,j,k]() {
+                auto Ajk = A( tileInd(j), tileInd(k) );
+                auto Ajj = A( tileInd(j), tileInd(j) );
+                Herk( LOWER, NORMAL, Real(-1), Ajk, Real(1), Ajj );
+            });
+
+            for( Int i=j+1; i<numTiles; ++i )
+            {
+#ifdef EL_HYBRID
+                #pragma omp task default(shared) firstprivate(i,j,k) \
+                  depend(in:tok[i+k*numTiles],tok[j+k*numTiles]) \
+                  depend(inout:tok[i+j*numTiles])
+#endif
+                errors.Run( [&,i,j,k]() {
+                    auto Aik = A( tileInd(i), tileInd(k) );
+                    auto Ajk = A( tileInd(j), tileInd(k) );
+                    auto Aij = A( tileInd(i), tileInd(j) );
+                    Gemm( NORMAL, ADJOINT, F(-1), Aik, Ajk, F(1), Aij );
+                });
+            }
+        }
+    }
+#ifdef EL_HYBRID
+    #pragma omp taskwait
+#endif
+    errors.Rethrow();
+}
+
+template<typename F>
+void UpperTile( Matrix<F>& A, Int tileSize )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Int numTiles = tile::NumTiles( n, tileSize );
+#ifdef EL_HYBRID
+    if( !omp_in_parallel() )
+    {
+        // Launch a team and spawn the DAG from a single thread
+        #pragma omp parallel
+        #pragma omp single
+        UpperTile( A, tileSize );
+        return;
+    }
+
+    // Dependency tokens
+    vector<char> tokens( numTiles*numTiles );
+    char* tok = tokens.data();
+#endif
+    auto tileInd = [&]( Int k ) { return tile::TileRange( k, tileSize, n ); };
+    tile::TaskErrors errors;
+
+    for( Int k=0; k<numTiles; ++k )
+    {
+#ifdef EL_HYBRID
+        #pragma omp task default(shared) firstprivate(k) \
+          depend(inout:tok[k+k*numTiles])
+#endif
+        errors.Run( [&,k]() {
+            auto Akk = A( tileInd(k), tileInd(k) );
+            El::Cholesky( UPPER, Akk );
+        });
+
+        for( Int i=k+1; i<numTiles; ++i )
+        {
+#ifdef EL_HYBRID
+            #pragma omp task default(shared) firstprivate(i,k) \
+              depend(in:tok[k+k*numTiles]) depend(inout:tok[k+i*numTiles])
+#endif
+            errors.Run( [&,i,k]() {
+                auto Akk = A( tileInd(k), tileInd(k) );
+                auto Aki = A( tileInd(k), tileInd(i) );
+                Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), Akk, Aki );
+            });
+        }
+
+        for( Int j=k+1; j<numTiles; ++j )
+        {
+#ifdef EL_HYBRID
+            #pragma omp task default(shared) firstprivate(j,k) \
+              depend(in:tok[k+j*numTiles]) depend(inout:tok[j+j*numTiles])
+#endif
+            errors.Run( [&,j,k]() {
+                auto Akj = A( tileInd(k), tileInd(j) );
+                auto Ajj = A( tileInd(j), tileInd(j) );
+                Herk( UPPER, ADJOINT, Real(-1), Akj, Real(1), Ajj );
+            });
+
+            for( Int i=j+1; i<numTiles; ++i )
+            {
+#ifdef EL_HYBRID
+                #pragma omp task default(shared) firstprivate(i,j,k) \
+                  depend(in:tok[k+j*numTiles],tok[k+i*numTiles]) \
+                  depend(inout:tok[j+i*numTiles])
+#endif
+                errors.Run( [&,i,j,k]() {
+                    auto Akj = A( tileInd(k), tileInd(j) );
+                    auto Aki = A( tileInd(k), tileInd(i) );
+                    auto Aji = A( tileInd(j), tileInd(i) );
+                    Gemm( ADJOINT, NORMAL, F(-1), Akj, Aki, F(1), Aji );
+                });
+            }
+        }
+    }
+#ifdef EL_HYBRID
+    #pragma omp taskwait
+#endif
+    errors.Rethrow();
+}
+
+template<typename F>
+void Tile( UpperOrLower uplo, Matrix<F>& A, Int tileSize )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Can only compute Cholesky factor of square matrices");
+    if( tileSize <= 0 )
+        LogicError("Tile size must be positive");
+    if( uplo == LOWER )
+        LowerTile( A, tileSize );
+    else
+        UpperTile( A, tileSize );
+}
+
+} // namespace cholesky
+} // namespace El
+
+#endif // ifndef EL_CHOLESKY_TILE_HPP
@@ -72,8 +72,22 @@ void UpperVariant3Blocked( Matrix<F>& A )
     }
 }
 
+// An upper bound on the workspace entries that any process draws on
+inline Int UpperVariant3WorkspaceSize( Int n, const Grid& grid )
+{
+    const Int nb = Min(Blocksize(),n);
+    const Int r = grid.Height();
+    const Int c = grid.Width();
+    const Int p = grid.Size();
+    return MaxWorkspaceSize( nb, nb ) +
+           MaxWorkspaceSize( nb, n-nb, 1, p ) +
+           MaxWorkspaceSize( nb, n-nb, 1, r ) +
+           MaxWorkspaceSize( nb, n-nb, 1, c );
+}
+
 template<typename F>
-void UpperVariant3Blocked( AbstractDistMatrix<F>& APre )
+void UpperVariant3Blocked
+( AbstractDistMatrix<F>& APre, Workspace<F>& workspace )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -103,18 +117,22 @@ void UpperVariant3Blocked( AbstractDistMatrix<F>& APre )
         auto A12 = A( ind1, ind2 );
         auto A22 = A( ind2, ind2 );
 
+        typename Workspace<F>::Scope scope( workspace );
+        const auto A22Data = A22.DistData();
+        workspace.Attach( A11_STAR_STAR, nb, nb );
+        workspace.Attach( A12_STAR_VR, nb, n-(k+nb), A22Data );
+        workspace.Attach( A12_STAR_MC, nb, n-(k+nb), A22Data );
+        workspace.Attach( A12_STAR_MR, nb, n-(k+nb), A22Data );
+
         A11_STAR_STAR = A11;
         Cholesky( UPPER, A11_STAR_STAR );
         A11 = A11_STAR_STAR;
 
-        A12_STAR_VR.AlignWith( A22 );
         A12_STAR_VR = A12;
         LocalTrsm
         ( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), A11_STAR_STAR, A12_STAR_VR );
 
-        A12_STAR_MC.AlignWith( A22 );
         A12_STAR_MC = A12_STAR_VR;
-        A12_STAR_MR.AlignWith( A22 );
         A12_STAR_MR = A12_STAR_VR;
         LocalTrrk
         ( UPPER, ADJOINT, F(-1), A12_STAR_MC, A12_STAR_MR, F(1), A22 );
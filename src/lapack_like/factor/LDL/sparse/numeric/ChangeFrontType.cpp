@@ -162,9 +162,7 @@ void ChangeFrontType( DistFront<F>& front, LDLFrontType type, bool recurse )
 
 #define PROTO(F) \
   template void ChangeFrontType \
-  ( Front<F>& front, LDLFrontType type, bool recurse ); \
-  template void ChangeFrontType \
-  ( DistFront<F>& front, LDLFrontType type, bool recurse );
+  ( Front<F>& front, LDLFrontType type, bool recurse );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
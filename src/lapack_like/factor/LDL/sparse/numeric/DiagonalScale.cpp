@@ -83,13 +83,7 @@ void DiagonalScale
 #define PROTO(F) \
   template void DiagonalScale \
   ( const NodeInfo& info, const Front<F>& front, \
-    MatrixNode<F>& X ); \
-  template void DiagonalScale \
-  ( const DistNodeInfo& info, const DistFront<F>& front, \
-    DistMultiVecNode<F>& X ); \
-  template void DiagonalScale \
-  ( const DistNodeInfo& info, const DistFront<F>& front, \
-    DistMatrixNode<F>& X );
+    MatrixNode<F>& X );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
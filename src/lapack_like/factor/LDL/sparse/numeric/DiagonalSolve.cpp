@@ -84,13 +84,7 @@ void DiagonalSolve
 #define PROTO(F) \
   template void DiagonalSolve \
   ( const NodeInfo& info, const Front<F>& front, \
-    MatrixNode<F>& X ); \
-  template void DiagonalSolve \
-  ( const DistNodeInfo& info, const DistFront<F>& front, \
-    DistMultiVecNode<F>& X ); \
-  template void DiagonalSolve \
-  ( const DistNodeInfo& info, const DistFront<F>& front, \
-    DistMatrixNode<F>& X );
+    MatrixNode<F>& X );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -24,6 +24,7 @@
 #define EL_LDL_PROCESS_HPP
 
 #include "./ProcessFront.hpp"
+#include "../../../TileTasks.hpp"
 
 namespace El {
 namespace ldl {
@@ -33,6 +34,17 @@ void Process
 ( const NodeInfo& info, Front<Field>& front, LDLFrontType factorType )
 {
     EL_DEBUG_CSE
+#ifdef EL_HYBRID
+    if( !front.sparseLeaf && !omp_in_parallel() )
+    {
+        // Launch a team and traverse the elimination tree from a single
+        // thread, processing independent subtrees as tasks
+        #pragma omp parallel
+        #pragma omp single
+        Process( info, front, factorType );
+        return;
+    }
+#endif
     const int updateSize = info.lowerStruct.size();
     auto& FBR = front.workDense;
     FBR.Empty();
@@ -119,12 +131,27 @@ void Process
               LogicError("Front was not the proper size");
         )
 
-        // Process children and add in their updates
+        // The subtrees of the children are independent, so they may be
+        // processed as tasks before their updates are added in
         const int numChildren = info.children.size();
+        tile::TaskErrors errors;
         for( Int c=0; c<numChildren; ++c )
         {
-            Process( *info.children[c], *front.children[c], factorType );
+#ifdef EL_HYBRID
+            #pragma omp task default(shared) firstprivate(c)
+#endif
+            errors.Run
+            ( [&,c]()
+              { Process( *info.children[c], *front.children[c], factorType ); }
+            );
+        }
+#ifdef EL_HYBRID
+        #pragma omp taskwait
+#endif
+        errors.Rethrow();
 
+        for( Int c=0; c<numChildren; ++c )
+        {
             auto& childU = front.children[c]->workDense;
             const int childUSize = childU.Height();
             for( int jChild=0; jChild<childUSize; ++jChild )
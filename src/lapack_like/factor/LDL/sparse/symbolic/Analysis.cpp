@@ -226,6 +226,7 @@ Int Analysis( NodeInfo& node, Int myOff )
             LogicError("Node child ",c," was nullptr");
         myOff = Analysis( *node.children[c], myOff );
     }
+    node.myOff = myOff;
 
     EL_DEBUG_ONLY(
       if( !IsStrictlySorted(node.origLowerStruct) )
@@ -0,0 +1,316 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace ldl {
+
+// Form the graphs of the two halves from a map which orders the left half
+// first, then the right half, and then the separator. Edges into the
+// separator (or beyond the original sources) are kept, with the targets
+// shifted to be relative to the offset of the child.
+inline void BuildChildrenFromPerm
+( const Graph& graph,
+  const vector<Int>& perm,
+        Int leftChildSize,
+        Graph& leftChild,
+        Int rightChildSize,
+        Graph& rightChild )
+{
+    EL_DEBUG_CSE
+    const Int numSources = graph.NumSources();
+    const Int numTargets = graph.NumTargets();
+    const Int* offsetBuf = graph.LockedOffsetBuffer();
+    const Int* targetBuf = graph.LockedTargetBuffer();
+
+    vector<Int> invPerm;
+    InvertMap( perm, invPerm );
+
+    auto buildChild = [&]( Int childOff, Int childSize, Graph& child )
+    {
+        Int numEdgesUpperBound = 0;
+        for( Int s=0; s<childSize; ++s )
+        {
+            const Int origSource = invPerm[s+childOff];
+            numEdgesUpperBound += offsetBuf[origSource+1]-offsetBuf[origSource];
+        }
+
+        child.Resize( childSize, numTargets-childOff );
+        child.SoftEmpty();
+        child.Reserve( numEdgesUpperBound );
+        for( Int s=0; s<childSize; ++s )
+        {
+            const Int origSource = invPerm[s+childOff];
+            for( Int e=offsetBuf[origSource]; e<offsetBuf[origSource+1]; ++e )
+            {
+                const Int origTarget = targetBuf[e];
+                const Int target =
+                  ( origTarget < numSources ? perm[origTarget] : origTarget );
+                child.QueueConnection( s, target-childOff );
+            }
+        }
+        child.ProcessQueues();
+    };
+    buildChild( 0, leftChildSize, leftChild );
+    buildChild( leftChildSize, rightChildSize, rightChild );
+}
+
+// Order the vertices which are assigned to the left half (0), right half (1),
+// and separator (2), in that order, while preserving their relative order
+inline Int PermFromParts
+( const vector<Int>& parts,
+        vector<Int>& perm,
+        Int& leftChildSize,
+        Int& rightChildSize )
+{
+    EL_DEBUG_CSE
+    const Int numSources = parts.size();
+    Int partSizes[3] = { 0, 0, 0 };
+    for( Int s=0; s<numSources; ++s )
+        ++partSizes[parts[s]];
+    Int offs[3] = { 0, partSizes[0], partSizes[0]+partSizes[1] };
+    perm.resize( numSources );
+    for( Int s=0; s<numSources; ++s )
+        perm[s] = offs[parts[s]]++;
+    leftChildSize = partSizes[0];
+    rightChildSize = partSizes[1];
+    return partSizes[2];
+}
+
+// Form the breadth-first level structure of the connected component
+// containing 'root', restricted to the vertices with a negative entry in
+// 'level' and to the edges between sources. On exit, 'order' contains the
+// component in breadth-first order and the vertices of level l are
+// order[levelOffs[l]:levelOffs[l+1]].
+inline void LevelStructure
+( const Graph& graph,
+        Int root,
+        vector<Int>& level,
+        vector<Int>& order,
+        vector<Int>& levelOffs )
+{
+    EL_DEBUG_CSE
+    const Int numSources = graph.NumSources();
+    const Int* offsetBuf = graph.LockedOffsetBuffer();
+    const Int* targetBuf = graph.LockedTargetBuffer();
+
+    order.resize( 0 );
+    levelOffs.resize( 0 );
+    level[root] = 0;
+    order.push_back( root );
+    levelOffs.push_back( 0 );
+    for( Int k=0; k<Int(order.size()); ++k )
+    {
+        const Int s = order[k];
+        if( level[s] == Int(levelOffs.size()) )
+            levelOffs.push_back( k );
+        for( Int e=offsetBuf[s]; e<offsetBuf[s+1]; ++e )
+        {
+            const Int t = targetBuf[e];
+            if( t < numSources && level[t] < 0 )
+            {
+                level[t] = level[s] + 1;
+                order.push_back( t );
+            }
+        }
+    }
+    levelOffs.push_back( order.size() );
+}
+
+// Without a graph partitioner, the separator is chosen as a level of the
+// breadth-first level structure rooted at a pseudo-peripheral vertex
+// (each level separates the preceding levels from the following ones).
+// The 'ctrl.numSeqSeps' levels nearest to the median are considered and the
+// one which minimizes the separator size relative to the smaller half is
+// kept. Disconnected graphs are instead split between components.
+Int Bisect
+( const Graph& graph,
+        Graph& leftChild,
+        Graph& rightChild,
+        vector<Int>& perm,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    graph.AssertConsistent();
+    const Int numSources = graph.NumSources();
+    const Int* offsetBuf = graph.LockedOffsetBuffer();
+    vector<Int> parts( numSources, 1 );
+    vector<Int> level( numSources, -1 ), order, levelOffs;
+    if( numSources == 0 )
+    {
+        Int leftChildSize, rightChildSize;
+        const Int sepSize =
+          PermFromParts( parts, perm, leftChildSize, rightChildSize );
+        BuildChildrenFromPerm
+        ( graph, perm, leftChildSize, leftChild, rightChildSize, rightChild );
+        return sepSize;
+    }
+
+    // Greedily move entire connected components into the left half while it
+    // holds at most half of the vertices
+    Int leftSize = 0;
+    Int firstBigRoot = -1;
+    for( Int s=0; s<numSources; ++s )
+    {
+        if( level[s] >= 0 )
+            continue;
+        LevelStructure( graph, s, level, order, levelOffs );
+        const Int componentSize = order.size();
+        if( leftSize+componentSize <= numSources/2 )
+        {
+            for( const Int t : order )
+                parts[t] = 0;
+            leftSize += componentSize;
+        }
+        else if( firstBigRoot < 0 && 2*componentSize > numSources )
+            firstBigRoot = s;
+    }
+
+    if( firstBigRoot >= 0 )
+    {
+        // A single component holds most of the graph and must be split by a
+        // separator. Find a pseudo-peripheral root by repeatedly rooting at a
+        // minimum-degree vertex of the last level (the vertices already in
+        // the left half are marked as visited).
+        auto resetLevels = [&]() { for( const Int t : order ) level[t] = -1; };
+        auto degree = [&]( Int s ) { return offsetBuf[s+1]-offsetBuf[s]; };
+
+        for( Int s=0; s<numSources; ++s )
+            level[s] = ( parts[s] == 0 ? numSources : -1 );
+        LevelStructure( graph, firstBigRoot, level, order, levelOffs );
+        resetLevels();
+        Int root = firstBigRoot;
+        Int numLevels = levelOffs.size()-1;
+        for( Int iter=0; iter<numSources; ++iter )
+        {
+            Int candidate = order[levelOffs[numLevels-1]];
+            for( Int k=levelOffs[numLevels-1]; k<levelOffs[numLevels]; ++k )
+                if( degree(order[k]) < degree(candidate) )
+                    candidate = order[k];
+            LevelStructure( graph, candidate, level, order, levelOffs );
+            resetLevels();
+            const Int candidateNumLevels = levelOffs.size()-1;
+            if( candidateNumLevels <= numLevels )
+                break;
+            root = candidate;
+            numLevels = candidateNumLevels;
+        }
+        LevelStructure( graph, root, level, order, levelOffs );
+        numLevels = levelOffs.size()-1;
+        const Int componentSize = order.size();
+
+        // Consider the levels nearest to the median as separators
+        Int median = 0;
+        while( 2*levelOffs[median+1] <= componentSize )
+            ++median;
+        const Int numCandidates = Max(ctrl.numSeqSeps,Int(1));
+        const Int firstCandidate = Max(median-numCandidates/2,Int(0));
+        const Int lastCandidate =
+          Min(firstCandidate+numCandidates,numLevels) - 1;
+        Int sepLevel = median;
+        double bestCost = -1;
+        for( Int l=firstCandidate; l<=lastCandidate; ++l )
+        {
+            const Int sepSize = levelOffs[l+1]-levelOffs[l];
+            const Int minSize =
+              Min(levelOffs[l],componentSize-levelOffs[l+1]);
+            if( minSize == 0 && l != median )
+                continue;
+            const double cost = double(sepSize) / (minSize+1);
+            if( bestCost < 0 || cost < bestCost )
+            {
+                bestCost = cost;
+                sepLevel = l;
+            }
+        }
+        const Int leftCompSize = levelOffs[sepLevel];
+        const Int rightCompSize = componentSize-levelOffs[sepLevel+1];
+
+        // The remaining components (currently on the right) join whichever
+        // half of the split component is smaller
+        const bool restOnLeft = ( leftSize+leftCompSize < rightCompSize );
+        for( Int s=0; s<numSources; ++s )
+            if( parts[s] == 1 && level[s] < 0 )
+                parts[s] = ( restOnLeft ? 0 : 1 );
+        for( Int k=0; k<componentSize; ++k )
+        {
+            const Int s = order[k];
+            parts[s] = ( level[s] < sepLevel ? 0 :
+                         level[s] > sepLevel ? 1 : 2 );
+        }
+    }
+
+    Int leftChildSize, rightChildSize;
+    const Int sepSize =
+      PermFromParts( parts, perm, leftChildSize, rightChildSize );
+    BuildChildrenFromPerm
+    ( graph, perm, leftChildSize, leftChild, rightChildSize, rightChild );
+    return sepSize;
+}
+
+Int NaturalBisect
+( Int nx, Int ny, Int nz,
+  const Graph& graph,
+        Int& nxLeft, Int& nyLeft, Int& nzLeft,
+        Graph& leftChild,
+        Int& nxRight, Int& nyRight, Int& nzRight,
+        Graph& rightChild,
+        vector<Int>& perm )
+{
+    EL_DEBUG_CSE
+    const Int numSources = graph.NumSources();
+    if( numSources != nx*ny*nz )
+        LogicError
+        ("Graph had ",numSources," sources but the grid was ",
+         nx," x ",ny," x ",nz);
+    nxLeft = nxRight = nx;
+    nyLeft = nyRight = ny;
+    nzLeft = nzRight = nz;
+
+    // Split the largest dimension with a plane through its middle
+    const Int nMax = Max(Max(nx,ny),nz);
+    const Int mid = nMax/2;
+    Int stride;
+    if( nx == nMax )
+    {
+        stride = 1;
+        nxLeft = mid;
+        nxRight = nx-mid-1;
+    }
+    else if( ny == nMax )
+    {
+        stride = nx;
+        nyLeft = mid;
+        nyRight = ny-mid-1;
+    }
+    else
+    {
+        stride = nx*ny;
+        nzLeft = mid;
+        nzRight = nz-mid-1;
+    }
+
+    // The natural orderings of the halves are inherited from the parent
+    vector<Int> parts( numSources );
+    for( Int s=0; s<numSources; ++s )
+    {
+        const Int coord = (s/stride) % nMax;
+        parts[s] = ( coord < mid ? 0 : coord > mid ? 1 : 2 );
+    }
+
+    Int leftChildSize, rightChildSize;
+    const Int sepSize =
+      PermFromParts( parts, perm, leftChildSize, rightChildSize );
+    BuildChildrenFromPerm
+    ( graph, perm, leftChildSize, leftChild, rightChildSize, rightChild );
+    return sepSize;
+}
+
+} // namespace ldl
+} // namespace El
@@ -0,0 +1,195 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <set>
+
+namespace El {
+namespace ldl {
+
+// Defined in NaturalNestedDissection.cpp
+void
+NaturalNestedDissectionRecursion
+(       Int nx,
+        Int ny,
+        Int nz,
+  const Graph& graph,
+  const vector<Int>& perm,
+        Separator& sep,
+        NodeInfo& info,
+        Int off,
+        Int cutoff );
+
+inline void
+NaturalNestedDissectionRecursion
+(       Int nx,
+        Int ny,
+        Int nz,
+  const DistGraph& graph,
+  const DistMap& perm,
+        DistSeparator& sep,
+        DistNodeInfo& info,
+        Int off,
+        Int cutoff )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = graph.Grid();
+    mpi::Comm comm = grid.Comm();
+    const int commSize = grid.Size();
+
+    if( commSize > 1 )
+    {
+        const Int numLocalSources = graph.NumLocalSources();
+        const Int firstLocalSource = graph.FirstLocalSource();
+        const Int* offsetBuf = graph.LockedOffsetBuffer();
+        const Int* targetBuf = graph.LockedTargetBuffer();
+
+        // Partition the graph and construct the inverse map
+        Int nxChild, nyChild, nzChild;
+        DistGraph child;
+        bool childIsOnLeft;
+        DistMap map;
+        info.child.reset( new DistNodeInfo(&info) );
+        unique_ptr<Grid> childGrid;
+        const Int sepSize =
+            NaturalBisect
+            ( nx, ny, nz, graph, nxChild, nyChild, nzChild,
+              childGrid, child, map, childIsOnLeft );
+        info.child->AssignGrid( childGrid );
+        const Int numSources = graph.NumSources();
+        const Int childSize = child.NumSources();
+        const Int leftChildSize =
+          childIsOnLeft ? childSize : numSources-sepSize-childSize;
+
+        DistMap invMap;
+        InvertMap( map, invMap );
+
+        // Mostly fill this node of the DistSeparatorTree
+        // (we will finish computing the separator indices at the end)
+        sep.off = off + (numSources-sepSize);
+        sep.inds.resize( sepSize );
+        for( Int s=0; s<sepSize; ++s )
+            sep.inds[s] = s + (numSources-sepSize);
+        invMap.Translate( sep.inds );
+
+        // Fill in this node of the DistNode
+        info.size = sepSize;
+        info.off = sep.off;
+
+        set<Int> localStructSet;
+        for( Int s=0; s<sepSize; ++s )
+        {
+            const Int source = sep.inds[s];
+            if( source >= firstLocalSource &&
+                source < firstLocalSource+numLocalSources )
+            {
+                const Int localSource = source - firstLocalSource;
+                const Int edgeOff = offsetBuf[localSource];
+                const Int numConn = offsetBuf[localSource+1] - edgeOff;
+                for( Int t=0; t<numConn; ++t )
+                {
+                    const Int target = targetBuf[edgeOff+t];
+                    if( target >= numSources )
+                        localStructSet.insert( off+target );
+                }
+            }
+        }
+        const int localStructSize = localStructSet.size();
+        vector<int> localStructSizes( commSize );
+        mpi::AllGather( &localStructSize, 1, localStructSizes.data(), 1, comm );
+        vector<Int> localStruct;
+        CopySTL( localStructSet, localStruct );
+        vector<int> localStructOffs;
+        int nonUniqueStructSize = Scan( localStructSizes, localStructOffs );
+        vector<Int> nonUniqueStruct( nonUniqueStructSize );
+        mpi::AllGather
+        ( localStruct.data(), localStructSize,
+          nonUniqueStruct.data(),
+          localStructSizes.data(), localStructOffs.data(), comm );
+        set<Int> structSet( nonUniqueStruct.begin(), nonUniqueStruct.end() );
+        CopySTL( structSet, info.origLowerStruct );
+
+        // Finish computing the separator indices
+        perm.Translate( sep.inds );
+
+        // Construct map from child indices to the original ordering
+        DistMap newPerm( child.NumSources(), child.Grid() );
+        const Int localChildSize = child.NumLocalSources();
+        const Int firstLocalChildSource = child.FirstLocalSource();
+        auto& newPermLoc = newPerm.Map();
+        if( childIsOnLeft )
+            for( Int s=0; s<localChildSize; ++s )
+                newPermLoc[s] = s+firstLocalChildSource;
+        else
+            for( Int s=0; s<localChildSize; ++s )
+                newPermLoc[s] = s+firstLocalChildSource+leftChildSize;
+        invMap.Extend( newPerm );
+        perm.Extend( newPerm );
+
+        // Recurse
+        const Int newOff = childIsOnLeft ? off : off+leftChildSize;
+        sep.child.reset( new DistSeparator(&sep) );
+        info.child->onLeft = childIsOnLeft;
+        NaturalNestedDissectionRecursion
+        ( nxChild, nyChild, nzChild, child, newPerm,
+          *sep.child, *info.child, newOff, cutoff );
+    }
+    else
+    {
+        Graph seqGraph( graph );
+
+        sep.duplicate.reset( new Separator(&sep) );
+        info.duplicate.reset( new NodeInfo(&info) );
+        NaturalNestedDissectionRecursion
+        ( nx, ny, nz, seqGraph, perm.Map(),
+          *sep.duplicate, *info.duplicate, off, cutoff );
+
+        // Pull information up from the duplicates
+        sep.off = sep.duplicate->off;
+        sep.inds = sep.duplicate->inds;
+        info.size = info.duplicate->size;
+        info.off = info.duplicate->off;
+        info.origLowerStruct = info.duplicate->origLowerStruct;
+    }
+}
+
+void NaturalNestedDissection
+(       Int nx,
+        Int ny,
+        Int nz,
+  const DistGraph& graph,
+        DistMap& map,
+        DistSeparator& sep,
+        DistNodeInfo& info,
+        Int cutoff,
+        bool storeFactRecvInds )
+{
+    EL_DEBUG_CSE
+
+    DistMap perm( graph.NumSources(), graph.Grid() );
+    const Int firstLocalSource = perm.FirstLocalSource();
+    const Int numLocalSources = perm.NumLocalSources();
+    for( Int s=0; s<numLocalSources; ++s )
+        perm.SetLocal( s, s+firstLocalSource );
+
+    info.SetRootGrid( graph.Grid() );
+    NaturalNestedDissectionRecursion
+    ( nx, ny, nz, graph, perm, sep, info, 0, cutoff );
+
+    // Construct the distributed reordering
+    sep.BuildMap( info, map );
+    EL_DEBUG_ONLY(EnsurePermutation(map))
+
+    // Run the symbolic analysis
+    Analysis( info, storeFactRecvInds );
+}
+
+} // namespace ldl
+} // namespace El
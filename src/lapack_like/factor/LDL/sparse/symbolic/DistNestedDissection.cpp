@@ -0,0 +1,182 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <set>
+
+namespace El {
+namespace ldl {
+
+// Defined in NestedDissection.cpp
+void
+NestedDissectionRecursion
+( const Graph& graph,
+  const vector<Int>& perm,
+        Separator& sep,
+        NodeInfo& info,
+        Int off,
+  const BisectCtrl& ctrl );
+
+inline void
+NestedDissectionRecursion
+( const DistGraph& graph,
+  const DistMap& perm,
+        DistSeparator& sep,
+        DistNodeInfo& info,
+        Int off,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = graph.Grid();
+    mpi::Comm comm = grid.Comm();
+    const int commSize = grid.Size();
+
+    if( commSize > 1 )
+    {
+        const Int numLocalSources = graph.NumLocalSources();
+        const Int firstLocalSource = graph.FirstLocalSource();
+        const Int* offsetBuf = graph.LockedOffsetBuffer();
+        const Int* targetBuf = graph.LockedTargetBuffer();
+
+        // Partition the graph and construct the inverse map
+        DistGraph child;
+        bool childIsOnLeft;
+        DistMap map(grid);
+        info.child.reset( new DistNodeInfo(&info) );
+        unique_ptr<Grid> childGrid;
+        const Int sepSize =
+          Bisect( graph, childGrid, child, map, childIsOnLeft, ctrl );
+        info.child->AssignGrid( childGrid );
+        info.child->onLeft = childIsOnLeft;
+        const Int numSources = graph.NumSources();
+        const Int childSize = child.NumSources();
+        const Int leftChildSize =
+          childIsOnLeft ? childSize : numSources-sepSize-childSize;
+
+        DistMap invMap(grid);
+        InvertMap( map, invMap );
+
+        // Mostly fill this node of the DistSeparatorTree
+        // (we will finish computing the separator indices at the end)
+        sep.off = off + (numSources-sepSize);
+        sep.inds.resize( sepSize );
+        for( Int s=0; s<sepSize; ++s )
+            sep.inds[s] = s + (numSources-sepSize);
+        invMap.Translate( sep.inds );
+
+        // Fill in this node of the DistNode
+        info.size = sepSize;
+        info.off = sep.off;
+
+        set<Int> localLowerStruct;
+        for( Int s=0; s<sepSize; ++s )
+        {
+            const Int source = sep.inds[s];
+            if( source >= firstLocalSource &&
+                source < firstLocalSource+numLocalSources )
+            {
+                const Int localSource = source - firstLocalSource;
+                const Int edgeOff = offsetBuf[localSource];
+                const Int numConn = offsetBuf[localSource+1] - edgeOff;
+                for( Int t=0; t<numConn; ++t )
+                {
+                    const Int target = targetBuf[edgeOff+t];
+                    if( target >= numSources )
+                        localLowerStruct.insert( off+target );
+                }
+            }
+        }
+        const int numLocalConnected = localLowerStruct.size();
+        vector<int> localConnectedSizes( commSize );
+        mpi::AllGather
+        ( &numLocalConnected, 1, localConnectedSizes.data(), 1, comm );
+        vector<Int> localConnectedVec;
+        CopySTL( localLowerStruct, localConnectedVec );
+        vector<int> localConnectedOffs;
+        const int sumOfLocalConnectedSizes =
+            Scan( localConnectedSizes, localConnectedOffs );
+        vector<Int> localConnections( sumOfLocalConnectedSizes );
+        mpi::AllGather
+        ( localConnectedVec.data(), numLocalConnected,
+          localConnections.data(),
+          localConnectedSizes.data(), localConnectedOffs.data(), comm );
+        set<Int> lowerStruct
+        ( localConnections.begin(), localConnections.end() );
+        CopySTL( lowerStruct, info.origLowerStruct );
+
+        // Finish computing the separator indices
+        perm.Translate( sep.inds );
+
+        // Construct map from child indices to the original ordering
+        DistMap newPerm( child.NumSources(), child.Grid() );
+        const Int localChildSize = child.NumLocalSources();
+        const Int firstLocalChildSource = child.FirstLocalSource();
+        auto& newPermLoc = newPerm.Map();
+        if( childIsOnLeft )
+            for( Int s=0; s<localChildSize; ++s )
+                newPermLoc[s] = s+firstLocalChildSource;
+        else
+            for( Int s=0; s<localChildSize; ++s )
+                newPermLoc[s] = s+firstLocalChildSource+leftChildSize;
+        invMap.Extend( newPerm );
+        perm.Extend( newPerm );
+
+        // Recurse
+        const Int childOff = childIsOnLeft ? off : off+leftChildSize;
+        sep.child.reset( new DistSeparator(&sep) );
+        NestedDissectionRecursion
+        ( child, newPerm, *sep.child, *info.child, childOff, ctrl );
+    }
+    else
+    {
+        Graph seqGraph( graph );
+
+        sep.duplicate.reset( new Separator(&sep) );
+        info.duplicate.reset( new NodeInfo(&info) );
+        NestedDissectionRecursion
+        ( seqGraph, perm.Map(), *sep.duplicate, *info.duplicate, off, ctrl );
+
+        // Pull information up from the duplicates
+        sep.off = sep.duplicate->off;
+        sep.inds = sep.duplicate->inds;
+        info.size = info.duplicate->size;
+        info.off = info.duplicate->off;
+        info.origLowerStruct = info.duplicate->origLowerStruct;
+    }
+}
+
+void NestedDissection
+( const DistGraph& graph,
+        DistMap& map,
+        DistSeparator& sep,
+        DistNodeInfo& info,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+
+    DistMap perm( graph.NumSources(), graph.Grid() );
+    const Int firstLocalSource = perm.FirstLocalSource();
+    const Int numLocalSources = perm.NumLocalSources();
+    for( Int s=0; s<numLocalSources; ++s )
+        perm.SetLocal( s, s+firstLocalSource );
+
+    info.SetRootGrid( graph.Grid() );
+    NestedDissectionRecursion( graph, perm, sep, info, 0, ctrl );
+
+    // Construct the distributed reordering
+    sep.BuildMap( info, map );
+    EL_DEBUG_ONLY(EnsurePermutation(map))
+
+    // Run the symbolic analysis
+    Analysis( info, ctrl.storeFactRecvInds );
+}
+
+} // namespace ldl
+} // namespace El
@@ -13,6 +13,8 @@
 #include "./LU/Full.hpp"
 #include "./LU/Mod.hpp"
 #include "./LU/SolveAfter.hpp"
+#include "./LU/Tile.hpp"
+#include "./LU/OutOfCore.hpp"
 
 namespace El {
 
@@ -152,12 +154,22 @@ void LU
 }
 
 template<typename F>
-void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
+void LU( AbstractDistMatrix<F>& A, DistPermutation& P )
+{
+    EL_DEBUG_CSE
+    Workspace<F> workspace;
+    LU( A, P, workspace );
+}
+
+template<typename F>
+void LU
+( AbstractDistMatrix<F>& APre, DistPermutation& P, Workspace<F>& workspace )
 {
     EL_DEBUG_CSE
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
+    workspace.Reserve( lu::WorkspaceSize( A ) );
 
     const Grid& g = A.Grid();
     DistMatrix<F,  STAR,STAR> A11_STAR_STAR(g);
@@ -175,7 +187,7 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
 
     DistPermutation PB(g);
 
-    vector<F> panelBuf, pivotBuf;
+    vector<F> pivotBuf;
     const Int bsize = Blocksize();
     for( Int k=0; k<minDim; k+=bsize )
     {
@@ -189,10 +201,11 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
 
         auto AB  = A( indB, ALL );
 
+        typename Workspace<F>::Scope scope( workspace );
         const Int A21Height = A21.Height();
         const Int A21LocHeight = A21.LocalHeight();
         const Int panelLDim = nb+A21LocHeight;
-        FastResize( panelBuf, panelLDim*nb );
+        F* panelBuf = workspace.Require( panelLDim*nb );
         A11_STAR_STAR.Attach
         ( nb, nb, g, 0, 0, &panelBuf[0], panelLDim, 0 );
         A21_MC_STAR.Attach
@@ -205,12 +218,12 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
 
         // Perhaps we should give up perfectly distributing this operation since
         // it's total contribution is only O(n^2)
-        A12_STAR_VR.AlignWith( A22 );
+        workspace.Attach( A12_STAR_VR, nb, A12.Width(), A22.DistData() );
         A12_STAR_VR = A12;
         LocalTrsm
         ( LEFT, LOWER, NORMAL, UNIT, F(1), A11_STAR_STAR, A12_STAR_VR );
 
-        A12_STAR_MR.AlignWith( A22 );
+        workspace.Attach( A12_STAR_MR, nb, A12.Width(), A22.DistData() );
         A12_STAR_MR = A12_STAR_VR;
         LocalGemm( NORMAL, NORMAL, F(-1), A21_MC_STAR, A12_STAR_MR, F(1), A22 );
 
@@ -220,6 +233,24 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
     }
 }
 
+namespace lu {
+
+template<typename F>
+Int WorkspaceSize( const AbstractDistMatrix<F>& A )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int nb = Min(Blocksize(),Min(m,n));
+    // The stacked [A11; A21] panel and the two copies of A12
+    return (nb+MaxLength(m-nb,g.Height()))*nb +
+           MaxWorkspaceSize( nb, n-nb, 1, g.Size() ) +
+           MaxWorkspaceSize( nb, n-nb, 1, g.Width() );
+}
+
+} // namespace lu
+
 template<typename F>
 void LU
 ( AbstractDistMatrix<F>& A,
@@ -230,7 +261,7 @@ void LU
     lu::Full( A, P, Q );
 }
 
-#define PROTO(F) \
+#define PROTO_BASE(F) \
   template void LU( Matrix<F>& A ); \
   template void LU( AbstractDistMatrix<F>& A ); \
   template void LU( DistMatrix<F,STAR,STAR>& A ); \
@@ -241,6 +272,11 @@ void LU
   ( AbstractDistMatrix<F>& A, \
     DistPermutation& P ); \
   template void LU \
+  ( AbstractDistMatrix<F>& A, \
+    DistPermutation& P, \
+    Workspace<F>& workspace ); \
+  template Int lu::WorkspaceSize( const AbstractDistMatrix<F>& A ); \
+  template void LU \
   ( Matrix<F>& A, \
     Permutation& P, \
     Permutation& Q ); \
@@ -303,8 +339,25 @@ void LU
     const AbstractDistMatrix<F>& A, \
     const DistPermutation& P, \
     const DistPermutation& Q, \
+          AbstractDistMatrix<F>& B ); \
+  template void lu::Tile \
+  ( Matrix<F>& A, \
+    Permutation& P, \
+    Int tileSize );
+
+#define PROTO(F) \
+  PROTO_BASE(F) \
+  template void LU( OutOfCoreMatrix<F>& A, DistPermutation& P ); \
+  template void lu::SolveAfter \
+  ( Orientation orientation, \
+    const OutOfCoreMatrix<F>& A, \
+    const DistPermutation& P, \
           AbstractDistMatrix<F>& B );
 
+// BigFloat is not supported out-of-core since its data is not contiguous
+#define PROTO_BIGFLOAT PROTO_BASE(BigFloat)
+#define PROTO_COMPLEX_BIGFLOAT PROTO_BASE(Complex<BigFloat>)
+
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -0,0 +1,207 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_OUTOFCORE_HPP
+#define EL_LU_OUTOFCORE_HPP
+
+#include "../OutOfCore.hpp"
+
+namespace El {
+
+// Left-looking LU with partial pivoting over the column panels of an
+// out-of-core matrix. Each panel is brought up to date by applying the row
+// swaps and the TRSM/GEMM update of each previous panel (in increasing order)
+// and its diagonal block and below is then factored with the in-core
+// distributed LU. The row swaps of each panel are only applied to the
+// (already written) previous panels during a final pass, which rereads and
+// rewrites each factored panel once.
+template<typename F>
+void LU( OutOfCoreMatrix<F>& A, DistPermutation& P )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    const Int panelWidth = A.PanelWidth();
+    const Int numFactored =
+      ( panelWidth == 0 ? 0 : (minDim+panelWidth-1) / panelWidth );
+
+    P.SetGrid( g );
+    P.MakeIdentity( m );
+    P.ReserveSwaps( minDim );
+
+    vector<DistPermutation> PBs;
+    PBs.reserve( numFactored );
+    for( Int k=0; k<numFactored; ++k )
+        PBs.emplace_back( g );
+
+    // The range of rows/columns of the diagonal block of factored panel k
+    auto diagInd = [&]( Int k )
+      { return Range<Int>( k*panelWidth, Min((k+1)*panelWidth,minDim) ); };
+
+    auto update =
+      [&]( DistMatrix<F>& Pj, Int j, DistMatrix<F>& Pk, Int k )
+      {
+          const Range<Int> indJ = diagInd( j );
+          const Range<Int> ind1( indJ.beg, indJ.end ), ind2( indJ.end, m ),
+                           indB( indJ.beg, m ),
+                           indL( 0, indJ.end-indJ.beg );
+          auto AkB = Pk( indB, ALL );
+          PBs[j].PermuteRows( AkB );
+
+          auto L11 = Pj( ind1, indL );
+          auto L21 = Pj( ind2, indL );
+          auto Ak1 = Pk( ind1, ALL );
+          auto Ak2 = Pk( ind2, ALL );
+          Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), L11, Ak1 );
+          Gemm( NORMAL, NORMAL, F(-1), L21, Ak1, F(1), Ak2 );
+      };
+    auto factor =
+      [&]( DistMatrix<F>& Pk, Int k )
+      {
+          const Range<Int> indK = diagInd( k );
+          const Int nb = indK.end - indK.beg;
+          const Range<Int> ind1( indK.beg, indK.end ), indB( indK.beg, m ),
+                           indL( 0, nb ), indR( nb, Pk.Width() );
+          auto AkBL = Pk( indB, indL );
+          LU( AkBL, PBs[k] );
+          P.SwapSequence( PBs[k], indK.beg );
+
+          // When m < n, the last factored panel may contain columns of U
+          // beyond the diagonal block
+          if( indR.end > indR.beg )
+          {
+              auto AkBR = Pk( indB, indR );
+              PBs[k].PermuteRows( AkBR );
+              auto L11 = Pk( ind1, indL );
+              auto A1R = Pk( ind1, indR );
+              Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), L11, A1R );
+          }
+      };
+    ooc::LeftLooking( A, numFactored, update, factor );
+
+    // Apply the later row swaps to the previous panels
+    ooc::PanelStream<F> stream( A, ooc::PanelSequence(0,numFactored-1) );
+    while( !stream.Done() )
+    {
+        Int j;
+        auto& Pj = stream.Next( j );
+        for( Int k=j+1; k<numFactored; ++k )
+        {
+            auto AjB = Pj( IR(diagInd(k).beg,m), ALL );
+            PBs[k].PermuteRows( AjB );
+        }
+        A.WritePanelAsync( j, Pj ).get();
+    }
+}
+
+namespace lu {
+
+template<typename F>
+void SolveAfter
+( Orientation orientation,
+  const OutOfCoreMatrix<F>& A,
+  const DistPermutation& P,
+        AbstractDistMatrix<F>& BPre )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    if( A.Height() != BPre.Height() )
+        LogicError("A and B must be the same height");
+    if( A.Grid() != BPre.Grid() )
+        LogicError("A and B must be distributed over the same grid");
+    const Int n = A.Height();
+    const Int numPanels = A.NumPanels();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> BProx( BPre );
+    auto& B = BProx.Get();
+
+    if( orientation == NORMAL )
+    {
+        P.PermuteRows( B );
+
+        // B := inv(L) B
+        ooc::PanelStream<F> forward( A, ooc::PanelSequence(0,numPanels) );
+        while( !forward.Done() )
+        {
+            Int k;
+            auto& Pk = forward.Next( k );
+            const Range<Int> indK = A.PanelRange( k );
+            const Range<Int> ind1( indK.beg, indK.end ), ind2( indK.end, n );
+            auto L11 = Pk( ind1, ALL );
+            auto L21 = Pk( ind2, ALL );
+            auto B1 = B( ind1, ALL );
+            auto B2 = B( ind2, ALL );
+            Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), L11, B1 );
+            Gemm( NORMAL, NORMAL, F(-1), L21, B1, F(1), B2 );
+        }
+
+        // B := inv(U) B
+        ooc::PanelStream<F>
+          backward( A, ooc::PanelSequence(0,numPanels,true) );
+        while( !backward.Done() )
+        {
+            Int k;
+            auto& Pk = backward.Next( k );
+            const Range<Int> indK = A.PanelRange( k );
+            const Range<Int> ind0( 0, indK.beg ), ind1( indK.beg, indK.end );
+            auto U01 = Pk( ind0, ALL );
+            auto U11 = Pk( ind1, ALL );
+            auto B0 = B( ind0, ALL );
+            auto B1 = B( ind1, ALL );
+            Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), U11, B1 );
+            if( indK.beg > 0 )
+                Gemm( NORMAL, NORMAL, F(-1), U01, B1, F(1), B0 );
+        }
+    }
+    else
+    {
+        // B := inv(U)^{T/H} B
+        ooc::PanelStream<F> forward( A, ooc::PanelSequence(0,numPanels) );
+        while( !forward.Done() )
+        {
+            Int k;
+            auto& Pk = forward.Next( k );
+            const Range<Int> indK = A.PanelRange( k );
+            const Range<Int> ind0( 0, indK.beg ), ind1( indK.beg, indK.end );
+            auto U01 = Pk( ind0, ALL );
+            auto U11 = Pk( ind1, ALL );
+            auto B0 = B( ind0, ALL );
+            auto B1 = B( ind1, ALL );
+            if( indK.beg > 0 )
+                Gemm( orientation, NORMAL, F(-1), U01, B0, F(1), B1 );
+            Trsm( LEFT, UPPER, orientation, NON_UNIT, F(1), U11, B1 );
+        }
+
+        // B := inv(L)^{T/H} B
+        ooc::PanelStream<F>
+          backward( A, ooc::PanelSequence(0,numPanels,true) );
+        while( !backward.Done() )
+        {
+            Int k;
+            auto& Pk = backward.Next( k );
+            const Range<Int> indK = A.PanelRange( k );
+            const Range<Int> ind1( indK.beg, indK.end ), ind2( indK.end, n );
+            auto L11 = Pk( ind1, ALL );
+            auto L21 = Pk( ind2, ALL );
+            auto B1 = B( ind1, ALL );
+            auto B2 = B( ind2, ALL );
+            Gemm( orientation, NORMAL, F(-1), L21, B2, F(1), B1 );
+            Trsm( LEFT, LOWER, orientation, UNIT, F(1), L11, B1 );
+        }
+
+        P.InversePermuteRows( B );
+    }
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_OUTOFCORE_HPP
@@ -0,0 +1,143 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_TILE_HPP
+#define EL_LU_TILE_HPP
+
+#include "../TileTasks.hpp"
+#include "./Panel.hpp"
+
+namespace El {
+namespace lu {
+
+namespace tile_lu {
+
+// Apply the row swaps of the panel starting at (k,k) with width nb to the
+// columns 'cols' (which lie to the right of the panel) and then perform
+// their share of the right-looking update
+template<typename F>
+void UpdateColumns
+( Matrix<F>& A, const Permutation& PB, Int k, Int nb, const Range<Int>& cols )
+{
+    EL_DEBUG_CSE
+    const Range<Int> ind1( k, k+nb ), ind2( k+nb, END ), indB( k, END );
+
+    auto AB = A( indB, cols );
+    PB.PermuteRows( AB );
+
+    auto A11 = A( ind1, ind1 );
+    auto A21 = A( ind2, ind1 );
+    auto A1 = A( ind1, cols );
+    auto A2 = A( ind2, cols );
+    Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A11, A1 );
+    Gemm( NORMAL, NORMAL, F(-1), A21, A1, F(1), A2 );
+}
+
+} // namespace tile_lu
+
+// Partial pivoting couples all of the rows of a panel, so the DAG is
+// expressed over columns of tiles: the panel task of step k factors
+// A(k:m,k) and records its row swaps, while one task per remaining column of
+// tiles applies those swaps and its TRSM/GEMM update. Since the update of
+// column tile k+1 is spawned first, the panel of step k+1 may proceed while
+// the remainder of the trailing matrix of step k is being updated.
+//
+// NOTE: The per-step permutations are swap sequences, whose PermuteRows
+//       does not modify any (mutable) internal state, so that they may be
+//       concurrently applied to disjoint columns.
+template<typename F>
+void Tile( Matrix<F>& A, Permutation& P, Int tileSize )
+{
+    EL_DEBUG_CSE
+    if( tileSize <= 0 )
+        LogicError("Tile size must be positive");
+#ifdef EL_HYBRID
+    if( !omp_in_parallel() )
+    {
+        // Launch a team and spawn the DAG from a single thread
+        #pragma omp parallel
+        #pragma omp single
+        Tile( A, P, tileSize );
+        return;
+    }
+#endif
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    const Int numPanels = tile::NumTiles( minDim, tileSize );
+    const Int numColTiles = tile::NumTiles( n, tileSize );
+
+    P.MakeIdentity( m );
+    P.ReserveSwaps( minDim );
+
+    vector<Permutation> PBs( numPanels );
+#ifdef EL_HYBRID
+    // Dependency tokens
+    vector<char> tokens( numColTiles );
+    char* tok = tokens.data();
+#endif
+    auto tileInd = [&]( Int k ) { return tile::TileRange( k, tileSize, n ); };
+    tile::TaskErrors errors;
+
+    for( Int kTile=0; kTile<numPanels; ++kTile )
+    {
+        const Int k = kTile*tileSize;
+        const Int nb = Min(tileSize,minDim-k);
+
+        // The panel is serialized with all previous panels through the
+        // update of its column of tiles, which protects the shared P
+#ifdef EL_HYBRID
+        #pragma omp task default(shared) firstprivate(kTile,k,nb) \
+          depend(inout:tok[kTile])
+#endif
+        errors.Run( [&,kTile,k,nb]() {
+            auto AB1 = A( IR(k,END), IR(k,k+nb) );
+            lu::Panel( AB1, P, PBs[kTile], k );
+
+            // The last panel may be narrower than its column of tiles
+            const Range<Int> cols( k+nb, tileInd(kTile).end );
+            if( cols.end > cols.beg )
+                tile_lu::UpdateColumns( A, PBs[kTile], k, nb, cols );
+        });
+
+        for( Int jTile=kTile+1; jTile<numColTiles; ++jTile )
+        {
+#ifdef EL_HYBRID
+            #pragma omp task default(shared) firstprivate(jTile,kTile,k,nb) \
+              depend(in:tok[kTile]) depend(inout:tok[jTile])
+#endif
+            errors.Run( [&,jTile,kTile,k,nb]() {
+                tile_lu::UpdateColumns
+                ( A, PBs[kTile], k, nb, tileInd(jTile) );
+            });
+        }
+
+        // The swaps of the previous columns of tiles are off the critical
+        // path and are spawned last
+        for( Int jTile=0; jTile<kTile; ++jTile )
+        {
+#ifdef EL_HYBRID
+            #pragma omp task default(shared) firstprivate(jTile,kTile,k) \
+              depend(in:tok[kTile]) depend(inout:tok[jTile])
+#endif
+            errors.Run( [&,jTile,kTile,k]() {
+                auto ABj = A( IR(k,END), tileInd(jTile) );
+                PBs[kTile].PermuteRows( ABj );
+            });
+        }
+    }
+#ifdef EL_HYBRID
+    #pragma omp taskwait
+#endif
+    errors.Rethrow();
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_TILE_HPP
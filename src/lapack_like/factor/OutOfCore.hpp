@@ -0,0 +1,128 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_FACTOR_OUTOFCORE_HPP
+#define EL_FACTOR_OUTOFCORE_HPP
+
+namespace El {
+namespace ooc {
+
+// Streams a sequence of panels of an out-of-core matrix through two resident
+// buffers: the read of the next panel is started as soon as the current
+// panel is handed out, so that it overlaps with the computation on the
+// current panel.
+//
+// NOTE: The caller is responsible for ensuring that no writes to the
+//       streamed panels are in flight.
+template<typename F>
+class PanelStream
+{
+public:
+    PanelStream( const OutOfCoreMatrix<F>& A, vector<Int> panels )
+    : A_(A), panels_(std::move(panels)),
+      buffers_{ DistMatrix<F>(A.Grid()), DistMatrix<F>(A.Grid()) }
+    {
+        if( !panels_.empty() )
+            reads_[0] = A_.ReadPanelAsync( panels_[0], buffers_[0] );
+    }
+
+    bool Done() const EL_NO_EXCEPT { return next_ == Int(panels_.size()); }
+
+    // Returns the next panel (and its index) once it is resident. The panel
+    // remains valid until the subsequent call.
+    DistMatrix<F>& Next( Int& k )
+    {
+        EL_DEBUG_CSE
+        const Int slot = next_ % 2;
+        reads_[slot].get();
+        k = panels_[next_++];
+        if( !Done() )
+            reads_[1-slot] =
+              A_.ReadPanelAsync( panels_[next_], buffers_[1-slot] );
+        return buffers_[slot];
+    }
+
+private:
+    const OutOfCoreMatrix<F>& A_;
+    vector<Int> panels_;
+    Int next_=0;
+    DistMatrix<F> buffers_[2];
+    std::future<void> reads_[2];
+};
+
+// The panels [beg,end), in increasing or decreasing order
+inline vector<Int> PanelSequence( Int beg, Int end, bool backward=false )
+{
+    vector<Int> panels;
+    for( Int k=beg; k<end; ++k )
+        panels.push_back( backward ? end-1-(k-beg) : k );
+    return panels;
+}
+
+inline void Wait( std::future<void>& request )
+{
+    if( request.valid() )
+        request.get();
+}
+
+// Left-looking factorizations over the column panels of an out-of-core
+// matrix: panel k is read, updated by each previous factored panel (of which
+// there are numFactored in total) as it is streamed back through memory in
+// increasing order, factored with the in-core distributed kernels, and then
+// asynchronously written back. The previous panel is still resident when the
+// next step begins, so only the panels before it are reread.
+//
+// Four panels are resident at any time: the current panel, the previous
+// panel (whose writeback may be in flight), and two streaming buffers.
+template<typename F,typename UpdateFunctor,typename FactorFunctor>
+void LeftLooking
+( OutOfCoreMatrix<F>& A, Int numFactored,
+  UpdateFunctor update, FactorFunctor factor )
+{
+    EL_DEBUG_CSE
+    const El::Grid& g = A.Grid();
+    const Int numPanels = A.NumPanels();
+    DistMatrix<F> panels[2] = { DistMatrix<F>(g), DistMatrix<F>(g) };
+    std::future<void> writes[2];
+    for( Int k=0; k<numPanels; ++k )
+    {
+        // The previous occupant of this slot must be on disk before the slot
+        // is reused and before any panel before k-1 is streamed
+        const Int slot = k % 2;
+        Wait( writes[slot] );
+
+        const Int numUpdates = Min(k,numFactored);
+        const bool previousResident = ( numUpdates > 0 && numUpdates == k );
+        const Int numStreamed = ( previousResident ? k-1 : numUpdates );
+
+        auto& Pk = panels[slot];
+        auto readK = A.ReadPanelAsync( k, Pk );
+        PanelStream<F> stream( A, PanelSequence(0,numStreamed) );
+        readK.get();
+
+        while( !stream.Done() )
+        {
+            Int j;
+            auto& Pj = stream.Next( j );
+            update( Pj, j, Pk, k );
+        }
+        if( previousResident )
+            update( panels[1-slot], k-1, Pk, k );
+        if( k < numFactored )
+            factor( Pk, k );
+
+        writes[slot] = A.WritePanelAsync( k, Pk );
+    }
+    Wait( writes[0] );
+    Wait( writes[1] );
+}
+
+} // namespace ooc
+} // namespace El
+
+#endif // ifndef EL_FACTOR_OUTOFCORE_HPP
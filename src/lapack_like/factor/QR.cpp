@@ -16,8 +16,10 @@
 #include "./QR/Explicit.hpp"
 
 #include "./QR/ColSwap.hpp"
+#include "./QR/Mod.hpp"
 
 #include "./QR/TS.hpp"
+#include "./QR/Tile.hpp"
 
 namespace El {
 
@@ -72,9 +74,33 @@ void QR
   AbstractDistMatrix<Base<F>>& signature )
 {
     EL_DEBUG_CSE
-    qr::Householder( A, householderScalars, signature );
+    Workspace<F> workspace;
+    QR( A, householderScalars, signature, workspace );
+}
+
+template<typename F>
+void QR
+( AbstractDistMatrix<F>& A,
+  AbstractDistMatrix<F>& householderScalars,
+  AbstractDistMatrix<Base<F>>& signature,
+  Workspace<F>& workspace )
+{
+    EL_DEBUG_CSE
+    workspace.Reserve( qr::WorkspaceSize( A ) );
+    qr::Householder( A, householderScalars, signature, workspace );
 }
 
+namespace qr {
+
+template<typename F>
+Int WorkspaceSize( const AbstractDistMatrix<F>& A )
+{
+    EL_DEBUG_CSE
+    return HouseholderWorkspaceSize( A.Height(), A.Width(), A.Grid() );
+}
+
+} // namespace qr
+
 // Variants which perform (Businger-Golub) column-pivoting
 // =======================================================
 
@@ -112,6 +138,12 @@ void QR
     AbstractDistMatrix<F>& householderScalars, \
     AbstractDistMatrix<Base<F>>& signature ); \
   template void QR \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& householderScalars, \
+    AbstractDistMatrix<Base<F>>& signature, \
+    Workspace<F>& workspace ); \
+  template Int qr::WorkspaceSize( const AbstractDistMatrix<F>& A ); \
+  template void QR \
   ( Matrix<F>& A, \
     Matrix<F>& householderScalars, \
     Matrix<Base<F>>& signature, \
@@ -161,6 +193,66 @@ void QR
   (       Matrix<F>& Q, \
           Matrix<F>& R, \
     const Matrix<Int>& colSwaps ); \
+  template void qr::InsertColumns \
+  (       Matrix<F>& Q, \
+          Matrix<F>& R, \
+          Int j, \
+    const Matrix<F>& C ); \
+  template void qr::InsertColumns \
+  (       AbstractDistMatrix<F>& Q, \
+          AbstractDistMatrix<F>& R, \
+          Int j, \
+    const AbstractDistMatrix<F>& C ); \
+  template void qr::InsertRows \
+  (       Matrix<F>& Q, \
+          Matrix<F>& R, \
+          Int i, \
+    const Matrix<F>& C ); \
+  template void qr::InsertRows \
+  (       AbstractDistMatrix<F>& Q, \
+          AbstractDistMatrix<F>& R, \
+          Int i, \
+    const AbstractDistMatrix<F>& C ); \
+  template void qr::DeleteColumns \
+  ( Matrix<F>& Q, \
+    Matrix<F>& R, \
+    Int j, \
+    Int numCols ); \
+  template void qr::DeleteColumns \
+  ( AbstractDistMatrix<F>& Q, \
+    AbstractDistMatrix<F>& R, \
+    Int j, \
+    Int numCols ); \
+  template void qr::DeleteRows \
+  ( Matrix<F>& Q, \
+    Matrix<F>& R, \
+    Int i, \
+    Int numRows ); \
+  template void qr::DeleteRows \
+  ( AbstractDistMatrix<F>& Q, \
+    AbstractDistMatrix<F>& R, \
+    Int i, \
+    Int numRows ); \
+  template void qr::Mod \
+  (       Matrix<F>& Q, \
+          Matrix<F>& R, \
+    const Matrix<F>& U, \
+    const Matrix<F>& V ); \
+  template void qr::Mod \
+  (       AbstractDistMatrix<F>& Q, \
+          AbstractDistMatrix<F>& R, \
+    const AbstractDistMatrix<F>& U, \
+    const AbstractDistMatrix<F>& V ); \
+  template void qr::AppendColumns \
+  (       Matrix<F>& A, \
+          Matrix<F>& householderScalars, \
+          Matrix<Base<F>>& signature, \
+    const Matrix<F>& C ); \
+  template void qr::AppendColumns \
+  (       AbstractDistMatrix<F>& A, \
+          AbstractDistMatrix<F>& householderScalars, \
+          AbstractDistMatrix<Base<F>>& signature, \
+    const AbstractDistMatrix<F>& C ); \
   template void qr::ApplyQ \
   ( LeftOrRight side, \
     Orientation orientation, \
@@ -191,10 +283,17 @@ void QR
           AbstractDistMatrix<F>& X ); \
   template void qr::Cholesky \
   ( Matrix<F>& A, \
-    Matrix<F>& R ); \
+    Matrix<F>& R, \
+    const CholeskyQRCtrl& ctrl ); \
   template void qr::Cholesky \
   ( AbstractDistMatrix<F>& A, \
-    AbstractDistMatrix<F>& R ); \
+    AbstractDistMatrix<F>& R, \
+    const CholeskyQRCtrl& ctrl ); \
+  template void qr::Tile \
+  ( Matrix<F>& A, \
+    Matrix<F>& householderScalars, \
+    Matrix<Base<F>>& signature, \
+    Int tileSize ); \
   template qr::TreeData<F> qr::TS( const AbstractDistMatrix<F>& A ); \
   template void qr::ExplicitTS \
   ( AbstractDistMatrix<F>& A, \
@@ -12,26 +12,159 @@
 namespace El {
 namespace qr {
 
-// NOTE: This version is designed for tall-skinny matrices and is much less
-//       numerically stable than Householder-based QR factorizations
+// NOTE: These routines are designed for tall-skinny matrices. A single pass
+//       (CHOLESKY_QR) is much less numerically stable than Householder-based
+//       QR factorizations, but CHOLESKY_QR2 and SHIFTED_CHOLESKY_QR3 recover
+//       an orthogonality of O(eps) for condition numbers up to roughly
+//       1/sqrt(eps) and 1/eps, respectively, while only requiring a single
+//       reduction per pass.
 //
 // Computes the QR factorization of full-rank tall-skinny matrix A and
 // overwrites A with Q
 //
 
+namespace chol_qr {
+
+template<typename F>
+void FormGram( const Matrix<F>& A, Matrix<F>& G )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    Zeros( G, n, n );
+    Herk( UPPER, ADJOINT, Base<F>(1), A, Base<F>(0), G );
+}
+
+template<typename F,typename FGram,
+         typename=DisableIf<IsSame<F,FGram>>>
+void FormGram( const Matrix<F>& A, Matrix<FGram>& G )
+{
+    EL_DEBUG_CSE
+    Matrix<FGram> AGram;
+    Copy( A, AGram );
+    FormGram( AGram, G );
+}
+
+// R := chol(G + shift I), where the upper triangle of G is a Gram matrix
+template<typename F,typename FGram>
+void FactorGram( Matrix<FGram>& G, const Base<F>& shift, Matrix<F>& R )
+{
+    EL_DEBUG_CSE
+    if( shift != Base<F>(0) )
+        ShiftDiagonal( G, Caster<Base<F>,Base<FGram>>::Cast(shift) );
+    El::Cholesky( UPPER, G );
+    Copy( G, R );
+}
+
+// The shift of Fukaya et al. for the first pass of shifted CholeskyQR3, with
+// ||A||_F used as an upper bound for ||A||_2
+template<typename Real>
+Real Shift( Int m, Int n, const Real& frobNormA )
+{
+    const Real eps = limits::Epsilon<Real>();
+    return Real(11)*(Real(m)*Real(n)+Real(n)*Real(n+1))*eps*
+           frobNormA*frobNormA;
+}
+
+// R := chol(A^H A + shift I), A := A inv(R)
 template<typename F>
-void Cholesky( Matrix<F>& A, Matrix<F>& R )
+void Pass
+( Matrix<F>& A, Matrix<F>& R, const Base<F>& shift, bool promoteGram )
+{
+    EL_DEBUG_CSE
+    if( promoteGram )
+    {
+        Matrix<Promote<F>> G;
+        FormGram( A, G );
+        FactorGram( G, shift, R );
+    }
+    else
+    {
+        Matrix<F> G;
+        FormGram( A, G );
+        FactorGram( G, shift, R );
+    }
+    Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R, A );
+}
+
+// Each process of the column communicator of the [VC,* ] matrix A
+// contributes its local Gram matrix to a single summation
+template<typename F>
+void Pass
+( DistMatrix<F,VC,STAR>& A, Matrix<F>& R, const Base<F>& shift,
+  bool promoteGram )
+{
+    EL_DEBUG_CSE
+    if( promoteGram )
+    {
+        Matrix<Promote<F>> G;
+        FormGram( A.LockedMatrix(), G );
+        El::AllReduce( G, A.ColComm() );
+        FactorGram( G, shift, R );
+    }
+    else
+    {
+        Matrix<F> G;
+        FormGram( A.LockedMatrix(), G );
+        El::AllReduce( G, A.ColComm() );
+        FactorGram( G, shift, R );
+    }
+    Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R, A.Matrix() );
+}
+
+template<typename F,typename AType>
+void Passes
+( AType& A, Matrix<F>& R, const CholeskyQRCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    Int numUnshifted = ( ctrl.variant == CHOLESKY_QR2 ? 2 : 1 );
+    bool shifted = ( ctrl.variant == SHIFTED_CHOLESKY_QR3 );
+    if( !shifted )
+    {
+        // A is left unmodified if the Gram matrix is not numerically HPD
+        try
+        {
+            Pass( A, R, Real(0), ctrl.promoteGram );
+            --numUnshifted;
+        }
+        catch( const NonHPDMatrixException& )
+        {
+            if( !ctrl.shiftOnBreakdown )
+                throw;
+            shifted = true;
+        }
+    }
+    if( shifted )
+    {
+        const Real shift = Shift( A.Height(), A.Width(), FrobeniusNorm(A) );
+        Pass( A, R, shift, ctrl.promoteGram );
+        numUnshifted = 2;
+    }
+
+    Matrix<F> RPass;
+    for( ; numUnshifted>0; --numUnshifted )
+    {
+        Pass( A, RPass, Real(0), ctrl.promoteGram );
+        Trmm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), RPass, R );
+    }
+}
+
+} // namespace chol_qr
+
+template<typename F>
+void Cholesky( Matrix<F>& A, Matrix<F>& R, const CholeskyQRCtrl& ctrl )
 {
     EL_DEBUG_CSE
     if( A.Height() < A.Width() )
         LogicError("A^H A will be singular");
-    Herk( UPPER, ADJOINT, Base<F>(1), A, R );
-    El::Cholesky( UPPER, R );
-    Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R, A );
+    chol_qr::Passes( A, R, ctrl );
 }
 
 template<typename F>
-void Cholesky( AbstractDistMatrix<F>& APre, AbstractDistMatrix<F>& RPre )
+void Cholesky
+( AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& RPre,
+  const CholeskyQRCtrl& ctrl )
 {
     EL_DEBUG_CSE
     const Int m = APre.Height();
@@ -44,11 +177,9 @@ void Cholesky( AbstractDistMatrix<F>& APre, AbstractDistMatrix<F>& RPre )
     auto& A = AProx.Get();
     auto& R = RProx.Get();
 
-    Zeros( R, n, n );
-    Herk( UPPER, ADJOINT, Base<F>(1), A.Matrix(), Base<F>(0), R.Matrix() );
-    El::AllReduce( R, A.ColComm() );
-    El::Cholesky( UPPER, R.Matrix() );
-    Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R.Matrix(), A.Matrix() );
+    // The factors are computed redundantly on each process
+    R.Resize( n, n );
+    chol_qr::Passes( A, R.Matrix(), ctrl );
 }
 
 } // namespace qr
@@ -53,7 +53,8 @@ void
 Householder
 ( AbstractDistMatrix<F>& APre,
   AbstractDistMatrix<F>& householderScalarsPre,
-  AbstractDistMatrix<Base<F>>& signaturePre )
+  AbstractDistMatrix<Base<F>>& signaturePre,
+  Workspace<F>& workspace )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(AssertSameGrids( APre, householderScalarsPre, signaturePre ))
@@ -86,11 +87,32 @@ Householder
         auto householderScalars1 = householderScalars( ind1, ALL );
         auto sig1 = signature( ind1, ALL );
 
-        PanelHouseholder( AB1, householderScalars1, sig1 );
+        PanelHouseholder( AB1, householderScalars1, sig1, workspace );
         ApplyQ( LEFT, ADJOINT, AB1, householderScalars1, sig1, AB2 );
     }
 }
 
+// An upper bound on the workspace entries that any process draws on
+inline Int HouseholderWorkspaceSize( Int m, Int n, const Grid& grid )
+{
+    const Int nb = Min(Blocksize(),Min(m,n));
+    return MaxWorkspaceSize( m, 1, grid.Height() ) +
+           MaxWorkspaceSize( Max(nb-1,Int(0)), 1, grid.Width() );
+}
+
+template<typename F>
+void
+Householder
+( AbstractDistMatrix<F>& A,
+  AbstractDistMatrix<F>& householderScalars,
+  AbstractDistMatrix<Base<F>>& signature )
+{
+    EL_DEBUG_CSE
+    Workspace<F> workspace
+    ( HouseholderWorkspaceSize( A.Height(), A.Width(), A.Grid() ) );
+    Householder( A, householderScalars, signature, workspace );
+}
+
 } // namespace qr
 } // namespace El
 
@@ -0,0 +1,977 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_QR_MOD_HPP
+#define EL_QR_MOD_HPP
+
+// Updates of an explicit QR factorization A = Q R, where Q is m x n with
+// orthonormal columns and R is n x n and upper-triangular, after inserting or
+// deleting blocks of columns or rows of A or after a rank-k modification.
+//
+// Every update reduces to one (or both) of two kernels:
+//
+//  1) 'SpikeToTop' reduces a "spike" of k full columns to [T; 0] with
+//     orthogonal transformations which each act on k+1 consecutive rows,
+//     sweeping from the bottom up, so that an upper-triangular matrix they
+//     are applied to picks up at most k subdiagonals;
+//
+//  2) 'BandToTriangular' returns a matrix with k subdiagonals to
+//     upper-triangular form with Householder QR of successive
+//     (nb+k) x nb panels.
+//
+// In both cases the transformations are aggregated, nb (the algorithmic
+// blocksize) at a time, into dense (nb+k) x (nb+k) unitary matrices, so that
+// their applications to the trailing columns of R and to the columns of Q are
+// Level 3. The aggregated matrices are applied without exploiting their
+// structure, so an update costs O((m+n) n (nb+k)^2 / nb) work. This exceeds
+// the O((m+n) n k) work of applying the transformations one at a time by
+// roughly a factor of (nb+k)^2 / (nb k), but is much less than the O(m n^2)
+// cost of refactoring whenever (nb+k)^2 / nb is much smaller than n.
+
+namespace El {
+namespace qr {
+
+namespace mod {
+
+// Overwrite S with [T; 0] by a bottom-up sweep of transformations acting on
+// k+1 rows at a time. Each group of (up to) nb of them is accumulated into an
+// explicit unitary matrix G, and
+//
+//     apply( G, offset )
+//
+// is then expected to overwrite the rows [offset,offset+size(G)) of the
+// target with G^H times themselves (and the corresponding columns of Q with
+// themselves times G).
+template<typename F,class ApplyType>
+void SpikeToTop( Matrix<F>& S, const ApplyType& apply, Int nb )
+{
+    EL_DEBUG_CSE
+    const Int p = S.Height();
+    const Int k = S.Width();
+    if( p == 0 || k == 0 )
+        return;
+    const Int windowSize = Min( k+1, p );
+
+    Matrix<F> G, W, householderScalars;
+    Matrix<Base<F>> signature;
+    Int rEnd = p - windowSize;
+    while( rEnd >= 0 )
+    {
+        const Int rBeg = Max( rEnd-nb+1, Int(0) );
+        const Int offset = rBeg;
+        const Int groupSize = rEnd+windowSize - rBeg;
+        Identity( G, groupSize, groupSize );
+        for( Int r=rEnd; r>=rBeg; --r )
+        {
+            const Int rLoc = r - offset;
+            auto SWin = S( IR(r,r+windowSize), ALL );
+            W = SWin;
+            QR( W, householderScalars, signature );
+            auto GWin = G( ALL, IR(rLoc,rLoc+windowSize) );
+            ApplyQ( RIGHT, NORMAL, W, householderScalars, signature, GWin );
+            MakeTrapezoidal( UPPER, W );
+            SWin = W;
+        }
+        apply( G, offset );
+        rEnd = rBeg-1;
+    }
+}
+
+// B(offset:offset+s,:) := G^H B(offset:offset+s,:) and
+// Q(:,offset:offset+s) := Q(:,offset:offset+s) G
+template<typename F>
+void ApplyGroup( const Matrix<F>& G, Int offset, Matrix<F>& B, Matrix<F>& Q )
+{
+    EL_DEBUG_CSE
+    const Int s = G.Height();
+    Matrix<F> T;
+
+    auto B1 = B( IR(offset,offset+s), ALL );
+    T = B1;
+    Gemm( ADJOINT, NORMAL, F(1), G, T, F(0), B1 );
+
+    auto Q1 = Q( ALL, IR(offset,offset+s) );
+    T = Q1;
+    Gemm( NORMAL, NORMAL, F(1), T, G, F(0), Q1 );
+}
+
+template<typename F>
+void ApplyGroup
+( const Matrix<F>& G, Int offset, DistMatrix<F>& B, DistMatrix<F>& Q )
+{
+    EL_DEBUG_CSE
+    const Int s = G.Height();
+    const Grid& g = B.Grid();
+    DistMatrix<F,STAR,STAR> G_STAR_STAR(g);
+    G_STAR_STAR.LockedAttach( s, s, g, 0, 0, G );
+    DistMatrix<F> T(g);
+
+    auto B1 = B( IR(offset,offset+s), ALL );
+    T = B1;
+    Gemm( ADJOINT, NORMAL, F(1), G_STAR_STAR, T, F(0), B1 );
+
+    auto Q1 = Q( ALL, IR(offset,offset+s) );
+    T = Q1;
+    Gemm( NORMAL, NORMAL, F(1), T, G_STAR_STAR, F(0), Q1 );
+}
+
+// Return the matrix B, which is zero below its k'th subdiagonal, to
+// upper-triangular form, applying the same transformations to the columns
+// of Q (which must have as many columns as B has rows)
+template<typename F>
+void BandToTriangular( Matrix<F>& B, Int k, Matrix<F>& Q, Int nb )
+{
+    EL_DEBUG_CSE
+    const Int p = B.Height();
+    const Int q = B.Width();
+    Matrix<F> P, householderScalars;
+    Matrix<Base<F>> signature;
+    for( Int c=0; c<Min(p,q); c+=nb )
+    {
+        const Int nbc = Min( nb, q-c );
+        const Int rEnd = Min( c+nbc+k, p );
+        auto BPan = B( IR(c,rEnd), IR(c,c+nbc) );
+        auto BRight = B( IR(c,rEnd), IR(c+nbc,q) );
+        auto QPan = Q( ALL, IR(c,rEnd) );
+
+        P = BPan;
+        QR( P, householderScalars, signature );
+        ApplyQ( LEFT, ADJOINT, P, householderScalars, signature, BRight );
+        ApplyQ( RIGHT, NORMAL, P, householderScalars, signature, QPan );
+        MakeTrapezoidal( UPPER, P );
+        BPan = P;
+    }
+}
+
+template<typename F>
+void BandToTriangular( DistMatrix<F>& B, Int k, DistMatrix<F>& Q, Int nb )
+{
+    EL_DEBUG_CSE
+    const Int p = B.Height();
+    const Int q = B.Width();
+    const Grid& g = B.Grid();
+    DistMatrix<F> P(g);
+    DistMatrix<F,MD,STAR> householderScalars(g);
+    DistMatrix<Base<F>,MD,STAR> signature(g);
+    for( Int c=0; c<Min(p,q); c+=nb )
+    {
+        const Int nbc = Min( nb, q-c );
+        const Int rEnd = Min( c+nbc+k, p );
+        auto BPan = B( IR(c,rEnd), IR(c,c+nbc) );
+        auto BRight = B( IR(c,rEnd), IR(c+nbc,q) );
+        auto QPan = Q( ALL, IR(c,rEnd) );
+
+        P = BPan;
+        QR( P, householderScalars, signature );
+        ApplyQ( LEFT, ADJOINT, P, householderScalars, signature, BRight );
+        ApplyQ( RIGHT, NORMAL, P, householderScalars, signature, QPan );
+        MakeTrapezoidal( UPPER, P );
+        BPan = P;
+    }
+}
+
+// Recompute the factorization C = Q W + Q2 R2 one column at a time, after C
+// has already been projected against Q (with the projection accumulated into
+// W). Each column is orthogonalized twice against [Q, Q2(:,0:j)]; a column
+// whose remainder is at the level of the rounding errors (its direction would
+// be determined by them) is instead replaced with an orthogonalized random
+// direction and given a zero diagonal entry in R2.
+template<typename F>
+void ColumnComplement
+( const Matrix<F>& Q, const Matrix<F>& CPerp,
+  Matrix<F>& Q2, Matrix<F>& W, Matrix<F>& R2, Base<F> tol )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = CPerp.Height();
+    const Int k = CPerp.Width();
+    Zeros( Q2, m, k );
+    Zeros( R2, k, k );
+
+    Matrix<F> v, r, w, rj;
+    auto project = [&]( Int j, Matrix<F>& x, bool accumulate )
+      {
+          Gemm( ADJOINT, NORMAL, F(1), Q, x, r );
+          Gemm( NORMAL, NORMAL, F(-1), Q, r, F(1), x );
+          if( accumulate )
+              w += r;
+          if( j > 0 )
+          {
+              auto Q2L = Q2( ALL, IR(0,j) );
+              Gemm( ADJOINT, NORMAL, F(1), Q2L, x, r );
+              Gemm( NORMAL, NORMAL, F(-1), Q2L, r, F(1), x );
+              if( accumulate )
+                  rj += r;
+          }
+      };
+    for( Int j=0; j<k; ++j )
+    {
+        w = W( ALL, IR(j) );
+        Zeros( rj, j, 1 );
+        v = CPerp( ALL, IR(j) );
+        for( Int pass=0; pass<2; ++pass )
+            project( j, v, true );
+        auto wj = W( ALL, IR(j) );
+        wj = w;
+        if( j > 0 )
+        {
+            auto R2j = R2( IR(0,j), IR(j) );
+            R2j = rj;
+        }
+        Real beta = FrobeniusNorm( v );
+        if( beta > tol )
+        {
+            R2(j,j) = beta;
+        }
+        else
+        {
+            // The remainder is discarded, which perturbs C at the level of
+            // the rounding errors
+            const Int maxTries = 10;
+            for( Int attempt=0; attempt<maxTries; ++attempt )
+            {
+                Gaussian( v, m, 1 );
+                const Real origNorm = FrobeniusNorm( v );
+                for( Int pass=0; pass<3; ++pass )
+                    project( j, v, false );
+                beta = FrobeniusNorm( v );
+                if( beta > Sqrt(limits::Epsilon<Real>())*origNorm )
+                    break;
+                if( attempt == maxTries-1 )
+                    RuntimeError("Could not complete the orthonormal basis");
+            }
+        }
+        v *= F(1)/beta;
+        auto q2j = Q2( ALL, IR(j) );
+        q2j = v;
+    }
+}
+
+template<typename F>
+void ColumnComplement
+( const DistMatrix<F>& Q, const DistMatrix<F>& CPerp,
+  DistMatrix<F>& Q2, DistMatrix<F>& W, DistMatrix<F>& R2, Base<F> tol )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = Q.Grid();
+    const Int m = CPerp.Height();
+    const Int k = CPerp.Width();
+    Zeros( Q2, m, k );
+    Zeros( R2, k, k );
+
+    DistMatrix<F> v(g), r(g), w(g), rj(g);
+    auto project = [&]( Int j, DistMatrix<F>& x, bool accumulate )
+      {
+          Gemm( ADJOINT, NORMAL, F(1), Q, x, r );
+          Gemm( NORMAL, NORMAL, F(-1), Q, r, F(1), x );
+          if( accumulate )
+              w += r;
+          if( j > 0 )
+          {
+              auto Q2L = Q2( ALL, IR(0,j) );
+              Gemm( ADJOINT, NORMAL, F(1), Q2L, x, r );
+              Gemm( NORMAL, NORMAL, F(-1), Q2L, r, F(1), x );
+              if( accumulate )
+                  rj += r;
+          }
+      };
+    for( Int j=0; j<k; ++j )
+    {
+        w = W( ALL, IR(j) );
+        Zeros( rj, j, 1 );
+        v = CPerp( ALL, IR(j) );
+        for( Int pass=0; pass<2; ++pass )
+            project( j, v, true );
+        auto wj = W( ALL, IR(j) );
+        wj = w;
+        if( j > 0 )
+        {
+            auto R2j = R2( IR(0,j), IR(j) );
+            R2j = rj;
+        }
+        Real beta = FrobeniusNorm( v );
+        if( beta > tol )
+        {
+            R2.Set( j, j, beta );
+        }
+        else
+        {
+            // The remainder is discarded, which perturbs C at the level of
+            // the rounding errors
+            const Int maxTries = 10;
+            for( Int attempt=0; attempt<maxTries; ++attempt )
+            {
+                Gaussian( v, m, 1 );
+                const Real origNorm = FrobeniusNorm( v );
+                for( Int pass=0; pass<3; ++pass )
+                    project( j, v, false );
+                beta = FrobeniusNorm( v );
+                if( beta > Sqrt(limits::Epsilon<Real>())*origNorm )
+                    break;
+                if( attempt == maxTries-1 )
+                    RuntimeError("Could not complete the orthonormal basis");
+            }
+        }
+        v *= F(1)/beta;
+        auto q2j = Q2( ALL, IR(j) );
+        q2j = v;
+    }
+}
+
+// Split C into its components within and orthogonal to range(Q), i.e.,
+// C = Q W + Q2 R2, with C overwritten by Q2.
+//
+// Classical Gram-Schmidt is applied twice before the QR factorization of the
+// remainder. Since the columns of Q2 are then only orthogonal to Q up to
+// roughly eps ||C|| / sigma_min(R2), they are projected against Q once more
+// (and refactored). If the remainder is numerically rank-deficient, e.g.,
+// because some columns of C lie in range(Q), the factorization is instead
+// recomputed column by column so that the deficient directions of Q2 can be
+// replaced.
+template<typename F>
+void Complement( const Matrix<F>& Q, Matrix<F>& C, Matrix<F>& W, Matrix<F>& R2 )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = C.Height();
+    const Int k = C.Width();
+    const Real tol = m*limits::Epsilon<Real>()*FrobeniusNorm( C );
+
+    Matrix<F> dW;
+    Gemm( ADJOINT, NORMAL, F(1), Q, C, W );
+    Gemm( NORMAL, NORMAL, F(-1), Q, W, F(1), C );
+    Gemm( ADJOINT, NORMAL, F(1), Q, C, dW );
+    Gemm( NORMAL, NORMAL, F(-1), Q, dW, F(1), C );
+    W += dW;
+
+    Matrix<F> CPerp( C );
+    qr::Explicit( C, R2 );
+    bool deficient = false;
+    for( Int j=0; j<k; ++j )
+        if( Abs(R2(j,j)) <= tol )
+            deficient = true;
+    if( deficient )
+    {
+        ColumnComplement( Q, CPerp, C, W, R2, tol );
+        return;
+    }
+
+    // Q2 R2 = (Q2 - Q X) R2 + Q (X R2), with Q2 - Q X = Q3 T
+    Matrix<F> X, T;
+    Gemm( ADJOINT, NORMAL, F(1), Q, C, X );
+    Gemm( NORMAL, NORMAL, F(-1), Q, X, F(1), C );
+    Gemm( NORMAL, NORMAL, F(1), X, R2, F(1), W );
+    qr::Explicit( C, T );
+    Trmm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), T, R2 );
+}
+
+template<typename F>
+void Complement
+( const DistMatrix<F>& Q, DistMatrix<F>& C, DistMatrix<F>& W,
+  DistMatrix<F>& R2 )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = Q.Grid();
+    const Int m = C.Height();
+    const Int k = C.Width();
+    const Real tol = m*limits::Epsilon<Real>()*FrobeniusNorm( C );
+
+    DistMatrix<F> dW(g);
+    Gemm( ADJOINT, NORMAL, F(1), Q, C, W );
+    Gemm( NORMAL, NORMAL, F(-1), Q, W, F(1), C );
+    Gemm( ADJOINT, NORMAL, F(1), Q, C, dW );
+    Gemm( NORMAL, NORMAL, F(-1), Q, dW, F(1), C );
+    W += dW;
+
+    DistMatrix<F> CPerp( C );
+    qr::Explicit( C, R2 );
+    bool deficient = false;
+    for( Int j=0; j<k; ++j )
+        if( Abs(R2.Get(j,j)) <= tol )
+            deficient = true;
+    if( deficient )
+    {
+        ColumnComplement( Q, CPerp, C, W, R2, tol );
+        return;
+    }
+
+    // Q2 R2 = (Q2 - Q X) R2 + Q (X R2), with Q2 - Q X = Q3 T
+    DistMatrix<F> X(g), T(g);
+    Gemm( ADJOINT, NORMAL, F(1), Q, C, X );
+    Gemm( NORMAL, NORMAL, F(-1), Q, X, F(1), C );
+    Gemm( NORMAL, NORMAL, F(1), X, R2, F(1), W );
+    qr::Explicit( C, T );
+    Trmm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), T, R2 );
+}
+
+inline void CheckFactors( Int mQ, Int nQ, Int mR, Int nR )
+{
+    if( mR != nQ || nR != nQ )
+        LogicError("R must be square with as many rows as Q has columns");
+    if( mQ < nQ )
+        LogicError("Q must be at least as tall as it is wide");
+}
+
+} // namespace mod
+
+// Insert the columns of C before column j of A
+// --------------------------------------------
+template<typename F>
+void InsertColumns( Matrix<F>& Q, Matrix<F>& R, Int j, const Matrix<F>& C )
+{
+    EL_DEBUG_CSE
+    const Int m = Q.Height();
+    const Int n = Q.Width();
+    const Int k = C.Width();
+    mod::CheckFactors( m, n, R.Height(), R.Width() );
+    if( C.Height() != m )
+        LogicError("C must be the same height as Q");
+    if( j < 0 || j > n )
+        LogicError("Invalid insertion point ",j);
+    if( m < n+k )
+        LogicError("Cannot insert ",k," columns into an ",m," x ",n," QR");
+
+    Matrix<F> Q2( C ), W, R2;
+    mod::Complement( Q, Q2, W, R2 );
+
+    // A [C inserted] = [Q, Q2] | R(:,0:j), W,  R(:,j:n) |
+    //                          | 0,        R2, 0        |
+    Matrix<F> QNew, RNew;
+    Zeros( QNew, m, n+k );
+    Zeros( RNew, n+k, n+k );
+    QNew( ALL, IR(0,n) ) = Q;
+    QNew( ALL, IR(n,n+k) ) = Q2;
+    RNew( IR(0,n), IR(0,j) ) = R( ALL, IR(0,j) );
+    RNew( IR(0,n), IR(j,j+k) ) = W;
+    RNew( IR(n,n+k), IR(j,j+k) ) = R2;
+    RNew( IR(0,n), IR(j+k,n+k) ) = R( ALL, IR(j,n) );
+
+    // Sweep the spike below the diagonal of columns [j,j+k) away; the
+    // trailing columns, having been shifted right by k, stay triangular
+    auto RSpike = RNew( IR(j,n+k), IR(j,j+k) );
+    auto RTrail = RNew( IR(j,n+k), IR(j+k,n+k) );
+    auto QTrail = QNew( ALL, IR(j,n+k) );
+    Matrix<F> S( RSpike );
+    mod::SpikeToTop
+    ( S, [&]( const Matrix<F>& G, Int offset )
+         { mod::ApplyGroup( G, offset, RTrail, QTrail ); },
+      Blocksize() );
+    RSpike = S;
+    MakeTrapezoidal( UPPER, RNew );
+
+    Q = QNew;
+    R = RNew;
+}
+
+template<typename F>
+void InsertColumns
+( AbstractDistMatrix<F>& QPre,
+  AbstractDistMatrix<F>& RPre,
+  Int j,
+  const AbstractDistMatrix<F>& C )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<F,F,MC,MR> QProx( QPre ), RProx( RPre );
+    auto& Q = QProx.Get();
+    auto& R = RProx.Get();
+    const Grid& g = Q.Grid();
+    const Int m = Q.Height();
+    const Int n = Q.Width();
+    const Int k = C.Width();
+    mod::CheckFactors( m, n, R.Height(), R.Width() );
+    if( C.Height() != m )
+        LogicError("C must be the same height as Q");
+    if( j < 0 || j > n )
+        LogicError("Invalid insertion point ",j);
+    if( m < n+k )
+        LogicError("Cannot insert ",k," columns into an ",m," x ",n," QR");
+
+    DistMatrix<F> Q2( C ), W(g), R2(g);
+    mod::Complement( Q, Q2, W, R2 );
+
+    DistMatrix<F> QNew(g), RNew(g);
+    Zeros( QNew, m, n+k );
+    Zeros( RNew, n+k, n+k );
+    QNew( ALL, IR(0,n) ) = Q;
+    QNew( ALL, IR(n,n+k) ) = Q2;
+    RNew( IR(0,n), IR(0,j) ) = R( ALL, IR(0,j) );
+    RNew( IR(0,n), IR(j,j+k) ) = W;
+    RNew( IR(n,n+k), IR(j,j+k) ) = R2;
+    RNew( IR(0,n), IR(j+k,n+k) ) = R( ALL, IR(j,n) );
+
+    // The spike is only n+k-j by k, so its transformations are computed
+    // redundantly by every process
+    auto RSpike = RNew( IR(j,n+k), IR(j,j+k) );
+    auto RTrail = RNew( IR(j,n+k), IR(j+k,n+k) );
+    auto QTrail = QNew( ALL, IR(j,n+k) );
+    DistMatrix<F,STAR,STAR> S_STAR_STAR( RSpike );
+    mod::SpikeToTop
+    ( S_STAR_STAR.Matrix(),
+      [&]( const Matrix<F>& G, Int offset )
+      { mod::ApplyGroup( G, offset, RTrail, QTrail ); },
+      Blocksize() );
+    RSpike = S_STAR_STAR;
+    MakeTrapezoidal( UPPER, RNew );
+
+    Q = QNew;
+    R = RNew;
+}
+
+// Delete the columns [j,j+numCols) of A
+// -------------------------------------
+template<typename F>
+void DeleteColumns( Matrix<F>& Q, Matrix<F>& R, Int j, Int numCols )
+{
+    EL_DEBUG_CSE
+    const Int m = Q.Height();
+    const Int n = Q.Width();
+    const Int k = numCols;
+    mod::CheckFactors( m, n, R.Height(), R.Width() );
+    if( j < 0 || k < 0 || j+k > n )
+        LogicError("Invalid column range [",j,",",j+k,")");
+
+    // Removing the columns leaves k subdiagonals in the trailing columns
+    Matrix<F> RNew;
+    Zeros( RNew, n, n-k );
+    RNew( ALL, IR(0,j) ) = R( ALL, IR(0,j) );
+    RNew( ALL, IR(j,n-k) ) = R( ALL, IR(j+k,n) );
+    auto RBand = RNew( IR(j,n), IR(j,n-k) );
+    auto QBand = Q( ALL, IR(j,n) );
+    mod::BandToTriangular( RBand, k, QBand, Blocksize() );
+
+    R = RNew( IR(0,n-k), ALL );
+    MakeTrapezoidal( UPPER, R );
+    Matrix<F> QNew( Q( ALL, IR(0,n-k) ) );
+    Q = QNew;
+}
+
+template<typename F>
+void DeleteColumns
+( AbstractDistMatrix<F>& QPre,
+  AbstractDistMatrix<F>& RPre,
+  Int j,
+  Int numCols )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<F,F,MC,MR> QProx( QPre ), RProx( RPre );
+    auto& Q = QProx.Get();
+    auto& R = RProx.Get();
+    const Grid& g = Q.Grid();
+    const Int m = Q.Height();
+    const Int n = Q.Width();
+    const Int k = numCols;
+    mod::CheckFactors( m, n, R.Height(), R.Width() );
+    if( j < 0 || k < 0 || j+k > n )
+        LogicError("Invalid column range [",j,",",j+k,")");
+
+    DistMatrix<F> RNew(g);
+    Zeros( RNew, n, n-k );
+    RNew( ALL, IR(0,j) ) = R( ALL, IR(0,j) );
+    RNew( ALL, IR(j,n-k) ) = R( ALL, IR(j+k,n) );
+    auto RBand = RNew( IR(j,n), IR(j,n-k) );
+    auto QBand = Q( ALL, IR(j,n) );
+    mod::BandToTriangular( RBand, k, QBand, Blocksize() );
+
+    R = RNew( IR(0,n-k), ALL );
+    MakeTrapezoidal( UPPER, R );
+    DistMatrix<F> QNew( Q( ALL, IR(0,n-k) ) );
+    Q = QNew;
+}
+
+// Insert the rows of C before row i of A
+// --------------------------------------
+template<typename F>
+void InsertRows( Matrix<F>& Q, Matrix<F>& R, Int i, const Matrix<F>& C )
+{
+    EL_DEBUG_CSE
+    const Int m = Q.Height();
+    const Int n = Q.Width();
+    const Int k = C.Height();
+    mod::CheckFactors( m, n, R.Height(), R.Width() );
+    if( C.Width() != n )
+        LogicError("C must be the same width as R");
+    if( i < 0 || i > m )
+        LogicError("Invalid insertion point ",i);
+
+    // A [C inserted] = [E, Q [zero rows inserted]] | C |,
+    //                                              | R |
+    // where E is the identity in the inserted rows, and [C; R] has k
+    // subdiagonals
+    Matrix<F> QBig, B;
+    Zeros( QBig, m+k, k+n );
+    QBig( IR(0,i), IR(k,k+n) ) = Q( IR(0,i), ALL );
+    QBig( IR(i+k,m+k), IR(k,k+n) ) = Q( IR(i,m), ALL );
+    for( Int t=0; t<k; ++t )
+        QBig(i+t,t) = F(1);
+    Zeros( B, k+n, n );
+    B( IR(0,k), ALL ) = C;
+    B( IR(k,k+n), ALL ) = R;
+    mod::BandToTriangular( B, k, QBig, Blocksize() );
+
+    R = B( IR(0,n), ALL );
+    MakeTrapezoidal( UPPER, R );
+    Q = QBig( ALL, IR(0,n) );
+}
+
+template<typename F>
+void InsertRows
+( AbstractDistMatrix<F>& QPre,
+  AbstractDistMatrix<F>& RPre,
+  Int i,
+  const AbstractDistMatrix<F>& C )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<F,F,MC,MR> QProx( QPre ), RProx( RPre );
+    auto& Q = QProx.Get();
+    auto& R = RProx.Get();
+    const Grid& g = Q.Grid();
+    const Int m = Q.Height();
+    const Int n = Q.Width();
+    const Int k = C.Height();
+    mod::CheckFactors( m, n, R.Height(), R.Width() );
+    if( C.Width() != n )
+        LogicError("C must be the same width as R");
+    if( i < 0 || i > m )
+        LogicError("Invalid insertion point ",i);
+
+    DistMatrix<F> QBig(g), B(g);
+    Zeros( QBig, m+k, k+n );
+    QBig( IR(0,i), IR(k,k+n) ) = Q( IR(0,i), ALL );
+    QBig( IR(i+k,m+k), IR(k,k+n) ) = Q( IR(i,m), ALL );
+    auto E = QBig( IR(i,i+k), IR(0,k) );
+    FillDiagonal( E, F(1) );
+    Zeros( B, k+n, n );
+    B( IR(0,k), ALL ) = C;
+    B( IR(k,k+n), ALL ) = R;
+    mod::BandToTriangular( B, k, QBig, Blocksize() );
+
+    R = B( IR(0,n), ALL );
+    MakeTrapezoidal( UPPER, R );
+    Q = QBig( ALL, IR(0,n) );
+}
+
+// Delete the rows [i,i+numRows) of A
+// ----------------------------------
+template<typename F>
+void DeleteRows( Matrix<F>& Q, Matrix<F>& R, Int i, Int numRows )
+{
+    EL_DEBUG_CSE
+    const Int m = Q.Height();
+    const Int n = Q.Width();
+    const Int k = numRows;
+    mod::CheckFactors( m, n, R.Height(), R.Width() );
+    if( i < 0 || k < 0 || i+k > m )
+        LogicError("Invalid row range [",i,",",i+k,")");
+    if( m < n+k )
+        LogicError("Cannot delete ",k," rows from an ",m," x ",n," QR");
+
+    // Extend Q to [Q, Qc] so that its range contains the deleted unit vectors
+    Matrix<F> Qc, W, Rc;
+    Zeros( Qc, m, k );
+    auto E = Qc( IR(i,i+k), ALL );
+    FillDiagonal( E, F(1) );
+    mod::Complement( Q, Qc, W, Rc );
+    Matrix<F> QBig, B;
+    Zeros( QBig, m, n+k );
+    QBig( ALL, IR(0,n) ) = Q;
+    QBig( ALL, IR(n,n+k) ) = Qc;
+    Zeros( B, n+k, n );
+    B( IR(0,n), ALL ) = R;
+
+    // Rotate the (orthonormal) deleted rows of [Q, Qc] into its first k
+    // columns, which are then supported only on the deleted rows. This
+    // leaves k subdiagonals in [R; 0], so dropping its first k rows leaves
+    // the new (triangular) R.
+    Matrix<F> S;
+    Adjoint( QBig( IR(i,i+k), ALL ), S );
+    mod::SpikeToTop
+    ( S, [&]( const Matrix<F>& G, Int offset )
+         { mod::ApplyGroup( G, offset, B, QBig ); },
+      Blocksize() );
+
+    R = B( IR(k,n+k), ALL );
+    MakeTrapezoidal( UPPER, R );
+    Zeros( Q, m-k, n );
+    Q( IR(0,i), ALL ) = QBig( IR(0,i), IR(k,n+k) );
+    Q( IR(i,m-k), ALL ) = QBig( IR(i+k,m), IR(k,n+k) );
+}
+
+template<typename F>
+void DeleteRows
+( AbstractDistMatrix<F>& QPre,
+  AbstractDistMatrix<F>& RPre,
+  Int i,
+  Int numRows )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<F,F,MC,MR> QProx( QPre ), RProx( RPre );
+    auto& Q = QProx.Get();
+    auto& R = RProx.Get();
+    const Grid& g = Q.Grid();
+    const Int m = Q.Height();
+    const Int n = Q.Width();
+    const Int k = numRows;
+    mod::CheckFactors( m, n, R.Height(), R.Width() );
+    if( i < 0 || k < 0 || i+k > m )
+        LogicError("Invalid row range [",i,",",i+k,")");
+    if( m < n+k )
+        LogicError("Cannot delete ",k," rows from an ",m," x ",n," QR");
+
+    DistMatrix<F> Qc(g), W(g), Rc(g);
+    Zeros( Qc, m, k );
+    auto E = Qc( IR(i,i+k), ALL );
+    FillDiagonal( E, F(1) );
+    mod::Complement( Q, Qc, W, Rc );
+    DistMatrix<F> QBig(g), B(g);
+    Zeros( QBig, m, n+k );
+    QBig( ALL, IR(0,n) ) = Q;
+    QBig( ALL, IR(n,n+k) ) = Qc;
+    Zeros( B, n+k, n );
+    B( IR(0,n), ALL ) = R;
+
+    DistMatrix<F,STAR,STAR> S_STAR_STAR(g);
+    Adjoint( QBig( IR(i,i+k), ALL ), S_STAR_STAR );
+    mod::SpikeToTop
+    ( S_STAR_STAR.Matrix(),
+      [&]( const Matrix<F>& G, Int offset )
+      { mod::ApplyGroup( G, offset, B, QBig ); },
+      Blocksize() );
+
+    R = B( IR(k,n+k), ALL );
+    MakeTrapezoidal( UPPER, R );
+    Zeros( Q, m-k, n );
+    Q( IR(0,i), ALL ) = QBig( IR(0,i), IR(k,n+k) );
+    Q( IR(i,m-k), ALL ) = QBig( IR(i+k,m), IR(k,n+k) );
+}
+
+// Rank-k modification A := A + U V^H
+// ----------------------------------
+template<typename F>
+void Mod
+(       Matrix<F>& Q,
+        Matrix<F>& R,
+  const Matrix<F>& U,
+  const Matrix<F>& V )
+{
+    EL_DEBUG_CSE
+    const Int m = Q.Height();
+    const Int n = Q.Width();
+    const Int k = U.Width();
+    mod::CheckFactors( m, n, R.Height(), R.Width() );
+    if( U.Height() != m || V.Height() != n || V.Width() != k )
+        LogicError("U and V must be m x k and n x k");
+    // A square Q already spans every U
+    const Int extra = ( m == n ? 0 : k );
+    if( m < n+extra )
+        LogicError("Cannot modify an ",m," x ",n," QR by rank ",k);
+
+    // A + U V^H = [Q, Q2] ( | R | + | W  | V^H )
+    //                       | 0 |   | R2 |
+    Matrix<F> QBig, B, S;
+    Zeros( QBig, m, n+extra );
+    Zeros( B, n+extra, n );
+    Zeros( S, n+extra, k );
+    QBig( ALL, IR(0,n) ) = Q;
+    B( IR(0,n), ALL ) = R;
+    if( extra > 0 )
+    {
+        Matrix<F> Q2( U ), W, R2;
+        mod::Complement( Q, Q2, W, R2 );
+        QBig( ALL, IR(n,n+k) ) = Q2;
+        S( IR(0,n), ALL ) = W;
+        S( IR(n,n+k), ALL ) = R2;
+    }
+    else
+        Gemm( ADJOINT, NORMAL, F(1), Q, U, F(0), S );
+
+    // Reduce the coefficients of U to [T; 0], which leaves k subdiagonals in
+    // [R; 0], so that the update only touches the first k rows
+    mod::SpikeToTop
+    ( S, [&]( const Matrix<F>& G, Int offset )
+         { mod::ApplyGroup( G, offset, B, QBig ); },
+      Blocksize() );
+    const Int kEff = Min( k, n+extra );
+    auto BTop = B( IR(0,kEff), ALL );
+    Gemm( NORMAL, ADJOINT, F(1), S(IR(0,kEff),ALL), V, F(1), BTop );
+    mod::BandToTriangular( B, k, QBig, Blocksize() );
+
+    R = B( IR(0,n), ALL );
+    MakeTrapezoidal( UPPER, R );
+    Q = QBig( ALL, IR(0,n) );
+}
+
+template<typename F>
+void Mod
+(       AbstractDistMatrix<F>& QPre,
+        AbstractDistMatrix<F>& RPre,
+  const AbstractDistMatrix<F>& U,
+  const AbstractDistMatrix<F>& V )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<F,F,MC,MR> QProx( QPre ), RProx( RPre );
+    auto& Q = QProx.Get();
+    auto& R = RProx.Get();
+    const Grid& g = Q.Grid();
+    const Int m = Q.Height();
+    const Int n = Q.Width();
+    const Int k = U.Width();
+    mod::CheckFactors( m, n, R.Height(), R.Width() );
+    if( U.Height() != m || V.Height() != n || V.Width() != k )
+        LogicError("U and V must be m x k and n x k");
+    const Int extra = ( m == n ? 0 : k );
+    if( m < n+extra )
+        LogicError("Cannot modify an ",m," x ",n," QR by rank ",k);
+
+    DistMatrix<F> QBig(g), B(g), S(g);
+    Zeros( QBig, m, n+extra );
+    Zeros( B, n+extra, n );
+    Zeros( S, n+extra, k );
+    QBig( ALL, IR(0,n) ) = Q;
+    B( IR(0,n), ALL ) = R;
+    if( extra > 0 )
+    {
+        DistMatrix<F> Q2( U ), W(g), R2(g);
+        mod::Complement( Q, Q2, W, R2 );
+        QBig( ALL, IR(n,n+k) ) = Q2;
+        S( IR(0,n), ALL ) = W;
+        S( IR(n,n+k), ALL ) = R2;
+    }
+    else
+        Gemm( ADJOINT, NORMAL, F(1), Q, U, F(0), S );
+
+    DistMatrix<F,STAR,STAR> S_STAR_STAR( S );
+    mod::SpikeToTop
+    ( S_STAR_STAR.Matrix(),
+      [&]( const Matrix<F>& G, Int offset )
+      { mod::ApplyGroup( G, offset, B, QBig ); },
+      Blocksize() );
+    const Int kEff = Min( k, n+extra );
+    auto BTop = B( IR(0,kEff), ALL );
+    auto STop = S_STAR_STAR( IR(0,kEff), ALL );
+    Gemm( NORMAL, ADJOINT, F(1), STop, V, F(1), BTop );
+    mod::BandToTriangular( B, k, QBig, Blocksize() );
+
+    R = B( IR(0,n), ALL );
+    MakeTrapezoidal( UPPER, R );
+    Q = QBig( ALL, IR(0,n) );
+}
+
+// Append the columns of C to a packed Householder QR
+// --------------------------------------------------
+// The reflectors of A are reused: C is overwritten by Q^H C and only the
+// part of it below row n needs to be factored.
+template<typename F>
+void AppendColumns
+(       Matrix<F>& A,
+        Matrix<F>& householderScalars,
+        Matrix<Base<F>>& signature,
+  const Matrix<F>& C )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int k = C.Width();
+    if( C.Height() != m )
+        LogicError("C must be the same height as A");
+    const Int minDim = Min(m,n);
+
+    Matrix<F> ANew;
+    Zeros( ANew, m, n+k );
+    ANew( ALL, IR(0,n) ) = A;
+    auto AR = ANew( ALL, IR(n,n+k) );
+    AR = C;
+    ApplyQ( LEFT, ADJOINT, A, householderScalars, signature, AR );
+
+    const Int newMinDim = Min(m,n+k);
+    Matrix<F> householderScalarsNew;
+    Matrix<Base<F>> signatureNew;
+    Zeros( householderScalarsNew, newMinDim, 1 );
+    Zeros( signatureNew, newMinDim, 1 );
+    householderScalarsNew( IR(0,minDim), ALL ) = householderScalars;
+    signatureNew( IR(0,minDim), ALL ) = signature;
+    if( newMinDim > minDim )
+    {
+        auto ABR = ANew( IR(n,m), IR(n,n+k) );
+        auto householderScalarsB =
+          householderScalarsNew( IR(minDim,newMinDim), ALL );
+        auto signatureB = signatureNew( IR(minDim,newMinDim), ALL );
+        Matrix<F> householderScalarsBR;
+        Matrix<Base<F>> signatureBR;
+        QR( ABR, householderScalarsBR, signatureBR );
+        householderScalarsB = householderScalarsBR;
+        signatureB = signatureBR;
+    }
+
+    A = ANew;
+    householderScalars = householderScalarsNew;
+    signature = signatureNew;
+}
+
+template<typename F>
+void AppendColumns
+(       AbstractDistMatrix<F>& APre,
+        AbstractDistMatrix<F>& householderScalarsPre,
+        AbstractDistMatrix<Base<F>>& signaturePre,
+  const AbstractDistMatrix<F>& C )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<F,F,MD,STAR>
+      householderScalarsProx( householderScalarsPre );
+    DistMatrixReadWriteProxy<Base<F>,Base<F>,MD,STAR>
+      signatureProx( signaturePre );
+    auto& A = AProx.Get();
+    auto& householderScalars = householderScalarsProx.Get();
+    auto& signature = signatureProx.Get();
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int k = C.Width();
+    if( C.Height() != m )
+        LogicError("C must be the same height as A");
+    const Int minDim = Min(m,n);
+
+    DistMatrix<F> ANew(g);
+    Zeros( ANew, m, n+k );
+    ANew( ALL, IR(0,n) ) = A;
+    auto AR = ANew( ALL, IR(n,n+k) );
+    AR = C;
+    ApplyQ( LEFT, ADJOINT, A, householderScalars, signature, AR );
+
+    // The reflectors are stored redundantly since there are only min(m,n+k)
+    const Int newMinDim = Min(m,n+k);
+    DistMatrix<F,STAR,STAR> householderScalarsNew(g);
+    DistMatrix<Base<F>,STAR,STAR> signatureNew(g);
+    Zeros( householderScalarsNew, newMinDim, 1 );
+    Zeros( signatureNew, newMinDim, 1 );
+    householderScalarsNew( IR(0,minDim), ALL ) = householderScalars;
+    signatureNew( IR(0,minDim), ALL ) = signature;
+    if( newMinDim > minDim )
+    {
+        auto ABR = ANew( IR(n,m), IR(n,n+k) );
+        DistMatrix<F,MD,STAR> householderScalarsBR(g);
+        DistMatrix<Base<F>,MD,STAR> signatureBR(g);
+        QR( ABR, householderScalarsBR, signatureBR );
+        auto householderScalarsB =
+          householderScalarsNew( IR(minDim,newMinDim), ALL );
+        auto signatureB = signatureNew( IR(minDim,newMinDim), ALL );
+        householderScalarsB = householderScalarsBR;
+        signatureB = signatureBR;
+    }
+
+    A = ANew;
+    householderScalars = householderScalarsNew;
+    signature = signatureNew;
+}
+
+} // namespace qr
+} // namespace El
+
+#endif // ifndef EL_QR_MOD_HPP
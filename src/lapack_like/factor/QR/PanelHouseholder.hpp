@@ -71,7 +71,8 @@ template<typename F>
 void PanelHouseholder
 ( DistMatrix<F>& A,
   AbstractDistMatrix<F>& householderScalars,
-  AbstractDistMatrix<Base<F>>& signature )
+  AbstractDistMatrix<Base<F>>& signature,
+  Workspace<F>& workspace )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(AssertSameGrids( A, householderScalars, signature ))
@@ -119,10 +120,11 @@ void PanelHouseholder
         // AB2 := Hous(aB1,tau) AB2
         //      = (I - tau aB1 aB1^H) AB2
         //      = AB2 - tau aB1 (AB2^H aB1)^H
-        aB1_MC_STAR.AlignWith( AB2 );
+        typename Workspace<F>::Scope scope( workspace );
+        workspace.Attach( aB1_MC_STAR, aB1.Height(), 1, AB2.DistData() );
         aB1_MC_STAR = aB1;
-        z21_MR_STAR.AlignWith( AB2 );
-        Zeros( z21_MR_STAR, AB2.Width(), 1 );
+        workspace.Attach( z21_MR_STAR, AB2.Width(), 1, AB2.DistData() );
+        Zero( z21_MR_STAR );
         LocalGemv( ADJOINT, F(1), AB2, aB1_MC_STAR, F(0), z21_MR_STAR );
         El::AllReduce( z21_MR_STAR, AB2.ColComm() );
         Ger
@@ -0,0 +1,111 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_QR_TILE_HPP
+#define EL_QR_TILE_HPP
+
+#include "../TileTasks.hpp"
+#include "./ApplyQ.hpp"
+#include "./PanelHouseholder.hpp"
+
+namespace El {
+namespace qr {
+
+// The DAG is expressed over columns of tiles: the panel task of step k
+// computes the Householder reflectors of A(k:m,k) and one task per remaining
+// column of tiles applies them. Since the update of column tile k+1 is
+// spawned first, the panel of step k+1 may proceed while the remainder of
+// the trailing matrix of step k is being updated. The result is identical to
+// that of qr::Householder with a blocksize of tileSize.
+template<typename F>
+void Tile
+( Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  Matrix<Base<F>>& signature,
+  Int tileSize )
+{
+    EL_DEBUG_CSE
+    if( tileSize <= 0 )
+        LogicError("Tile size must be positive");
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    householderScalars.Resize( minDim, 1 );
+    signature.Resize( minDim, 1 );
+#ifdef EL_HYBRID
+    if( !omp_in_parallel() )
+    {
+        // Launch a team and spawn the DAG from a single thread
+        #pragma omp parallel
+        #pragma omp single
+        Tile( A, householderScalars, signature, tileSize );
+        return;
+    }
+#endif
+    const Int numPanels = tile::NumTiles( minDim, tileSize );
+    const Int numColTiles = tile::NumTiles( n, tileSize );
+
+#ifdef EL_HYBRID
+    // Dependency tokens
+    vector<char> tokens( numColTiles );
+    char* tok = tokens.data();
+#endif
+    auto tileInd = [&]( Int k ) { return tile::TileRange( k, tileSize, n ); };
+    tile::TaskErrors errors;
+
+    for( Int kTile=0; kTile<numPanels; ++kTile )
+    {
+        const Int k = kTile*tileSize;
+        const Int nb = Min(tileSize,minDim-k);
+
+#ifdef EL_HYBRID
+        #pragma omp task default(shared) firstprivate(kTile,k,nb) \
+          depend(inout:tok[kTile])
+#endif
+        errors.Run( [&,kTile,k,nb]() {
+            const Range<Int> ind1( k, k+nb ), indB( k, END );
+            auto AB1 = A( indB, ind1 );
+            auto householderScalars1 = householderScalars( ind1, ALL );
+            auto sig1 = signature( ind1, ALL );
+            PanelHouseholder( AB1, householderScalars1, sig1 );
+
+            // The last panel may be narrower than its column of tiles
+            const Range<Int> cols( k+nb, tileInd(kTile).end );
+            if( cols.end > cols.beg )
+            {
+                auto ABR = A( indB, cols );
+                ApplyQ( LEFT, ADJOINT, AB1, householderScalars1, sig1, ABR );
+            }
+        });
+
+        for( Int jTile=kTile+1; jTile<numColTiles; ++jTile )
+        {
+#ifdef EL_HYBRID
+            #pragma omp task default(shared) firstprivate(jTile,kTile,k,nb) \
+              depend(in:tok[kTile]) depend(inout:tok[jTile])
+#endif
+            errors.Run( [&,jTile,k,nb]() {
+                const Range<Int> ind1( k, k+nb ), indB( k, END );
+                auto AB1 = A( indB, ind1 );
+                auto ABj = A( indB, tileInd(jTile) );
+                auto householderScalars1 = householderScalars( ind1, ALL );
+                auto sig1 = signature( ind1, ALL );
+                ApplyQ( LEFT, ADJOINT, AB1, householderScalars1, sig1, ABj );
+            });
+        }
+    }
+#ifdef EL_HYBRID
+    #pragma omp taskwait
+#endif
+    errors.Rethrow();
+}
+
+} // namespace qr
+} // namespace El
+
+#endif // ifndef EL_QR_TILE_HPP
@@ -0,0 +1,75 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_FACTOR_TILE_TASKS_HPP
+#define EL_FACTOR_TILE_TASKS_HPP
+
+#include <atomic>
+#include <exception>
+
+namespace El {
+namespace tile {
+
+// The tile factorizations express each kernel as an OpenMP task whose
+// dependencies are declared on one token per tile (or per column of tiles),
+// so that the runtime may overlap the panel of one step with the trailing
+// updates of the previous step. The tasks are spawned in the order of the
+// corresponding right-looking blocked algorithm, which is itself a valid
+// topological ordering of the DAG; without EL_HYBRID they simply execute
+// in that order.
+//
+// Exceptions may not escape a task, so each kernel is run through a
+// TaskErrors object which records the first exception, skips all
+// subsequently-executed kernels, and rethrows once the DAG has drained.
+
+class TaskErrors
+{
+public:
+    template<typename Kernel>
+    void Run( Kernel kernel )
+    {
+        if( failed_.load() )
+            return;
+        try { kernel(); }
+        catch( ... )
+        {
+#ifdef EL_HYBRID
+            #pragma omp critical(El_tile_task_errors)
+#endif
+            {
+                if( !failed_.load() )
+                {
+                    error_ = std::current_exception();
+                    failed_.store( true );
+                }
+            }
+        }
+    }
+
+    void Rethrow()
+    {
+        if( failed_.load() )
+            std::rethrow_exception( error_ );
+    }
+
+private:
+    std::atomic<bool> failed_{false};
+    std::exception_ptr error_;
+};
+
+// The rows/columns of the k'th tile of a dimension of size n
+inline Range<Int> TileRange( Int k, Int tileSize, Int n )
+{ return Range<Int>( k*tileSize, Min((k+1)*tileSize,n) ); }
+
+inline Int NumTiles( Int n, Int tileSize )
+{ return (n+tileSize-1) / tileSize; }
+
+} // namespace tile
+} // namespace El
+
+#endif // ifndef EL_FACTOR_TILE_TASKS_HPP
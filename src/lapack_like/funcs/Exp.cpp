@@ -0,0 +1,389 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// The dense exponential follows the scaling and squaring algorithm of
+// Nicholas J. Higham's "The scaling and squaring method for the matrix
+// exponential revisited", SIAM J. Matrix Anal. Appl., 26(4), 2005.
+//
+// The action of the exponential on a block of vectors follows the truncated
+// Taylor algorithm of Awad H. Al-Mohy and Nicholas J. Higham's "Computing the
+// action of the matrix exponential, with an application to exponential
+// integrators", SIAM J. Sci. Comput., 33(2), 2011, but with the truncation
+// degree chosen from a forward bound on the Taylor remainder so that the same
+// code path applies to every supported precision.
+
+namespace El {
+
+namespace matrix_exp {
+
+// The [m/m] Pade coefficients, scaled so that b_m = 1, are
+//   b_k = (2m-k)! m! / ((2m)! k! (m-k)!) / b_m,
+// which we form via the ratio b_k/b_{k-1} = (m-k+1)/(k (2m-k+1)) so that
+// high-precision types do not inherit the rounding of double literals.
+template<typename Real>
+vector<Real> PadeCoefficients( Int m )
+{
+    vector<Real> b(m+1);
+    b[0] = Real(1);
+    for( Int k=1; k<=m; ++k )
+        b[k] = b[k-1]*Real(m-k+1)/(Real(k)*Real(2*m-k+1));
+    const Real scale = b[m];
+    for( Int k=0; k<=m; ++k )
+        b[k] /= scale;
+    return b;
+}
+
+// The one-norm thresholds from Table 2.3 of Higham (2005) are derived for
+// double-precision unit roundoff. Since the backward error of the [m/m]
+// approximant behaves like || A ||^(2m+1), we shrink the thresholds
+// accordingly for types with a smaller unit roundoff.
+template<typename Real>
+Real PadeTheta( Int m )
+{
+    double thetaDouble;
+    switch( m )
+    {
+    case 3:  thetaDouble = 1.495585217958292e-2; break;
+    case 5:  thetaDouble = 2.539398330063230e-1; break;
+    case 7:  thetaDouble = 9.504178996162932e-1; break;
+    case 9:  thetaDouble = 2.097847961257068e0;  break;
+    case 13: thetaDouble = 5.371920351148152e0;  break;
+    default: LogicError("Unsupported Pade degree ",m); thetaDouble = 0;
+    }
+    const Real eps = limits::Epsilon<Real>();
+    const Real epsDouble = limits::Epsilon<double>();
+    Real theta = thetaDouble;
+    if( eps < epsDouble )
+        theta *= Pow( eps/epsDouble, Real(1)/Real(2*m+1) );
+    return theta;
+}
+
+// Choose the Taylor degree m and number of steps s which minimize m*s subject
+// to the remainder bound || tA/s ||^(m+1) / (m+1)! <= tol. The costs are
+// compared in Real, and the number of steps is only converted to an Int once
+// it is known to fit.
+template<typename Real>
+void TaylorParameters
+( const Real& normTA, const Real& tol, Int maxDegree,
+  Int& degree, Int& numSteps )
+{
+    EL_DEBUG_CSE
+    degree = 0;
+    numSteps = 1;
+    if( normTA == Real(0) )
+        return;
+
+    const Real logTol = Log( tol );
+    Real logFactorial = 0;
+    Real bestCost = -1, bestSteps = 1;
+    for( Int m=1; m<=maxDegree; ++m )
+    {
+        logFactorial += Log( Real(m+1) );
+        const Real theta = Exp( (logTol+logFactorial)/Real(m+1) );
+        const Real s = Max( Ceil(normTA/theta), Real(1) );
+        const Real cost = Real(m)*s;
+        if( bestCost < Real(0) || cost < bestCost )
+        {
+            bestCost = cost;
+            bestSteps = s;
+            degree = m;
+        }
+    }
+    // Reject step counts which do not fit in an Int (or a non-finite norm)
+    const Real maxSteps = Real(limits::Max<Int>()/Max(maxDegree,Int(1)));
+    if( !(bestSteps <= maxSteps) )
+        RuntimeError
+        ("|| tA ||_1 = ",normTA," requires too many Taylor steps");
+    numSteps = Int(bestSteps);
+}
+
+// An empty matrix with the same distribution as A
+template<typename Field>
+Matrix<Field> EmptyLike( const Matrix<Field>& A )
+{ return Matrix<Field>(); }
+
+template<typename Field>
+DistMatrix<Field> EmptyLike( const DistMatrix<Field>& A )
+{ return DistMatrix<Field>( A.Grid() ); }
+
+// Form the numerator and denominator components U and V of the [m/m] Pade
+// approximant, r_m(A) = (V - U)^{-1} (V + U)
+template<typename Field,class MatType>
+void PadeApproximant
+( const MatType& A,
+        Int m,
+        MatType& U,
+        MatType& V )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    const vector<Real> b = PadeCoefficients<Real>( m );
+
+    MatType A2( EmptyLike(A) ), A4( EmptyLike(A) ), A6( EmptyLike(A) ),
+      UTmp( EmptyLike(A) );
+    Gemm( NORMAL, NORMAL, Field(1), A, A, A2 );
+    if( m == 13 )
+    {
+        Gemm( NORMAL, NORMAL, Field(1), A2, A2, A4 );
+        Gemm( NORMAL, NORMAL, Field(1), A4, A2, A6 );
+
+        // U := A (A6 (b13 A6 + b11 A4 + b9 A2) + b7 A6 + b5 A4 + b3 A2 + b1 I)
+        MatType W( EmptyLike(A) );
+        W = A6;
+        W *= b[13];
+        Axpy( b[11], A4, W );
+        Axpy( b[9], A2, W );
+        Gemm( NORMAL, NORMAL, Field(1), A6, W, UTmp );
+        Axpy( b[7], A6, UTmp );
+        Axpy( b[5], A4, UTmp );
+        Axpy( b[3], A2, UTmp );
+        ShiftDiagonal( UTmp, b[1] );
+        Gemm( NORMAL, NORMAL, Field(1), A, UTmp, U );
+
+        // V := A6 (b12 A6 + b10 A4 + b8 A2) + b6 A6 + b4 A4 + b2 A2 + b0 I
+        W = A6;
+        W *= b[12];
+        Axpy( b[10], A4, W );
+        Axpy( b[8], A2, W );
+        Gemm( NORMAL, NORMAL, Field(1), A6, W, V );
+        Axpy( b[6], A6, V );
+        Axpy( b[4], A4, V );
+        Axpy( b[2], A2, V );
+        ShiftDiagonal( V, b[0] );
+    }
+    else
+    {
+        // Accumulate the even and odd polynomials in A2 term-by-term
+        MatType A2Pow( A2 ), A2PowNew( EmptyLike(A) );
+        Identity( UTmp, n, n );
+        UTmp *= b[1];
+        Identity( V, n, n );
+        V *= b[0];
+        for( Int k=2; k<=m; k+=2 )
+        {
+            Axpy( b[k+1], A2Pow, UTmp );
+            Axpy( b[k], A2Pow, V );
+            if( k+2 <= m )
+            {
+                Gemm( NORMAL, NORMAL, Field(1), A2Pow, A2, A2PowNew );
+                A2Pow = A2PowNew;
+            }
+        }
+        Gemm( NORMAL, NORMAL, Field(1), A, UTmp, U );
+    }
+}
+
+// Overwrite V with (V - U)^{-1} (V + U)
+template<typename Field>
+void PadeSolve( const Matrix<Field>& U, Matrix<Field>& V )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> D( V );
+    Axpy( Field(-1), U, D );
+    Axpy( Field(1), U, V );
+    Permutation P;
+    LU( D, P );
+    lu::SolveAfter( NORMAL, D, P, V );
+}
+
+template<typename Field>
+void PadeSolve( const DistMatrix<Field>& U, DistMatrix<Field>& V )
+{
+    EL_DEBUG_CSE
+    DistMatrix<Field> D( V );
+    Axpy( Field(-1), U, D );
+    Axpy( Field(1), U, V );
+    DistPermutation P( V.Grid() );
+    LU( D, P );
+    lu::SolveAfter( NORMAL, D, P, V );
+}
+
+template<typename Real>
+Int NumSquarings( const Real& oneNorm, const Real& theta )
+{
+    Int s = 0;
+    Real scaledNorm = oneNorm;
+    while( scaledNorm > theta )
+    {
+        scaledNorm /= Real(2);
+        ++s;
+    }
+    return s;
+}
+
+// Overwrite the Matrix or [MC,MR] DistMatrix A with exp(A)
+template<typename Field,class MatType>
+void ScalingAndSquaring( MatType& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( A.Height() != A.Width() )
+        LogicError("Cannot exponentiate a non-square matrix");
+    const Real oneNorm = OneNorm( A );
+    if( !limits::IsFinite(oneNorm) )
+        RuntimeError("Cannot exponentiate a matrix with non-finite entries");
+
+    MatType U( EmptyLike(A) ), V( EmptyLike(A) );
+    const Int lowDegrees[] = { 3, 5, 7, 9 };
+    for( const Int m : lowDegrees )
+    {
+        if( oneNorm <= PadeTheta<Real>(m) )
+        {
+            PadeApproximant<Field>( A, m, U, V );
+            PadeSolve( U, V );
+            A = V;
+            return;
+        }
+    }
+
+    // Scale so that || A / 2^s ||_1 <= theta_13
+    const Int s = NumSquarings( oneNorm, PadeTheta<Real>(13) );
+    if( s > 0 )
+        A *= Pow( Real(2), Real(-s) );
+    PadeApproximant<Field>( A, 13, U, V );
+    PadeSolve( U, V );
+
+    // Undo the scaling by repeated squaring
+    MatType *X=&V, *XNew=&U;
+    for( Int j=0; j<s; ++j )
+    {
+        Gemm( NORMAL, NORMAL, Field(1), *X, *X, *XNew );
+        std::swap( X, XNew );
+    }
+    A = *X;
+}
+
+// Overwrite the Matrix or [MC,MR] DistMatrix B with exp(t A) B
+template<typename Field,class MatType>
+void TaylorTimes
+( const MatType& A,
+        MatType& B,
+        Field t,
+  const ExpTimesCtrl<Base<Field>>& ctrl,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    if( A.Width() != n )
+        LogicError("A must be square");
+    if( B.Height() != n )
+        LogicError("A and B must conform");
+    const Real tol =
+      ( ctrl.tol == Real(0) ? limits::Epsilon<Real>()/Real(2) : ctrl.tol );
+
+    // Shift by the mean of the eigenvalues to reduce the norm of A
+    MatType AShift( A );
+    Field mu = 0;
+    if( ctrl.shift && n > 0 )
+    {
+        mu = Trace( A ) / Field(n);
+        ShiftDiagonal( AShift, -mu );
+    }
+
+    Int degree, numSteps;
+    const Real normTA = Abs(t)*OneNorm( AShift );
+    TaylorParameters( normTA, tol, ctrl.maxDegree, degree, numSteps );
+    if( progress )
+        Output
+        ("ExpTimes: ||tA||_1=",normTA,", degree=",degree,", steps=",numSteps);
+
+    const Field tStep = t / Field(numSteps);
+    const Field eta = Exp( tStep*mu );
+    MatType F( B ), Z( EmptyLike(A) );
+    for( Int step=0; step<numSteps; ++step )
+    {
+        Real c1 = InfinityNorm( B );
+        for( Int k=1; k<=degree; ++k )
+        {
+            // B := (t / (s k)) (A - mu I) B
+            Gemm( NORMAL, NORMAL, tStep/Field(k), AShift, B, Z );
+            B = Z;
+            Axpy( Field(1), B, F );
+
+            // Stop early once two successive terms are negligible
+            const Real c2 = InfinityNorm( B );
+            if( c1 + c2 <= tol*InfinityNorm(F) )
+                break;
+            c1 = c2;
+        }
+        F *= eta;
+        B = F;
+    }
+}
+
+} // namespace matrix_exp
+
+template<typename Field>
+void Exp( Matrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    matrix_exp::ScalingAndSquaring<Field>( A );
+}
+
+template<typename Field>
+void Exp( AbstractDistMatrix<Field>& APre )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+    matrix_exp::ScalingAndSquaring<Field>( A );
+}
+
+template<typename Field>
+void ExpTimes
+( const Matrix<Field>& A,
+        Matrix<Field>& B,
+        Field t,
+  const ExpTimesCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    matrix_exp::TaylorTimes( A, B, t, ctrl, ctrl.progress );
+}
+
+template<typename Field>
+void ExpTimes
+( const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& BPre,
+        Field t,
+  const ExpTimesCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.Get();
+    matrix_exp::TaylorTimes
+    ( A, B, t, ctrl, ctrl.progress && A.Grid().Rank() == 0 );
+}
+
+#define PROTO(Field) \
+  template void Exp( Matrix<Field>& A ); \
+  template void Exp( AbstractDistMatrix<Field>& A ); \
+  template void ExpTimes \
+  ( const Matrix<Field>& A, \
+          Matrix<Field>& B, \
+          Field t, \
+    const ExpTimesCtrl<Base<Field>>& ctrl ); \
+  template void ExpTimes \
+  ( const AbstractDistMatrix<Field>& A, \
+          AbstractDistMatrix<Field>& B, \
+          Field t, \
+    const ExpTimesCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,382 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "./HagerHigham.hpp"
+#include "../Norm/Lanczos.hpp"
+
+namespace El {
+
+namespace cond {
+
+// Estimate || B ||_2 for the n x n operator B = op(inv(A)) applied in place
+template<typename Field,class SolveType>
+Base<Field> InverseTwoNormEstimate( Int n, const SolveType& solve )
+{
+    EL_DEBUG_CSE
+    auto apply = [&]
+      ( Orientation orientation, const Matrix<Field>& x, Matrix<Field>& y )
+      { y = x; solve( orientation, y ); };
+    Matrix<Base<Field>> s;
+    gkl::LargestSingularValues<Field>
+    ( n, n, 1, apply, s, LanczosSVDCtrl<Base<Field>>() );
+    return ( s.Height() > 0 ? s(0) : Base<Field>(0) );
+}
+
+} // namespace cond
+
+namespace lu {
+
+template<typename Field>
+Base<Field> InverseOneNormEstimate
+( const Matrix<Field>& A, const Permutation& P )
+{
+    EL_DEBUG_CSE
+    auto apply = [&]( Orientation orientation, Matrix<Field>& X )
+      { SolveAfter( orientation, A, P, X ); };
+    return cond::OneNormEstimate<Field>( A.Height(), apply );
+}
+
+template<typename Field>
+Base<Field> InverseOneNormEstimate
+( const AbstractDistMatrix<Field>& A, const DistPermutation& P )
+{
+    EL_DEBUG_CSE
+    auto apply = cond::ReplicatedApply<Field>
+      ( A.Grid(),
+        [&]( Orientation orientation, AbstractDistMatrix<Field>& X )
+        { SolveAfter( orientation, A, P, X ); } );
+    return cond::OneNormEstimate<Field>( A.Height(), apply );
+}
+
+// || inv(A) ||_oo = || inv(A)^H ||_1
+template<typename Field>
+Base<Field> InverseInfinityNormEstimate
+( const Matrix<Field>& A, const Permutation& P )
+{
+    EL_DEBUG_CSE
+    auto apply = [&]( Orientation orientation, Matrix<Field>& X )
+      { SolveAfter( orientation==NORMAL ? ADJOINT : NORMAL, A, P, X ); };
+    return cond::OneNormEstimate<Field>( A.Height(), apply );
+}
+
+template<typename Field>
+Base<Field> InverseInfinityNormEstimate
+( const AbstractDistMatrix<Field>& A, const DistPermutation& P )
+{
+    EL_DEBUG_CSE
+    auto apply = cond::ReplicatedApply<Field>
+      ( A.Grid(),
+        [&]( Orientation orientation, AbstractDistMatrix<Field>& X )
+        { SolveAfter( orientation==NORMAL ? ADJOINT : NORMAL, A, P, X ); } );
+    return cond::OneNormEstimate<Field>( A.Height(), apply );
+}
+
+template<typename Field>
+Base<Field> InverseTwoNormEstimate
+( const Matrix<Field>& A, const Permutation& P )
+{
+    EL_DEBUG_CSE
+    auto solve = [&]( Orientation orientation, Matrix<Field>& X )
+      { SolveAfter( orientation, A, P, X ); };
+    return cond::InverseTwoNormEstimate<Field>( A.Height(), solve );
+}
+
+template<typename Field>
+Base<Field> InverseTwoNormEstimate
+( const AbstractDistMatrix<Field>& A, const DistPermutation& P )
+{
+    EL_DEBUG_CSE
+    auto solve = cond::ReplicatedApply<Field>
+      ( A.Grid(),
+        [&]( Orientation orientation, AbstractDistMatrix<Field>& X )
+        { SolveAfter( orientation, A, P, X ); } );
+    return cond::InverseTwoNormEstimate<Field>( A.Height(), solve );
+}
+
+} // namespace lu
+
+namespace cholesky {
+
+// inv(A) is Hermitian, so its one and infinity norms coincide
+template<typename Field>
+Base<Field> InverseOneNormEstimate
+( UpperOrLower uplo, const Matrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    auto apply = [&]( Orientation orientation, Matrix<Field>& X )
+      { SolveAfter( uplo, NORMAL, A, X ); };
+    return cond::OneNormEstimate<Field>( A.Height(), apply );
+}
+
+template<typename Field>
+Base<Field> InverseOneNormEstimate
+( UpperOrLower uplo, const AbstractDistMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    auto apply = cond::ReplicatedApply<Field>
+      ( A.Grid(),
+        [&]( Orientation orientation, AbstractDistMatrix<Field>& X )
+        { SolveAfter( uplo, NORMAL, A, X ); } );
+    return cond::OneNormEstimate<Field>( A.Height(), apply );
+}
+
+} // namespace cholesky
+
+namespace qr {
+
+template<typename Field>
+Base<Field> InverseOneNormEstimate
+( const Matrix<Field>& A,
+  const Matrix<Field>& householderScalars,
+  const Matrix<Base<Field>>& signature )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> B;
+    auto apply = [&]( Orientation orientation, Matrix<Field>& X )
+      {
+          B = X;
+          SolveAfter( orientation, A, householderScalars, signature, B, X );
+      };
+    return cond::OneNormEstimate<Field>( A.Height(), apply );
+}
+
+template<typename Field>
+Base<Field> InverseOneNormEstimate
+( const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& householderScalars,
+  const AbstractDistMatrix<Base<Field>>& signature )
+{
+    EL_DEBUG_CSE
+    auto apply = cond::ReplicatedApply<Field>
+      ( A.Grid(),
+        [&]( Orientation orientation, AbstractDistMatrix<Field>& X )
+        {
+            DistMatrix<Field> B( X );
+            SolveAfter( orientation, A, householderScalars, signature, B, X );
+        } );
+    return cond::OneNormEstimate<Field>( A.Height(), apply );
+}
+
+template<typename Field>
+Base<Field> InverseInfinityNormEstimate
+( const Matrix<Field>& A,
+  const Matrix<Field>& householderScalars,
+  const Matrix<Base<Field>>& signature )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> B;
+    auto apply = [&]( Orientation orientation, Matrix<Field>& X )
+      {
+          B = X;
+          SolveAfter
+          ( orientation==NORMAL ? ADJOINT : NORMAL,
+            A, householderScalars, signature, B, X );
+      };
+    return cond::OneNormEstimate<Field>( A.Height(), apply );
+}
+
+template<typename Field>
+Base<Field> InverseInfinityNormEstimate
+( const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& householderScalars,
+  const AbstractDistMatrix<Base<Field>>& signature )
+{
+    EL_DEBUG_CSE
+    auto apply = cond::ReplicatedApply<Field>
+      ( A.Grid(),
+        [&]( Orientation orientation, AbstractDistMatrix<Field>& X )
+        {
+            DistMatrix<Field> B( X );
+            SolveAfter
+            ( orientation==NORMAL ? ADJOINT : NORMAL,
+              A, householderScalars, signature, B, X );
+        } );
+    return cond::OneNormEstimate<Field>( A.Height(), apply );
+}
+
+} // namespace qr
+
+// A single LU factorization replaces the three-or-so required to form inv(A)
+
+template<typename Field>
+Base<Field> OneConditionEstimate( const Matrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    Matrix<Field> B( A );
+    const Real oneNorm = OneNorm( B );
+    Permutation P;
+    try { LU( B, P ); }
+    catch( SingularMatrixException& e )
+    { return limits::Infinity<Real>(); }
+    return oneNorm*lu::InverseOneNormEstimate( B, P );
+}
+
+template<typename Field>
+Base<Field> OneConditionEstimate( const AbstractDistMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    DistMatrix<Field> B( A );
+    const Real oneNorm = OneNorm( B );
+    DistPermutation P( B.Grid() );
+    try { LU( B, P ); }
+    catch( SingularMatrixException& e )
+    { return limits::Infinity<Real>(); }
+    return oneNorm*lu::InverseOneNormEstimate( B, P );
+}
+
+template<typename Field>
+Base<Field> InfinityConditionEstimate( const Matrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    Matrix<Field> B( A );
+    const Real infNorm = InfinityNorm( B );
+    Permutation P;
+    try { LU( B, P ); }
+    catch( SingularMatrixException& e )
+    { return limits::Infinity<Real>(); }
+    return infNorm*lu::InverseInfinityNormEstimate( B, P );
+}
+
+template<typename Field>
+Base<Field> InfinityConditionEstimate( const AbstractDistMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    DistMatrix<Field> B( A );
+    const Real infNorm = InfinityNorm( B );
+    DistPermutation P( B.Grid() );
+    try { LU( B, P ); }
+    catch( SingularMatrixException& e )
+    { return limits::Infinity<Real>(); }
+    return infNorm*lu::InverseInfinityNormEstimate( B, P );
+}
+
+template<typename Field>
+Base<Field> TwoConditionEstimate( const Matrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    Matrix<Real> s;
+    LanczosSingularValues( A, 1, s );
+    const Real twoNorm = ( s.Height() > 0 ? s(0) : Real(0) );
+
+    Matrix<Field> B( A );
+    Permutation P;
+    try { LU( B, P ); }
+    catch( SingularMatrixException& e )
+    { return limits::Infinity<Real>(); }
+    return twoNorm*lu::InverseTwoNormEstimate( B, P );
+}
+
+template<typename Field>
+Base<Field> TwoConditionEstimate( const AbstractDistMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    DistMatrix<Real,STAR,STAR> s( A.Grid() );
+    LanczosSingularValues( A, 1, s );
+    const Real twoNorm = ( s.Height() > 0 ? s.GetLocal(0,0) : Real(0) );
+
+    DistMatrix<Field> B( A );
+    DistPermutation P( B.Grid() );
+    try { LU( B, P ); }
+    catch( SingularMatrixException& e )
+    { return limits::Infinity<Real>(); }
+    return twoNorm*lu::InverseTwoNormEstimate( B, P );
+}
+
+template<typename Field>
+Base<Field> ConditionEstimate( const Matrix<Field>& A, NormType type )
+{
+    EL_DEBUG_CSE
+    switch( type )
+    {
+    case ONE_NORM:      return OneConditionEstimate( A );
+    case INFINITY_NORM: return InfinityConditionEstimate( A );
+    case TWO_NORM:      return TwoConditionEstimate( A );
+    default: LogicError("Estimates are only supported for the one, infinity, "
+                        "and two norms");
+    }
+    return Base<Field>(0);
+}
+
+template<typename Field>
+Base<Field> ConditionEstimate
+( const AbstractDistMatrix<Field>& A, NormType type )
+{
+    EL_DEBUG_CSE
+    switch( type )
+    {
+    case ONE_NORM:      return OneConditionEstimate( A );
+    case INFINITY_NORM: return InfinityConditionEstimate( A );
+    case TWO_NORM:      return TwoConditionEstimate( A );
+    default: LogicError("Estimates are only supported for the one, infinity, "
+                        "and two norms");
+    }
+    return Base<Field>(0);
+}
+
+#define PROTO(Field) \
+  template Base<Field> lu::InverseOneNormEstimate \
+  ( const Matrix<Field>& A, const Permutation& P ); \
+  template Base<Field> lu::InverseOneNormEstimate \
+  ( const AbstractDistMatrix<Field>& A, const DistPermutation& P ); \
+  template Base<Field> lu::InverseInfinityNormEstimate \
+  ( const Matrix<Field>& A, const Permutation& P ); \
+  template Base<Field> lu::InverseInfinityNormEstimate \
+  ( const AbstractDistMatrix<Field>& A, const DistPermutation& P ); \
+  template Base<Field> lu::InverseTwoNormEstimate \
+  ( const Matrix<Field>& A, const Permutation& P ); \
+  template Base<Field> lu::InverseTwoNormEstimate \
+  ( const AbstractDistMatrix<Field>& A, const DistPermutation& P ); \
+  template Base<Field> cholesky::InverseOneNormEstimate \
+  ( UpperOrLower uplo, const Matrix<Field>& A ); \
+  template Base<Field> cholesky::InverseOneNormEstimate \
+  ( UpperOrLower uplo, const AbstractDistMatrix<Field>& A ); \
+  template Base<Field> qr::InverseOneNormEstimate \
+  ( const Matrix<Field>& A, \
+    const Matrix<Field>& householderScalars, \
+    const Matrix<Base<Field>>& signature ); \
+  template Base<Field> qr::InverseOneNormEstimate \
+  ( const AbstractDistMatrix<Field>& A, \
+    const AbstractDistMatrix<Field>& householderScalars, \
+    const AbstractDistMatrix<Base<Field>>& signature ); \
+  template Base<Field> qr::InverseInfinityNormEstimate \
+  ( const Matrix<Field>& A, \
+    const Matrix<Field>& householderScalars, \
+    const Matrix<Base<Field>>& signature ); \
+  template Base<Field> qr::InverseInfinityNormEstimate \
+  ( const AbstractDistMatrix<Field>& A, \
+    const AbstractDistMatrix<Field>& householderScalars, \
+    const AbstractDistMatrix<Base<Field>>& signature ); \
+  template Base<Field> OneConditionEstimate( const Matrix<Field>& A ); \
+  template Base<Field> OneConditionEstimate \
+  ( const AbstractDistMatrix<Field>& A ); \
+  template Base<Field> InfinityConditionEstimate( const Matrix<Field>& A ); \
+  template Base<Field> InfinityConditionEstimate \
+  ( const AbstractDistMatrix<Field>& A ); \
+  template Base<Field> TwoConditionEstimate( const Matrix<Field>& A ); \
+  template Base<Field> TwoConditionEstimate \
+  ( const AbstractDistMatrix<Field>& A ); \
+  template Base<Field> ConditionEstimate \
+  ( const Matrix<Field>& A, NormType type ); \
+  template Base<Field> ConditionEstimate \
+  ( const AbstractDistMatrix<Field>& A, NormType type );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
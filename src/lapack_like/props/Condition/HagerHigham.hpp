@@ -0,0 +1,165 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CONDITION_HAGERHIGHAM_HPP
+#define EL_CONDITION_HAGERHIGHAM_HPP
+
+namespace El {
+namespace cond {
+
+// A +-1 pattern which is identical on every process, so that the
+// (redundantly-computed) estimates agree without communication
+inline bool SignFlip( Int i, Int j ) EL_NO_EXCEPT
+{
+    const unsigned long long hash =
+      (unsigned long long)(i+1)*2654435761ULL ^
+      (unsigned long long)(j+1)*40503ULL;
+    return (hash >> 13) & 1;
+}
+
+// Higham and Tisseur's block generalization of Hager's estimate of || B ||_1,
+// where the n x n operator B is only available through
+//
+//     apply( orientation, X ),
+//
+// which overwrites the n x t matrix X with op(B) X. Each iteration costs
+// one multiplication by B and one by B^H on t vectors, and rarely more than
+// a few iterations are required. The estimate is a lower bound which is
+// almost always within a factor of three of || B ||_1.
+template<typename Field,class ApplyType>
+Base<Field> OneNormEstimate
+( Int n, const ApplyType& apply, Int numCols=2, Int maxIts=5 )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( n == 0 )
+        return Real(0);
+    const Int t = Min( Max(numCols,Int(1)), n );
+
+    // The first column is the vector of all ones, the rest are random signs
+    Matrix<Field> X, Y, Z;
+    Zeros( X, n, t );
+    for( Int i=0; i<n; ++i )
+    {
+        X(i,0) = Real(1)/Real(n);
+        for( Int j=1; j<t; ++j )
+            X(i,j) = ( SignFlip(i,j) ? Real(1) : Real(-1) )/Real(n);
+    }
+
+    vector<bool> used( n, false );
+    vector<Int> indices( t, -1 ), order( n );
+    vector<Real> h( n );
+    Real estimate=0, lastEst=0;
+    Int bestIndex=-1;
+    for( Int it=0; it<maxIts; ++it )
+    {
+        Y = X;
+        apply( NORMAL, Y );
+
+        Int bestCol = 0;
+        estimate = 0;
+        for( Int j=0; j<t; ++j )
+        {
+            const Real colNorm = OneNorm( Y(ALL,IR(j)) );
+            if( colNorm > estimate )
+            {
+                estimate = colNorm;
+                bestCol = j;
+            }
+        }
+        if( it > 0 && estimate <= lastEst )
+        {
+            estimate = lastEst;
+            break;
+        }
+        lastEst = estimate;
+        bestIndex = indices[bestCol];
+        if( it == maxIts-1 )
+            break;
+
+        // Z := B^H sign(Y)
+        Z = Y;
+        for( Int j=0; j<t; ++j )
+            for( Int i=0; i<n; ++i )
+            {
+                const Real absVal = Abs(Z(i,j));
+                Z(i,j) = ( absVal == Real(0) ? Field(1) : Z(i,j)/absVal );
+            }
+        apply( ADJOINT, Z );
+
+        Real hMax = 0;
+        for( Int i=0; i<n; ++i )
+        {
+            h[i] = 0;
+            for( Int j=0; j<t; ++j )
+                h[i] = Max( h[i], Abs(Z(i,j)) );
+            hMax = Max( hMax, h[i] );
+        }
+        if( it > 0 && bestIndex >= 0 && hMax == h[bestIndex] )
+            break;
+
+        // Move to the unit vectors with the largest gradients which have not
+        // yet been visited, stopping if the best of them all have been
+        for( Int i=0; i<n; ++i )
+            order[i] = i;
+        std::stable_sort
+        ( order.begin(), order.end(),
+          [&]( Int i, Int j ) { return h[i] > h[j]; } );
+        bool allUsed = true;
+        for( Int j=0; j<t; ++j )
+            allUsed = allUsed && used[order[j]];
+        if( allUsed )
+            break;
+
+        Zeros( X, n, t );
+        for( Int j=0, k=0; j<t && k<n; ++k )
+        {
+            const Int i = order[k];
+            if( used[i] )
+                continue;
+            used[i] = true;
+            indices[j] = i;
+            X(i,j) = Field(1);
+            ++j;
+        }
+    }
+
+    // Higham's alternative estimate guards against the (rare) failures of the
+    // gradient iteration
+    Matrix<Field> x;
+    Zeros( x, n, 1 );
+    for( Int i=0; i<n; ++i )
+    {
+        const Real mag = ( n > 1 ? Real(1) + Real(i)/Real(n-1) : Real(1) );
+        x(i) = ( i % 2 == 0 ? mag : -mag );
+    }
+    apply( NORMAL, x );
+    const Real altEst = Real(2)*OneNorm( x )/(Real(3)*Real(n));
+    return Max( estimate, altEst );
+}
+
+// Wrap a distributed operator so that it acts on copies of X which are
+// replicated over the grid
+template<typename Field,class DistApplyType>
+std::function<void(Orientation,Matrix<Field>&)>
+ReplicatedApply( const Grid& g, const DistApplyType& distApply )
+{
+    return [&g,distApply]( Orientation orientation, Matrix<Field>& X )
+    {
+        DistMatrix<Field,STAR,STAR> X_STAR_STAR(g);
+        X_STAR_STAR.Attach( X.Height(), X.Width(), g, 0, 0, X );
+        DistMatrix<Field> XDist( X_STAR_STAR );
+        distApply( orientation, XDist );
+        X_STAR_STAR = XDist;
+    };
+}
+
+} // namespace cond
+} // namespace El
+
+#endif // ifndef EL_CONDITION_HAGERHIGHAM_HPP
@@ -0,0 +1,137 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_NORM_LANCZOS_HPP
+#define EL_NORM_LANCZOS_HPP
+
+#include "../Condition/HagerHigham.hpp"
+
+namespace El {
+namespace gkl {
+
+// Golub-Kahan-Lanczos bidiagonalization, with full reorthogonalization, of
+// an m x n operator B which is only available through
+//
+//     apply( orientation, x, y ),
+//
+// which sets y := op(B) x. Expansion stops once the leading k singular
+// values of the projected bidiagonal have residuals below tol times the
+// largest one, and those k values are returned in descending order.
+template<typename Field,class ApplyType>
+void LargestSingularValues
+( Int m, Int n, Int k, const ApplyType& apply, Matrix<Base<Field>>& s,
+  const LanczosSVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int minDim = Min(m,n);
+    k = Min( k, minDim );
+    Zeros( s, k, 1 );
+    if( k == 0 )
+        return;
+    const Int maxBasisSize =
+      ( ctrl.maxBasisSize > 0 ? Min(ctrl.maxBasisSize,minDim) : minDim );
+
+    // The starting vector is a fixed sign pattern so that every process
+    // generates the same basis
+    Matrix<Field> U, V, u, v, coeffs;
+    Zeros( U, m, maxBasisSize );
+    Zeros( V, n, maxBasisSize );
+    Zeros( v, n, 1 );
+    for( Int i=0; i<n; ++i )
+        v(i) = ( cond::SignFlip(i,0) ? Real(1) : Real(-1) )/Sqrt(Real(n));
+
+    // Orthogonalize x against the first j columns of Q twice, which suffices
+    // to retain orthogonality to working precision
+    auto reorthogonalize = [&]( const Matrix<Field>& Q, Int j, Matrix<Field>& x )
+    {
+        if( j == 0 )
+            return;
+        auto QL = Q( ALL, IR(0,j) );
+        for( Int pass=0; pass<2; ++pass )
+        {
+            Gemv( ADJOINT, Field(1), QL, x, coeffs );
+            Gemv( NORMAL, Field(-1), QL, coeffs, Field(1), x );
+        }
+    };
+
+    vector<Real> alphas, betas;
+    Matrix<Real> B, sB;
+    Matrix<Real> P, Q;
+    Real beta = 0;
+    for( Int j=0; j<maxBasisSize; ++j )
+    {
+        auto vj = V( ALL, IR(j) );
+        vj = v;
+
+        // u := B v_j - beta_j u_{j-1}
+        apply( NORMAL, v, u );
+        if( j > 0 )
+            Axpy( -beta, U(ALL,IR(j-1)), u );
+        reorthogonalize( U, j, u );
+        const Real alpha = FrobeniusNorm( u );
+        alphas.push_back( alpha );
+        if( alpha > Real(0) )
+            u *= Real(1)/alpha;
+        auto uj = U( ALL, IR(j) );
+        uj = u;
+
+        // v := B^H u_j - alpha_j v_j
+        apply( ADJOINT, u, v );
+        Axpy( -alpha, vj, v );
+        reorthogonalize( V, j+1, v );
+        beta = FrobeniusNorm( v );
+        if( beta > Real(0) )
+            v *= Real(1)/beta;
+
+        // The basis spans an invariant subspace (or is exhausted) once alpha
+        // or beta vanishes
+        const Int basisSize = j+1;
+        const bool exhausted =
+          alpha == Real(0) || beta == Real(0) || basisSize == maxBasisSize;
+        if( basisSize < k && !exhausted )
+        {
+            betas.push_back( beta );
+            continue;
+        }
+
+        // The Ritz values are the singular values of the upper bidiagonal
+        // with diagonal alphas and superdiagonal betas, and the residual
+        // of the i'th is beta_{j+1} times the magnitude of the last entry of
+        // its left singular vector
+        Zeros( B, basisSize, basisSize );
+        for( Int i=0; i<basisSize; ++i )
+        {
+            B(i,i) = alphas[i];
+            if( i+1 < basisSize )
+                B(i,i+1) = betas[i];
+        }
+        SVD( B, P, sB, Q );
+        const Int numVals = Min( k, sB.Height() );
+        bool converged = true;
+        for( Int i=0; i<numVals; ++i )
+            if( beta*Abs(P(basisSize-1,i)) > ctrl.tol*sB(0) )
+                converged = false;
+        if( ctrl.progress )
+            Output
+            ("basis size ",basisSize,": largest Ritz value ",sB(0),
+             ( converged ? " (converged)" : "" ));
+        if( converged || exhausted )
+        {
+            for( Int i=0; i<numVals; ++i )
+                s(i) = sB(i);
+            return;
+        }
+        betas.push_back( beta );
+    }
+}
+
+} // namespace gkl
+} // namespace El
+
+#endif // ifndef EL_NORM_LANCZOS_HPP
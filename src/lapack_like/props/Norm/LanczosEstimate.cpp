@@ -0,0 +1,111 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "./Lanczos.hpp"
+
+namespace El {
+
+template<typename Field>
+void LanczosSingularValues
+( const Matrix<Field>& A, Int k, Matrix<Base<Field>>& s,
+  const LanczosSVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto apply = [&]
+      ( Orientation orientation, const Matrix<Field>& x, Matrix<Field>& y )
+      { Gemv( orientation, Field(1), A, x, y ); };
+    gkl::LargestSingularValues<Field>
+    ( A.Height(), A.Width(), k, apply, s, ctrl );
+}
+
+template<typename Field>
+void LanczosSingularValues
+( const AbstractDistMatrix<Field>& APre, Int k,
+  AbstractDistMatrix<Base<Field>>& s,
+  const LanczosSVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& g = A.Grid();
+
+    // The (short) Lanczos vectors are replicated over the grid
+    DistMatrix<Field> xDist(g), yDist(g);
+    auto apply = [&]
+      ( Orientation orientation, const Matrix<Field>& x, Matrix<Field>& y )
+      {
+          DistMatrix<Field,STAR,STAR> x_STAR_STAR(g);
+          x_STAR_STAR.LockedAttach( x.Height(), x.Width(), g, 0, 0, x );
+          xDist = x_STAR_STAR;
+          Gemv( orientation, Field(1), A, xDist, yDist );
+          DistMatrix<Field,STAR,STAR> y_STAR_STAR( yDist );
+          y = y_STAR_STAR.Matrix();
+      };
+    auto rootCtrl = ctrl;
+    rootCtrl.progress = ctrl.progress && g.Rank() == 0;
+    Matrix<Base<Field>> sLoc;
+    gkl::LargestSingularValues<Field>
+    ( A.Height(), A.Width(), k, apply, sLoc, rootCtrl );
+
+    DistMatrix<Base<Field>,STAR,STAR> s_STAR_STAR(g);
+    s_STAR_STAR.Resize( sLoc.Height(), 1 );
+    s_STAR_STAR.Matrix() = sLoc;
+    Copy( s_STAR_STAR, s );
+}
+
+template<typename Field>
+Base<Field> KyFanNormEstimate
+( const Matrix<Field>& A, Int k, const LanczosSVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Base<Field>> s;
+    LanczosSingularValues( A, k, s, ctrl );
+    Base<Field> norm = 0;
+    for( Int i=0; i<s.Height(); ++i )
+        norm += s(i);
+    return norm;
+}
+
+template<typename Field>
+Base<Field> KyFanNormEstimate
+( const AbstractDistMatrix<Field>& A, Int k,
+  const LanczosSVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrix<Base<Field>,STAR,STAR> s( A.Grid() );
+    LanczosSingularValues( A, k, s, ctrl );
+    Base<Field> norm = 0;
+    for( Int i=0; i<s.Height(); ++i )
+        norm += s.GetLocal(i,0);
+    return norm;
+}
+
+#define PROTO(Field) \
+  template void LanczosSingularValues \
+  ( const Matrix<Field>& A, Int k, Matrix<Base<Field>>& s, \
+    const LanczosSVDCtrl<Base<Field>>& ctrl ); \
+  template void LanczosSingularValues \
+  ( const AbstractDistMatrix<Field>& A, Int k, \
+    AbstractDistMatrix<Base<Field>>& s, \
+    const LanczosSVDCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> KyFanNormEstimate \
+  ( const Matrix<Field>& A, Int k, \
+    const LanczosSVDCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> KyFanNormEstimate \
+  ( const AbstractDistMatrix<Field>& A, Int k, \
+    const LanczosSVDCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
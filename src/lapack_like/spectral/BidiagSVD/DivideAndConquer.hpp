@@ -614,41 +614,65 @@ Merge
     else
         plusShift.Resize( numUndeflated, 1 );
 
+    // The secular equations are independent, so their roots may be computed
+    // concurrently (in which case each task needs its own plusShift). The
+    // corrections to the update vector are then formed row-by-row using the
+    // same order of multiplication as a serial sweep.
+    vector<SecularSVDInfo> valueInfos( numUndeflated );
+    auto secularCtrl( dcCtrl.secularCtrl );
+    if( dcCtrl.parallelTasks )
+        secularCtrl.progress = false;
+#ifdef EL_HYBRID
+    #pragma omp taskloop default(shared) if(dcCtrl.parallelTasks)
+#endif
     for( Int j=0; j<numUndeflated; ++j )
     {
         auto minusShift = VSecular( ALL, IR(j) );
+        Matrix<Real> plusShiftTask;
+        if( dcCtrl.parallelTasks )
+            plusShiftTask.Resize( numUndeflated, 1 );
+        else
+            View( plusShiftTask, plusShift );
 
-        auto valueInfo =
+        valueInfos[j] =
           SecularSingularValue
-          ( j, dUndeflated, rho, rUndeflated, d(j), minusShift, plusShift,
-            dcCtrl.secularCtrl );
-        if( ctrl.progress )
-            Output("Secular singular value ",j," is ",d(j));
-
-        secularInfo.numIterations += valueInfo.numIterations;
-        secularInfo.numAlternations += valueInfo.numAlternations;
-        secularInfo.numCubicIterations += valueInfo.numCubicIterations;
-        secularInfo.numCubicFailures += valueInfo.numCubicFailures;
+          ( j, dUndeflated, rho, rUndeflated, d(j), minusShift, plusShiftTask,
+            secularCtrl );
 
         // minusShift currently holds dUndeflated-d(j) and plusShift
         // holds dUndeflated+d(j). Overwrite minusShift with their
         // element-wise product since that is all we require from here on
         // out.
         for( Int k=0; k<numUndeflated; ++k )
-            minusShift(k) *= plusShift(k);
-
-        rCorrected(j) *= minusShift(j);
-        for( Int k=0; k<numUndeflated; ++k )
+            minusShift(k) *= plusShiftTask(k);
+    }
+    // Report from outside of the tasks so that the output does not interleave
+    for( Int j=0; j<numUndeflated; ++j )
+    {
+        if( ctrl.progress )
+            Output("Secular singular value ",j," is ",d(j));
+        const auto& valueInfo = valueInfos[j];
+        secularInfo.numIterations += valueInfo.numIterations;
+        secularInfo.numAlternations += valueInfo.numAlternations;
+        secularInfo.numCubicIterations += valueInfo.numCubicIterations;
+        secularInfo.numCubicFailures += valueInfo.numCubicFailures;
+    }
+#ifdef EL_HYBRID
+    #pragma omp taskloop default(shared) if(dcCtrl.parallelTasks)
+#endif
+    for( Int k=0; k<numUndeflated; ++k )
+    {
+        for( Int j=0; j<numUndeflated; ++j )
         {
             if( k == j )
-                continue;
-            rCorrected(k) *= minusShift(k) /
-              ((dUndeflated(j)+dUndeflated(k))*
-               (dUndeflated(j)-dUndeflated(k)));
+                rCorrected(k) *= VSecular(k,j);
+            else
+                rCorrected(k) *= VSecular(k,j) /
+                  ((dUndeflated(j)+dUndeflated(k))*
+                   (dUndeflated(j)-dUndeflated(k)));
         }
+        rCorrected(k) = Sgn(rUndeflated(k),false) * Sqrt(Abs(rCorrected(k)));
     }
-    for( Int j=0; j<numUndeflated; ++j )
-        rCorrected(j) = Sgn(rUndeflated(j),false) * Sqrt(Abs(rCorrected(j)));
 
     // Compute the unnormalized left and right singular vectors via Eqs. (3.4)
     // and (3.3), respectively, from Gu/Eisenstat [CITATION].
@@ -656,6 +680,9 @@ Merge
         Output("Computing unnormalized singular vectors");
     if( ctrl.wantU )
     {
+#ifdef EL_HYBRID
+        #pragma omp taskloop default(shared) if(dcCtrl.parallelTasks)
+#endif
         for( Int j=0; j<numUndeflated; ++j )
         {
             auto u = USecular(ALL,IR(j));
@@ -675,6 +702,9 @@ Merge
     }
     else
     {
+#ifdef EL_HYBRID
+        #pragma omp taskloop default(shared) if(dcCtrl.parallelTasks)
+#endif
         for( Int j=0; j<numUndeflated; ++j )
         {
             auto v = VSecular(ALL,IR(j));
@@ -697,9 +727,14 @@ Merge
     if( ctrl.progress )
         Output("Forming undeflated left singular vectors");
     Matrix<Real> Q;
+    // Ensure that the packing permutation is explicit before sharing it
+    packingPerm.MakeArbitrary();
     if( ctrl.wantU )
     {
         Zeros( Q, numUndeflated, numUndeflated );
+#ifdef EL_HYBRID
+        #pragma omp taskloop default(shared) if(dcCtrl.parallelTasks)
+#endif
         for( Int j=0; j<numUndeflated; ++j )
         {
             auto u = USecular(ALL,IR(j));
@@ -738,21 +773,37 @@ Merge
         auto UUndeflated = U( ALL, undeflatedInd );
         if( dcCtrl.exploitStructure )
         {
-            auto Z2 = UPacked( ALL, packingInd2 );
+            // The first block row is independent of the last two, so the two
+            // sets of rows are updated as separate tasks
             auto Q2 = Q( packingInd2, ALL );
-            Gemm( NORMAL, NORMAL, Real(1), Z2, Q2, UUndeflated );
-
-            // Finish updating the first block row
-            auto U0Undeflated = UUndeflated( IR(0,m0), ALL );
-            auto Z00 = UPacked( IR(0,m0), packingInd0 );
-            auto Q0 = Q( packingInd0, ALL );
-            Gemm( NORMAL, NORMAL, Real(1), Z00, Q0, Real(1), U0Undeflated );
-
-            // Finish updating the last block row
-            auto U2Undeflated = UUndeflated( IR(n0,m), ALL );
-            auto Z21 = UPacked( IR(n0,m), packingInd1 );
-            auto Q1 = Q( packingInd1, ALL );
-            Gemm( NORMAL, NORMAL, Real(1), Z21, Q1, Real(1), U2Undeflated );
+#ifdef EL_HYBRID
+            #pragma omp task default(shared) if(dcCtrl.parallelTasks)
+#endif
+            {
+                auto U0Undeflated = UUndeflated( IR(0,m0), ALL );
+                auto Z02 = UPacked( IR(0,m0), packingInd2 );
+                auto Z00 = UPacked( IR(0,m0), packingInd0 );
+                auto Q0 = Q( packingInd0, ALL );
+                Gemm( NORMAL, NORMAL, Real(1), Z02, Q2, U0Undeflated );
+                Gemm( NORMAL, NORMAL, Real(1), Z00, Q0, Real(1), U0Undeflated );
+            }
+#ifdef EL_HYBRID
+            #pragma omp task default(shared) if(dcCtrl.parallelTasks)
+#endif
+            {
+                auto U12Undeflated = UUndeflated( IR(m0,m), ALL );
+                auto Z12 = UPacked( IR(m0,m), packingInd2 );
+                Gemm( NORMAL, NORMAL, Real(1), Z12, Q2, U12Undeflated );
+
+                // Finish updating the last block row
+                auto U2Undeflated = UUndeflated( IR(n0,m), ALL );
+                auto Z21 = UPacked( IR(n0,m), packingInd1 );
+                auto Q1 = Q( packingInd1, ALL );
+                Gemm( NORMAL, NORMAL, Real(1), Z21, Q1, Real(1), U2Undeflated );
+            }
+#ifdef EL_HYBRID
+            #pragma omp taskwait
+#endif
         }
         else
         {
@@ -767,6 +818,9 @@ Merge
     if( ctrl.progress )
         Output("Forming undeflated right singular vectors");
     Q.Resize( numUndeflated, numUndeflated );
+#ifdef EL_HYBRID
+    #pragma omp taskloop default(shared) if(dcCtrl.parallelTasks)
+#endif
     for( Int j=0; j<numUndeflated; ++j )
     {
         auto v = VSecular(ALL,IR(j));
@@ -799,21 +853,34 @@ Merge
     {
         if( dcCtrl.exploitStructure )
         {
-            auto Z2 = VPacked( ALL, packingInd2 );
+            // The two block rows are independent, so each is updated as a
+            // separate task
             auto Q2 = Q( packingInd2, ALL );
-            Gemm( NORMAL, NORMAL, Real(1), Z2, Q2, VUndeflated );
-
-            // Finish updating the first block row
-            auto V0Undeflated = VUndeflated( IR(0,n0), ALL );
-            auto Z00 = VPacked( IR(0,n0), packingInd0 );
-            auto Q0 = Q( packingInd0, ALL );
-            Gemm( NORMAL, NORMAL, Real(1), Z00, Q0, Real(1), V0Undeflated );
-
-            // Finish updating the second block row
-            auto V1Undeflated = VUndeflated( IR(n0,n), ALL );
-            auto Z11 = VPacked( IR(n0,n), packingInd1 );
-            auto Q1 = Q( packingInd1, ALL );
-            Gemm( NORMAL, NORMAL, Real(1), Z11, Q1, Real(1), V1Undeflated );
+#ifdef EL_HYBRID
+            #pragma omp task default(shared) if(dcCtrl.parallelTasks)
+#endif
+            {
+                auto V0Undeflated = VUndeflated( IR(0,n0), ALL );
+                auto Z02 = VPacked( IR(0,n0), packingInd2 );
+                auto Z00 = VPacked( IR(0,n0), packingInd0 );
+                auto Q0 = Q( packingInd0, ALL );
+                Gemm( NORMAL, NORMAL, Real(1), Z02, Q2, V0Undeflated );
+                Gemm( NORMAL, NORMAL, Real(1), Z00, Q0, Real(1), V0Undeflated );
+            }
+#ifdef EL_HYBRID
+            #pragma omp task default(shared) if(dcCtrl.parallelTasks)
+#endif
+            {
+                auto V1Undeflated = VUndeflated( IR(n0,n), ALL );
+                auto Z12 = VPacked( IR(n0,n), packingInd2 );
+                auto Z11 = VPacked( IR(n0,n), packingInd1 );
+                auto Q1 = Q( packingInd1, ALL );
+                Gemm( NORMAL, NORMAL, Real(1), Z12, Q2, V1Undeflated );
+                Gemm( NORMAL, NORMAL, Real(1), Z11, Q1, Real(1), V1Undeflated );
+            }
+#ifdef EL_HYBRID
+            #pragma omp taskwait
+#endif
         }
         else
         {
@@ -1759,6 +1826,27 @@ DivideAndConquer
         }
         return info;
     }
+#ifdef EL_HYBRID
+    if( dcCtrl.parallelTasks )
+    {
+        if( m <= dcCtrl.taskCutoff )
+        {
+            // Solve this subtree with a single thread
+            auto ctrlMod( ctrl );
+            ctrlMod.dcCtrl.parallelTasks = false;
+            return DivideAndConquer
+              ( mainDiag, superDiag, U, s, V, ctrlMod );
+        }
+        if( !omp_in_parallel() )
+        {
+            // Launch a team and run the recursion from a single thread
+            #pragma omp parallel
+            #pragma omp single
+            info = DivideAndConquer( mainDiag, superDiag, U, s, V, ctrl );
+            return info;
+        }
+    }
+#endif
 
     // TODO(poulson): A more intelligent split point. Perhaps the row near
     // m/2 with smallest norm should be chosen to encourage small entry
@@ -1795,11 +1883,24 @@ DivideAndConquer
         Zeros( V1, 2, n-(split+1) );
     }
 
-    Matrix<Real> s0;
-    auto info0 = DivideAndConquer( mainDiag0, superDiag0, U0, s0, V0, ctrl );
-
-    Matrix<Real> s1;
-    auto info1 = DivideAndConquer( mainDiag1, superDiag1, U1, s1, V1, ctrl );
+    // The two subproblems are independent and may be solved as tasks, in
+    // which case only the outermost merge reports its progress
+    auto subCtrl( ctrl );
+    if( dcCtrl.parallelTasks )
+    {
+        subCtrl.progress = false;
+        subCtrl.dcCtrl.secularCtrl.progress = false;
+    }
+    Matrix<Real> s0, s1;
+    DCInfo info0, info1;
+#ifdef EL_HYBRID
+    #pragma omp task default(shared) if(dcCtrl.parallelTasks)
+#endif
+    info0 = DivideAndConquer( mainDiag0, superDiag0, U0, s0, V0, subCtrl );
+    info1 = DivideAndConquer( mainDiag1, superDiag1, U1, s1, V1, subCtrl );
+#ifdef EL_HYBRID
+    #pragma omp taskwait
+#endif
 
     if( !ctrl.wantV )
     {
@@ -210,7 +210,7 @@ RandomizedSignDivide
     auto S( G );
     PolarCtrl polarCtrl;
     polarCtrl.qdwh = true;
-    HermitianPolar( uplo, G, polarCtrl );
+    HermitianPolar( uplo, S, polarCtrl );
     ShiftDiagonal( S, F(1) );
     S *= F(1)/F(2);
 
@@ -256,6 +256,151 @@ RandomizedSignDivide
     return part;
 }
 
+// The QDWH-eig splitting of Nakatsukasa and Higham: rather than a URV of the
+// entire spectral projector, its rank, k, is read off of its trace and an
+// orthonormal basis for its range is found by randomized subspace iteration on
+// k vectors, which usually converges in a single step since the projector's
+// nonzero eigenvalues are all one. Only an n x k QR is then required.
+template<typename F>
+ValueInt<Base<F>>
+SubspaceDivide
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<F>& G,
+  bool returnQ,
+  const HermitianSDCCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    MakeHermitian( uplo, A );
+    const Real oneA = OneNorm( A );
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = 500*n*limits::Epsilon<Real>();
+
+    // G := sgn(G)
+    // G := 1/2 ( G + I )
+    PolarCtrl polarCtrl;
+    polarCtrl.qdwh = true;
+    HermitianPolar( uplo, G, polarCtrl );
+    ShiftDiagonal( G, F(1) );
+    G *= F(1)/F(2);
+
+    // A shift outside of the spectrum yields a trivial projector
+    ValueInt<Real> part;
+    part.index = Int(Round(RealPart(Trace(G))));
+    part.value = limits::Max<Real>();
+    const Int k = part.index;
+    if( k <= 0 || k >= n )
+        return part;
+
+    Matrix<F> X, Y, B, t;
+    Matrix<Base<F>> d;
+    Gaussian( X, n, k );
+    Int it=0;
+    while( it < ctrl.maxInnerIts )
+    {
+        Gemm( NORMAL, NORMAL, F(1), G, X, Y );
+        El::QR( Y, t, d );
+
+        // B := Q^H A Q
+        B = A;
+        qr::ApplyQ( LEFT, ADJOINT, Y, t, d, B );
+        qr::ApplyQ( RIGHT, NORMAL, Y, t, d, B );
+
+        // || E21 ||1 / || A ||1, with E21 measured as in ComputePartition
+        part.value = EntrywiseNorm( B(IR(k,n),IR(0,k)), Real(1) ) / oneA;
+
+        ++it;
+        if( part.value <= tol || it == ctrl.maxInnerIts )
+            break;
+
+        // X := Q(:,0:k)
+        Identity( X, n, k );
+        qr::ApplyQ( LEFT, NORMAL, Y, t, d, X );
+    }
+    A = B;
+    if( returnQ )
+    {
+        Identity( G, n, n );
+        qr::ApplyQ( LEFT, NORMAL, Y, t, d, G );
+    }
+    return part;
+}
+
+template<typename F>
+ValueInt<Base<F>>
+SubspaceDivide
+( UpperOrLower uplo,
+  DistMatrix<F>& A,
+  DistMatrix<F>& G,
+  bool returnQ,
+  const HermitianSDCCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    MakeHermitian( uplo, A );
+    const Real oneA = OneNorm( A );
+    Real tol = ctrl.tol;
+    if( tol == Real(0) )
+        tol = 500*n*limits::Epsilon<Real>();
+
+    // G := sgn(G)
+    // G := 1/2 ( G + I )
+    PolarCtrl polarCtrl;
+    polarCtrl.qdwh = true;
+    HermitianPolar( uplo, G, polarCtrl );
+    ShiftDiagonal( G, F(1) );
+    G *= F(1)/F(2);
+
+    // A shift outside of the spectrum yields a trivial projector
+    ValueInt<Real> part;
+    part.index = Int(Round(RealPart(Trace(G))));
+    part.value = limits::Max<Real>();
+    const Int k = part.index;
+    if( k <= 0 || k >= n )
+        return part;
+
+    DistMatrix<F> X(g), Y(g), B(g);
+    DistMatrix<F,MD,STAR> t(g);
+    DistMatrix<Base<F>,MD,STAR> d(g);
+    Gaussian( X, n, k );
+    Int it=0;
+    while( it < ctrl.maxInnerIts )
+    {
+        Gemm( NORMAL, NORMAL, F(1), G, X, Y );
+        El::QR( Y, t, d );
+
+        // B := Q^H A Q
+        B = A;
+        qr::ApplyQ( LEFT, ADJOINT, Y, t, d, B );
+        qr::ApplyQ( RIGHT, NORMAL, Y, t, d, B );
+
+        // || E21 ||1 / || A ||1, with E21 measured as in ComputePartition
+        part.value = EntrywiseNorm( B(IR(k,n),IR(0,k)), Real(1) ) / oneA;
+
+        ++it;
+        if( part.value <= tol || it == ctrl.maxInnerIts )
+            break;
+
+        // X := Q(:,0:k)
+        Identity( X, n, k );
+        qr::ApplyQ( LEFT, NORMAL, Y, t, d, X );
+    }
+    A = B;
+    if( returnQ )
+    {
+        Identity( G, n, n );
+        qr::ApplyQ( LEFT, NORMAL, Y, t, d, G );
+    }
+    return part;
+}
+
 template<typename F>
 ValueInt<Base<F>>
 SpectralDivide
@@ -288,7 +433,10 @@ SpectralDivide
         G = A;
         ShiftDiagonal( G, F(shift) );
 
-        part = RandomizedSignDivide( uplo, A, G, false, ctrl );
+        part =
+          ( ctrl.subspaceIteration ?
+            SubspaceDivide( uplo, A, G, false, ctrl ) :
+            RandomizedSignDivide( uplo, A, G, false, ctrl ) );
 
         ++it;
         if( part.value <= tol )
@@ -337,7 +485,10 @@ SpectralDivide
         Q = A;
         ShiftDiagonal( Q, F(shift) );
 
-        part = RandomizedSignDivide( uplo, A, Q, true, ctrl );
+        part =
+          ( ctrl.subspaceIteration ?
+            SubspaceDivide( uplo, A, Q, true, ctrl ) :
+            RandomizedSignDivide( uplo, A, Q, true, ctrl ) );
 
         ++it;
         if( part.value <= tol )
@@ -386,7 +537,10 @@ SpectralDivide
         G = A;
         ShiftDiagonal( G, F(shift) );
 
-        part = RandomizedSignDivide( uplo, A, G, false, ctrl );
+        part =
+          ( ctrl.subspaceIteration ?
+            SubspaceDivide( uplo, A, G, false, ctrl ) :
+            RandomizedSignDivide( uplo, A, G, false, ctrl ) );
 
         ++it;
         if( part.value <= tol )
@@ -436,7 +590,10 @@ SpectralDivide
         Q = A;
         ShiftDiagonal( Q, F(shift) );
 
-        part = RandomizedSignDivide( uplo, A, Q, true, ctrl );
+        part =
+          ( ctrl.subspaceIteration ?
+            SubspaceDivide( uplo, A, Q, true, ctrl ) :
+            RandomizedSignDivide( uplo, A, Q, true, ctrl ) );
 
         ++it;
         if( part.value <= tol )
@@ -10,6 +10,7 @@
 
 #include "./HermitianTridiagEig/QR.hpp"
 #include "./HermitianTridiagEig/DivideAndConquer.hpp"
+#include "./HermitianTridiagEig/MRRR.hpp"
 
 // NOTE: dSubReal and QReal could be packed into their complex counterparts
 
@@ -341,6 +342,21 @@ DCHelper
     return info;
 }
 
+template<typename Real>
+HermitianTridiagEigInfo
+NativeMRRRHelper
+( const Matrix<Real>& d,
+  const Matrix<Real>& dSub,
+        Matrix<Real>& w,
+  const HermitianTridiagEigCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    HermitianTridiagEigInfo info;
+    info.mrrrInfo = MRRR<Real>( d, dSub, w, nullptr, mpi::COMM_SELF, ctrl );
+    Sort( w, ctrl.sort );
+    return info;
+}
+
 template<typename Real,
          typename=EnableIf<IsBlasScalar<Real>>>
 HermitianTridiagEigInfo
@@ -401,6 +417,10 @@ Helper
         auto dSubMod( dSub );
         return DCHelper( dMod, dSubMod, w, ctrl );
     }
+    else if( ctrl.mrrrCtrl.native )
+    {
+        return NativeMRRRHelper( d, dSub, w, ctrl );
+    }
     // Both d and dSub need to be modifiable
     auto dMod( d );
     auto dSubMod( dSub );
@@ -424,12 +444,16 @@ Helper
         auto dSubMod( dSub );
         return QRHelper( d, dSubMod, w, ctrl );
     }
-    else
+    else if( ctrl.alg == HERM_TRIDIAG_EIG_DC )
     {
         auto dMod( d );
         auto dSubMod( dSub );
         return DCHelper( dMod, dSubMod, w, ctrl );
     }
+    else
+    {
+        return NativeMRRRHelper( d, dSub, w, ctrl );
+    }
 }
 
 template<typename Real>
@@ -565,6 +589,50 @@ DCHelper
     return info;
 }
 
+template<typename Real>
+HermitianTridiagEigInfo
+NativeMRRRHelper
+( const AbstractDistMatrix<Real>& d,
+  const AbstractDistMatrix<Real>& dSub,
+        AbstractDistMatrix<Real>& wPre,
+  const HermitianTridiagEigCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    HermitianTridiagEigInfo info;
+    DistMatrix<Real,STAR,STAR> d_STAR_STAR( d ), dSub_STAR_STAR( dSub );
+
+    DistMatrixWriteProxy<Real,Real,STAR,STAR> wProx( wPre );
+    auto& w = wProx.Get();
+
+    // The bisections are spread over the entire grid
+    Matrix<Real> wLoc;
+    info.mrrrInfo =
+      MRRR<Real>
+      ( d_STAR_STAR.Matrix(), dSub_STAR_STAR.Matrix(), wLoc, nullptr,
+        w.Grid().VCComm(), ctrl );
+    w.Resize( wLoc.Height(), 1 );
+    Copy( wLoc, w.Matrix() );
+    Sort( w, ctrl.sort );
+
+    return info;
+}
+
+template<typename Real>
+HermitianTridiagEigInfo
+NativeMRRRHelper
+( const AbstractDistMatrix<Real         >& d,
+  const AbstractDistMatrix<Complex<Real>>& dSub,
+        AbstractDistMatrix<Real         >& w,
+  const HermitianTridiagEigCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& g = d.Grid();
+    DistMatrix<Complex<Real>,STAR,STAR> dSub_STAR_STAR( dSub );
+    DistMatrix<Real,STAR,STAR> dSubReal(g);
+    RemovePhase( dSub_STAR_STAR, dSubReal );
+    return NativeMRRRHelper( d, dSubReal, w, ctrl );
+}
+
 template<typename Real,
          typename=EnableIf<IsBlasScalar<Real>>>
 HermitianTridiagEigInfo
@@ -635,6 +703,10 @@ Helper
     {
         return DCHelper( d, dSub, wPre, ctrl );
     }
+    else if( ctrl.mrrrCtrl.native )
+    {
+        return NativeMRRRHelper( d, dSub, wPre, ctrl );
+    }
     else
     {
         return MRRRHelper( d, dSub, wPre, ctrl );
@@ -656,10 +728,14 @@ Helper
     {
         return QRHelper( d, dSub, w, ctrl );
     }
-    else
+    else if( ctrl.alg == HERM_TRIDIAG_EIG_DC )
     {
         return DCHelper( d, dSub, w, ctrl );
     }
+    else
+    {
+        return NativeMRRRHelper( d, dSub, w, ctrl );
+    }
 }
 
 template<typename Real,
@@ -744,6 +820,10 @@ Helper
     {
         return DCHelper( d, dSub, wPre, ctrl );
     }
+    else if( ctrl.mrrrCtrl.native )
+    {
+        return NativeMRRRHelper( d, dSub, wPre, ctrl );
+    }
     else
     {
         return MRRRHelper( d, dSub, wPre, ctrl );
@@ -765,10 +845,14 @@ Helper
     {
         return QRHelper( d, dSub, w, ctrl );
     }
-    else
+    else if( ctrl.alg == HERM_TRIDIAG_EIG_DC )
     {
         return DCHelper( d, dSub, w, ctrl );
     }
+    else
+    {
+        return NativeMRRRHelper( d, dSub, w, ctrl );
+    }
 }
 
 } // namespace herm_tridiag_eig
@@ -833,6 +917,27 @@ DCHelper
     return info;
 }
 
+template<typename Real>
+HermitianTridiagEigInfo
+NativeMRRRHelper
+( const Matrix<Real>& d,
+  const Matrix<Real>& dSub,
+        Matrix<Real>& w,
+        Matrix<Real>& Q,
+  const HermitianTridiagEigCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.accumulateEigVecs )
+        LogicError("Accumulating eigenvectors not yet supported for MRRR");
+    HermitianTridiagEigInfo info;
+    info.mrrrInfo = MRRR( d, dSub, w, &Q, mpi::COMM_SELF, ctrl );
+    auto sortPairs = TaggedSort( w, ctrl.sort );
+    for( Int j=0; j<w.Height(); ++j )
+        w(j) = sortPairs[j].value;
+    ApplyTaggedSortToEachRow( sortPairs, Q );
+    return info;
+}
+
 template<typename Real,
          typename=EnableIf<IsBlasScalar<Real>>>
 HermitianTridiagEigInfo
@@ -908,6 +1013,10 @@ Helper
         auto dSubMod( dSub );
         return DCHelper( dMod, dSubMod, w, Q, ctrl );
     }
+    else if( ctrl.mrrrCtrl.native )
+    {
+        return NativeMRRRHelper( d, dSub, w, Q, ctrl );
+    }
     else
     {
         // Both d and dSub need to be modified
@@ -935,12 +1044,16 @@ Helper
         auto dSubMod( dSub );
         return QRHelper( d, dSubMod, w, Q, ctrl );
     }
-    else
+    else if( ctrl.alg == HERM_TRIDIAG_EIG_DC )
     {
         auto dMod( d );
         auto dSubMod( dSub );
         return DCHelper( dMod, dSubMod, w, Q, ctrl );
     }
+    else
+    {
+        return NativeMRRRHelper( d, dSub, w, Q, ctrl );
+    }
 }
 
 // (Y^H T Y) QHat = QHat Lambda
@@ -1150,6 +1263,78 @@ DCHelper
     return info;
 }
 
+template<typename Real>
+HermitianTridiagEigInfo
+NativeMRRRHelper
+( const AbstractDistMatrix<Real>& d,
+  const AbstractDistMatrix<Real>& dSub,
+        AbstractDistMatrix<Real>& wPre,
+        AbstractDistMatrix<Real>& QPre,
+  const HermitianTridiagEigCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.accumulateEigVecs )
+        LogicError("Accumulating eigenvectors not yet supported for MRRR");
+    HermitianTridiagEigInfo info;
+    DistMatrix<Real,STAR,STAR> d_STAR_STAR( d ), dSub_STAR_STAR( dSub );
+
+    ElementalProxyCtrl QCtrl;
+    QCtrl.rowConstrain = true;
+    QCtrl.rowAlign = 0;
+
+    DistMatrixWriteProxy<Real,Real,STAR,STAR> wProx( wPre );
+    DistMatrixWriteProxy<Real,Real,STAR,VR> QProx( QPre, QCtrl );
+    auto& w = wProx.Get();
+    auto& Q = QProx.Get();
+
+    // Each process computes the eigenvectors of its local columns of Q
+    Matrix<Real> wLoc, QLoc;
+    info.mrrrInfo =
+      MRRR
+      ( d_STAR_STAR.Matrix(), dSub_STAR_STAR.Matrix(), wLoc, &QLoc,
+        Q.RowComm(), ctrl );
+    const Int n = d.Height();
+    const Int k = wLoc.Height();
+    w.Resize( k, 1 );
+    Copy( wLoc, w.Matrix() );
+    Q.Resize( n, k );
+    Copy( QLoc, Q.Matrix() );
+
+    auto sortPairs = TaggedSort( w, ctrl.sort );
+    for( Int j=0; j<k; ++j )
+        w.Set( j, 0, sortPairs[j].value );
+    ApplyTaggedSortToEachRow( sortPairs, Q );
+
+    return info;
+}
+
+template<typename Real>
+HermitianTridiagEigInfo
+NativeMRRRHelper
+( const AbstractDistMatrix<Real         >& d,
+  const AbstractDistMatrix<Complex<Real>>& dSub,
+        AbstractDistMatrix<Real         >& w,
+        AbstractDistMatrix<Complex<Real>>& Q,
+  const HermitianTridiagEigCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> F;
+    const Grid& g = d.Grid();
+
+    DistMatrix<F,STAR,STAR> dSub_STAR_STAR( dSub );
+    DistMatrix<Real,STAR,STAR> dSubReal(g);
+    DistMatrix<F,STAR,STAR> phase(g);
+    RemovePhase( dSub_STAR_STAR, dSubReal, phase );
+
+    DistMatrix<Real,STAR,VR> QReal(g);
+    auto info = NativeMRRRHelper( d, dSubReal, w, QReal, ctrl );
+
+    Copy( QReal, Q );
+    DiagonalScale( LEFT, NORMAL, phase, Q );
+
+    return info;
+}
+
 template<typename Real,
          typename=EnableIf<IsBlasScalar<Real>>>
 HermitianTridiagEigInfo
@@ -1344,6 +1529,10 @@ Helper
     {
         return DCHelper( d, dSub, w, Q, ctrl );
     }
+    else if( ctrl.mrrrCtrl.native )
+    {
+        return NativeMRRRHelper( d, dSub, w, Q, ctrl );
+    }
     else
     {
         return MRRRHelper( d, dSub, w, Q, ctrl );
@@ -1366,10 +1555,14 @@ Helper
     {
         return QRHelper( d, dSub, w, Q, ctrl );
     }
-    else
+    else if( ctrl.alg == HERM_TRIDIAG_EIG_DC )
     {
         return DCHelper( d, dSub, w, Q, ctrl );
     }
+    else
+    {
+        return NativeMRRRHelper( d, dSub, w, Q, ctrl );
+    }
 }
 
 template<typename Real,
@@ -1391,6 +1584,10 @@ Helper
     {
         return DCHelper( d, dSub, w, Q, ctrl );
     }
+    else if( ctrl.mrrrCtrl.native )
+    {
+        return NativeMRRRHelper( d, dSub, w, Q, ctrl );
+    }
     else
     {
         return MRRRHelper( d, dSub, w, Q, ctrl );
@@ -1413,10 +1610,14 @@ Helper
     {
         return QRHelper( d, dSub, w, QPre, ctrl );
     }
-    else
+    else if( ctrl.alg == HERM_TRIDIAG_EIG_DC )
     {
         return DCHelper( d, dSub, w, QPre, ctrl );
     }
+    else
+    {
+        return NativeMRRRHelper( d, dSub, w, QPre, ctrl );
+    }
 }
 
 } // namespace herm_tridiag_eig
@@ -1472,8 +1673,16 @@ Int MRRREstimateHelper
         Real vu )
 {
     EL_DEBUG_CSE
-    LogicError("MRRREstimate not yet supported for nonstandard datatypes");
-    return 0;
+    DistMatrix<Real,STAR,STAR> d_STAR_STAR( d ), dSub_STAR_STAR( dSub );
+    HermitianTridiagEigCtrl<Real> ctrl;
+    ctrl.subset.rangeSubset = true;
+    ctrl.subset.lowerBound = vl;
+    ctrl.subset.upperBound = vu;
+    Matrix<Real> w;
+    MRRR<Real>
+    ( d_STAR_STAR.Matrix(), dSub_STAR_STAR.Matrix(), w, nullptr, wColComm,
+      ctrl );
+    return w.Height();
 }
 
 // Q is assumed to be sufficiently large and properly aligned
@@ -1545,10 +1754,12 @@ MRRRPostEstimateHelper
         Real vu )
 {
     EL_DEBUG_CSE
-    LogicError
-    ("HermitianTridiagEigEstimate not yet supported for nonstandard datatypes");
-    HermitianTridiagEigInfo info;
-    return info;
+    HermitianTridiagEigCtrl<Real> ctrl;
+    ctrl.sort = sort;
+    ctrl.subset.rangeSubset = true;
+    ctrl.subset.lowerBound = vl;
+    ctrl.subset.upperBound = vu;
+    return NativeMRRRHelper( d, dSub, wPre, QPre, ctrl );
 }
 
 template<typename Real>
@@ -431,36 +431,58 @@ Merge
     else
         QSecular.Resize( numUndeflated, numUndeflated );
 
+    // The secular equations are independent, so their roots may be computed
+    // concurrently. The corrections to the update vector are then formed
+    // row-by-row using the same order of multiplication as a serial sweep.
+    vector<SecularEVDInfo> valueInfos( numUndeflated );
+    auto secularCtrl( dcCtrl.secularCtrl );
+    if( dcCtrl.parallelTasks )
+        secularCtrl.progress = false;
+#ifdef EL_HYBRID
+    #pragma omp taskloop default(shared) if(dcCtrl.parallelTasks)
+#endif
     for( Int j=0; j<numUndeflated; ++j )
     {
         auto minusShift = QSecular( ALL, IR(j) );
 
-        auto valueInfo =
+        valueInfos[j] =
           SecularEigenvalue
           ( j, dUndeflated, rho, zUndeflated, d(j), minusShift,
-            dcCtrl.secularCtrl );
+            secularCtrl );
+    }
+    // Report from outside of the tasks so that the output does not interleave
+    for( Int j=0; j<numUndeflated; ++j )
+    {
         if( ctrl.progress )
             Output("Secular eigenvalue ",j," is ",d(j));
-
+        const auto& valueInfo = valueInfos[j];
         secularInfo.numIterations += valueInfo.numIterations;
         secularInfo.numAlternations += valueInfo.numAlternations;
         secularInfo.numCubicIterations += valueInfo.numCubicIterations;
         secularInfo.numCubicFailures += valueInfo.numCubicFailures;
-
-        rCorrected(j) *= minusShift(j);
-        for( Int k=0; k<numUndeflated; ++k )
+    }
+#ifdef EL_HYBRID
+    #pragma omp taskloop default(shared) if(dcCtrl.parallelTasks)
+#endif
+    for( Int k=0; k<numUndeflated; ++k )
+    {
+        for( Int j=0; j<numUndeflated; ++j )
         {
             if( k == j )
-                continue;
-            rCorrected(k) *= minusShift(k) / (dUndeflated(j)-dUndeflated(k));
+                rCorrected(k) *= QSecular(k,j);
+            else
+                rCorrected(k) *=
+                  QSecular(k,j) / (dUndeflated(j)-dUndeflated(k));
         }
+        rCorrected(k) = Sgn(zUndeflated(k),false) * Sqrt(Abs(rCorrected(k)));
     }
-    for( Int j=0; j<numUndeflated; ++j )
-        rCorrected(j) = Sgn(zUndeflated(j),false) * Sqrt(Abs(rCorrected(j)));
 
     // Compute the unnormalized eigenvectors.
     if( ctrl.progress )
         Output("Computing unnormalized eigenvectors");
+#ifdef EL_HYBRID
+    #pragma omp taskloop default(shared) if(dcCtrl.parallelTasks)
+#endif
     for( Int j=0; j<numUndeflated; ++j )
     {
         auto q = QSecular(ALL,IR(j));
@@ -476,6 +498,11 @@ Merge
     if( ctrl.progress )
         Output("Forming undeflated right singular vectors");
     U.Resize( numUndeflated, numUndeflated );
+    // Ensure that the packing permutation is explicit before sharing it
+    packingPerm.MakeArbitrary();
+#ifdef EL_HYBRID
+    #pragma omp taskloop default(shared) if(dcCtrl.parallelTasks)
+#endif
     for( Int j=0; j<numUndeflated; ++j )
     {
         auto q = QSecular(ALL,IR(j));
@@ -508,21 +535,34 @@ Merge
     {
         if( dcCtrl.exploitStructure )
         {
-            auto Z2 = QPacked( ALL, packingInd2 );
+            // The two block rows are independent, so each is updated as a
+            // separate task
             auto U2 = U( packingInd2, ALL );
-            Gemm( NORMAL, NORMAL, Real(1), Z2, U2, QUndeflated );
-
-            // Finish updating the first block row
-            auto Q0Undeflated = QUndeflated( IR(0,n0), ALL );
-            auto Z00 = QPacked( IR(0,n0), packingInd0 );
-            auto U0 = U( packingInd0, ALL );
-            Gemm( NORMAL, NORMAL, Real(1), Z00, U0, Real(1), Q0Undeflated );
-
-            // Finish updating the second block row
-            auto Q1Undeflated = QUndeflated( IR(n0,n), ALL );
-            auto Z11 = QPacked( IR(n0,n), packingInd1 );
-            auto U1 = U( packingInd1, ALL );
-            Gemm( NORMAL, NORMAL, Real(1), Z11, U1, Real(1), Q1Undeflated );
+#ifdef EL_HYBRID
+            #pragma omp task default(shared) if(dcCtrl.parallelTasks)
+#endif
+            {
+                auto Q0Undeflated = QUndeflated( IR(0,n0), ALL );
+                auto Z02 = QPacked( IR(0,n0), packingInd2 );
+                auto Z00 = QPacked( IR(0,n0), packingInd0 );
+                auto U0 = U( packingInd0, ALL );
+                Gemm( NORMAL, NORMAL, Real(1), Z02, U2, Q0Undeflated );
+                Gemm( NORMAL, NORMAL, Real(1), Z00, U0, Real(1), Q0Undeflated );
+            }
+#ifdef EL_HYBRID
+            #pragma omp task default(shared) if(dcCtrl.parallelTasks)
+#endif
+            {
+                auto Q1Undeflated = QUndeflated( IR(n0,n), ALL );
+                auto Z12 = QPacked( IR(n0,n), packingInd2 );
+                auto Z11 = QPacked( IR(n0,n), packingInd1 );
+                auto U1 = U( packingInd1, ALL );
+                Gemm( NORMAL, NORMAL, Real(1), Z12, U2, Q1Undeflated );
+                Gemm( NORMAL, NORMAL, Real(1), Z11, U1, Real(1), Q1Undeflated );
+            }
+#ifdef EL_HYBRID
+            #pragma omp taskwait
+#endif
         }
         else
         {
@@ -1153,6 +1193,26 @@ DivideAndConquer
         }
         return info;
     }
+#ifdef EL_HYBRID
+    if( dcCtrl.parallelTasks )
+    {
+        if( n <= dcCtrl.taskCutoff )
+        {
+            // Solve this subtree with a single thread
+            auto ctrlMod( ctrl );
+            ctrlMod.dcCtrl.parallelTasks = false;
+            return DivideAndConquer( mainDiag, superDiag, w, Q, ctrlMod );
+        }
+        if( !omp_in_parallel() )
+        {
+            // Launch a team and run the recursion from a single thread
+            #pragma omp parallel
+            #pragma omp single
+            info = DivideAndConquer( mainDiag, superDiag, w, Q, ctrl );
+            return info;
+        }
+    }
+#endif
 
     // TODO(poulson): A more intelligent split point.
     const Int split = (n/2) + 1;
@@ -1179,11 +1239,24 @@ DivideAndConquer
         Zeros( Q1, 2, n-split );
     }
 
-    Matrix<Real> w0;
-    auto info0 = DivideAndConquer( mainDiag0, superDiag0, w0, Q0, ctrl );
-
-    Matrix<Real> w1;
-    auto info1 = DivideAndConquer( mainDiag1, superDiag1, w1, Q1, ctrl );
+    // The two subproblems are independent and may be solved as tasks, in
+    // which case only the outermost merge reports its progress
+    auto subCtrl( ctrl );
+    if( dcCtrl.parallelTasks )
+    {
+        subCtrl.progress = false;
+        subCtrl.dcCtrl.secularCtrl.progress = false;
+    }
+    Matrix<Real> w0, w1;
+    DCInfo info0, info1;
+#ifdef EL_HYBRID
+    #pragma omp task default(shared) if(dcCtrl.parallelTasks)
+#endif
+    info0 = DivideAndConquer( mainDiag0, superDiag0, w0, Q0, subCtrl );
+    info1 = DivideAndConquer( mainDiag1, superDiag1, w1, Q1, subCtrl );
+#ifdef EL_HYBRID
+    #pragma omp taskwait
+#endif
 
     if( !ctrl.wantEigVecs )
     {
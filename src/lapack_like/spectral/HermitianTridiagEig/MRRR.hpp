@@ -0,0 +1,801 @@
+/*
+   Copyright (c) 2009-2017, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERM_TRIDIAG_EIG_MRRR_HPP
+#define EL_HERM_TRIDIAG_EIG_MRRR_HPP
+
+// A native implementation of the Algorithm of Multiple Relatively Robust
+// Representations (MRRR) for the real symmetric tridiagonal eigenvalue
+// problem. Cf. Dhillon and Parlett's "Multiple representations to compute
+// orthogonal eigenvectors of symmetric tridiagonal matrices" [CITATION],
+// Dhillon, Parlett, and Voemel's "The Design and Implementation of the MRRR
+// Algorithm" [CITATION], and LAPACK's {s,d}stemr [CITATION].
+//
+// Unlike PMRRR and LAPACK, this implementation is templated over the real
+// datatype. Each unreduced block is represented as L D L^T = T - sigma I
+// for a shift sigma just outside of its Gershgorin interval, the eigenvalues
+// are refined to high relative accuracy with bisection driven by the
+// stationary qd transform, and each eigenvector is computed in O(n) work
+// from a twisted factorization. Clusters of eigenvalues with small relative
+// gaps are resolved by shifting to a new representation near one end of the
+// cluster, which forms the 'representation tree'.
+//
+// NOTE: Bisection is used for the initial eigenvalue approximations rather
+// than dqds so that index and value subsets only require O(nk) work.
+
+namespace El {
+namespace herm_tridiag_eig {
+namespace mrrr {
+
+// L D L^T = T - sigma I, where L is unit lower bidiagonal. The products D L
+// and D L^2 are stored since they drive each of the qd transforms.
+template<typename Real>
+struct Representation
+{
+    Real sigma;
+    vector<Real> D, L, DL, DLL;
+};
+
+template<typename Real>
+struct Params
+{
+    Real pivmin;
+    Real relTol;
+    Real spectralDiameter;
+    Real minRelGap;
+    Int maxDepth;
+    Int maxRQIIter;
+    int commRank;
+    int commSize;
+};
+
+template<typename Real>
+Real GuardPivot( const Real& pivot, const Real& pivmin )
+{ return Abs(pivot) < pivmin ? -pivmin : pivot; }
+
+template<typename Real>
+void FormProducts( Representation<Real>& rep )
+{
+    const Int n = rep.D.size();
+    rep.DL.resize( n-1 );
+    rep.DLL.resize( n-1 );
+    for( Int i=0; i<n-1; ++i )
+    {
+        rep.DL[i] = rep.D[i]*rep.L[i];
+        rep.DLL[i] = rep.DL[i]*rep.L[i];
+    }
+}
+
+// The number of eigenvalues less than x of the symmetric tridiagonal matrix
+// with diagonal d and squared off-diagonal eSq (a Sturm count)
+template<typename Real>
+Int SturmCount
+( Int n, const Real* d, const Real* eSq, const Real& pivmin, const Real& x )
+{
+    Int numLess = 0;
+    Real q = GuardPivot( d[0]-x, pivmin );
+    if( q < Real(0) )
+        ++numLess;
+    for( Int i=1; i<n; ++i )
+    {
+        q = GuardPivot( d[i]-x-eSq[i-1]/q, pivmin );
+        if( q < Real(0) )
+            ++numLess;
+    }
+    return numLess;
+}
+
+// The number of eigenvalues of L D L^T less than tau, computed via the
+// stationary qd transform L D L^T - tau I = L+ D+ L+^T
+template<typename Real>
+Int NegCount
+( const Representation<Real>& rep, const Real& tau, const Real& pivmin )
+{
+    const Int n = rep.D.size();
+    Int numNeg = 0;
+    Real s = -tau;
+    for( Int i=0; i<n-1; ++i )
+    {
+        const Real dPlus = GuardPivot( rep.D[i]+s, pivmin );
+        if( dPlus < Real(0) )
+            ++numNeg;
+        s = (rep.DLL[i]/dPlus)*s - tau;
+    }
+    if( GuardPivot( rep.D[n-1]+s, pivmin ) < Real(0) )
+        ++numNeg;
+    return numNeg;
+}
+
+// Form the child representation L+ D+ L+^T = L D L^T - tau I and return its
+// element growth, max_i |D+(i)|
+template<typename Real>
+Real ShiftRepresentation
+( const Representation<Real>& rep,
+  const Real& tau,
+        Representation<Real>& child,
+  const Real& pivmin )
+{
+    const Int n = rep.D.size();
+    child.sigma = rep.sigma + tau;
+    child.D.resize( n );
+    child.L.resize( n-1 );
+    Real growth = 0;
+    Real s = -tau;
+    for( Int i=0; i<n-1; ++i )
+    {
+        const Real dPlus = GuardPivot( rep.D[i]+s, pivmin );
+        child.D[i] = dPlus;
+        child.L[i] = rep.DL[i]/dPlus;
+        s = child.L[i]*rep.L[i]*s - tau;
+        growth = Max( growth, Abs(dPlus) );
+    }
+    child.D[n-1] = GuardPivot( rep.D[n-1]+s, pivmin );
+    growth = Max( growth, Abs(child.D[n-1]) );
+    FormProducts( child );
+    if( !limits::IsFinite(growth) )
+        growth = limits::Infinity<Real>();
+    return growth;
+}
+
+// Bisect for the index'th (zero-based) smallest eigenvalue of L D L^T,
+// starting from an interval of the given half-width about 'approx' which is
+// expanded until it brackets the eigenvalue
+template<typename Real>
+Real Refine
+( const Representation<Real>& rep,
+  Int index,
+  const Real& approx,
+        Real halfWidth,
+  const Params<Real>& params )
+{
+    const Real pivmin = params.pivmin;
+    halfWidth = Max( halfWidth, pivmin );
+    Real lower = approx - halfWidth;
+    Real expansion = halfWidth;
+    while( NegCount( rep, lower, pivmin ) > index )
+    {
+        expansion = Max( 4*expansion, params.spectralDiameter );
+        lower = approx - expansion;
+    }
+    Real upper = approx + halfWidth;
+    expansion = halfWidth;
+    while( NegCount( rep, upper, pivmin ) <= index )
+    {
+        expansion = Max( 4*expansion, params.spectralDiameter );
+        upper = approx + expansion;
+    }
+
+    while( true )
+    {
+        const Real mid = (lower+upper)/2;
+        const Real tol =
+          Max( params.relTol*Max(Abs(lower),Abs(upper)), pivmin );
+        if( upper-lower <= tol || mid == lower || mid == upper )
+            return mid;
+        if( NegCount( rep, mid, pivmin ) <= index )
+            lower = mid;
+        else
+            upper = mid;
+    }
+}
+
+// Compute the unit eigenvector z of L D L^T associated with lambda from the
+// twisted factorization N_r Gamma_r N_r^T = L D L^T - lambda I which
+// minimizes |gamma_r|, applying Rayleigh quotient corrections to lambda as
+// long as they remain within half of the gap to the neighboring eigenvalues
+template<typename Real>
+void TwistedVector
+( const Representation<Real>& rep,
+        Real& lambda,
+  const Real& gap,
+        Real* z,
+  const Params<Real>& params )
+{
+    const Int n = rep.D.size();
+    const Real eps = limits::Epsilon<Real>();
+    const Real pivmin = params.pivmin;
+    vector<Real> LPlus(n-1), UMinus(n-1), s(n), p(n);
+    for( Int iter=0; iter<=params.maxRQIIter; ++iter )
+    {
+        // Stationary qd transform: L D L^T - lambda I = L+ D+ L+^T
+        s[0] = -lambda;
+        for( Int i=0; i<n-1; ++i )
+        {
+            const Real dPlus = GuardPivot( rep.D[i]+s[i], pivmin );
+            LPlus[i] = rep.DL[i]/dPlus;
+            s[i+1] = LPlus[i]*rep.L[i]*s[i] - lambda;
+        }
+
+        // Progressive qd transform: L D L^T - lambda I = U- D- U-^T
+        p[n-1] = rep.D[n-1] - lambda;
+        for( Int i=n-2; i>=0; --i )
+        {
+            const Real dMinus = GuardPivot( rep.DLL[i]+p[i+1], pivmin );
+            const Real ratio = rep.D[i]/dMinus;
+            UMinus[i] = rep.L[i]*ratio;
+            p[i] = p[i+1]*ratio - lambda;
+        }
+
+        // Choose the twist index
+        Int r = 0;
+        Real gamma = s[0] + p[0] + lambda;
+        for( Int i=1; i<n; ++i )
+        {
+            const Real gammaCand = s[i] + p[i] + lambda;
+            if( Abs(gammaCand) < Abs(gamma) )
+            {
+                gamma = gammaCand;
+                r = i;
+            }
+        }
+
+        // Solve N_r^T z = e_r
+        z[r] = 1;
+        for( Int i=r-1; i>=0; --i )
+            z[i] = -LPlus[i]*z[i+1];
+        for( Int i=r; i<n-1; ++i )
+            z[i+1] = -UMinus[i]*z[i];
+        Real zNormSq = 0;
+        for( Int i=0; i<n; ++i )
+            zNormSq += z[i]*z[i];
+
+        // The residual norm of z/||z|| is |gamma|/||z||, and gamma/||z||^2
+        // is the Rayleigh quotient correction of lambda
+        const Real correction = gamma / zNormSq;
+        if( iter == params.maxRQIIter ||
+            Abs(correction) <= 4*eps*Abs(lambda) ||
+            2*Abs(correction) >= gap )
+        {
+            const Real scale = 1 / Sqrt(zNormSq);
+            for( Int i=0; i<n; ++i )
+                z[i] *= scale;
+            return;
+        }
+        lambda += correction;
+    }
+}
+
+// Split the ascending eigenvalues of a representation into groups, each of
+// which is either a singleton or a cluster with small relative gaps
+template<typename Real>
+vector<Int> GroupStarts( const vector<Real>& lambda, const Real& minRelGap )
+{
+    const Int numEig = lambda.size();
+    vector<Int> starts;
+    for( Int i=0; i<numEig; ++i )
+        if( i == 0 ||
+            lambda[i]-lambda[i-1] >=
+            minRelGap*Max(Abs(lambda[i-1]),Abs(lambda[i])) )
+            starts.push_back( i );
+    starts.push_back( numEig );
+    return starts;
+}
+
+template<typename Real>
+bool OwnsColumn( Int column, const Params<Real>& params )
+{ return column >= 0 && column % params.commSize == params.commRank; }
+
+template<typename Real>
+void StoreVector
+( const Real* z, Int nb, Int offset, Int column,
+  Matrix<Real>& Q, const Params<Real>& params )
+{
+    const Int jLoc = column / params.commSize;
+    Real* qCol = Q.Buffer(offset,jLoc);
+    for( Int i=0; i<nb; ++i )
+        qCol[i] = z[i];
+}
+
+template<typename Real>
+void ProcessNode
+( const Representation<Real>& rep,
+  const vector<Int>& indices,
+  const vector<Real>& lambda,
+  const vector<Int>& columns,
+  const Real& leftGap,
+  const Real& rightGap,
+        Int depth,
+        Int offset,
+  const Params<Real>& params,
+        Matrix<Real>& Q,
+        MRRRInfo& info );
+
+// Compute the locally-owned eigenvectors of the group [first,last) of the
+// eigenvalues of the given representation (via a child representation if the
+// group is a cluster)
+template<typename Real>
+void ProcessGroup
+( const Representation<Real>& rep,
+  const vector<Int>& indices,
+  const vector<Real>& lambda,
+  const vector<Int>& columns,
+        Int first,
+        Int last,
+  const Real& leftGap,
+  const Real& rightGap,
+        Int depth,
+        Int offset,
+  const Params<Real>& params,
+        Matrix<Real>& Q,
+        MRRRInfo& info )
+{
+    const Int nb = rep.D.size();
+    const Int numEig = indices.size();
+
+    bool ownsAny = false;
+    for( Int i=first; i<last; ++i )
+        ownsAny = ownsAny || OwnsColumn( columns[i], params );
+    if( !ownsAny )
+        return;
+
+    const Real groupLeftGap =
+      ( first > 0 ? lambda[first]-lambda[first-1] : leftGap );
+    const Real groupRightGap =
+      ( last < numEig ? lambda[last]-lambda[last-1] : rightGap );
+
+    vector<Real> z(nb);
+    if( last-first == 1 )
+    {
+        Real lambdaRefined = lambda[first];
+        TwistedVector
+        ( rep, lambdaRefined, Min(groupLeftGap,groupRightGap), z.data(),
+          params );
+        StoreVector( z.data(), nb, offset, columns[first], Q, params );
+        return;
+    }
+
+    ++info.numClusters;
+    if( depth+1 > params.maxDepth )
+    {
+        // Fall back to explicitly orthogonalizing the wanted members of the
+        // cluster with modified Gram-Schmidt
+        vector<Int> members;
+        for( Int i=first; i<last; ++i )
+            if( columns[i] >= 0 )
+                members.push_back( i );
+        const Int numMembers = members.size();
+        Matrix<Real> Z( nb, numMembers );
+        for( Int m=0; m<numMembers; ++m )
+        {
+            const Int i = members[m];
+            const Real gap = Min
+              ( i > 0 ? lambda[i]-lambda[i-1] : leftGap,
+                i < numEig-1 ? lambda[i+1]-lambda[i] : rightGap );
+            Real lambdaRefined = lambda[i];
+            Real* zCol = Z.Buffer(0,m);
+            TwistedVector( rep, lambdaRefined, gap, zCol, params );
+            for( Int mPrev=0; mPrev<m; ++mPrev )
+            {
+                const Real* zPrev = Z.LockedBuffer(0,mPrev);
+                Real alpha = 0;
+                for( Int k=0; k<nb; ++k )
+                    alpha += zPrev[k]*zCol[k];
+                for( Int k=0; k<nb; ++k )
+                    zCol[k] -= alpha*zPrev[k];
+            }
+            Real zNormSq = 0;
+            for( Int k=0; k<nb; ++k )
+                zNormSq += zCol[k]*zCol[k];
+            const Real scale = 1 / Sqrt(zNormSq);
+            for( Int k=0; k<nb; ++k )
+                zCol[k] *= scale;
+            if( OwnsColumn( columns[i], params ) )
+            {
+                StoreVector( zCol, nb, offset, columns[i], Q, params );
+                ++info.numReorthogonalized;
+            }
+        }
+        return;
+    }
+
+    // Shift to a new representation just outside of one end of the cluster,
+    // preferring the shift with the smallest element growth
+    const Real left = lambda[first];
+    const Real right = lambda[last-1];
+    const Real maxGrowth = 8*params.spectralDiameter;
+    const Int numTries = 6;
+    Real delta = 4*params.relTol*Max(Abs(left),Abs(right)) + params.pivmin;
+    Representation<Real> child, candidate;
+    Real childGrowth = limits::Infinity<Real>();
+    for( Int attempt=0; attempt<numTries; ++attempt )
+    {
+        // The shift must not pass over the neighboring groups
+        const Real leftDelta = Min( delta, groupLeftGap/2 );
+        const Real rightDelta = Min( delta, groupRightGap/2 );
+        const Real growthLeft =
+          ShiftRepresentation( rep, left-leftDelta, candidate, params.pivmin );
+        if( growthLeft < childGrowth )
+        {
+            childGrowth = growthLeft;
+            std::swap( child, candidate );
+        }
+        if( childGrowth <= maxGrowth )
+            break;
+        const Real growthRight =
+          ShiftRepresentation
+          ( rep, right+rightDelta, candidate, params.pivmin );
+        if( growthRight < childGrowth )
+        {
+            childGrowth = growthRight;
+            std::swap( child, candidate );
+        }
+        if( childGrowth <= maxGrowth )
+            break;
+        delta *= 4;
+    }
+
+    const Real tau = child.sigma - rep.sigma;
+    vector<Int> childIndices( indices.begin()+first, indices.begin()+last );
+    vector<Int> childColumns( columns.begin()+first, columns.begin()+last );
+    vector<Real> childLambda( last-first );
+    for( Int i=first; i<last; ++i )
+    {
+        const Real approx = lambda[i] - tau;
+        const Real halfWidth = 2*params.relTol*Abs(lambda[i]);
+        childLambda[i-first] =
+          Refine( child, indices[i], approx, halfWidth, params );
+    }
+    ProcessNode
+    ( child, childIndices, childLambda, childColumns,
+      groupLeftGap, groupRightGap, depth+1, offset, params, Q, info );
+}
+
+template<typename Real>
+void ProcessNode
+( const Representation<Real>& rep,
+  const vector<Int>& indices,
+  const vector<Real>& lambda,
+  const vector<Int>& columns,
+  const Real& leftGap,
+  const Real& rightGap,
+        Int depth,
+        Int offset,
+  const Params<Real>& params,
+        Matrix<Real>& Q,
+        MRRRInfo& info )
+{
+    info.maxDepth = Max( info.maxDepth, depth );
+    const auto starts = GroupStarts( lambda, params.minRelGap );
+    const Int numGroups = starts.size()-1;
+    for( Int group=0; group<numGroups; ++group )
+        ProcessGroup
+        ( rep, indices, lambda, columns, starts[group], starts[group+1],
+          leftGap, rightGap, depth, offset, params, Q, info );
+}
+
+template<typename Real>
+struct Block
+{
+    Int offset, size;
+    // The wanted eigenvalues have block indices in [begin,end), and the
+    // representation tree is built over [extBegin,extEnd), which includes a
+    // neighbor on each side (when it exists) so that the gaps are known
+    Int begin, end, extBegin, extEnd;
+    // The Gershgorin interval of the block relative to the root shift
+    Real lower, upper;
+    Representation<Real> root;
+    vector<Int> indices;
+    vector<Real> lambda;
+    vector<Int> columns;
+};
+
+template<typename Real>
+struct Candidate
+{
+    Real value;
+    Int block, index;
+};
+
+} // namespace mrrr
+
+// Compute the requested eigenvalues (and, if Q is non-null, eigenvectors) of
+// the real symmetric tridiagonal matrix with diagonal d and subdiagonal dSub.
+// The eigenvalues are returned in ascending order in w (redundantly over
+// 'comm'), and the eigenvector corresponding to w(j) is returned in local
+// column j / p of Q if j mod p = q, where q and p are the rank and size of
+// 'comm'; this is the local portion of a [* ,VR] matrix with zero row
+// alignment when 'comm' is the VR communicator. The bisection and the
+// eigenvector computations are spread over the processes of 'comm' (and the
+// OpenMP threads of each process).
+template<typename Real>
+MRRRInfo
+MRRR
+( const Matrix<Real>& d,
+  const Matrix<Real>& dSub,
+        Matrix<Real>& w,
+        Matrix<Real>* Q,
+        mpi::Comm comm,
+  const HermitianTridiagEigCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = d.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real safeMin = limits::SafeMin<Real>();
+    const auto& subset = ctrl.subset;
+    MRRRInfo info;
+
+    mrrr::Params<Real> params;
+    params.commRank = mpi::Rank( comm );
+    params.commSize = mpi::Size( comm );
+    if( n == 0 )
+    {
+        w.Resize( 0, 1 );
+        if( Q != nullptr )
+            Q->Resize( 0, 0 );
+        return info;
+    }
+    if( subset.indexSubset &&
+        (subset.lowerIndex < 0 || subset.upperIndex >= n ||
+         subset.lowerIndex > subset.upperIndex) )
+        LogicError
+        ("Invalid index subset [",subset.lowerIndex,",",subset.upperIndex,
+         "] for a tridiagonal matrix of height ",n);
+
+    // Form the Gershgorin interval and the squared off-diagonal, splitting
+    // wherever the off-diagonal is negligible relative to the matrix norm
+    Real gl = d(0), gu = d(0), tNorm = 0, maxESq = 0;
+    for( Int i=0; i<n; ++i )
+    {
+        const Real radius = (i > 0 ? Abs(dSub(i-1)) : Real(0)) +
+                            (i < n-1 ? Abs(dSub(i)) : Real(0));
+        gl = Min( gl, d(i)-radius );
+        gu = Max( gu, d(i)+radius );
+        tNorm = Max( tNorm, Abs(d(i))+radius );
+    }
+    const Real splitTol = eps*tNorm;
+    vector<Real> eSq(n);
+    vector<Int> splits(1,0);
+    for( Int i=0; i<n-1; ++i )
+    {
+        if( Abs(dSub(i)) <= splitTol )
+        {
+            eSq[i] = 0;
+            splits.push_back( i+1 );
+        }
+        else
+        {
+            eSq[i] = dSub(i)*dSub(i);
+            maxESq = Max( maxESq, eSq[i] );
+        }
+    }
+    splits.push_back( n );
+    params.pivmin = safeMin*Max( Real(1), maxESq );
+    params.relTol = 4*eps;
+    params.minRelGap = ctrl.mrrrCtrl.minRelGap;
+    params.maxDepth = ctrl.mrrrCtrl.maxDepth;
+    params.maxRQIIter = ctrl.mrrrCtrl.maxRQIIter;
+    const Real pad = 4*n*eps*tNorm + 2*params.pivmin;
+    gl -= pad;
+    gu += pad;
+    params.spectralDiameter = gu - gl;
+
+    auto globalCount = [&]( const Real& x )
+      { return mrrr::SturmCount
+               ( n, d.LockedBuffer(), eSq.data(), params.pivmin, x ); };
+
+    // Determine the interval [selLower,selUpper) containing the wanted
+    // eigenvalues
+    Real selLower, selUpper;
+    if( subset.indexSubset )
+    {
+        // Bisect for an interval whose lower end has at most 'index'
+        // eigenvalues below it and whose upper end has more
+        auto bracket = [&]( Int index, Real& lower, Real& upper )
+        {
+            lower = gl;
+            upper = gu;
+            while( true )
+            {
+                const Real mid = (lower+upper)/2;
+                const Real tol =
+                  2*eps*Max(Abs(lower),Abs(upper)) + params.pivmin;
+                if( upper-lower <= tol || mid == lower || mid == upper )
+                    break;
+                if( globalCount(mid) <= index )
+                    lower = mid;
+                else
+                    upper = mid;
+            }
+        };
+        Real lower, upper;
+        bracket( subset.lowerIndex, lower, upper );
+        selLower = lower;
+        bracket( subset.upperIndex, lower, upper );
+        selUpper = upper;
+    }
+    else if( subset.rangeSubset )
+    {
+        selLower = subset.lowerBound;
+        selUpper = subset.upperBound;
+    }
+    else
+    {
+        selLower = gl;
+        selUpper = gu;
+    }
+
+    // Form the root representation of each block with wanted eigenvalues
+    vector<mrrr::Block<Real>> blocks;
+    const Int numSplits = splits.size()-1;
+    for( Int b=0; b<numSplits; ++b )
+    {
+        mrrr::Block<Real> block;
+        block.offset = splits[b];
+        block.size = splits[b+1] - splits[b];
+        const Real* dBlock = d.LockedBuffer(block.offset,0);
+        const Real* eSqBlock = &eSq[block.offset];
+        block.begin = mrrr::SturmCount
+          ( block.size, dBlock, eSqBlock, params.pivmin, selLower );
+        block.end = mrrr::SturmCount
+          ( block.size, dBlock, eSqBlock, params.pivmin, selUpper );
+        if( block.begin >= block.end )
+            continue;
+        block.extBegin = Max( block.begin-1, Int(0) );
+        block.extEnd = Min( block.end+1, block.size );
+
+        // Shift to just outside the end of the Gershgorin interval of the
+        // block nearest to the wanted eigenvalues so that L D L^T is definite
+        Real blockLower = dBlock[0], blockUpper = dBlock[0];
+        for( Int i=0; i<block.size; ++i )
+        {
+            const Int iGlob = block.offset + i;
+            const Real radius =
+              (i > 0 ? Abs(dSub(iGlob-1)) : Real(0)) +
+              (i < block.size-1 ? Abs(dSub(iGlob)) : Real(0));
+            blockLower = Min( blockLower, dBlock[i]-radius );
+            blockUpper = Max( blockUpper, dBlock[i]+radius );
+        }
+        const Real blockPad =
+          4*block.size*eps*Max(Abs(blockLower),Abs(blockUpper)) +
+          2*params.pivmin;
+        blockLower -= blockPad;
+        blockUpper += blockPad;
+
+        auto& root = block.root;
+        root.sigma = ( block.begin+block.end <= block.size ?
+                       blockLower : blockUpper );
+        root.D.resize( block.size );
+        root.L.resize( block.size-1 );
+        root.D[0] = mrrr::GuardPivot( dBlock[0]-root.sigma, params.pivmin );
+        for( Int i=0; i<block.size-1; ++i )
+        {
+            const Real beta = dSub(block.offset+i);
+            root.L[i] = beta / root.D[i];
+            root.D[i+1] = mrrr::GuardPivot
+              ( dBlock[i+1]-root.sigma-root.L[i]*beta, params.pivmin );
+        }
+        mrrr::FormProducts( root );
+
+        block.lower = blockLower - root.sigma;
+        block.upper = blockUpper - root.sigma;
+        const Int numExt = block.extEnd - block.extBegin;
+        block.indices.resize( numExt );
+        for( Int i=0; i<numExt; ++i )
+            block.indices[i] = block.extBegin + i;
+        blocks.push_back( std::move(block) );
+    }
+    const Int numBlocks = blocks.size();
+
+    // Refine the eigenvalues of each root representation to high relative
+    // accuracy, spreading the bisections over the processes and threads
+    vector<Int> bisectOffsets( numBlocks+1, 0 );
+    for( Int b=0; b<numBlocks; ++b )
+        bisectOffsets[b+1] = bisectOffsets[b] + blocks[b].indices.size();
+    const Int numBisections = bisectOffsets[numBlocks];
+    Matrix<Real> rootEigs;
+    Zeros( rootEigs, numBisections, 1 );
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        const auto& block = blocks[b];
+        const Int numExt = block.indices.size();
+        const Real center = (block.lower+block.upper)/2;
+        const Real halfWidth = (block.upper-block.lower)/2;
+        Real* eigBuf = rootEigs.Buffer(bisectOffsets[b],0);
+        EL_PARALLEL_FOR
+        for( Int i=0; i<numExt; ++i )
+        {
+            if( (bisectOffsets[b]+i) % params.commSize == params.commRank )
+                eigBuf[i] = mrrr::Refine
+                  ( block.root, block.indices[i], center, halfWidth, params );
+        }
+    }
+    if( params.commSize > 1 )
+        AllReduce( rootEigs, comm );
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        auto& block = blocks[b];
+        const Int numExt = block.indices.size();
+        block.lambda.resize( numExt );
+        for( Int i=0; i<numExt; ++i )
+            block.lambda[i] = rootEigs(bisectOffsets[b]+i);
+    }
+
+    // Merge the wanted eigenvalues of the blocks and assign their columns
+    vector<mrrr::Candidate<Real>> candidates;
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        const auto& block = blocks[b];
+        for( Int index=block.begin; index<block.end; ++index )
+        {
+            mrrr::Candidate<Real> candidate;
+            candidate.value =
+              block.root.sigma + block.lambda[index-block.extBegin];
+            candidate.block = b;
+            candidate.index = index;
+            candidates.push_back( candidate );
+        }
+    }
+    std::sort
+    ( candidates.begin(), candidates.end(),
+      []( const mrrr::Candidate<Real>& a, const mrrr::Candidate<Real>& b )
+      { return a.value < b.value ||
+               (a.value == b.value &&
+                (a.block < b.block ||
+                 (a.block == b.block && a.index < b.index))); } );
+    for( auto& block : blocks )
+        block.columns.resize( block.indices.size(), -1 );
+    const Int numCandidates = candidates.size();
+    const Int firstIndex = ( subset.indexSubset ? globalCount(selLower) : 0 );
+    Int k = 0;
+    w.Resize( numCandidates, 1 );
+    for( Int r=0; r<numCandidates; ++r )
+    {
+        const Int index = firstIndex + r;
+        if( subset.indexSubset &&
+            (index < subset.lowerIndex || index > subset.upperIndex) )
+            continue;
+        const auto& candidate = candidates[r];
+        auto& block = blocks[candidate.block];
+        block.columns[candidate.index-block.extBegin] = k;
+        w(k++) = candidate.value;
+    }
+    w.Resize( k, 1 );
+    if( Q == nullptr )
+        return info;
+
+    // Traverse the representation tree of each group of each root,
+    // computing the locally-owned eigenvectors
+    Zeros( *Q, n, Length(k,params.commRank,params.commSize) );
+    vector<std::pair<Int,Int>> groups;
+    vector<Int> groupStarts;
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        const auto starts =
+          mrrr::GroupStarts( blocks[b].lambda, params.minRelGap );
+        for( Int group=0; group<Int(starts.size())-1; ++group )
+        {
+            groups.emplace_back( b, starts[group] );
+            groupStarts.push_back( starts[group+1] );
+        }
+    }
+    const Int numGroups = groups.size();
+    vector<MRRRInfo> groupInfos( numGroups );
+    EL_PARALLEL_FOR
+    for( Int group=0; group<numGroups; ++group )
+    {
+        const auto& block = blocks[groups[group].first];
+        mrrr::ProcessGroup
+        ( block.root, block.indices, block.lambda, block.columns,
+          groups[group].second, groupStarts[group],
+          params.spectralDiameter, params.spectralDiameter,
+          Int(0), block.offset, params, *Q, groupInfos[group] );
+    }
+    for( const auto& groupInfo : groupInfos )
+    {
+        info.numClusters += groupInfo.numClusters;
+        info.maxDepth = Max( info.maxDepth, groupInfo.maxDepth );
+        info.numReorthogonalized += groupInfo.numReorthogonalized;
+    }
+
+    return info;
+}
+
+} // namespace herm_tridiag_eig
+} // namespace El
+
+#endif // ifndef EL_HERM_TRIDIAG_EIG_MRRR_HPP
@@ -123,10 +123,10 @@ QDWHInfo QDWH( Matrix<F>& A, const QDWHCtrl& ctrl )
     const Real twoEst = TwoNormEstimate( A );
     A *= 1/twoEst;
 
-    // The one-norm of the inverse can be replaced with an estimate which is
-    // a few times cheaper, e.g., via Higham and Tisseur's block algorithm
-    // from "A Block Algorithm for Matrix 1-Norm Estimation, with an Application
-    // to 1-Norm Pseudospectra".
+    // For square matrices, the one-norm of the inverse is estimated from an
+    // LU factorization with Higham and Tisseur's block algorithm from
+    // "A Block Algorithm for Matrix 1-Norm Estimation, with an Application
+    // to 1-Norm Pseudospectra" rather than by forming the inverse.
     Real sMinUpper;
     Matrix<F> Y( A );
     if( A.Height() > A.Width() )
@@ -142,8 +142,9 @@ QDWHInfo QDWH( Matrix<F>& A, const QDWHCtrl& ctrl )
     {
         try
         {
-            Inverse( Y );
-            sMinUpper = Real(1) / OneNorm( Y );
+            Permutation P;
+            LU( Y, P );
+            sMinUpper = Real(1) / lu::InverseOneNormEstimate( Y, P );
         } catch( SingularMatrixException& e ) { sMinUpper = 0; }
     }
 
@@ -274,10 +275,10 @@ QDWH( AbstractDistMatrix<F>& APre, const QDWHCtrl& ctrl )
     const Real twoEst = TwoNormEstimate( A );
     A *= 1/twoEst;
 
-    // The one-norm of the inverse can be replaced with an estimate which is
-    // a few times cheaper, e.g., via Higham and Tisseur's block algorithm
-    // from "A Block Algorithm for Matrix 1-Norm Estimation, with an Application
-    // to 1-Norm Pseudospectra".
+    // For square matrices, the one-norm of the inverse is estimated from an
+    // LU factorization with Higham and Tisseur's block algorithm from
+    // "A Block Algorithm for Matrix 1-Norm Estimation, with an Application
+    // to 1-Norm Pseudospectra" rather than by forming the inverse.
     Real sMinUpper;
     DistMatrix<F> Y( A );
     if( A.Height() > A.Width() )
@@ -293,8 +294,9 @@ QDWH( AbstractDistMatrix<F>& APre, const QDWHCtrl& ctrl )
     {
         try
         {
-            Inverse( Y );
-            sMinUpper = Real(1) / OneNorm( Y );
+            DistPermutation P( A.Grid() );
+            LU( Y, P );
+            sMinUpper = Real(1) / lu::InverseOneNormEstimate( Y, P );
         } catch( SingularMatrixException& e ) { sMinUpper = 0; }
     }
 
@@ -442,16 +444,17 @@ QDWH( UpperOrLower uplo, Matrix<F>& A, const QDWHCtrl& ctrl )
     const Real twoEst = TwoNormEstimate( A );
     A *= 1/twoEst;
 
-    // The one-norm of the inverse can be replaced with an estimate which is
-    // a few times cheaper, e.g., via Higham and Tisseur's block algorithm
-    // from "A Block Algorithm for Matrix 1-Norm Estimation, with an Application
-    // to 1-Norm Pseudospectra".
+    // The one-norm of the inverse is estimated from an LU factorization with
+    // Higham and Tisseur's block algorithm from "A Block Algorithm for Matrix
+    // 1-Norm Estimation, with an Application to 1-Norm Pseudospectra" rather
+    // than by forming the inverse.
     Real sMinUpper;
     Matrix<F> Y( A );
     try
     {
-        Inverse( Y );
-        sMinUpper = Real(1) / OneNorm( Y );
+        Permutation P;
+        LU( Y, P );
+        sMinUpper = Real(1) / lu::InverseOneNormEstimate( Y, P );
     } catch( SingularMatrixException& e ) { sMinUpper = 0; }
 
     return QDWHInner( uplo, A, sMinUpper, ctrl );
@@ -596,16 +599,17 @@ QDWH( UpperOrLower uplo, AbstractDistMatrix<F>& APre, const QDWHCtrl& ctrl )
     const Real twoEst = TwoNormEstimate( A );
     A *= 1/twoEst;
 
-    // The one-norm of the inverse can be replaced with an estimate which is
-    // a few times cheaper, e.g., via Higham and Tisseur's block algorithm
-    // from "A Block Algorithm for Matrix 1-Norm Estimation, with an Application
-    // to 1-Norm Pseudospectra".
+    // The one-norm of the inverse is estimated from an LU factorization with
+    // Higham and Tisseur's block algorithm from "A Block Algorithm for Matrix
+    // 1-Norm Estimation, with an Application to 1-Norm Pseudospectra" rather
+    // than by forming the inverse.
     Real sMinUpper;
     DistMatrix<F> Y( A );
     try
     {
-        Inverse( Y );
-        sMinUpper = Real(1) / OneNorm( Y );
+        DistPermutation P( A.Grid() );
+        LU( Y, P );
+        sMinUpper = Real(1) / lu::InverseOneNormEstimate( Y, P );
     } catch( SingularMatrixException& e ) { sMinUpper = 0; }
 
     return QDWHInner( uplo, A, sMinUpper, ctrl );
@@ -9,7 +9,9 @@
 #include <El.hpp>
 
 #include "./SVD/Chan.hpp"
+#include "./SVD/Jacobi.hpp"
 #include "./SVD/Product.hpp"
+#include "./SVD/QDWH.hpp"
 
 namespace El {
 
@@ -242,6 +244,14 @@ SVDInfo SVD
     {
         return SVD( A, s, ctrl );
     }
+    if( ctrl.useQDWH )
+    {
+        return svd::QDWH( A, U, s, V, ctrl );
+    }
+    if( ctrl.useJacobi )
+    {
+        return svd::Jacobi( A, U, s, V, ctrl );
+    }
     if( ctrl.useLAPACK )
     {
         return svd::LAPACKHelper( A, U, s, V, ctrl );
@@ -317,6 +327,14 @@ SVDInfo SVD
     {
         return SVD( A, s, ctrl );
     }
+    if( ctrl.useQDWH )
+    {
+        return svd::QDWH( A, U, s, V, ctrl );
+    }
+    if( ctrl.useJacobi )
+    {
+        return svd::Jacobi( A, U, s, V, ctrl );
+    }
 
     SVDInfo info;
     if( approach == PRODUCT_SVD )
@@ -519,6 +537,14 @@ SVDInfo SVD
         View( AMod, A );
     else
         AMod = A;
+    if( ctrl.useQDWH )
+    {
+        return svd::QDWH( AMod, s, ctrl );
+    }
+    if( ctrl.useJacobi )
+    {
+        return svd::Jacobi( AMod, s, ctrl );
+    }
 
     if( IsBlasScalar<Field>::value && ctrl.useLAPACK )
     {
@@ -555,6 +581,16 @@ SVDInfo SVD
     {
         return svd::ScaLAPACKHelper( A, s, ctrl );
     }
+    if( ctrl.useQDWH )
+    {
+        DistMatrix<Field> ACopy( A );
+        return svd::QDWH( ACopy, s, ctrl );
+    }
+    if( ctrl.useJacobi )
+    {
+        DistMatrix<Field> ACopy( A );
+        return svd::Jacobi( ACopy, s, ctrl );
+    }
     if( ctrl.bidiagSVDCtrl.approach == THIN_SVD ||
         ctrl.bidiagSVDCtrl.approach == COMPACT_SVD ||
         ctrl.bidiagSVDCtrl.approach == FULL_SVD )
@@ -600,6 +636,14 @@ SVDInfo SVD
         DistMatrix<Field> ACopy( A );
         return SVD( ACopy, s, ctrlMod );
     }
+    if( ctrl.useQDWH )
+    {
+        return svd::QDWH( A, s, ctrl );
+    }
+    if( ctrl.useJacobi )
+    {
+        return svd::Jacobi( A, s, ctrl );
+    }
     return svd::Chan( A, s, ctrl );
 }
 
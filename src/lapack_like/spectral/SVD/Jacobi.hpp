@@ -0,0 +1,593 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SVD_JACOBI_HPP
+#define EL_SVD_JACOBI_HPP
+
+// Blocked one-sided Jacobi: the columns of X are split into blocks of width
+// b, and every round of a round-robin ordering pairs the blocks so that each
+// pair (I,J) can be orthogonalized independently by diagonalizing the 2b x 2b
+// Gram matrix [X_I, X_J]^H [X_I, X_J] and updating [X_I, X_J] with the
+// resulting unitary matrix. Since only the Gram matrices need to be summed,
+// the rows of X may be distributed arbitrarily, and so the distributed
+// variant works on [VC,STAR] matrices with one AllReduce per round (plus one
+// more to share the rotations, whose computation is spread over the team).
+//
+// If A Omega^T = Q R is a column-pivoted QR factorization, the iteration is
+// instead run on R^H, which typically converges in a small number of sweeps
+// and yields the singular values to high relative accuracy; see
+// Drmac and Veselic, "New fast and accurate Jacobi SVD algorithm. I".
+
+namespace El {
+namespace svd {
+namespace jacobi {
+
+// The largest |G(i,j)| / sqrt(G(i,i) G(j,j)) over the strictly lower triangle
+// of the Hermitian matrix G, i.e., the largest cosine between the columns
+// whose Gram matrix is G
+template<typename Field>
+Base<Field> RelativeOffDiagonal( const Matrix<Field>& G )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = G.Height();
+    Real maxOff = 0;
+    for( Int j=0; j<n; ++j )
+    {
+        const Real gammaj = RealPart(G(j,j));
+        if( gammaj <= Real(0) )
+            continue;
+        for( Int i=j+1; i<n; ++i )
+        {
+            const Real gammai = RealPart(G(i,i));
+            if( gammai > Real(0) )
+                maxOff =
+                  Max( maxOff, Abs(G(i,j))/(Sqrt(gammai)*Sqrt(gammaj)) );
+        }
+    }
+    return maxOff;
+}
+
+// Cyclic two-sided Jacobi on the Hermitian matrix G, with the product of the
+// rotations returned in W, so that W^H G W is (nearly) diagonal
+template<typename Field>
+void LocalJacobi
+( Matrix<Field>& G, Matrix<Field>& W, Base<Field> tol, Int maxSweeps )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = G.Height();
+    Identity( W, n, n );
+    for( Int sweep=0; sweep<maxSweeps; ++sweep )
+    {
+        bool rotated = false;
+        for( Int p=0; p<n-1; ++p )
+        {
+            for( Int q=p+1; q<n; ++q )
+            {
+                const Real alpha = RealPart(G(p,p));
+                const Real beta = RealPart(G(q,q));
+                const Field gamma = G(p,q);
+                const Real gammaAbs = Abs(gamma);
+                if( gammaAbs == Real(0) ||
+                    gammaAbs <= tol*Sqrt(Max(alpha,Real(0)))*
+                                    Sqrt(Max(beta,Real(0))) )
+                    continue;
+                rotated = true;
+
+                // With psi = gamma/|gamma|, the rotation
+                //   J = [c, s; -s conj(psi), c conj(psi)]
+                // zeroes the (p,q) entry of J^H G([p,q],[p,q]) J
+                const Field psi = gamma / gammaAbs;
+                const Real zeta = (beta-alpha) / (2*gammaAbs);
+                const Real t = (zeta >= Real(0) ? Real(1) : Real(-1)) /
+                               (Abs(zeta) + SafeNorm(Real(1),zeta));
+                const Real c = Real(1) / SafeNorm(Real(1),t);
+                const Real s = c*t;
+                const Field tau00 = c;
+                const Field tau01 = s;
+                const Field tau10 = -s*Conj(psi);
+                const Field tau11 = c*Conj(psi);
+
+                for( Int i=0; i<n; ++i )
+                {
+                    const Field gp = G(i,p), gq = G(i,q);
+                    G(i,p) = gp*tau00 + gq*tau10;
+                    G(i,q) = gp*tau01 + gq*tau11;
+                    const Field wp = W(i,p), wq = W(i,q);
+                    W(i,p) = wp*tau00 + wq*tau10;
+                    W(i,q) = wp*tau01 + wq*tau11;
+                }
+                for( Int j=0; j<n; ++j )
+                {
+                    const Field gp = G(p,j), gq = G(q,j);
+                    G(p,j) = Conj(tau00)*gp + Conj(tau10)*gq;
+                    G(q,j) = Conj(tau01)*gp + Conj(tau11)*gq;
+                }
+                G(p,q) = G(q,p) = 0;
+            }
+        }
+        if( !rotated )
+            break;
+    }
+}
+
+inline Range<Int> BlockRange( Int block, Int blocksize, Int n )
+{
+    if( block < 0 )
+        return IR(0,0);
+    return IR( block*blocksize, Min((block+1)*blocksize,n) );
+}
+
+// XPair := [X(:,I), X(:,J)]
+template<typename Field>
+void GatherPair
+( const Matrix<Field>& X, Range<Int> I, Range<Int> J, Matrix<Field>& XPair )
+{
+    EL_DEBUG_CSE
+    const Int nI = I.end - I.beg;
+    const Int nJ = J.end - J.beg;
+    XPair.Resize( X.Height(), nI+nJ );
+    auto XPairI = XPair( ALL, IR(0,nI) );
+    auto XPairJ = XPair( ALL, IR(nI,nI+nJ) );
+    XPairI = X( ALL, I );
+    XPairJ = X( ALL, J );
+}
+
+// [X(:,I), X(:,J)] := XPair W
+template<typename Field>
+void UpdatePair
+( Matrix<Field>& X, Range<Int> I, Range<Int> J,
+  const Matrix<Field>& XPair, const Matrix<Field>& W )
+{
+    EL_DEBUG_CSE
+    const Int nI = I.end - I.beg;
+    const Int nJ = J.end - J.beg;
+    auto XI = X( ALL, I );
+    auto XJ = X( ALL, J );
+    Gemm
+    ( NORMAL, NORMAL, Field(1), XPair, W(ALL,IR(0,nI)), Field(0), XI );
+    Gemm
+    ( NORMAL, NORMAL, Field(1), XPair, W(ALL,IR(nI,nI+nJ)), Field(0), XJ );
+}
+
+// Run block one-sided Jacobi sweeps over the columns of X, whose rows may be
+// spread over the processes in 'comm' (each process passing in its local
+// rows). The same rotations are applied to the local rows of V if
+// 'accumulate' is true. Returns the number of sweeps.
+template<typename Field>
+Int Sweeps
+( Matrix<Field>& XLoc,
+  Matrix<Field>& VLoc,
+  bool accumulate,
+  Int blocksize,
+  Base<Field> tol,
+  mpi::Comm comm,
+  const JacobiSVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = XLoc.Width();
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    const Int numBlocks = (n+blocksize-1) / blocksize;
+
+    // The circle method for round-robin tournaments: the first slot is fixed
+    // and the others rotate, so that each pair of blocks meets exactly once
+    // per sweep. An odd number of blocks is padded with a dummy (-1) block.
+    vector<Int> order( numBlocks );
+    for( Int block=0; block<numBlocks; ++block )
+        order[block] = block;
+    if( numBlocks % 2 == 1 )
+        order.push_back( -1 );
+    const Int numSlots = order.size();
+    const Int numPairs = numSlots / 2;
+    const Int numRounds = numSlots - 1;
+    const Int pairSize = 2*blocksize;
+
+    Matrix<Field> GBuf, WBuf, XPair, VPair, G, W;
+    vector<Real> offs( numPairs );
+    Int sweep = 0;
+    while( sweep < ctrl.maxSweeps )
+    {
+        ++sweep;
+        Real maxOff = 0;
+        for( Int round=0; round<numRounds; ++round )
+        {
+            // Sum the Gram matrices of all of this round's pairs at once
+            Zeros( GBuf, pairSize, pairSize*numPairs );
+            for( Int k=0; k<numPairs; ++k )
+            {
+                const Range<Int> I =
+                  BlockRange( order[k], blocksize, n );
+                const Range<Int> J =
+                  BlockRange( order[numSlots-1-k], blocksize, n );
+                const Int nPair = (I.end-I.beg) + (J.end-J.beg);
+                GatherPair( XLoc, I, J, XPair );
+                auto Gk = GBuf( IR(0,nPair), IR(0,nPair)+k*pairSize );
+                Gemm( ADJOINT, NORMAL, Field(1), XPair, XPair, Field(0), Gk );
+            }
+            if( commSize > 1 )
+                mpi::AllReduce
+                ( GBuf.Buffer(), GBuf.Height()*GBuf.Width(), comm );
+
+            // Spread the diagonalization of the (redundantly known) Gram
+            // matrices over the team
+            Zeros( WBuf, pairSize, pairSize*numPairs );
+            for( Int k=0; k<numPairs; ++k )
+            {
+                const Range<Int> I =
+                  BlockRange( order[k], blocksize, n );
+                const Range<Int> J =
+                  BlockRange( order[numSlots-1-k], blocksize, n );
+                const Int nPair = (I.end-I.beg) + (J.end-J.beg);
+                G = GBuf( IR(0,nPair), IR(0,nPair)+k*pairSize );
+                offs[k] = RelativeOffDiagonal( G );
+                maxOff = Max( maxOff, offs[k] );
+                if( offs[k] > tol && k % commSize == commRank )
+                {
+                    LocalJacobi( G, W, tol, ctrl.maxSweeps );
+                    auto Wk = WBuf( IR(0,nPair), IR(0,nPair)+k*pairSize );
+                    Wk = W;
+                }
+            }
+            if( commSize > 1 )
+                mpi::AllReduce
+                ( WBuf.Buffer(), WBuf.Height()*WBuf.Width(), comm );
+
+            for( Int k=0; k<numPairs; ++k )
+            {
+                if( offs[k] <= tol )
+                    continue;
+                const Range<Int> I =
+                  BlockRange( order[k], blocksize, n );
+                const Range<Int> J =
+                  BlockRange( order[numSlots-1-k], blocksize, n );
+                const Int nPair = (I.end-I.beg) + (J.end-J.beg);
+                auto Wk = WBuf( IR(0,nPair), IR(0,nPair)+k*pairSize );
+                GatherPair( XLoc, I, J, XPair );
+                UpdatePair( XLoc, I, J, XPair, Wk );
+                if( accumulate )
+                {
+                    GatherPair( VLoc, I, J, VPair );
+                    UpdatePair( VLoc, I, J, VPair, Wk );
+                }
+            }
+
+            std::rotate( order.begin()+1, order.end()-1, order.end() );
+        }
+        if( ctrl.progress && commRank == 0 )
+            Output
+            ("Jacobi sweep ",sweep,": max relative off-diagonal of ",maxOff);
+        if( maxOff <= tol )
+            break;
+    }
+    return sweep;
+}
+
+// The singular values are the norms of the (now orthogonal) columns of X,
+// which are normalized to form the left singular vectors. The columns of X
+// and V are then reordered so that the singular values are non-increasing.
+template<typename Field>
+void Finalize
+( Matrix<Field>& XLoc,
+  Matrix<Field>& VLoc,
+  bool accumulate,
+  Matrix<Base<Field>>& s,
+  mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = XLoc.Width();
+    const Int mLoc = XLoc.Height();
+
+    // Combine the local (scale,scaledSquare) pairs of each column, as in
+    // ColumnTwoNorms, so that large columns do not overflow
+    Matrix<Real> localScales( n, 1 ), localScaledSquares( n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        Real localScale = 0;
+        Real localScaledSquare = 1;
+        for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+            UpdateScaledSquare( XLoc(iLoc,j), localScale, localScaledSquare );
+        localScales(j) = localScale;
+        localScaledSquares(j) = localScaledSquare;
+    }
+    Matrix<Real> scales( localScales );
+    if( mpi::Size(comm) > 1 )
+    {
+        mpi::AllReduce( scales.Buffer(), n, mpi::MAX, comm );
+        for( Int j=0; j<n; ++j )
+        {
+            if( scales(j) != Real(0) )
+            {
+                const Real relScale = localScales(j)/scales(j);
+                localScaledSquares(j) *= relScale*relScale;
+            }
+            else
+                localScaledSquares(j) = 0;
+        }
+        mpi::AllReduce( localScaledSquares.Buffer(), n, comm );
+    }
+    Zeros( s, n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        s(j) = scales(j)*Sqrt(localScaledSquares(j));
+        if( s(j) > Real(0) )
+        {
+            auto xj = XLoc( ALL, IR(j) );
+            xj *= Real(1)/s(j);
+        }
+    }
+
+    vector<Int> perm( n );
+    for( Int j=0; j<n; ++j )
+        perm[j] = j;
+    std::stable_sort
+    ( perm.begin(), perm.end(),
+      [&]( const Int& i, const Int& j ) { return s(i) > s(j); } );
+
+    Matrix<Base<Field>> sPerm( n, 1 );
+    Matrix<Field> XPerm( mLoc, n ), VPerm( VLoc.Height(), n );
+    for( Int j=0; j<n; ++j )
+    {
+        sPerm(j) = s(perm[j]);
+        auto xj = XPerm( ALL, IR(j) );
+        xj = XLoc( ALL, IR(perm[j]) );
+        if( accumulate )
+        {
+            auto vj = VPerm( ALL, IR(j) );
+            vj = VLoc( ALL, IR(perm[j]) );
+        }
+    }
+    s = sPerm;
+    XLoc = XPerm;
+    if( accumulate )
+        VLoc = VPerm;
+}
+
+inline Int DefaultBlocksize( Int n, int commSize, Int blocksize )
+{
+    if( blocksize > 0 )
+        return blocksize;
+    // Aim for at least as many pairs per round as there are processes
+    return Max( Min( Blocksize(), n/(2*Int(commSize)) ), Int(1) );
+}
+
+template<typename Real>
+Real DefaultTolerance( Int m, const JacobiSVDCtrl<Real>& ctrl )
+{
+    if( ctrl.tol > Real(0) )
+        return ctrl.tol;
+    return Sqrt(Real(Max(m,Int(1))))*limits::Epsilon<Real>();
+}
+
+inline void CheckApproach( SVDApproach approach )
+{
+    if( approach != THIN_SVD && approach != COMPACT_SVD )
+        LogicError("Jacobi SVD only supports thin and compact SVDs");
+}
+
+template<typename Field>
+SVDInfo Helper
+( Matrix<Field>& A,
+  Matrix<Field>& U,
+  Matrix<Base<Field>>& s,
+  Matrix<Field>& V,
+  bool vectors,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    CheckApproach( ctrl.bidiagSVDCtrl.approach );
+    if( m < n )
+    {
+        Matrix<Field> AAdj;
+        Adjoint( A, AAdj );
+        return Helper( AAdj, V, s, U, vectors, ctrl );
+    }
+    const auto& jacobiCtrl = ctrl.jacobiCtrl;
+
+    Matrix<Field> X, W;
+    Matrix<Field> householderScalars;
+    Matrix<Real> signature;
+    Permutation Omega;
+    if( jacobiCtrl.precondition )
+    {
+        QR( A, householderScalars, signature, Omega );
+        Adjoint( A(IR(0,n),ALL), X );
+        MakeTrapezoidal( LOWER, X );
+    }
+    else
+        X = A;
+    if( vectors )
+        Identity( W, n, n );
+
+    SVDInfo info;
+    const Int blocksize = DefaultBlocksize( n, 1, jacobiCtrl.blocksize );
+    const Real tol = DefaultTolerance( X.Height(), jacobiCtrl );
+    info.numJacobiSweeps =
+      Sweeps( X, W, vectors, blocksize, tol, mpi::COMM_SELF, jacobiCtrl );
+    Finalize( X, W, vectors, s, mpi::COMM_SELF );
+
+    const Int rank = CompactRank( m, n, s, ctrl );
+    s.Resize( rank, 1 );
+    if( !vectors )
+        return info;
+
+    if( jacobiCtrl.precondition )
+    {
+        // A Omega^T = Q R = Q (X W^H)^H = (Q W) diag(s) (Omega^T X)^H
+        Zeros( U, m, n );
+        auto UT = U( IR(0,n), ALL );
+        UT = W;
+        qr::ApplyQ( LEFT, NORMAL, A, householderScalars, signature, U );
+        Omega.InversePermuteRows( X );
+        V = X;
+    }
+    else
+    {
+        U = X;
+        V = W;
+    }
+    if( rank < n )
+    {
+        Matrix<Field> UTrunc( U(ALL,IR(0,rank)) ), VTrunc( V(ALL,IR(0,rank)) );
+        U = UTrunc;
+        V = VTrunc;
+    }
+    return info;
+}
+
+template<typename Field>
+SVDInfo Helper
+( AbstractDistMatrix<Field>& APre,
+  AbstractDistMatrix<Field>& UPre,
+  AbstractDistMatrix<Base<Field>>& sPre,
+  AbstractDistMatrix<Field>& VPre,
+  bool vectors,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    CheckApproach( ctrl.bidiagSVDCtrl.approach );
+    if( m < n )
+    {
+        DistMatrix<Field> AAdj( APre.Grid() );
+        Adjoint( APre, AAdj );
+        return Helper( AAdj, VPre, sPre, UPre, vectors, ctrl );
+    }
+    const auto& jacobiCtrl = ctrl.jacobiCtrl;
+
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+    const Grid& g = A.Grid();
+
+    DistMatrix<Field,VC,STAR> X(g), W(g);
+    DistMatrix<Field,MD,STAR> householderScalars(g);
+    DistMatrix<Real,MD,STAR> signature(g);
+    DistPermutation Omega(g);
+    if( jacobiCtrl.precondition )
+    {
+        QR( A, householderScalars, signature, Omega );
+        DistMatrix<Field> RAdj(g);
+        Adjoint( A(IR(0,n),ALL), RAdj );
+        MakeTrapezoidal( LOWER, RAdj );
+        X = RAdj;
+    }
+    else
+        X = A;
+    if( vectors )
+        Identity( W, n, n );
+
+    SVDInfo info;
+    const mpi::Comm comm = X.ColComm();
+    const Int blocksize =
+      DefaultBlocksize( n, mpi::Size(comm), jacobiCtrl.blocksize );
+    const Real tol = DefaultTolerance( X.Height(), jacobiCtrl );
+    Matrix<Real> sLoc;
+    info.numJacobiSweeps =
+      Sweeps
+      ( X.Matrix(), W.Matrix(), vectors, blocksize, tol, comm, jacobiCtrl );
+    Finalize( X.Matrix(), W.Matrix(), vectors, sLoc, comm );
+
+    const Int rank = CompactRank( m, n, sLoc, ctrl );
+    sLoc.Resize( rank, 1 );
+    {
+        DistMatrixWriteProxy<Real,Real,STAR,STAR> sProx( sPre );
+        auto& s = sProx.Get();
+        s.Resize( rank, 1 );
+        s.Matrix() = sLoc;
+    }
+    if( !vectors )
+        return info;
+
+    DistMatrixWriteProxy<Field,Field,MC,MR> UProx( UPre ), VProx( VPre );
+    auto& U = UProx.Get();
+    auto& V = VProx.Get();
+    if( jacobiCtrl.precondition )
+    {
+        // A Omega^T = Q R = Q (X W^H)^H = (Q W) diag(s) (Omega^T X)^H
+        Zeros( U, m, n );
+        auto UT = U( IR(0,n), ALL );
+        UT = W;
+        qr::ApplyQ( LEFT, NORMAL, A, householderScalars, signature, U );
+        V = X;
+        Omega.InversePermuteRows( V );
+    }
+    else
+    {
+        U = X;
+        V = W;
+    }
+    if( rank < n )
+    {
+        DistMatrix<Field> UTrunc( U(ALL,IR(0,rank)) ),
+                          VTrunc( V(ALL,IR(0,rank)) );
+        U = UTrunc;
+        V = VTrunc;
+    }
+    return info;
+}
+
+} // namespace jacobi
+
+template<typename Field>
+SVDInfo Jacobi
+( Matrix<Field>& A,
+  Matrix<Base<Field>>& s,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> U, V;
+    return jacobi::Helper( A, U, s, V, false, ctrl );
+}
+
+template<typename Field>
+SVDInfo Jacobi
+( Matrix<Field>& A,
+  Matrix<Field>& U,
+  Matrix<Base<Field>>& s,
+  Matrix<Field>& V,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return jacobi::Helper( A, U, s, V, true, ctrl );
+}
+
+template<typename Field>
+SVDInfo Jacobi
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Base<Field>>& s,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrix<Field> U( A.Grid() ), V( A.Grid() );
+    return jacobi::Helper( A, U, s, V, false, ctrl );
+}
+
+template<typename Field>
+SVDInfo Jacobi
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& U,
+  AbstractDistMatrix<Base<Field>>& s,
+  AbstractDistMatrix<Field>& V,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return jacobi::Helper( A, U, s, V, true, ctrl );
+}
+
+} // namespace svd
+} // namespace El
+
+#endif // ifndef EL_SVD_JACOBI_HPP
@@ -0,0 +1,225 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SVD_QDWH_HPP
+#define EL_SVD_QDWH_HPP
+
+// QDWH-SVD, due to Nakatsukasa and Higham: if A = U_p H is the polar
+// decomposition and H = V diag(s) V^H, then A = (U_p V) diag(s) V^H. Both the
+// polar decomposition (via QDWH) and the eigendecomposition (via spectral
+// divide and conquer with QDWH-eig) are built almost entirely from Gemm, QR,
+// and Cholesky, and so avoid the bidiagonal reduction.
+
+namespace El {
+namespace svd {
+
+template<typename Field>
+HermitianEigCtrl<Field> QDWHEigCtrl( const SVDCtrl<Base<Field>>& ctrl )
+{
+    HermitianEigCtrl<Field> hermCtrl;
+    hermCtrl.useSDC = true;
+    hermCtrl.sdcCtrl = ctrl.sdcCtrl;
+    hermCtrl.tridiagEigCtrl.sort = DESCENDING;
+    return hermCtrl;
+}
+
+inline PolarCtrl QDWHPolarCtrl( const QDWHCtrl& qdwhCtrl )
+{
+    PolarCtrl polarCtrl;
+    polarCtrl.qdwh = true;
+    polarCtrl.qdwhCtrl = qdwhCtrl;
+    return polarCtrl;
+}
+
+inline void CheckQDWHApproach( SVDApproach approach )
+{
+    if( approach != THIN_SVD && approach != COMPACT_SVD )
+        LogicError("QDWH-SVD only supports thin and compact SVDs");
+}
+
+template<typename Field>
+SVDInfo QDWH
+( Matrix<Field>& A,
+  Matrix<Base<Field>>& s,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    CheckQDWHApproach( ctrl.bidiagSVDCtrl.approach );
+    if( m < n )
+    {
+        Matrix<Field> AAdj;
+        Adjoint( A, AAdj );
+        return QDWH( AAdj, s, ctrl );
+    }
+
+    SVDInfo info;
+    Matrix<Field> H;
+    Polar( A, H, QDWHPolarCtrl(ctrl.qdwhCtrl) );
+    HermitianEig( LOWER, H, s, QDWHEigCtrl<Field>(ctrl) );
+
+    // H is only positive semi-definite to working precision
+    for( Int i=0; i<n; ++i )
+        s(i) = Abs(s(i));
+    Sort( s, DESCENDING );
+    s.Resize( CompactRank( m, n, s, ctrl ), 1 );
+    return info;
+}
+
+template<typename Field>
+SVDInfo QDWH
+( Matrix<Field>& A,
+  Matrix<Field>& U,
+  Matrix<Base<Field>>& s,
+  Matrix<Field>& V,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    CheckQDWHApproach( ctrl.bidiagSVDCtrl.approach );
+    if( m < n )
+    {
+        Matrix<Field> AAdj;
+        Adjoint( A, AAdj );
+        return QDWH( AAdj, V, s, U, ctrl );
+    }
+
+    SVDInfo info;
+    Matrix<Field> H;
+    Polar( A, H, QDWHPolarCtrl(ctrl.qdwhCtrl) );
+    HermitianEig( LOWER, H, s, V, QDWHEigCtrl<Field>(ctrl) );
+    Gemm( NORMAL, NORMAL, Field(1), A, V, U );
+
+    // H is only positive semi-definite to working precision, and any
+    // (tiny) negative eigenvalues are already ordered last
+    for( Int i=0; i<n; ++i )
+    {
+        if( s(i) < 0 )
+        {
+            s(i) = -s(i);
+            auto ui = U( ALL, IR(i) );
+            ui *= -1;
+        }
+    }
+
+    const Int rank = CompactRank( m, n, s, ctrl );
+    if( rank < n )
+    {
+        s.Resize( rank, 1 );
+        Matrix<Field> UTrunc( U(ALL,IR(0,rank)) ), VTrunc( V(ALL,IR(0,rank)) );
+        U = UTrunc;
+        V = VTrunc;
+    }
+    return info;
+}
+
+template<typename Field>
+SVDInfo QDWH
+( AbstractDistMatrix<Field>& APre,
+  AbstractDistMatrix<Base<Field>>& sPre,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    CheckQDWHApproach( ctrl.bidiagSVDCtrl.approach );
+    if( m < n )
+    {
+        DistMatrix<Field> AAdj( APre.Grid() );
+        Adjoint( APre, AAdj );
+        return QDWH( AAdj, sPre, ctrl );
+    }
+
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<Real,Real,STAR,STAR> sProx( sPre );
+    auto& A = AProx.Get();
+    auto& s = sProx.Get();
+
+    SVDInfo info;
+    DistMatrix<Field> H( A.Grid() );
+    Polar( A, H, QDWHPolarCtrl(ctrl.qdwhCtrl) );
+    HermitianEig( LOWER, H, s, QDWHEigCtrl<Field>(ctrl) );
+
+    auto& sLoc = s.Matrix();
+    for( Int i=0; i<n; ++i )
+        sLoc(i) = Abs(sLoc(i));
+    Sort( sLoc, DESCENDING );
+    const Int rank = CompactRank( m, n, sLoc, ctrl );
+    if( rank < n )
+    {
+        DistMatrix<Real,STAR,STAR> sTrunc( s(IR(0,rank),ALL) );
+        s = sTrunc;
+    }
+    return info;
+}
+
+template<typename Field>
+SVDInfo QDWH
+( AbstractDistMatrix<Field>& APre,
+  AbstractDistMatrix<Field>& UPre,
+  AbstractDistMatrix<Base<Field>>& sPre,
+  AbstractDistMatrix<Field>& VPre,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    CheckQDWHApproach( ctrl.bidiagSVDCtrl.approach );
+    if( m < n )
+    {
+        DistMatrix<Field> AAdj( APre.Grid() );
+        Adjoint( APre, AAdj );
+        return QDWH( AAdj, VPre, sPre, UPre, ctrl );
+    }
+
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<Field,Field,MC,MR> UProx( UPre ), VProx( VPre );
+    DistMatrixWriteProxy<Real,Real,STAR,STAR> sProx( sPre );
+    auto& A = AProx.Get();
+    auto& U = UProx.Get();
+    auto& V = VProx.Get();
+    auto& s = sProx.Get();
+
+    SVDInfo info;
+    DistMatrix<Field> H( A.Grid() );
+    Polar( A, H, QDWHPolarCtrl(ctrl.qdwhCtrl) );
+    HermitianEig( LOWER, H, s, V, QDWHEigCtrl<Field>(ctrl) );
+    Gemm( NORMAL, NORMAL, Field(1), A, V, U );
+
+    auto& sLoc = s.Matrix();
+    for( Int i=0; i<n; ++i )
+    {
+        if( sLoc(i) < 0 )
+        {
+            sLoc(i) = -sLoc(i);
+            auto ui = U( ALL, IR(i) );
+            ui *= -1;
+        }
+    }
+
+    const Int rank = CompactRank( m, n, sLoc, ctrl );
+    if( rank < n )
+    {
+        DistMatrix<Real,STAR,STAR> sTrunc( s(IR(0,rank),ALL) );
+        DistMatrix<Field> UTrunc( U(ALL,IR(0,rank)) ),
+                          VTrunc( V(ALL,IR(0,rank)) );
+        s = sTrunc;
+        U = UTrunc;
+        V = VTrunc;
+    }
+    return info;
+}
+
+} // namespace svd
+} // namespace El
+
+#endif // ifndef EL_SVD_QDWH_HPP
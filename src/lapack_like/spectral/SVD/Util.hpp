@@ -66,6 +66,23 @@ bool CheckScale( AbstractDistMatrix<Field>& A, Base<Field>& scale )
         return false;
 }
 
+// The number of singular values which a compact SVD should keep, i.e., those
+// above the a posteriori threshold
+template<typename Real>
+Int CompactRank
+( Int m, Int n, const Matrix<Real>& s, const SVDCtrl<Real>& ctrl )
+{
+    const Int k = s.Height();
+    if( ctrl.bidiagSVDCtrl.approach != COMPACT_SVD || k == 0 )
+        return k;
+    const Real thresh =
+      bidiag_svd::APosterioriThreshold( m, n, s(0), ctrl.bidiagSVDCtrl );
+    Int rank = 0;
+    while( rank < k && s(rank) > thresh )
+        ++rank;
+    return rank;
+}
+
 } // namespace svd
 } // namespace El
 
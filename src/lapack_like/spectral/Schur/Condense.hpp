@@ -21,13 +21,11 @@ void Condense
     EL_DEBUG_CSE
     Timer timer;
 
-    Matrix<F> householderScalars;
     if( ctrl.time )
         timer.Start();
-    Hessenberg( UPPER, A, householderScalars );
+    hessenberg::ExplicitCondensed( UPPER, A, ctrl.hessCtrl );
     if( ctrl.time )
         Output("  Hessenberg reduction: ",timer.Stop()," seconds");
-    MakeTrapezoidal( UPPER, A, -1 );
 
     if( ctrl.time )
         timer.Start();
@@ -57,10 +55,24 @@ void Condense
     Matrix<F> householderScalars;
     if( ctrl.time )
         timer.Start();
-    Hessenberg( UPPER, A, householderScalars );
-    if( ctrl.time )
-        Output("  Hessenberg reduction: ",timer.Stop()," seconds");
-    hessenberg::FormQ( UPPER, A, householderScalars, Q );
+    if( ctrl.hessCtrl.approach == HESSENBERG_TWO_STAGE )
+    {
+        Matrix<F> bulgeReflectors, bulgeScalars;
+        hessenberg::TwoStage
+        ( A, householderScalars, bulgeReflectors, bulgeScalars,
+          ctrl.hessCtrl );
+        if( ctrl.time )
+            Output("  Hessenberg reduction: ",timer.Stop()," seconds");
+        hessenberg::FormQ
+        ( A, householderScalars, bulgeReflectors, bulgeScalars, Q );
+    }
+    else
+    {
+        Hessenberg( UPPER, A, householderScalars );
+        if( ctrl.time )
+            Output("  Hessenberg reduction: ",timer.Stop()," seconds");
+        hessenberg::FormQ( UPPER, A, householderScalars, Q );
+    }
     MakeTrapezoidal( UPPER, A, -1 );
 
     auto hessSchurCtrl( ctrl.hessSchurCtrl );
@@ -93,7 +105,7 @@ void Condense
     // Reduce the matrix to upper-Hessenberg form in an elemental form
     if( ctrl.time && grid.Rank() == 0 )
         timer.Start();
-    hessenberg::ExplicitCondensed( UPPER, A );
+    hessenberg::ExplicitCondensed( UPPER, A, ctrl.hessCtrl );
     if( ctrl.time && grid.Rank() == 0 )
         Output("  Hessenberg reduction: ",timer.Stop()," seconds"); 
 
@@ -126,17 +138,29 @@ void Condense
     Timer timer;
 
     // Reduce A to upper-Hessenberg form
+    const bool twoStage = ( ctrl.hessCtrl.approach == HESSENBERG_TWO_STAGE );
     DistMatrix<F,STAR,STAR> householderScalars( A.Grid() );
+    DistMatrix<F> bulgeReflectors( A.Grid() );
+    DistMatrix<F,STAR,STAR> bulgeScalars( A.Grid() );
     if( ctrl.time && grid.Rank() == 0 )
         timer.Start();
-    Hessenberg( UPPER, A, householderScalars );
+    if( twoStage )
+        hessenberg::TwoStage
+        ( A, householderScalars, bulgeReflectors, bulgeScalars,
+          ctrl.hessCtrl );
+    else
+        Hessenberg( UPPER, A, householderScalars );
     if( ctrl.time && grid.Rank() == 0 )
         Output("  Hessenberg reduction: ",timer.Stop()," seconds");
 
     // Explicitly accumulate the Householder transformations into Q
     if( ctrl.time && grid.Rank() == 0 )
         timer.Start();
-    hessenberg::FormQ( UPPER, A, householderScalars, Q );
+    if( twoStage )
+        hessenberg::FormQ
+        ( A, householderScalars, bulgeReflectors, bulgeScalars, Q );
+    else
+        hessenberg::FormQ( UPPER, A, householderScalars, Q );
     if( ctrl.time && grid.Rank() == 0 )
         Output("  hessenberg::FormQ: ",timer.Stop()," seconds");
     MakeTrapezoidal( UPPER, A, -1 );
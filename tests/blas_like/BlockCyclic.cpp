@@ -0,0 +1,194 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Exercise the algorithms which work directly on conformally-blocked
+// [MC,MR] BLOCK matrices (the block-cyclic Trsm, Syrk and Cholesky) and
+// check them against residuals or the ELEMENT results. The block-cyclic Gemm
+// is checked by the Gemm test.
+
+template<typename F>
+void TestBlockTrsm
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  Int n,
+  Int numRHS,
+  Int blockSize,
+  const Grid& g )
+{
+    typedef Base<F> Real;
+    const Int m = ( side == LEFT ? n : numRHS );
+    const Int k = ( side == LEFT ? numRHS : n );
+
+    // Keep the triangle well-conditioned
+    DistMatrix<F> A(g), B(g);
+    Uniform( A, n, n );
+    ShiftDiagonal( A, F(n) );
+    DistMatrix<F> S( A );
+    MakeTrapezoidal( uplo, S );
+    if( diag == UNIT )
+        FillDiagonal( S, F(1) );
+    Uniform( B, m, k );
+
+    DistMatrix<F,MC,MR,BLOCK>
+      ABlock(g,blockSize,blockSize), XBlock(g,blockSize,blockSize);
+    ABlock = A;
+    XBlock = B;
+    const F alpha = F(3);
+    Trsm( side, uplo, orientation, diag, alpha, ABlock, XBlock, true );
+
+    // R := alpha B - op(S) X or alpha B - X op(S)
+    DistMatrix<F> X( XBlock ), R( B );
+    if( side == LEFT )
+        Gemm( orientation, NORMAL, F(-1), S, X, alpha, R );
+    else
+        Gemm( NORMAL, orientation, F(-1), X, S, alpha, R );
+    const Real relResid =
+      FrobeniusNorm( R ) /
+      (n*limits::Epsilon<Real>()*
+       Max(FrobeniusNorm(S)*FrobeniusNorm(X),Real(1)));
+    OutputFromRoot
+    (g.Comm(),"Trsm ",LeftOrRightToChar(side),UpperOrLowerToChar(uplo),
+     OrientationToChar(orientation),UnitOrNonUnitToChar(diag),
+     ": relative residual ",relResid);
+    if( relResid > Real(100) )
+        RuntimeError("Block-cyclic Trsm residual was too large");
+}
+
+template<typename F>
+void TestBlockSyrk
+( UpperOrLower uplo,
+  Orientation orientation,
+  bool conjugate,
+  Int n,
+  Int k,
+  Int blockSize,
+  const Grid& g )
+{
+    typedef Base<F> Real;
+    DistMatrix<F> A(g), C(g);
+    if( orientation == NORMAL )
+        Uniform( A, n, k );
+    else
+        Uniform( A, k, n );
+    Uniform( C, n, n );
+    MakeSymmetric( uplo, C, conjugate );
+
+    DistMatrix<F,MC,MR,BLOCK>
+      ABlock(g,blockSize,blockSize), CBlock(g,blockSize,blockSize);
+    ABlock = A;
+    CBlock = C;
+
+    const F alpha = F(2), beta = F(3);
+    Syrk( uplo, orientation, alpha, A, beta, C, conjugate );
+    Syrk( uplo, orientation, alpha, ABlock, beta, CBlock, conjugate );
+
+    // Only the updated triangle is meaningful
+    DistMatrix<F> E( CBlock );
+    E -= C;
+    MakeTrapezoidal( uplo, E );
+    MakeTrapezoidal( uplo, C );
+    const Real relError =
+      FrobeniusNorm( E ) /
+      (Max(k,Int(1))*limits::Epsilon<Real>()*Max(FrobeniusNorm(C),Real(1)));
+    OutputFromRoot
+    (g.Comm(),(conjugate ? "Herk " : "Syrk "),UpperOrLowerToChar(uplo),
+     OrientationToChar(orientation),
+     ": || C_BLOCK - C_ELEMENT ||_F / (k eps || C_ELEMENT ||_F) = ",relError);
+    if( relError > Real(100) )
+        RuntimeError("Block-cyclic Syrk does not match the ELEMENT result");
+}
+
+template<typename F>
+void TestBlockCholesky( UpperOrLower uplo, Int n, Int blockSize, const Grid& g )
+{
+    typedef Base<F> Real;
+    DistMatrix<F> A(g);
+    HermitianUniformSpectrum( A, n, 1, 10 );
+
+    DistMatrix<F,MC,MR,BLOCK> ABlock(g,blockSize,blockSize);
+    ABlock = A;
+    Cholesky( uplo, ABlock );
+
+    // E := A - L L^H or A - U^H U, restricted to the triangle
+    DistMatrix<F> T( ABlock ), E( A );
+    MakeTrapezoidal( uplo, T );
+    if( uplo == LOWER )
+        Herk( LOWER, NORMAL, Real(-1), T, Real(1), E );
+    else
+        Herk( UPPER, ADJOINT, Real(-1), T, Real(1), E );
+    MakeTrapezoidal( uplo, E );
+    const Real relResid =
+      FrobeniusNorm( E ) / (n*limits::Epsilon<Real>()*FrobeniusNorm( A ));
+    OutputFromRoot
+    (g.Comm(),"Cholesky ",UpperOrLowerToChar(uplo),": relative residual ",
+     relResid);
+    if( relResid > Real(100) )
+        RuntimeError("Block-cyclic Cholesky residual was too large");
+}
+
+template<typename F>
+void TestBlockCyclic( Int n, Int k, Int blockSize, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+    for( const auto side : {LEFT,RIGHT} )
+        for( const auto uplo : {LOWER,UPPER} )
+            for( const auto orientation : {NORMAL,TRANSPOSE,ADJOINT} )
+                for( const auto diag : {NON_UNIT,UNIT} )
+                    TestBlockTrsm<F>
+                    ( side, uplo, orientation, diag, n, k, blockSize, g );
+    for( const auto uplo : {LOWER,UPPER} )
+        for( const auto orientation : {NORMAL,TRANSPOSE} )
+            for( const bool conjugate : {false,true} )
+                TestBlockSyrk<F>
+                ( uplo, orientation, conjugate, n, k, blockSize, g );
+    for( const auto uplo : {LOWER,UPPER} )
+        TestBlockCholesky<F>( uplo, n, blockSize, g );
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const Int blockSize =
+          Input("--blockSize","distribution block size",8);
+        const Int n =
+          Input("--n","size of the triangular/Hermitian matrices",45);
+        const Int k = Input("--k","number of right-hand sides/rank",13);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const Grid g( comm, gridHeight );
+        ComplainIfDebug();
+
+        TestBlockCyclic<float>( n, k, blockSize, g );
+        TestBlockCyclic<Complex<float>>( n, k, blockSize, g );
+        TestBlockCyclic<double>( n, k, blockSize, g );
+        TestBlockCyclic<Complex<double>>( n, k, blockSize, g );
+    }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
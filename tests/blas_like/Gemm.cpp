@@ -43,6 +43,66 @@ void TestAssociativity
          EFrobNorm, "/", YFrobNorm, "=", EFrobNorm/YFrobNorm);
 }
 
+// Repeat the product with [MC,MR] BLOCK copies of the operands and compare
+// against the ELEMENT result
+template<typename T>
+void TestBlockGemm
+(Orientation orientA, Orientation orientB,
+ T alpha,
+ DistMatrix<T,MC,MR,ELEMENT,Device::CPU> const& A,
+ DistMatrix<T,MC,MR,ELEMENT,Device::CPU> const& B,
+ T beta,
+ DistMatrix<T,MC,MR,ELEMENT,Device::CPU> const& COrig,
+ Int blockSize,
+ bool print)
+{
+    typedef Base<T> Real;
+    const Grid& g = A.Grid();
+    OutputFromRoot(g.Comm(),"Block-cyclic algorithm:");
+    PushIndent();
+
+    DistMatrix<T> C(COrig);
+    Gemm(orientA, orientB, alpha, A, B, beta, C);
+
+    DistMatrix<T,MC,MR,BLOCK> ABlock(g, blockSize, blockSize),
+      BBlock(g, blockSize, blockSize), CBlock(g, blockSize, blockSize);
+    ABlock = A;
+    BBlock = B;
+    CBlock = COrig;
+    Timer timer;
+    mpi::Barrier(g.Comm());
+    timer.Start();
+    Gemm(orientA, orientB, alpha, ABlock, BBlock, beta, CBlock);
+    mpi::Barrier(g.Comm());
+    OutputFromRoot(g.Comm(),"Finished in ",timer.Stop()," seconds");
+    if (print)
+        Print(CBlock, "C computed from BLOCK operands");
+
+    const Int k = (orientA == NORMAL ? A.Width() : A.Height());
+    DistMatrix<T> E(CBlock);
+    E -= C;
+    const Real relError =
+        FrobeniusNorm(E) / (Max(k,Int(1))*limits::Epsilon<Real>()*
+                            Max(FrobeniusNorm(C),Real(1)));
+    OutputFromRoot
+        (g.Comm(),"|| C_BLOCK - C_ELEMENT ||_F / (k eps || C_ELEMENT ||_F) = ",
+         relError);
+    if (relError > Real(100))
+        RuntimeError("BLOCK Gemm does not match the ELEMENT result");
+    PopIndent();
+}
+
+template<typename T, Device D>
+void TestBlockGemm
+(Orientation, Orientation, T,
+ DistMatrix<T,MC,MR,ELEMENT,D> const& A,
+ DistMatrix<T,MC,MR,ELEMENT,D> const&, T,
+ DistMatrix<T,MC,MR,ELEMENT,D> const&, Int, bool)
+{
+    OutputFromRoot
+        (A.Grid().Comm(),"BLOCK matrices are only supported on the CPU");
+}
+
 template<typename T, Device D>
 void TestGemm
 (Orientation orientA,
@@ -51,6 +111,7 @@ void TestGemm
  T alpha, T beta,
  const Grid& g,
  bool print, bool correctness,
+ bool block, Int blockSize,
  Int colAlignA=0, Int rowAlignA=0,
  Int colAlignB=0, Int rowAlignB=0,
  Int colAlignC=0, Int rowAlignC=0)
@@ -163,6 +224,10 @@ void TestGemm
                 (orientA, orientB, alpha, A, B, beta, COrig, C, print);
         PopIndent();
     }
+
+    if (block)
+        TestBlockGemm
+            (orientA, orientB, alpha, A, B, beta, COrig, blockSize, print);
     PopIndent();
 }
 
@@ -184,6 +249,10 @@ main(int argc, char* argv[])
         const Int nb = Input("--nb","algorithmic blocksize",96);
         const bool print = Input("--print","print matrices?",false);
         const bool correctness = Input("--correctness","correctness?",true);
+        const bool block =
+            Input("--block","also test [MC,MR] BLOCK operands?",true);
+        const Int blockSize =
+            Input("--blockSize","distribution block size for --block",32);
         const Int colAlignA = Input("--colAlignA","column align of A",0);
         const Int colAlignB = Input("--colAlignB","column align of B",0);
         const Int colAlignC = Input("--colAlignC","column align of C",0);
@@ -216,6 +285,7 @@ main(int argc, char* argv[])
                  float(3), float(4),
                  g,
                  print, correctness,
+                 block, blockSize,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -225,6 +295,7 @@ main(int argc, char* argv[])
                  double(3), double(4),
                  g,
                  print, correctness,
+                 block, blockSize,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -240,6 +311,7 @@ main(int argc, char* argv[])
                  float(3), float(4),
                  g,
                  print, correctness,
+                 block, blockSize,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -249,6 +321,7 @@ main(int argc, char* argv[])
                  Complex<float>(3), Complex<float>(4),
                  g,
                  print, correctness,
+                 block, blockSize,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -259,6 +332,7 @@ main(int argc, char* argv[])
                  double(3), double(4),
                  g,
                  print, correctness,
+                 block, blockSize,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -268,6 +342,7 @@ main(int argc, char* argv[])
                  Complex<double>(3), Complex<double>(4),
                  g,
                  print, correctness,
+                 block, blockSize,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -279,6 +354,7 @@ main(int argc, char* argv[])
                  DoubleDouble(3), DoubleDouble(4),
                  g,
                  print, correctness,
+                 block, blockSize,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -288,6 +364,7 @@ main(int argc, char* argv[])
                  QuadDouble(3), QuadDouble(4),
                  g,
                  print, correctness,
+                 block, blockSize,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -298,6 +375,7 @@ main(int argc, char* argv[])
                  Complex<DoubleDouble>(3), Complex<DoubleDouble>(4),
                  g,
                  print, correctness,
+                 block, blockSize,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -307,6 +385,7 @@ main(int argc, char* argv[])
                  Complex<QuadDouble>(3), Complex<QuadDouble>(4),
                  g,
                  print, correctness,
+                 block, blockSize,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -319,6 +398,7 @@ main(int argc, char* argv[])
                  Quad(3), Quad(4),
                  g,
                  print, correctness,
+                 block, blockSize,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -328,6 +408,7 @@ main(int argc, char* argv[])
                  Complex<Quad>(3), Complex<Quad>(4),
                  g,
                  print, correctness,
+                 block, blockSize,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -340,6 +421,7 @@ main(int argc, char* argv[])
                  BigFloat(3), BigFloat(4),
                  g,
                  print, correctness,
+                 block, blockSize,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -349,6 +431,7 @@ main(int argc, char* argv[])
                  Complex<BigFloat>(3), Complex<BigFloat>(4),
                  g,
                  print, correctness,
+                 block, blockSize,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -0,0 +1,139 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+#include <El.hpp>
+using namespace El;
+
+template <typename T>
+void CheckClose(Base<T> got, Base<T> expected, Int n, const char* name)
+{
+  typedef Base<T> Real;
+  const Real tol = 10 * n * limits::Epsilon<Real>();
+  if (Abs(got - expected) > tol * Max(Abs(expected), Real(1)))
+  {
+    Output(name, " does not match, got=", got, " instead of ", expected);
+    RuntimeError("got != expected");
+  }
+}
+
+template <typename T>
+void CheckClose(Complex<Base<T>> got, Complex<Base<T>> expected, Int n,
+                const char* name)
+{
+  typedef Base<T> Real;
+  const Real tol = 10 * n * limits::Epsilon<Real>();
+  if (Abs(got - expected) > tol * Max(Abs(expected), Real(1)))
+  {
+    Output(name, " does not match, got=", got, " instead of ", expected);
+    RuntimeError("got != expected");
+  }
+}
+
+template <typename T>
+void TestScalarReductions(Int m, Int n, const Grid& g, bool print)
+{
+  typedef Base<T> Real;
+  DistMatrix<T> A(g), B(g), C(g);
+  Uniform(A, m, n);
+  Uniform(B, m, n);
+  // The squares of the entries of C overflow
+  C = A;
+  C *= Pow(limits::Max<Real>(), Real(3) / Real(4));
+  if (print)
+  {
+    Print(A, "A");
+    Print(B, "B");
+  }
+
+  MultiReduction<T> batch;
+  const Int dotInd = batch.AddDot(A, B);
+  const Int normInd = batch.AddFrobeniusNorm(A);
+  const Int bigNormInd = batch.AddFrobeniusNorm(C);
+  const Int maxInd = batch.AddMaxAbs(B);
+  batch.StartReduce();
+  batch.FinishReduce();
+
+  CheckClose<T>(batch.Dot(dotInd), Dot(A, B), m * n, "Dot");
+  CheckClose<T>(batch.FrobeniusNorm(normInd), FrobeniusNorm(A), m * n,
+                "FrobeniusNorm");
+  const Real bigNorm = FrobeniusNorm(C);
+  if (!limits::IsFinite(batch.FrobeniusNorm(bigNormInd)))
+    RuntimeError("FrobeniusNorm of a large matrix overflowed");
+  CheckClose<T>(batch.FrobeniusNorm(bigNormInd) / bigNorm, Real(1), m * n,
+                "Scaled FrobeniusNorm");
+  if (batch.MaxAbs(maxInd) != MaxAbs(B))
+    RuntimeError("MaxAbs does not match");
+  if (print)
+    OutputFromRoot(g.Comm(), "dot=", batch.Dot(dotInd),
+                   ", norm=", batch.FrobeniusNorm(normInd),
+                   ", maxAbs=", batch.MaxAbs(maxInd));
+}
+
+template <typename T>
+void TestColumnReductions(Int m, Int n, const Grid& g, bool print)
+{
+  typedef Base<T> Real;
+  DistMatrix<T, VC, STAR> X(g), Y(g);
+  Uniform(X, m, n);
+  Uniform(Y, m, n);
+
+  MultiReduction<T> batch;
+  const Int dotsInd = batch.AddColumnDots(X, Y);
+  const Int normsInd = batch.AddColumnTwoNorms(X);
+  batch.Reduce();
+  const auto& dots = batch.ColumnDots(dotsInd);
+  const auto& norms = batch.ColumnTwoNorms(normsInd);
+  if (print)
+  {
+    Print(dots, "column dots");
+    Print(norms, "column norms");
+  }
+
+  DistMatrix<Real, STAR, STAR> normsSep(g);
+  ColumnTwoNorms(X, normsSep);
+  for (Int j = 0; j < X.LocalWidth(); ++j)
+  {
+    CheckClose<T>(dots(j), Dot(X(ALL, IR(j)), Y(ALL, IR(j))), m,
+                  "Column dot");
+    CheckClose<T>(norms(j), normsSep.GetLocal(j, 0), m, "Column norm");
+  }
+}
+
+template <typename T>
+void TestMultiReduction(Int m, Int n, const Grid& g, bool print)
+{
+  OutputFromRoot(g.Comm(), "Testing with ", TypeName<T>());
+  TestScalarReductions<T>(m, n, g, print);
+  TestColumnReductions<T>(m, n, g, print);
+}
+
+int main(int argc, char** argv)
+{
+  Environment env(argc, argv);
+  mpi::Comm comm = mpi::COMM_WORLD;
+  try
+  {
+    const Int m = Input("--m", "height", 100);
+    const Int n = Input("--n", "width", 20);
+    const bool print = Input("--print", "print matrices?", false);
+    ProcessInput();
+    PrintInputReport();
+
+    const Grid g(comm);
+    OutputFromRoot(comm, "Testing fused reductions against separate ones");
+    TestMultiReduction<float>(m, n, g, print);
+    TestMultiReduction<Complex<float>>(m, n, g, print);
+    TestMultiReduction<double>(m, n, g, print);
+    TestMultiReduction<Complex<double>>(m, n, g, print);
+  }
+  catch (exception& e)
+  {
+    ReportException(e);
+  }
+}
@@ -0,0 +1,191 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Solve op(A) X = alpha B with the given algorithm and return
+// || alpha B - op(S) X ||_F / (n eps || S ||_F || X ||_F), where S is the
+// triangle of A which is actually used
+template<typename F>
+Base<F> TrsmResidual
+( UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  F alpha,
+  const DistMatrix<F>& A,
+  const DistMatrix<F>& S,
+  const DistMatrix<F>& B,
+        DistMatrix<F>& X,
+  TrsmAlgorithm alg )
+{
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    X = B;
+    Trsm( LEFT, uplo, orientation, diag, alpha, A, X, false, alg );
+
+    DistMatrix<F> R( B );
+    Gemm( orientation, NORMAL, F(-1), S, X, alpha, R );
+    const Real SFrob = FrobeniusNorm( S );
+    const Real XFrob = FrobeniusNorm( X );
+    return FrobeniusNorm( R ) /
+      (Max(n,Int(1))*limits::Epsilon<Real>()*Max(SFrob*XFrob,Real(1)));
+}
+
+template<typename F>
+void TestPipelinedTrsm
+( UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  Int n,
+  Int numRHS,
+  const Grid& g,
+  bool print )
+{
+    typedef Base<F> Real;
+    OutputFromRoot
+    (g.Comm(),"Testing ",UpperOrLowerToChar(uplo),
+     OrientationToChar(orientation),UnitOrNonUnitToChar(diag)," with n=",n);
+    PushIndent();
+
+    // Keep the triangle well-conditioned so that the solutions of the
+    // different algorithms can also be compared directly
+    DistMatrix<F> A(g), B(g);
+    Uniform( A, n, n );
+    ShiftDiagonal( A, F(n) );
+    DistMatrix<F> S( A );
+    MakeTrapezoidal( uplo, S );
+    if( diag == UNIT )
+        FillDiagonal( S, F(1) );
+    Uniform( B, n, numRHS );
+    if( print )
+    {
+        Print( S, "S" );
+        Print( B, "B" );
+    }
+
+    const F alpha = F(3);
+    DistMatrix<F> X(g), XRef(g);
+    const Real pipeResid =
+      TrsmResidual
+      ( uplo, orientation, diag, alpha, A, S, B, X, TRSM_PIPELINED );
+    if( print )
+        Print( X, "X from the pipelined solve" );
+    OutputFromRoot(g.Comm(),"Pipelined relative residual: ",pipeResid);
+    if( pipeResid > Real(100) )
+        RuntimeError("Pipelined Trsm residual was too large");
+
+    const vector<std::pair<TrsmAlgorithm,string>> refAlgs =
+      { {TRSM_MEDIUM,"Medium"}, {TRSM_SMALL,"Small"} };
+    for( const auto& refAlg : refAlgs )
+    {
+        const Real refResid =
+          TrsmResidual
+          ( uplo, orientation, diag, alpha, A, S, B, XRef, refAlg.first );
+        DistMatrix<F> E( X );
+        E -= XRef;
+        const Real relDiff =
+          FrobeniusNorm( E ) /
+          (n*limits::Epsilon<Real>()*Max(FrobeniusNorm(XRef),Real(1)));
+        OutputFromRoot
+        (g.Comm(),refAlg.second," relative residual: ",refResid,
+         ", || X - X_",refAlg.second,"||_F / (n eps || X_",refAlg.second,
+         " ||_F) = ",relDiff);
+        if( refResid > Real(100) || relDiff > Real(100) )
+            RuntimeError
+            ("Pipelined Trsm does not match the ",refAlg.second," algorithm");
+    }
+
+    PopIndent();
+}
+
+// A zero on the diagonal must be reported on every process rather than only
+// on the one which solves against the corresponding diagonal block
+template<typename F>
+void TestSingular( UpperOrLower uplo, Int n, Int numRHS, const Grid& g )
+{
+    DistMatrix<F> A(g), B(g);
+    Uniform( A, n, n );
+    ShiftDiagonal( A, F(n) );
+    A.Set( n/2, n/2, F(0) );
+    Uniform( B, n, numRHS );
+
+    int caught = 0;
+    try
+    {
+        Trsm
+        ( LEFT, uplo, NORMAL, NON_UNIT, F(1), A, B, true, TRSM_PIPELINED );
+    }
+    catch( SingularMatrixException& ) { caught = 1; }
+    const int numCaught = mpi::AllReduce( caught, g.Comm() );
+    if( numCaught != g.Size() )
+        RuntimeError
+        ("Only ",numCaught," of ",g.Size(),
+         " processes detected the singular matrix");
+    OutputFromRoot(g.Comm(),"All processes detected the singular matrix");
+}
+
+template<typename F>
+void TestAll( const vector<Int>& sizes, Int numRHS, const Grid& g, bool print )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing with ",TypeName<F>()," on a ",g.Height()," x ",
+     g.Width()," grid");
+    PushIndent();
+    for( const Int n : sizes )
+        for( const auto uplo : {LOWER,UPPER} )
+            for( const auto orientation : {NORMAL,TRANSPOSE,ADJOINT} )
+                for( const auto diag : {NON_UNIT,UNIT} )
+                    TestPipelinedTrsm<F>
+                    ( uplo, orientation, diag, n, numRHS, g, print );
+    for( const auto uplo : {LOWER,UPPER} )
+        TestSingular<F>( uplo, sizes.back(), numRHS, g );
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int nb = Input("--nb","algorithmic blocksize",8);
+        const Int nSmall =
+          Input("--nSmall","size with fewer blocks than processes",2*nb+3);
+        const Int nLarge = Input("--nLarge","size with many blocks",11*nb+5);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",3);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        // Neither size is a multiple of the blocksize, and the first leaves
+        // some processes without a diagonal block to solve against
+        const vector<Int> sizes = { nSmall, nLarge };
+        const Grid g( comm );
+        const Grid gRow( comm, 1 );
+        for( const Grid* grid : {&g,&gRow} )
+        {
+            TestAll<float>( sizes, numRHS, *grid, print );
+            TestAll<Complex<float>>( sizes, numRHS, *grid, print );
+            TestAll<double>( sizes, numRHS, *grid, print );
+            TestAll<Complex<double>>( sizes, numRHS, *grid, print );
+        }
+    }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
@@ -19,7 +19,8 @@ void TestTrsm
   Int n,
   F alpha,
   const Grid& g,
-  bool print )
+  bool print,
+  bool pipelined )
 {
     OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
     PushIndent();
@@ -53,7 +54,9 @@ void TestTrsm
     mpi::Barrier( g.Comm() );
     Timer timer;
     timer.Start();
-    Trsm( side, uplo, orientation, diag, alpha, A, Y );
+    Trsm
+    ( side, uplo, orientation, diag, alpha, A, Y, false,
+      pipelined ? TRSM_PIPELINED : TRSM_DEFAULT );
     mpi::Barrier( g.Comm() );
     const double runTime = timer.Stop();
     const double realGFlops =
@@ -98,6 +101,8 @@ main( int argc, char* argv[] )
         const Int n = Input("--n","width of result",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
         const bool print = Input("--print","print matrices?",false);
+        const bool pipelined =
+          Input("--pipelined","force the pipelined algorithm?",false);
         ProcessInput();
         PrintInputReport();
 
@@ -110,6 +115,10 @@ main( int argc, char* argv[] )
         const Orientation orientation = CharToOrientation( transChar );
         const UnitOrNonUnit diag = CharToUnitOrNonUnit( diagChar );
         SetBlocksize( nb );
+        if( pipelined && side == RIGHT )
+            LogicError
+            ("--pipelined requires --side L since TRSM_PIPELINED only "
+             "supports left solves");
 
         ComplainIfDebug();
         OutputFromRoot
@@ -119,46 +128,46 @@ main( int argc, char* argv[] )
         ( side, uplo, orientation, diag,
           m, n,
           float(3),
-          g, print );
+          g, print, pipelined );
         TestTrsm<Complex<float>>
         ( side, uplo, orientation, diag,
           m, n,
           Complex<float>(3),
-          g, print );
+          g, print, pipelined );
 
         TestTrsm<double>
         ( side, uplo, orientation, diag,
           m, n,
           double(3),
-          g, print );
+          g, print, pipelined );
         TestTrsm<Complex<double>>
         ( side, uplo, orientation, diag,
           m, n,
           Complex<double>(3),
-          g, print );
+          g, print, pipelined );
 
 #ifdef EL_HAVE_QD
         TestTrsm<DoubleDouble>
         ( side, uplo, orientation, diag,
           m, n,
           DoubleDouble(3),
-          g, print );
+          g, print, pipelined );
         TestTrsm<QuadDouble>
         ( side, uplo, orientation, diag,
           m, n,
           QuadDouble(3),
-          g, print );
+          g, print, pipelined );
 
         TestTrsm<Complex<DoubleDouble>>
         ( side, uplo, orientation, diag,
           m, n,
           Complex<DoubleDouble>(3),
-          g, print );
+          g, print, pipelined );
         TestTrsm<Complex<QuadDouble>>
         ( side, uplo, orientation, diag,
           m, n,
           Complex<QuadDouble>(3),
-          g, print );
+          g, print, pipelined );
 #endif
 
 #ifdef EL_HAVE_QUAD
@@ -166,12 +175,12 @@ main( int argc, char* argv[] )
         ( side, uplo, orientation, diag,
           m, n,
           Quad(3),
-          g, print );
+          g, print, pipelined );
         TestTrsm<Complex<Quad>>
         ( side, uplo, orientation, diag,
           m, n,
           Complex<Quad>(3),
-          g, print );
+          g, print, pipelined );
 #endif
 
 #ifdef EL_HAVE_MPC
@@ -179,12 +188,12 @@ main( int argc, char* argv[] )
         ( side, uplo, orientation, diag,
           m, n,
           BigFloat(3),
-          g, print );
+          g, print, pipelined );
         TestTrsm<Complex<BigFloat>>
         ( side, uplo, orientation, diag,
           m, n,
           Complex<BigFloat>(3),
-          g, print );
+          g, print, pipelined );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
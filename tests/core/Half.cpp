@@ -0,0 +1,126 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void TestRounding()
+{
+    Output("Testing rounding of ",TypeName<T>());
+    PushIndent();
+    // Every finite 16-bit pattern must survive a trip through float
+    for( Unsigned bits=0; bits<65536; ++bits )
+    {
+        const T alpha = T::FromBits( std::uint16_t(bits) );
+        const float alphaFloat = alpha;
+        if( std::isnan(alphaFloat) )
+            continue;
+        const T beta( alphaFloat );
+        if( beta.bits != alpha.bits )
+            LogicError
+            ("Bit pattern ",bits," became ",beta.bits," after widening");
+    }
+
+    // Halfway cases round to the neighbor with an even mantissa
+    const float eps = limits::Precision<T>();
+    const float up = T( 1.f + eps/2 );
+    const float down = T( 1.f + 3*eps/2 );
+    if( up != 1.f || down != 1.f + 2*eps )
+        LogicError("Ties were not rounded to even");
+    if( !std::isinf( float(T(2*float(limits::Max<T>()))) ) )
+        LogicError("Overflow did not round to infinity");
+    Output("epsilon=",limits::Epsilon<T>(),", max=",limits::Max<T>());
+    PopIndent();
+}
+
+template<typename T>
+void TestGemm( const Grid& g, Int m, Int n, Int k )
+{
+    OutputFromRoot(g.Comm(),"Testing Gemm with ",TypeName<T>());
+    PushIndent();
+
+    // The inputs are representable in 16 bits, so the product should match
+    // the single-precision one up to the final rounding (and the difference
+    // in accumulation order)
+    Matrix<float> AFloat, BFloat, CFloat;
+    Uniform( AFloat, m, k );
+    Uniform( BFloat, k, n );
+    Matrix<T> A, B, C;
+    Copy( AFloat, A );
+    Copy( BFloat, B );
+    Copy( A, AFloat );
+    Copy( B, BFloat );
+    C.Resize( m, n );
+    Gemm( NORMAL, NORMAL, T(1), A, B, T(0), C );
+    Gemm( NORMAL, NORMAL, 1.f, AFloat, BFloat, CFloat );
+    const float CFrob = FrobeniusNorm( CFloat );
+    Matrix<float> CWidened;
+    Copy( C, CWidened );
+    CWidened -= CFloat;
+    const float relErr =
+      FrobeniusNorm( CWidened ) / (float(limits::Epsilon<T>())*CFrob);
+    Output("|| C - CFloat ||_F / (eps || CFloat ||_F) = ",relErr);
+    if( relErr > 2.f )
+        LogicError("Sequential Gemm did not accumulate in single precision");
+
+    DistMatrix<float> ADistFloat(g), BDistFloat(g), CDistFloat(g);
+    Uniform( ADistFloat, m, k );
+    Uniform( BDistFloat, k, n );
+    DistMatrix<T> ADist(g), BDist(g), CDist(g);
+    Copy( ADistFloat, ADist );
+    Copy( BDistFloat, BDist );
+    Copy( ADist, ADistFloat );
+    Copy( BDist, BDistFloat );
+    Gemm( NORMAL, NORMAL, T(1), ADist, BDist, CDist );
+    Gemm( NORMAL, NORMAL, 1.f, ADistFloat, BDistFloat, CDistFloat );
+    const float CDistFrob = FrobeniusNorm( CDistFloat );
+    DistMatrix<float> CDistWidened(g);
+    Copy( CDist, CDistWidened );
+    CDistWidened -= CDistFloat;
+    const float distRelErr =
+      FrobeniusNorm( CDistWidened ) / (float(limits::Epsilon<T>())*CDistFrob);
+    OutputFromRoot
+    (g.Comm(),"|| CDist - CDistFloat ||_F / (eps || CDistFloat ||_F) = ",
+     distRelErr);
+    if( distRelErr > 2.f )
+        LogicError("Distributed Gemm did not accumulate in single precision");
+
+    // Reductions are performed in float through user-defined operations
+    const T sum = mpi::AllReduce( T(1), g.Comm() );
+    if( float(sum) != float(mpi::Size(g.Comm())) )
+        LogicError("AllReduce returned ",float(sum));
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of C",100);
+        const Int n = Input("--n","width of C",100);
+        const Int k = Input("--k","inner dimension",100);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        if( mpi::Rank(comm) == 0 )
+        {
+            TestRounding<Half>();
+            TestRounding<BFloat16>();
+        }
+        TestGemm<Half>( g, m, n, k );
+        TestGemm<BFloat16>( g, m, n, k );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
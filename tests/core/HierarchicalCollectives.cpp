@@ -0,0 +1,136 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Run the same collectives with and without the node-aware algorithms and
+// demand bitwise-identical results
+
+template<typename T>
+void TestCollectives( mpi::Comm comm, int n )
+{
+    OutputFromRoot(comm,"Testing collectives with ",TypeName<T>());
+    PushIndent();
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    Int numErrors = 0;
+
+    vector<T> sendBuf( n*commSize );
+    for( int i=0; i<n*commSize; ++i )
+        sendBuf[i] = T(commRank*n*commSize+i);
+
+    vector<T> gathered[2], exchanged[2], reduced[2];
+    for( int hier=0; hier<2; ++hier )
+    {
+        mpi::SetHierarchicalCollectives( hier == 1 );
+
+        gathered[hier].resize( n*commSize );
+        mpi::AllGather( sendBuf.data(), n, gathered[hier].data(), n, comm );
+
+        exchanged[hier].resize( n*commSize );
+        mpi::AllToAll( sendBuf.data(), n, exchanged[hier].data(), n, comm );
+
+        vector<T> reduceBuf( sendBuf );
+        reduced[hier].resize( n );
+        mpi::ReduceScatter
+        ( reduceBuf.data(), reduced[hier].data(), n, mpi::SUM, comm );
+
+        for( int root=0; root<commSize; ++root )
+        {
+            vector<T> buf( n, T(commRank == root ? root+1 : 0) );
+            mpi::Broadcast( buf.data(), n, root, comm );
+            for( int i=0; i<n; ++i )
+                if( buf[i] != T(root+1) )
+                    ++numErrors;
+        }
+    }
+    if( gathered[0] != gathered[1] )
+        ++numErrors;
+    if( exchanged[0] != exchanged[1] )
+        ++numErrors;
+    if( reduced[0] != reduced[1] )
+        ++numErrors;
+
+    numErrors = mpi::AllReduce( numErrors, comm );
+    if( numErrors != 0 )
+        LogicError("Hierarchical collectives differed from the flat ones");
+    OutputFromRoot(comm,"Collectives agreed");
+    PopIndent();
+}
+
+template<typename F>
+void TestRedistributions( const Grid& g, Int m, Int n )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing redistributions with ",TypeName<F>());
+    PushIndent();
+    typedef Base<F> Real;
+
+    DistMatrix<F> A(g);
+    Uniform( A, m, n );
+    const int commRank = mpi::Rank( g.Comm() );
+
+    DistMatrix<F> B[2] = { DistMatrix<F>(g), DistMatrix<F>(g) };
+    DistMatrix<F> C[2] = { DistMatrix<F>(g), DistMatrix<F>(g) };
+    for( int hier=0; hier<2; ++hier )
+    {
+        mpi::SetHierarchicalCollectives( hier == 1 );
+        DistMatrix<F,VC,STAR> A_VC_STAR( A );
+        DistMatrix<F,STAR,STAR> A_STAR_STAR( A_VC_STAR );
+        DistMatrix<F,MR,MC> A_MR_MC( A_STAR_STAR );
+        B[hier] = A_MR_MC;
+
+        // Queued updates are exchanged with a sparse all-to-all
+        Zeros( C[hier], m, n );
+        C[hier].Reserve( n );
+        for( Int j=0; j<n; ++j )
+            C[hier].QueueUpdate( (commRank+j) % m, j, F(commRank+1) );
+        C[hier].ProcessQueues();
+    }
+
+    B[1] -= B[0];
+    const Real redistErr = FrobeniusNorm( B[1] );
+    OutputFromRoot(g.Comm(),"|| B_hier - B_flat ||_F = ",redistErr);
+    if( redistErr != Real(0) )
+        LogicError("Hierarchical redistribution was incorrect");
+
+    C[1] -= C[0];
+    const Real queueErr = FrobeniusNorm( C[1] );
+    OutputFromRoot(g.Comm(),"|| C_hier - C_flat ||_F = ",queueErr);
+    if( queueErr != Real(0) )
+        LogicError("Hierarchical sparse all-to-all was incorrect");
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","local buffer size",100);
+        const Int m = Input("--m","matrix height",200);
+        ProcessInput();
+        PrintInputReport();
+
+        const bool hierarchical = mpi::HierarchicalCollectives();
+        TestCollectives<float>( comm, n );
+        TestCollectives<Complex<double>>( comm, n );
+        TestCollectives<Int>( comm, n );
+
+        const Grid g( comm );
+        TestRedistributions<double>( g, m, m/2 );
+        TestRedistributions<Complex<float>>( g, m, m/2 );
+        mpi::SetHierarchicalCollectives( hierarchical );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
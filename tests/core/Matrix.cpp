@@ -38,6 +38,47 @@ void TestMatrix( Int m, Int n, Int ldim )
     Output("passed");
 }
 
+template<typename T>
+void TestMemoryModes( Int n )
+{
+    Output("Testing CPU memory modes with ",TypeName<T>());
+    PushIndent();
+    Output(numa::NumDomains()," NUMA domains",
+      ( numa::Available() ? "" : " (placement unavailable)" ));
+
+    Matrix<T> B;
+    Uniform( B, n, n );
+    const unsigned modes[] =
+      { CPU_MEMORY_INTERLEAVED, CPU_MEMORY_FIRST_TOUCH,
+        BoundCPUMemoryMode(numa::NumDomains()-1) };
+    for( const unsigned mode : modes )
+    {
+        Matrix<T> A;
+        A.SetMemoryMode( mode );
+        A.Resize( n, n );
+        if( A.MemoryMode() != mode )
+            LogicError("Memory mode was not preserved by Resize");
+        // Large buffers are value-initialized by the parallel first touch
+        if( n*n*Int(sizeof(T)) >= (1 << 16) )
+            for( Int j=0; j<n; ++j )
+                for( Int i=0; i<n; ++i )
+                    if( A.Get(i,j) != T(0) )
+                        LogicError("Buffer was not initialized in mode ",mode);
+        Copy( B, A );
+        A -= B;
+        if( MaxNorm( A ) != Base<T>(0) )
+            LogicError("Copy into mode ",mode," was incorrect");
+    }
+
+    SetDefaultCPUMemoryMode( CPU_MEMORY_INTERLEAVED );
+    Matrix<T> C( n, n );
+    SetDefaultCPUMemoryMode( CPU_MEMORY_DEFAULT );
+    if( C.MemoryMode() != CPU_MEMORY_INTERLEAVED )
+        LogicError("Default CPU memory mode was not used");
+    PopIndent();
+    Output("passed");
+}
+
 int 
 main( int argc, char* argv[] )
 {
@@ -58,6 +99,9 @@ main( int argc, char* argv[] )
             TestMatrix<double>( m, n, ldim );
             TestMatrix<Complex<double>>( m, n, ldim );
 
+            TestMemoryModes<float>( Max(m,n) );
+            TestMemoryModes<Complex<double>>( Max(m,n) );
+
 #ifdef EL_HAVE_QD
             TestMatrix<DoubleDouble>( m, n, ldim );
             TestMatrix<QuadDouble>( m, n, ldim );
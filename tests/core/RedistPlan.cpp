@@ -0,0 +1,137 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Reuse a single redistribution plan for several different fills of A and
+// demand that each result exactly matches both Copy and the fill itself
+
+template<typename T>
+T FillEntry( Int i, Int j, Int m, Int fill )
+{ return T(i+m*j+fill); }
+
+template<typename T>
+void TestPlan
+( const string& name,
+  const Grid& g,
+  Int m,
+  Int n,
+  Int numReuses,
+  AbstractDistMatrix<T>& B,
+  AbstractDistMatrix<T>& BCopy )
+{
+    OutputFromRoot(g.Comm(),"Testing [MC,MR] -> ",name);
+    PushIndent();
+    DistMatrix<T> A(g);
+    Zeros( A, m, n );
+
+    RedistPlan<T> plan( A, B );
+    OutputFromRoot
+    (g.Comm(),"Root has ",plan.NumSendNeighbors()," send and ",
+     plan.NumRecvNeighbors()," receive neighbors");
+    Int numErrors = 0;
+    for( Int fill=0; fill<=numReuses; ++fill )
+    {
+        // The last execution changes the height, which forces a rebuild
+        const Int height = ( fill == numReuses ? m+1 : m );
+        auto fillFunc =
+          [&]( Int i, Int j ) { return FillEntry<T>( i, j, height, fill ); };
+        A.Resize( height, n );
+        IndexDependentFill( A, function<T(Int,Int)>(fillFunc) );
+
+        Copy( A, B, plan );
+        Copy( A, BCopy );
+
+        if( B.Height() != height || B.Width() != n )
+            ++numErrors;
+        else if( B.Participating() )
+        {
+            for( Int jLoc=0; jLoc<B.LocalWidth(); ++jLoc )
+            {
+                const Int j = B.GlobalCol(jLoc);
+                for( Int iLoc=0; iLoc<B.LocalHeight(); ++iLoc )
+                {
+                    const Int i = B.GlobalRow(iLoc);
+                    if( B.GetLocal(iLoc,jLoc) != fillFunc(i,j) )
+                        ++numErrors;
+                }
+            }
+        }
+
+        DistMatrix<T> E( B ), ECopy( BCopy );
+        E -= ECopy;
+        if( MaxNorm( E ) != Base<T>(0) )
+            ++numErrors;
+    }
+    numErrors = mpi::AllReduce( numErrors, g.Comm() );
+    if( numErrors != 0 )
+        LogicError("Reused redistribution plan disagreed with Copy");
+    OutputFromRoot(g.Comm(),"Plan agreed with Copy");
+    PopIndent();
+}
+
+template<typename T>
+void TestPlans( const Grid& g, Int m, Int n, Int numReuses, Int blockSize )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+    {
+        DistMatrix<T,MR,MC> B(g), BCopy(g);
+        TestPlan<T>( "[MR,MC]", g, m, n, numReuses, B, BCopy );
+    }
+    {
+        DistMatrix<T,VC,STAR> B(g), BCopy(g);
+        TestPlan<T>( "[VC,STAR]", g, m, n, numReuses, B, BCopy );
+    }
+    {
+        DistMatrix<T,STAR,STAR> B(g), BCopy(g);
+        TestPlan<T>( "[STAR,STAR]", g, m, n, numReuses, B, BCopy );
+    }
+    {
+        DistMatrix<T> B(g), BCopy(g);
+        B.Align( 1 % g.Height(), 1 % g.Width() );
+        BCopy.Align( 1 % g.Height(), 1 % g.Width() );
+        TestPlan<T>( "realigned [MC,MR]", g, m, n, numReuses, B, BCopy );
+    }
+    {
+        DistMatrix<T,MC,MR,BLOCK>
+          B(g,blockSize,blockSize), BCopy(g,blockSize,blockSize);
+        TestPlan<T>( "[MC,MR,BLOCK]", g, m, n, numReuses, B, BCopy );
+    }
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","matrix height",100);
+        const Int n = Input("--n","matrix width",50);
+        const Int numReuses = Input("--numReuses","number of reuses",3);
+        const Int blockSize = Input("--blockSize","distribution block size",8);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestPlans<float>( g, m, n, numReuses, blockSize );
+        TestPlans<double>( g, m, n, numReuses, blockSize );
+        TestPlans<Complex<float>>( g, m, n, numReuses, blockSize );
+        TestPlans<Complex<double>>( g, m, n, numReuses, blockSize );
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
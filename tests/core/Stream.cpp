@@ -0,0 +1,155 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void TestLocal( Int n, Int numThreads )
+{
+    Output("Testing local stream operations with ",TypeName<F>());
+    PushIndent();
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+
+    Matrix<F> A, B, C, CRef;
+    Uniform( A, n, n );
+    Uniform( B, n, n );
+    Zeros( C, n, n );
+    Gemm( NORMAL, NORMAL, F(1), A, B, F(0), CRef );
+
+    // C := A B on one stream while U \ B is formed on another which first
+    // waits for a copy of A to be made
+    CPUStream stream0( numThreads ), stream1( numThreads );
+    Matrix<F> U, X( B );
+    auto gemmFuture = Gemm( NORMAL, NORMAL, F(1), A, B, F(0), C, stream0 );
+    auto copyFuture = Copy( A, U, stream0 );
+    CPUEvent copied;
+    stream0.Record( copied );
+    stream1.Wait( copied );
+    stream1.Enqueue( [&U]() { ShiftDiagonal( U, F(U.Height()) ); } );
+    auto trsmFuture =
+      Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), U, X, stream1 );
+    gemmFuture.get();
+    copyFuture.get();
+    trsmFuture.get();
+    if( !stream0.Query() || !copied.Query() )
+        LogicError("Stream was still busy after its futures were ready");
+
+    C -= CRef;
+    const Real gemmErr = FrobeniusNorm( C ) / (eps*n*FrobeniusNorm( CRef ));
+    Output("|| C - CRef ||_F / (eps n || CRef ||_F) = ",gemmErr);
+    if( gemmErr > Real(1) )
+        LogicError("Asynchronous Gemm differed from the synchronous one");
+
+    MakeTrapezoidal( UPPER, U );
+    Trmm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), U, X );
+    X -= B;
+    const Real trsmErr = FrobeniusNorm( X ) / (eps*n*FrobeniusNorm( B ));
+    Output("|| U (U \\ B) - B ||_F / (eps n || B ||_F) = ",trsmErr);
+    if( trsmErr > Real(100) )
+        LogicError("Asynchronous Trsm was inaccurate");
+
+    // Exceptions are rethrown by the futures and by Synchronize
+    auto failure = stream1.Enqueue( []() { LogicError("Expected"); } );
+    bool caught = false;
+    try { failure.get(); }
+    catch( std::exception& e ) { caught = true; }
+    stream1.Launch( []() { LogicError("Expected"); } );
+    try { stream1.Synchronize(); caught = false; }
+    catch( std::exception& e ) { }
+    if( !caught )
+        LogicError("Exceptions were not propagated from the stream");
+    PopIndent();
+}
+
+template<typename F>
+void TestDistributed( const Grid& g, Int n )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing distributed stream operations with ",TypeName<F>());
+    PushIndent();
+    typedef Base<F> Real;
+
+    // Redistribute on a stream while forming a local product
+    DistMatrix<F> A(g);
+    DistMatrix<F,STAR,VR> B(g);
+    Uniform( A, n, n );
+    CPUStream stream;
+    auto redist = Copy( A, B, stream );
+    Matrix<F> X, Y;
+    Uniform( X, n, n );
+    Gemm( NORMAL, ADJOINT, F(1), X, X, Y );
+    redist.get();
+    DistMatrix<F> ACopy( B );
+    ACopy -= A;
+    const Real redistErr = FrobeniusNorm( ACopy );
+    OutputFromRoot(g.Comm(),"|| A - Copy(A) ||_F = ",redistErr);
+    if( redistErr != Real(0) )
+        LogicError("Asynchronous redistribution was incorrect");
+
+    // Shift a vector around a ring, completing the requests on the progress
+    // stream while the calling thread computes
+    const int commRank = mpi::Rank( g.Comm() );
+    const int commSize = mpi::Size( g.Comm() );
+    vector<F> sendBuf( n, F(commRank) ), recvBuf( n );
+    mpi::Request<F> requests[2];
+    mpi::IRecv
+    ( recvBuf.data(), n, Mod(commRank-1,commSize), g.Comm(), requests[0] );
+    mpi::ISend
+    ( sendBuf.data(), n, Mod(commRank+1,commSize), g.Comm(), requests[1] );
+    auto progress = mpi::WaitAllAsync( 2, requests );
+    Gemm( ADJOINT, NORMAL, F(1), X, X, Y );
+    progress.get();
+    for( Int i=0; i<n; ++i )
+        if( recvBuf[i] != F(Mod(commRank-1,commSize)) )
+            LogicError("Received the wrong data from the ring");
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","matrix size",200);
+        const Int numThreads = Input("--numThreads","threads per stream",1);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        if( mpi::Rank(comm) == 0 )
+        {
+            TestLocal<float>( n, numThreads );
+            TestLocal<Complex<double>>( n, numThreads );
+        }
+        if( mpi::QueryThread() >= mpi::THREAD_MULTIPLE )
+        {
+            TestDistributed<double>( g, n );
+            TestDistributed<Complex<float>>( g, n );
+        }
+        else
+        {
+            OutputFromRoot
+            (comm,"Skipping distributed stream tests since MPI does not "
+             "provide THREAD_MULTIPLE support");
+            bool rejected = false;
+            try { mpi::AssertThreadSupport(); }
+            catch( std::exception& e ) { rejected = true; }
+            if( !rejected )
+                LogicError
+                ("Communication from streams was not rejected without "
+                 "THREAD_MULTIPLE support");
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,102 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void TestGemm( const Grid& g, const Grid& topoGrid, Int m, Int n, Int k )
+{
+    OutputFromRoot(g.Comm(),"Testing Gemm with ",TypeName<F>());
+    PushIndent();
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+
+    auto fillA = []( Int i, Int j ) { return F(Real(i+2*j)/(i+j+1)); };
+    auto fillB = []( Int i, Int j ) { return F(Real(i-j)/(i+1)); };
+
+    Matrix<F> C[2];
+    const Grid* grids[2] = { &g, &topoGrid };
+    for( int t=0; t<2; ++t )
+    {
+        DistMatrix<F> A(*grids[t]), B(*grids[t]), CDist(*grids[t]);
+        A.Resize( m, k );
+        B.Resize( k, n );
+        IndexDependentFill( A, std::function<F(Int,Int)>(fillA) );
+        IndexDependentFill( B, std::function<F(Int,Int)>(fillB) );
+        Gemm( NORMAL, NORMAL, F(1), A, B, CDist );
+        DistMatrix<F,STAR,STAR> C_STAR_STAR( CDist );
+        C[t] = C_STAR_STAR.Matrix();
+    }
+
+    const Real CFrob = FrobeniusNorm( C[0] );
+    C[1] -= C[0];
+    const Real relErr = FrobeniusNorm( C[1] ) / (eps*k*CFrob);
+    OutputFromRoot
+    (g.Comm(),"|| C_topo - C ||_F / (eps k || C ||_F) = ",relErr);
+    if( relErr > Real(1) )
+        LogicError("Gemm on the topology-aware grid was inaccurate");
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--m","height of C",200);
+        const Int n = Input("--n","width of C",100);
+        const Int k = Input("--k","inner dimension",150);
+        const Int nb = Input("--nb","algorithmic blocksize",32);
+        ProcessInput();
+        PrintInputReport();
+
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+
+        // The chosen height and placement should minimize the modeled cost
+        const GridTraffic square = GemmGridTraffic( 1000, 1000, 1000, nb );
+        for( int nodeSize : { 1, 2, 4, 8 } )
+        {
+            const int gridSize = 4*nodeSize;
+            bool colsOnNode;
+            const int height =
+              Grid::TopologyAwareHeight
+              ( gridSize, nodeSize, square, colsOnNode );
+            const double cost =
+              Grid::CommCost
+              ( gridSize, height, nodeSize, colsOnNode, square );
+            for( int h=1; h<=gridSize; ++h )
+                if( gridSize % h == 0 )
+                    for( bool cols : { true, false } )
+                        if( Grid::CommCost
+                            ( gridSize, h, nodeSize, cols, square ) < cost )
+                            LogicError
+                            ("Height ",h," was cheaper than ",height);
+        }
+
+        const Grid g( comm, order );
+        const Grid gemmGrid( comm, GemmGridTraffic( m, n, k, nb ), order );
+        const Grid panelGrid( comm, PanelGridTraffic( m, n, nb ), order );
+        OutputFromRoot
+        (comm,"Default: ",g.Height()," x ",g.Width(),
+         ", Gemm: ",gemmGrid.Height()," x ",gemmGrid.Width(),
+         ", panel: ",panelGrid.Height()," x ",panelGrid.Width());
+        if( gemmGrid.Size() != commSize || panelGrid.Size() != commSize )
+            LogicError("Topology-aware grids did not include every process");
+
+        TestGemm<double>( g, gemmGrid, m, n, k );
+        TestGemm<Complex<float>>( g, panelGrid, m, n, k );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,114 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void CheckEqual
+( const AbstractDistMatrix<F>& A, const AbstractDistMatrix<F>& B,
+  const string& msg )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError
+        (msg,": read a ",B.Height()," x ",B.Width()," matrix instead of a ",
+         A.Height()," x ",A.Width()," one");
+    DistMatrix<F> E( A );
+    E -= B;
+    const Base<F> error = FrobeniusNorm( E );
+    OutputFromRoot(A.Grid().Comm(),msg,": || A - B ||_F = ",error);
+    if( error != Base<F>(0) )
+        LogicError(msg," was incorrect");
+}
+
+template<typename F>
+void TestRoundTrip( const Grid& g, Int m, Int n )
+{
+    OutputFromRoot(g.Comm(),"Testing round trips with ",TypeName<F>());
+    PushIndent();
+    const string basename = "ReadTest";
+
+    // Integer-valued entries survive being written as text
+    DistMatrix<F> A(g);
+    Uniform( A, m, n, F(0), Base<F>(100) );
+    EntrywiseMap( A, function<F(const F&)>
+      ( []( const F& alpha ) { return Round(alpha); } ) );
+
+    for( const FileFormat format : { MATRIX_MARKET, ASCII } )
+    {
+        Write( A, basename, format );
+        mpi::Barrier( g.Comm() );
+        const string filename = basename + "." + FileExtension(format);
+
+        DistMatrix<F> B(g);
+        const bool sequential = false;
+        Read( B, filename, format, sequential );
+        CheckEqual( A, B, "Distributed read" );
+
+        DistMatrix<F,STAR,STAR> C(g);
+        Read( C.Matrix(), filename, format );
+        C.Resize( C.Matrix().Height(), C.Matrix().Width() );
+        CheckEqual( A, C, "Local read" );
+        mpi::Barrier( g.Comm() );
+    }
+    PopIndent();
+}
+
+void TestSymmetric( const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing symmetric coordinate files");
+    PushIndent();
+    const string filename = "ReadTestSymmetric.mtx";
+    if( g.Rank() == 0 )
+    {
+        std::ofstream file( filename.c_str() );
+        file << "%%MatrixMarket matrix coordinate real skew-symmetric\n"
+             << "% a comment\n"
+             << "4 4 5\n"
+             << "2 1 1.5\n"
+             << "\n"
+             << "4 1 -2\n"
+             << "3 2 4\n"
+             << "3 2 1\n" // duplicates are summed
+             << "4 3 0.25\n";
+    }
+    mpi::Barrier( g.Comm() );
+
+    DistMatrix<double> A(g), B(g);
+    Zeros( A, 4, 4 );
+    A.Set( 1, 0,  1.5  ); A.Set( 0, 1, -1.5  );
+    A.Set( 3, 0, -2.   ); A.Set( 0, 3,  2.   );
+    A.Set( 2, 1,  5.   ); A.Set( 1, 2, -5.   );
+    A.Set( 3, 2,  0.25 ); A.Set( 2, 3, -0.25 );
+    const bool sequential = false;
+    Read( B, filename, MATRIX_MARKET, sequential );
+    CheckEqual( A, B, "Skew-symmetric read" );
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",100);
+        const Int n = Input("--n","width of matrix",80);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestRoundTrip<double>( g, m, n );
+        TestRoundTrip<Complex<float>>( g, m, n );
+        TestSymmetric( g );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
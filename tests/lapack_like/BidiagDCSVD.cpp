@@ -170,6 +170,66 @@ void TestDivideAndConquer
     Output("");
 }
 
+// Run the task-parallel sequential divide and conquer with more than one
+// thread and compare it against the serial algorithm
+template<typename F>
+void TestTaskedDivideAndConquer
+( Int m,
+  UpperOrLower uplo,
+  Int taskCutoff,
+  Int numThreads,
+  bool print )
+{
+    Output
+    ("Testing task-parallel DivideAndConquer with ",numThreads,
+     " threads and ",TypeName<F>());
+    typedef Base<F> Real;
+
+    BidiagSVDCtrl<Real> ctrl;
+    ctrl.wantU = true;
+    ctrl.wantV = true;
+    ctrl.dcCtrl.cutoff = Min( taskCutoff/4, Int(16) );
+    ctrl.dcCtrl.taskCutoff = taskCutoff;
+
+    Matrix<F> mainDiag, offDiag;
+    Uniform( mainDiag, m, 1 );
+    Uniform( offDiag, m-1, 1 );
+
+    Matrix<Real> s;
+    Matrix<F> U, V;
+    BidiagSVD( uplo, mainDiag, offDiag, U, s, V, ctrl );
+
+#ifdef _OPENMP
+    const int oldNumThreads = omp_get_max_threads();
+    omp_set_num_threads( numThreads );
+#endif
+    ctrl.dcCtrl.parallelTasks = true;
+    Matrix<Real> sTask;
+    Matrix<F> UTask, VTask;
+    Timer timer;
+    timer.Start();
+    BidiagSVD( uplo, mainDiag, offDiag, UTask, sTask, VTask, ctrl );
+    Output("Task-parallel Bidiag D&C: ",timer.Stop()," seconds");
+#ifdef _OPENMP
+    omp_set_num_threads( oldNumThreads );
+#endif
+
+    Output("Residuals after task-parallel D&C:");
+    PushIndent();
+    PrintSVDResiduals( uplo, mainDiag, offDiag, UTask, sTask, VTask, print );
+    PopIndent();
+
+    const Real eps = limits::Epsilon<Real>();
+    const Real sFrob = FrobeniusNorm( s );
+    s -= sTask;
+    const Real relDiff = FrobeniusNorm( s ) / (m*eps*sFrob);
+    Output("|| s_serial - s_tasks ||_F / (m eps || s ||_F) = ",relDiff);
+    if( relDiff > Real(10) )
+        LogicError
+        ("Task-parallel singular values differed from the serial ones");
+    Output("");
+}
+
 int main( int argc, char* argv[] )
 {
     Environment env( argc, argv );
@@ -186,6 +246,12 @@ int main( int argc, char* argv[] )
         const bool wantV = Input("--wantV","compute V?",true);
         const bool progress = Input("--progress","print progress?",false);
         const bool print = Input("--print","print matrices?",false);
+        const Int taskN =
+          Input("--taskN","size for the task-parallel D&C test",400);
+        const Int taskCutoff =
+          Input("--taskCutoff","serial subproblem size for D&C tasks",64);
+        const Int numThreads =
+          Input("--numThreads","number of threads for D&C tasks",4);
 #ifdef EL_HAVE_MPC
         const mpfr_prec_t prec = Input("--prec","MPFR precision",256);
 #endif
@@ -209,6 +275,11 @@ int main( int argc, char* argv[] )
         ( n, uplo, wantU, wantV, divideCutoff, maxIter, maxCubicIter,
           negativeFix, progress, print );
 
+        TestTaskedDivideAndConquer<float>
+        ( taskN, uplo, taskCutoff, numThreads, print );
+        TestTaskedDivideAndConquer<double>
+        ( taskN, uplo, taskCutoff, numThreads, print );
+
 #ifdef EL_HAVE_QD
         TestDivideAndConquer<DoubleDouble>
         ( n, uplo, wantU, wantV, divideCutoff, maxIter, maxCubicIter,
@@ -129,6 +129,37 @@ void TestSequentialCholesky
     PopIndent();
 }
 
+template<typename F>
+void TestSequentialTileCholesky
+( UpperOrLower uplo,
+  Int m,
+  Int tileSize,
+  bool print )
+{
+    Output("Testing sequential tile Cholesky with ",TypeName<F>());
+    PushIndent();
+    Matrix<F> A, AOrig;
+    Permutation p;
+
+    HermitianUniformSpectrum( A, m, 1e-9, 10 );
+    AOrig = A;
+    if( print )
+        Print( A, "A" );
+
+    Output("Tile Cholesky...");
+    Timer timer;
+    timer.Start();
+    cholesky::Tile( uplo, A, tileSize );
+    const double runTime = timer.Stop();
+    const double realGFlops = (1./3.)*Pow(double(m),3.)/(1.e9*runTime);
+    const double gFlops = ( IsComplex<F>::value ? 4*realGFlops : realGFlops );
+    Output(runTime," seconds (",gFlops," GFlop/s)");
+    if( print )
+        Print( A, "A after tile factorization" );
+    TestCorrectness( false, uplo, A, p, AOrig );
+    PopIndent();
+}
+
 template<typename F>
 void TestCholesky
 ( const Grid& g,
@@ -139,7 +170,8 @@ void TestCholesky
   bool print,
   bool printDiag,
   bool correctness,
-  bool scalapack )
+  bool scalapack,
+  bool reuseWorkspace )
 {
     OutputFromRoot(g.Comm(),"Testing distributed Cholesky with ",TypeName<F>());
     PushIndent();
@@ -160,10 +192,13 @@ void TestCholesky
     else
         OutputFromRoot(g.Comm(),"Elemental Cholesky...");
     mpi::Barrier( g.Comm() );
+    Workspace<F> workspace;
     Timer timer;
     timer.Start();
     if( pivot )
         Cholesky( uplo, A, p );
+    else if( reuseWorkspace )
+        Cholesky( uplo, A, workspace );
     else
         Cholesky( uplo, A, scalapack );
     mpi::Barrier( g.Comm() );
@@ -185,6 +220,24 @@ void TestCholesky
         Print( GetRealPartOfDiagonal(A), "diag(A)" );
     if( correctness )
         TestCorrectness( pivot, uplo, A, p, AOrig );
+    if( reuseWorkspace && !pivot )
+    {
+        // A second factorization of the same size should not allocate
+        const Int numAllocations = workspace.NumAllocations();
+        const Int workspaceSize = cholesky::WorkspaceSize( uplo, A );
+        DistMatrix<F> B(g);
+        HermitianUniformSpectrum( B, m, 1e-9, 10 );
+        Cholesky( uplo, B, workspace );
+        OutputFromRoot
+        (g.Comm(),"Workspace peak of ",workspace.Peak()," entries (bound of ",
+         workspaceSize,") with ",workspace.NumAllocations()," allocation(s)");
+        if( workspace.Peak() > workspaceSize )
+            LogicError
+            ("Workspace peak of ",workspace.Peak()," exceeded the bound of ",
+             workspaceSize);
+        if( workspace.NumAllocations() != numAllocations )
+            LogicError("Reusing the workspace required further allocations");
+    }
     PopIndent();
 }
 
@@ -208,6 +261,11 @@ main( int argc, char* argv[] )
         const bool print = Input("--print","print matrices?",false);
         const bool printDiag = Input("--printDiag","print diag of fact?",false);
         const bool sequential = Input("--sequential","test sequential?",true);
+        const bool tile =
+          Input("--tile","test the sequential tile factorization?",true);
+        const Int tileSize = Input("--tileSize","tile size",32);
+        const bool reuseWorkspace =
+          Input("--workspace","factor twice with a shared workspace?",false);
 #ifdef EL_HAVE_SCALAPACK
         const bool scalapack = Input("--scalapack","test ScaLAPACK?",false);
 #else
@@ -242,6 +300,15 @@ main( int argc, char* argv[] )
             ( uplo, pivot, m, print, printDiag, correctness );
             TestSequentialCholesky<Complex<double>>
             ( uplo, pivot, m, print, printDiag, correctness );
+            if( tile )
+            {
+                TestSequentialTileCholesky<float>( uplo, m, tileSize, print );
+                TestSequentialTileCholesky<Complex<float>>
+                ( uplo, m, tileSize, print );
+                TestSequentialTileCholesky<double>( uplo, m, tileSize, print );
+                TestSequentialTileCholesky<Complex<double>>
+                ( uplo, m, tileSize, print );
+            }
 
 #ifdef EL_HAVE_QD
             TestSequentialCholesky<DoubleDouble>
@@ -272,49 +339,49 @@ main( int argc, char* argv[] )
 
         TestCholesky<float>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, reuseWorkspace );
         TestCholesky<Complex<float>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, reuseWorkspace );
         TestCholesky<double>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, reuseWorkspace );
         TestCholesky<Complex<double>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, reuseWorkspace );
 
 #ifdef EL_HAVE_QD
         TestCholesky<DoubleDouble>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, reuseWorkspace );
         TestCholesky<QuadDouble>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, reuseWorkspace );
 
         TestCholesky<Complex<DoubleDouble>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, reuseWorkspace );
         TestCholesky<Complex<QuadDouble>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, reuseWorkspace );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestCholesky<Quad>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, reuseWorkspace );
         TestCholesky<Complex<Quad>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, reuseWorkspace );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestCholesky<BigFloat>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, reuseWorkspace );
         TestCholesky<Complex<BigFloat>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, reuseWorkspace );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
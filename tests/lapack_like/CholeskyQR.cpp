@@ -58,6 +58,7 @@ void TestQR
 ( const Grid& g,
   Int m, 
   Int n,
+  const qr::CholeskyQRCtrl& ctrl,
   bool testCorrectness,
   bool print )
 {
@@ -75,12 +76,16 @@ void TestQR
     mpi::Barrier( g.Comm() );
     Timer timer;
     timer.Start();
-    qr::Cholesky( Q, R );
+    qr::Cholesky( Q, R, ctrl );
     mpi::Barrier( g.Comm() );
     const double runTime = timer.Stop();
     const double mD = double(m);
     const double nD = double(n);
-    const double gFlops = (2.*mD*nD*nD + 1./3.*nD*nD*nD)/(1.e9*runTime);
+    const double numPasses =
+      ( ctrl.variant == qr::CHOLESKY_QR ? 1. :
+        ctrl.variant == qr::CHOLESKY_QR2 ? 2. : 3. );
+    const double gFlops =
+      numPasses*(2.*mD*nD*nD + 1./3.*nD*nD*nD)/(1.e9*runTime);
     OutputFromRoot(g.Comm(),"Time: ",runTime," seconds (",gFlops," GFlop/s)");
     if( print )
     {
@@ -92,6 +97,60 @@ void TestQR
     PopIndent();
 }
 
+// A = U diag(sigma) V^H with geometrically graded singular values from 1 down
+// to 1/cond. For cond well beyond 1/sqrt(eps), the unshifted Gram matrix is
+// numerically indefinite, so the result depends upon the shifted first pass
+template<typename F>
+void TestIllConditioned
+( const Grid& g, Int m, Int n, Base<F> cond, bool promoteGram )
+{
+    typedef Base<F> Real;
+    OutputFromRoot
+    (g.Comm(),"Testing shifted CholeskyQR3 with ",TypeName<F>(),
+     " and cond(A)=",cond);
+    PushIndent();
+    const Real eps = limits::Epsilon<Real>();
+
+    DistMatrix<F> U(g), V(g);
+    Uniform( U, m, n );
+    qr::ExplicitUnitary( U );
+    Uniform( V, n, n );
+    qr::ExplicitUnitary( V );
+    DistMatrix<Real,STAR,STAR> sigma(g);
+    Zeros( sigma, n, 1 );
+    for( Int j=0; j<n; ++j )
+        sigma.Set( j, 0, Pow(cond,-Real(j)/Real(Max(n-1,Int(1)))) );
+    DiagonalScale( RIGHT, NORMAL, sigma, U );
+    DistMatrix<F> AFull(g);
+    Gemm( NORMAL, ADJOINT, F(1), U, V, AFull );
+
+    DistMatrix<F,VC,STAR> A( AFull ), Q( AFull );
+    DistMatrix<F,STAR,STAR> R(g);
+    qr::CholeskyQRCtrl ctrl;
+    ctrl.variant = qr::SHIFTED_CHOLESKY_QR3;
+    ctrl.promoteGram = promoteGram;
+    ctrl.shiftOnBreakdown = false;
+    qr::Cholesky( Q, R, ctrl );
+
+    DistMatrix<F> Z(g);
+    Identity( Z, n, n );
+    DistMatrix<F> Q_MC_MR( Q );
+    Herk( UPPER, ADJOINT, Real(-1), Q_MC_MR, Real(1), Z );
+    const Real orthogError =
+      HermitianFrobeniusNorm( UPPER, Z ) / (eps*Max(m,n));
+    const Real frobA = FrobeniusNorm( A );
+    LocalGemm( NORMAL, NORMAL, F(-1), Q, R, F(1), A );
+    const Real relError = FrobeniusNorm( A ) / (eps*Max(m,n)*frobA);
+    OutputFromRoot
+    (g.Comm(),"||Q^H Q - I||_F / (eps Max(m,n)) = ",orthogError,
+     ", ||A - QR||_F / (eps Max(m,n) ||A||_F) = ",relError);
+    if( orthogError > Real(10) )
+        LogicError("Shifted CholeskyQR3 lost orthogonality");
+    if( relError > Real(10) )
+        LogicError("Shifted CholeskyQR3 residual was unacceptably large");
+    PopIndent();
+}
+
 int 
 main( int argc, char* argv[] )
 {
@@ -104,9 +163,16 @@ main( int argc, char* argv[] )
         const Int m = Input("--height","height of matrix",100);
         const Int n = Input("--width","width of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int variant =
+          Input("--variant","0: CholQR, 1: CholQR2, 2: shifted CholQR3",1);
+        const bool promoteGram =
+          Input("--promoteGram","accumulate Gram in promoted precision?",
+                false);
         const bool testCorrectness = Input
             ("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
+        const double cond =
+          Input("--cond","condition number for the shifted tests",1e10);
 #ifdef EL_HAVE_MPC
         const mpfr_prec_t prec = Input("--prec","MPFR precision",256);
 #endif
@@ -122,28 +188,44 @@ main( int argc, char* argv[] )
         SetBlocksize( nb );
         ComplainIfDebug();
 
-        TestQR<float>( g, m, n, testCorrectness, print );
-        TestQR<Complex<float>>( g, m, n, testCorrectness, print );
+        qr::CholeskyQRCtrl ctrl;
+        ctrl.variant = static_cast<qr::CholeskyQRVariant>(variant);
+        ctrl.promoteGram = promoteGram;
+
+        TestQR<float>( g, m, n, ctrl, testCorrectness, print );
+        TestQR<Complex<float>>( g, m, n, ctrl, testCorrectness, print );
+
+        TestQR<double>( g, m, n, ctrl, testCorrectness, print );
+        TestQR<Complex<double>>( g, m, n, ctrl, testCorrectness, print );
 
-        TestQR<double>( g, m, n, testCorrectness, print );
-        TestQR<Complex<double>>( g, m, n, testCorrectness, print );
+        // Exercise the shifted variant regardless of --variant, since the
+        // default (CholeskyQR2) only shifts after a breakdown
+        if( m >= n )
+        {
+            TestIllConditioned<double>( g, m, n, cond, promoteGram );
+            TestIllConditioned<Complex<double>>( g, m, n, cond, promoteGram );
+        }
 
 #ifdef EL_HAVE_QD
-        TestQR<DoubleDouble>( g, m, n, testCorrectness, print );
-        TestQR<QuadDouble>( g, m, n, testCorrectness, print );
+        TestQR<DoubleDouble>( g, m, n, ctrl, testCorrectness, print );
+        TestQR<QuadDouble>( g, m, n, ctrl, testCorrectness, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
-        TestQR<Quad>( g, m, n, testCorrectness, print );
-        TestQR<Complex<Quad>>( g, m, n, testCorrectness, print );
+        TestQR<Quad>( g, m, n, ctrl, testCorrectness, print );
+        TestQR<Complex<Quad>>( g, m, n, ctrl, testCorrectness, print );
 #endif
 
 #ifdef EL_HAVE_MPC
-        TestQR<BigFloat>( g, m, n, testCorrectness, print );
-        TestQR<Complex<BigFloat>>( g, m, n, testCorrectness, print );
+        TestQR<BigFloat>( g, m, n, ctrl, testCorrectness, print );
+        TestQR<Complex<BigFloat>>( g, m, n, ctrl, testCorrectness, print );
 #endif
     }
-    catch( exception& e ) { ReportException(e); }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
 
     return 0;
 }
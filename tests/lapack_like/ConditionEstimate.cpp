@@ -0,0 +1,117 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void TestEstimates( const Grid& g, Int n, Int k, bool print )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+    typedef Base<F> Real;
+
+    DistMatrix<F> A(g);
+    Uniform( A, n, n );
+    ShiftDiagonal( A, F(n)/F(4) );
+    if( print )
+        Print( A, "A" );
+
+    // The estimates are lower bounds which are rarely off by more than a
+    // factor of three
+    const Real oneCond = OneCondition( A );
+    const Real oneEst = OneConditionEstimate( A );
+    const Real infCond = InfinityCondition( A );
+    const Real infEst = InfinityConditionEstimate( A );
+    const Real twoCond = TwoCondition( A );
+    const Real twoEst = TwoConditionEstimate( A );
+    OutputFromRoot
+    (g.Comm(),"kappa_1 = ",oneCond,", estimate = ",oneEst,"\n",
+     "kappa_oo = ",infCond,", estimate = ",infEst,"\n",
+     "kappa_2 = ",twoCond,", estimate = ",twoEst);
+    const Real slack = Sqrt(limits::Epsilon<Real>());
+    if( oneEst > oneCond*(1+slack) || 3*oneEst < oneCond )
+        LogicError("One-norm condition estimate was inaccurate");
+    if( infEst > infCond*(1+slack) || 3*infEst < infCond )
+        LogicError("Infinity-norm condition estimate was inaccurate");
+    if( Abs(twoEst-twoCond) > slack*n*twoCond )
+        LogicError("Two-norm condition estimate was inaccurate");
+
+    // Compare the leading singular values against those of a full SVD
+    DistMatrix<Real,STAR,STAR> s(g), sLanczos(g);
+    SVD( A, s );
+    LanczosSingularValues( A, k, sLanczos );
+    Real kyFan = 0;
+    for( Int i=0; i<k; ++i )
+        kyFan += s.GetLocal(i,0);
+    const Real kyFanEst = KyFanNormEstimate( A, k );
+    OutputFromRoot
+    (g.Comm(),"Ky-Fan ",k,"-norm = ",kyFan,", estimate = ",kyFanEst);
+    for( Int i=0; i<k; ++i )
+        if( Abs(sLanczos.GetLocal(i,0)-s.GetLocal(i,0)) >
+            slack*n*s.GetLocal(0,0) )
+            LogicError("Lanczos singular value ",i," was inaccurate");
+    if( Abs(kyFanEst-kyFan) > slack*n*kyFan )
+        LogicError("Ky-Fan norm estimate was inaccurate");
+    PopIndent();
+}
+
+template<typename F>
+void TestSingular( const Grid& g, Int n )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing singular estimates with ",TypeName<F>());
+    PushIndent();
+    typedef Base<F> Real;
+
+    // A zero first column forces an exactly zero pivot
+    Matrix<F> A;
+    Uniform( A, n, n );
+    auto a1 = A( ALL, IR(0) );
+    Zero( a1 );
+    DistMatrix<F> ADist(g);
+    Uniform( ADist, n, n );
+    auto a1Dist = ADist( ALL, IR(0) );
+    Zero( a1Dist );
+
+    const Real infinity = limits::Infinity<Real>();
+    if( OneConditionEstimate( A ) != infinity ||
+        InfinityConditionEstimate( A ) != infinity ||
+        TwoConditionEstimate( A ) != infinity )
+        LogicError("Sequential estimates of a singular matrix were finite");
+    if( OneConditionEstimate( ADist ) != infinity ||
+        InfinityConditionEstimate( ADist ) != infinity ||
+        TwoConditionEstimate( ADist ) != infinity )
+        LogicError("Distributed estimates of a singular matrix were finite");
+    OutputFromRoot(g.Comm(),"Estimates of a singular matrix were infinite");
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","size of matrix",100);
+        const Int k = Input("--k","number of singular values",3);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestEstimates<float>( g, n, k, print );
+        TestEstimates<Complex<double>>( g, n, k, print );
+        TestSingular<float>( g, n );
+        TestSingular<Complex<double>>( g, n );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
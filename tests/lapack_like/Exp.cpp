@@ -0,0 +1,160 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// A diagonal matrix with entries evenly spaced in [-radius,radius]
+template<typename Field>
+Field DiagonalEntry( Int i, Int j, Int n, Base<Field> radius )
+{
+    typedef Base<Field> Real;
+    if( i != j )
+        return Field(0);
+    return radius*(Real(2*i)/Real(Max(n-1,Int(1)))-Real(1));
+}
+
+// A Jordan block with eigenvalue lambda and superdiagonal alpha, whose
+// exponential has the entries exp(lambda) alpha^(j-i) / (j-i)! for j >= i
+template<typename Field>
+Field JordanEntry( Int i, Int j, Field lambda, Field alpha )
+{
+    if( i == j )
+        return lambda;
+    else if( j == i+1 )
+        return alpha;
+    return Field(0);
+}
+
+template<typename Field>
+Field ExpJordanEntry( Int i, Int j, Field lambda, Field alpha )
+{
+    typedef Base<Field> Real;
+    if( j < i )
+        return Field(0);
+    Field entry = Exp( lambda );
+    for( Int k=1; k<=j-i; ++k )
+        entry *= alpha / Real(k);
+    return entry;
+}
+
+template<typename Field,class MatType>
+void CheckError
+( const Grid& grid,
+  const string& name,
+        MatType& A,
+  const MatType& AExact,
+  bool print )
+{
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    const Real eps = limits::Epsilon<Real>();
+    if( print )
+        Print( A, name );
+    const Real frobExact = FrobeniusNorm( AExact );
+    A -= AExact;
+    const Real relError = FrobeniusNorm( A ) / (n*eps*frobExact);
+    OutputFromRoot
+    (grid.Comm(),name,": || E - E_exact ||_F / (n eps || E_exact ||_F) = ",
+     relError);
+    if( relError > Real(10) )
+        LogicError("Unacceptably large relative error");
+}
+
+template<typename Field>
+void TestExp( const Grid& grid, Int n, bool sequential, bool print )
+{
+    typedef Base<Field> Real;
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    // The one-norms are large enough to require scaling and squaring
+    const Real radius = 8;
+    const Field lambda = Field(1)/Field(2), alpha = 4;
+    auto diagFill =
+      [&]( Int i, Int j ) { return DiagonalEntry<Field>( i, j, n, radius ); };
+    auto expDiagFill =
+      [&]( Int i, Int j ) { return Exp( diagFill(i,j) )*Real(i==j); };
+    auto jordanFill =
+      [&]( Int i, Int j ) { return JordanEntry( i, j, lambda, alpha ); };
+    auto expJordanFill =
+      [&]( Int i, Int j ) { return ExpJordanEntry( i, j, lambda, alpha ); };
+
+    if( sequential && grid.Rank() == 0 )
+    {
+        Matrix<Field> A, AExact, B, X, XExact;
+        Zeros( A, n, n );
+        Zeros( AExact, n, n );
+        IndexDependentFill( A, function<Field(Int,Int)>(diagFill) );
+        IndexDependentFill( AExact, function<Field(Int,Int)>(expDiagFill) );
+        Exp( A );
+        CheckError<Field>( grid, "Sequential diagonal", A, AExact, print );
+
+        IndexDependentFill( A, function<Field(Int,Int)>(jordanFill) );
+        IndexDependentFill( AExact, function<Field(Int,Int)>(expJordanFill) );
+        Uniform( B, n, 3 );
+        X = B;
+        ExpTimes( A, X );
+        Gemm( NORMAL, NORMAL, Field(1), AExact, B, XExact );
+        Exp( A );
+        CheckError<Field>( grid, "Sequential Jordan", A, AExact, print );
+        CheckError<Field>( grid, "Sequential ExpTimes", X, XExact, print );
+    }
+
+    DistMatrix<Field> A(grid), AExact(grid), B(grid), X(grid), XExact(grid);
+    Zeros( A, n, n );
+    Zeros( AExact, n, n );
+    IndexDependentFill( A, function<Field(Int,Int)>(diagFill) );
+    IndexDependentFill( AExact, function<Field(Int,Int)>(expDiagFill) );
+    Exp( A );
+    CheckError<Field>( grid, "Diagonal", A, AExact, print );
+
+    IndexDependentFill( A, function<Field(Int,Int)>(jordanFill) );
+    IndexDependentFill( AExact, function<Field(Int,Int)>(expJordanFill) );
+    Uniform( B, n, 3 );
+    X = B;
+    ExpTimes( A, X );
+    Gemm( NORMAL, NORMAL, Field(1), AExact, B, XExact );
+    Exp( A );
+    CheckError<Field>( grid, "Jordan", A, AExact, print );
+    CheckError<Field>( grid, "ExpTimes", X, XExact, print );
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","matrix size",50);
+        const bool sequential = Input("--sequential","test sequential?",true);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        TestExp<float>( grid, n, sequential, print );
+        TestExp<Complex<float>>( grid, n, sequential, print );
+        TestExp<double>( grid, n, sequential, print );
+        TestExp<Complex<double>>( grid, n, sequential, print );
+#ifdef EL_HAVE_QD
+        TestExp<DoubleDouble>( grid, n, sequential, print );
+        TestExp<QuadDouble>( grid, n, sequential, print );
+#endif
+#ifdef EL_HAVE_QUAD
+        TestExp<Quad>( grid, n, sequential, print );
+#endif
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
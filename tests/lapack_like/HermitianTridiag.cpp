@@ -317,6 +317,44 @@ void TestHermitianTridiag
     PopIndent();
 }
 
+// Reduce two matrices of the same size with a shared workspace and demand that
+// the second reduction neither exceeds herm_tridiag::WorkspaceSize nor
+// allocates
+template<typename Field>
+void TestHermitianTridiagWorkspace
+( const Grid& grid, UpperOrLower uplo, Int m, Int nbLocal, bool avoidTrmv )
+{
+    OutputFromRoot
+    (grid.Comm(),"Testing workspace reuse with ",TypeName<Field>());
+    PushIndent();
+    DistMatrix<Field> A(grid);
+    DistMatrix<Field,STAR,STAR> householderScalars(grid);
+    Workspace<Field> workspace;
+
+    HermitianTridiagCtrl<Field> ctrl;
+    ctrl.symvCtrl.bsize = nbLocal;
+    ctrl.symvCtrl.avoidTrmvBasedLocalSymv = avoidTrmv;
+    ctrl.approach = HERMITIAN_TRIDIAG_NORMAL;
+
+    Wigner( A, m );
+    const Int workspaceSize = herm_tridiag::WorkspaceSize( uplo, A, ctrl );
+    HermitianTridiag( uplo, A, householderScalars, workspace, ctrl );
+    const Int numAllocations = workspace.NumAllocations();
+
+    Wigner( A, m );
+    HermitianTridiag( uplo, A, householderScalars, workspace, ctrl );
+    OutputFromRoot
+    (grid.Comm(),"Workspace peak of ",workspace.Peak()," entries (bound of ",
+     workspaceSize,") with ",workspace.NumAllocations()," allocation(s)");
+    if( workspace.Peak() > workspaceSize )
+        LogicError
+        ("Workspace peak of ",workspace.Peak()," exceeded the bound of ",
+         workspaceSize);
+    if( workspace.NumAllocations() != numAllocations )
+        LogicError("Reusing the workspace required further allocations");
+    PopIndent();
+}
+
 int
 main( int argc, char* argv[] )
 {
@@ -423,6 +461,13 @@ main( int argc, char* argv[] )
             TestHermitianTridiag<Complex<double>>
             ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
 
+        if( testReal )
+            TestHermitianTridiagWorkspace<double>
+            ( grid, uplo, m, nbLocal, avoidTrmv );
+        if( testCpx )
+            TestHermitianTridiagWorkspace<Complex<double>>
+            ( grid, uplo, m, nbLocal, avoidTrmv );
+
 #ifdef EL_HAVE_QD
         if( testReal )
         {
@@ -455,7 +500,11 @@ main( int argc, char* argv[] )
             ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
 #endif
     }
-    catch( exception& e ) { ReportException(e); }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
 
     return 0;
 }
@@ -150,6 +150,151 @@ void TestRandom
         Print( R );
 }
 
+// Demand a small residual, || T Q - Q diag(w) ||_F, and a small departure from
+// orthogonality, || I - Q^T Q ||_F
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void CheckTridiagEig
+( const Matrix<Real>& d,
+  const Matrix<Real>& e,
+  const Matrix<Real>& w,
+  const Matrix<Real>& Q )
+{
+    const Int n = d.Height();
+    const Real TOne = HermitianTridiagOneNorm( d, e );
+
+    // R := Q diag(w) - T Q
+    Matrix<Real> R(Q);
+    DiagonalScale( RIGHT, NORMAL, w, R );
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<n; ++i )
+        {
+            if( i > 0 )
+                R(i,j) -= e(i-1)*Q(i-1,j);
+            R(i,j) -= d(i)*Q(i,j);
+            if( i < n-1 )
+                R(i,j) -= e(i)*Q(i+1,j);
+        }
+    }
+    const Real eps = limits::Epsilon<Real>();
+    const Real relResid = FrobeniusNorm( R ) / (n*eps*TOne);
+    Output("|| T Q - Q diag(w) ||_F / (n eps || T ||_1) = ",relResid);
+
+    // E := I - Q^T Q
+    Matrix<Real> E;
+    Identity( E, n, n );
+    Gemm( TRANSPOSE, NORMAL, Real(-1), Q, Q, Real(1), E );
+    const Real relOrthog = FrobeniusNorm( E ) / (n*eps);
+    Output("|| I - Q^T Q ||_F / (n eps) = ",relOrthog);
+
+    if( relResid > Real(1) )
+        LogicError("Unacceptably large relative residual");
+    if( relOrthog > Real(10) )
+        LogicError("Unacceptable loss of orthogonality");
+}
+
+// Check the native MRRR implementation (which is otherwise only used for
+// datatypes not supported by PMRRR/LAPACK) on a random matrix and on a
+// Wilkinson matrix, whose eigenvalues come in close pairs
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void TestNativeMRRR( Int n, bool wilkinson, bool print )
+{
+    EL_DEBUG_CSE
+    Output
+    ("Testing native MRRR on ",(wilkinson ? "Wilkinson" : "random"),
+     " tridiagonal matrix with ",TypeName<Real>());
+    PushIndent();
+
+    HermitianTridiagEigCtrl<Real> ctrl;
+    ctrl.alg = HERM_TRIDIAG_EIG_MRRR;
+    ctrl.mrrrCtrl.native = true;
+
+    Matrix<Real> d, e;
+    if( wilkinson )
+    {
+        d.Resize( n, 1 );
+        Ones( e, n-1, 1 );
+        for( Int i=0; i<n; ++i )
+            d(i) = Abs( Real(n/2-i) );
+    }
+    else
+    {
+        Uniform( d, n, 1 );
+        Uniform( e, n-1, 1 );
+    }
+
+    Matrix<Real> w, Q;
+    Timer timer;
+    timer.Start();
+    auto info = HermitianTridiagEig( d, e, w, Q, ctrl );
+    Output("HermitianTridiagEig: ",timer.Stop()," seconds");
+    Output
+    (info.mrrrInfo.numClusters," clusters, representation tree depth of ",
+     info.mrrrInfo.maxDepth);
+    if( print )
+    {
+        Print( w, "w" );
+        Print( Q, "Q" );
+    }
+
+    CheckTridiagEig( d, e, w, Q );
+    PopIndent();
+}
+
+// Run the task-parallel sequential divide and conquer with more than one
+// thread and compare it against the serial algorithm
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void TestTaskedDivideAndConquer
+( Int n, Int taskCutoff, Int numThreads, bool print )
+{
+    EL_DEBUG_CSE
+    Output
+    ("Testing task-parallel divide and conquer with ",numThreads,
+     " threads and ",TypeName<Real>());
+    PushIndent();
+
+    HermitianTridiagEigCtrl<Real> ctrl;
+    ctrl.alg = HERM_TRIDIAG_EIG_DC;
+    ctrl.dcCtrl.cutoff = Min( taskCutoff/4, Int(16) );
+    ctrl.dcCtrl.taskCutoff = taskCutoff;
+
+    Matrix<Real> d, e;
+    Uniform( d, n, 1 );
+    Uniform( e, n-1, 1 );
+
+    Matrix<Real> w, Q;
+    HermitianTridiagEig( d, e, w, Q, ctrl );
+
+#ifdef _OPENMP
+    const int oldNumThreads = omp_get_max_threads();
+    omp_set_num_threads( numThreads );
+#endif
+    ctrl.dcCtrl.parallelTasks = true;
+    Matrix<Real> wTask, QTask;
+    Timer timer;
+    timer.Start();
+    HermitianTridiagEig( d, e, wTask, QTask, ctrl );
+    Output("Task-parallel HermitianTridiagEig: ",timer.Stop()," seconds");
+#ifdef _OPENMP
+    omp_set_num_threads( oldNumThreads );
+#endif
+    if( print )
+    {
+        Print( wTask, "w" );
+        Print( QTask, "Q" );
+    }
+    CheckTridiagEig( d, e, wTask, QTask );
+
+    const Real eps = limits::Epsilon<Real>();
+    const Real wFrob = FrobeniusNorm( w );
+    w -= wTask;
+    const Real relDiff = FrobeniusNorm( w ) / (n*eps*wFrob);
+    Output("|| w_serial - w_tasks ||_F / (n eps || w ||_F) = ",relDiff);
+    if( relDiff > Real(10) )
+        LogicError("Task-parallel eigenvalues differed from the serial ones");
+    PopIndent();
+}
+
 int main( int argc, char* argv[] )
 {
     Environment env( argc, argv );
@@ -163,6 +308,12 @@ int main( int argc, char* argv[] )
         const bool progress = Input("--progress","print progress?",true);
         const bool print = Input("--print","print matrices?",false);
         const Int algInt = Input("--algInt","0: QR, 1: D&C, 2: MRRR",1);
+        const Int taskN =
+          Input("--taskN","size for the task-parallel D&C test",400);
+        const Int taskCutoff =
+          Input("--taskCutoff","serial subproblem size for D&C tasks",64);
+        const Int numThreads =
+          Input("--numThreads","number of threads for D&C tasks",4);
         ProcessInput();
         PrintInputReport();
 
@@ -183,6 +334,16 @@ int main( int argc, char* argv[] )
         TestGraded<BigFloat>( progress, alg, qrCtrl, print );
 #endif
 
+        TestNativeMRRR<float>( n, false, print );
+        TestNativeMRRR<float>( n+1, true, print );
+        TestNativeMRRR<double>( n, false, print );
+        TestNativeMRRR<double>( n+1, true, print );
+
+        TestTaskedDivideAndConquer<float>
+        ( taskN, taskCutoff, numThreads, print );
+        TestTaskedDivideAndConquer<double>
+        ( taskN, taskCutoff, numThreads, print );
+
         TestRandom<float>( n, progress, alg, qrCtrl, print );
         TestRandom<double>( n, progress, alg, qrCtrl, print );
 #ifdef EL_HAVE_QUAD
@@ -236,6 +236,94 @@ void TestHessenberg
     PopIndent();
 }
 
+template<typename Field>
+void TestTwoStage( Int n, Int bandwidth, bool print )
+{
+    typedef Base<Field> Real;
+    Output("Testing two-stage reduction with ",TypeName<Field>());
+    PushIndent();
+
+    Matrix<Field> A, AOrig;
+    Matrix<Field> householderScalars, bulgeReflectors, bulgeScalars;
+    Uniform( A, n, n );
+    AOrig = A;
+
+    HessenbergCtrl ctrl;
+    ctrl.approach = HESSENBERG_TWO_STAGE;
+    ctrl.bandwidth = bandwidth;
+    Timer timer;
+    timer.Start();
+    hessenberg::TwoStage
+    ( A, householderScalars, bulgeReflectors, bulgeScalars, ctrl );
+    Output(timer.Stop()," seconds");
+
+    // Overwrite H with Q H Q^H and compare against A
+    Matrix<Field> H( A );
+    MakeTrapezoidal( UPPER, H, -1 );
+    if( print )
+        Print( H, "H" );
+    hessenberg::ApplyQ
+    ( LEFT, NORMAL, A, householderScalars, bulgeReflectors, bulgeScalars, H );
+    hessenberg::ApplyQ
+    ( RIGHT, ADJOINT, A, householderScalars, bulgeReflectors, bulgeScalars,
+      H );
+    H -= AOrig;
+    const Real frobA = FrobeniusNorm( AOrig );
+    const Real relError =
+      FrobeniusNorm( H ) / (n*limits::Epsilon<Real>()*frobA);
+    Output("||A - Q H Q^H||_F / (eps n ||A||_F) = ",relError);
+    if( relError > Real(1) )
+        LogicError("Unacceptably large relative error");
+
+    PopIndent();
+}
+
+template<typename Field>
+void TestTwoStage( const Grid& grid, Int n, Int bandwidth, bool print )
+{
+    typedef Base<Field> Real;
+    OutputFromRoot
+    (grid.Comm(),"Testing two-stage reduction with ",TypeName<Field>());
+    PushIndent();
+
+    DistMatrix<Field> A(grid), AOrig(grid), bulgeReflectors(grid);
+    DistMatrix<Field,STAR,STAR> householderScalars(grid), bulgeScalars(grid);
+    Uniform( A, n, n );
+    AOrig = A;
+
+    HessenbergCtrl ctrl;
+    ctrl.approach = HESSENBERG_TWO_STAGE;
+    ctrl.bandwidth = bandwidth;
+    mpi::Barrier( grid.Comm() );
+    Timer timer;
+    timer.Start();
+    hessenberg::TwoStage
+    ( A, householderScalars, bulgeReflectors, bulgeScalars, ctrl );
+    mpi::Barrier( grid.Comm() );
+    OutputFromRoot(grid.Comm(),timer.Stop()," seconds");
+
+    // Overwrite H with Q H Q^H and compare against A
+    DistMatrix<Field> H( A );
+    MakeTrapezoidal( UPPER, H, -1 );
+    if( print )
+        Print( H, "H" );
+    hessenberg::ApplyQ
+    ( LEFT, NORMAL, A, householderScalars, bulgeReflectors, bulgeScalars, H );
+    hessenberg::ApplyQ
+    ( RIGHT, ADJOINT, A, householderScalars, bulgeReflectors, bulgeScalars,
+      H );
+    H -= AOrig;
+    const Real frobA = FrobeniusNorm( AOrig );
+    const Real relError =
+      FrobeniusNorm( H ) / (n*limits::Epsilon<Real>()*frobA);
+    OutputFromRoot
+    (grid.Comm(),"||A - Q H Q^H||_F / (eps n ||A||_F) = ",relError);
+    if( relError > Real(1) )
+        LogicError("Unacceptably large relative error");
+
+    PopIndent();
+}
+
 int
 main( int argc, char* argv[] )
 {
@@ -249,6 +337,9 @@ main( int argc, char* argv[] )
         const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
         const Int n = Input("--height","height of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool twoStage =
+          Input("--twoStage","test the two-stage reduction?",true);
+        const Int bandwidth = Input("--bandwidth","two-stage bandwidth",8);
         const bool sequential = Input("--sequential","test sequential?",true);
         const bool correctness =
           Input("--correctness","test correctness?",true);
@@ -346,6 +437,21 @@ main( int argc, char* argv[] )
         TestHessenberg<Complex<BigFloat>>
         ( grid, uplo, n, correctness, print, display );
 #endif
+
+        if( twoStage )
+        {
+            if( sequential && mpi::Rank() == 0 )
+            {
+                TestTwoStage<float>( n, bandwidth, print );
+                TestTwoStage<Complex<float>>( n, bandwidth, print );
+                TestTwoStage<double>( n, bandwidth, print );
+                TestTwoStage<Complex<double>>( n, bandwidth, print );
+            }
+            TestTwoStage<float>( grid, n, bandwidth, print );
+            TestTwoStage<Complex<float>>( grid, n, bandwidth, print );
+            TestTwoStage<double>( grid, n, bandwidth, print );
+            TestTwoStage<Complex<double>>( grid, n, bandwidth, print );
+        }
     }
     catch( exception& e ) { ReportException(e); }
 
@@ -174,6 +174,40 @@ void TestLU
     PopIndent();
 }
 
+template<typename Field>
+void TestTileLU
+( Int m,
+  Int tileSize,
+  bool forceGrowth,
+  bool print )
+{
+    Output("Testing tile LU with ",TypeName<Field>());
+    PushIndent();
+    Matrix<Field> A, AOrig;
+    Permutation P, Q;
+
+    if( forceGrowth )
+        GEPPGrowth( A, m );
+    else
+        Uniform( A, m, m );
+    AOrig = A;
+    if( print )
+        Print( A, "A" );
+
+    Output("Starting tile LU factorization...");
+    Timer timer;
+    timer.Start();
+    lu::Tile( A, P, tileSize );
+    const double runTime = timer.Stop();
+    const double realGFlops = 2./3.*Pow(double(m),3.)/(1.e9*runTime);
+    const double gFlops = IsComplex<Field>::value ? 4*realGFlops : realGFlops;
+    Output(runTime," seconds (",gFlops," GFlop/s)");
+    if( print )
+        Print( A, "A after tile factorization" );
+    TestCorrectness( AOrig, A, P, Q, 1, print );
+    PopIndent();
+}
+
 template<typename Field>
 void TestLU
 ( const Grid& grid,
@@ -248,6 +282,37 @@ void TestLU
     PopIndent();
 }
 
+// Factor two matrices of the same size with a shared workspace and demand that
+// the second factorization neither exceeds lu::WorkspaceSize nor allocates
+template<typename Field>
+void TestLUWorkspace( const Grid& grid, Int m )
+{
+    OutputFromRoot
+    (grid.Comm(),"Testing workspace reuse with ",TypeName<Field>());
+    PushIndent();
+    DistMatrix<Field> A(grid);
+    DistPermutation P(grid);
+    Workspace<Field> workspace;
+
+    Uniform( A, m, m );
+    const Int workspaceSize = lu::WorkspaceSize( A );
+    LU( A, P, workspace );
+    const Int numAllocations = workspace.NumAllocations();
+
+    Uniform( A, m, m );
+    LU( A, P, workspace );
+    OutputFromRoot
+    (grid.Comm(),"Workspace peak of ",workspace.Peak()," entries (bound of ",
+     workspaceSize,") with ",workspace.NumAllocations()," allocation(s)");
+    if( workspace.Peak() > workspaceSize )
+        LogicError
+        ("Workspace peak of ",workspace.Peak()," exceeded the bound of ",
+         workspaceSize);
+    if( workspace.NumAllocations() != numAllocations )
+        LogicError("Reusing the workspace required further allocations");
+    PopIndent();
+}
+
 int
 main( int argc, char* argv[] )
 {
@@ -264,6 +329,9 @@ main( int argc, char* argv[] )
         const bool forceGrowth = Input
             ("--forceGrowth","force element growth?",false);
         const bool sequential = Input("--sequential","test sequential?",true);
+        const bool tile =
+          Input("--tile","test the sequential tile factorization?",true);
+        const Int tileSize = Input("--tileSize","tile size",32);
         const bool correctness =
           Input("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
@@ -304,6 +372,14 @@ main( int argc, char* argv[] )
             TestLU<Complex<double>>
             ( m, pivot, correctness, forceGrowth, print );
 
+            if( tile )
+            {
+                TestTileLU<float>( m, tileSize, forceGrowth, print );
+                TestTileLU<Complex<float>>( m, tileSize, forceGrowth, print );
+                TestTileLU<double>( m, tileSize, forceGrowth, print );
+                TestTileLU<Complex<double>>( m, tileSize, forceGrowth, print );
+            }
+
 #ifdef EL_HAVE_QD
             TestLU<DoubleDouble>
             ( m, pivot, correctness, forceGrowth, print );
@@ -341,6 +417,9 @@ main( int argc, char* argv[] )
         TestLU<Complex<double>>
         ( grid, m, pivot, correctness, forceGrowth, print );
 
+        TestLUWorkspace<double>( grid, m );
+        TestLUWorkspace<Complex<double>>( grid, m );
+
 #ifdef EL_HAVE_QD
         TestLU<DoubleDouble>
         ( grid, m, pivot, correctness, forceGrowth, print );
@@ -367,7 +446,11 @@ main( int argc, char* argv[] )
         ( grid, m, pivot, correctness, forceGrowth, print );
 #endif
     }
-    catch( exception& e ) { ReportException(e); }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
 
     return 0;
 }
@@ -0,0 +1,160 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void WritePanels( const DistMatrix<Field>& A, OutOfCoreMatrix<Field>& AOOC )
+{
+    for( Int k=0; k<AOOC.NumPanels(); ++k )
+        AOOC.WritePanel( k, A(ALL,AOOC.PanelRange(k)) );
+}
+
+template<typename Field>
+void TestCholesky
+( const Grid& grid,
+  UpperOrLower uplo,
+  Int n,
+  Int panelWidth,
+  const string& directory,
+  Int numRHS )
+{
+    OutputFromRoot
+    (grid.Comm(),"Testing out-of-core Cholesky with ",TypeName<Field>());
+    PushIndent();
+
+    DistMatrix<Field> AOrig(grid);
+    HermitianUniformSpectrum( AOrig, n, 1e-3, 10 );
+    OutOfCoreMatrix<Field> A( n, n, panelWidth, grid, directory, "chol" );
+    WritePanels( AOrig, A );
+
+    mpi::Barrier( grid.Comm() );
+    Timer timer;
+    timer.Start();
+    Cholesky( uplo, A );
+    mpi::Barrier( grid.Comm() );
+    const double runTime = timer.Stop();
+    const double realGFlops = 1./3.*Pow(double(n),3.)/(1.e9*runTime);
+    const double gFlops =
+      ( IsComplex<Field>::value ? 4*realGFlops : realGFlops );
+    OutputFromRoot(grid.Comm(),runTime," seconds (",gFlops," GFlop/s)");
+
+    DistMatrix<Field> X(grid), Y(grid);
+    Uniform( X, n, numRHS );
+    Y = X;
+    cholesky::SolveAfter( uplo, NORMAL, A, Y );
+
+    auto E( X );
+    Hemm( LEFT, uplo, Field(-1), AOrig, Y, Field(1), E );
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Real relError =
+      InfinityNorm( E ) / (eps*n*Max(OneNorm(AOrig),OneNorm(X)));
+    OutputFromRoot
+    (grid.Comm(),
+     "|| X - A Y ||_oo / (eps n Max(||A||_1,||X||_1)) = ",relError);
+    if( relError > Real(100) )
+        LogicError("Relative error was unacceptably large");
+    PopIndent();
+}
+
+template<typename Field>
+void TestLU
+( const Grid& grid,
+  Int n,
+  Int panelWidth,
+  const string& directory,
+  Int numRHS )
+{
+    OutputFromRoot
+    (grid.Comm(),"Testing out-of-core LU with ",TypeName<Field>());
+    PushIndent();
+
+    DistMatrix<Field> AOrig(grid);
+    Uniform( AOrig, n, n );
+    OutOfCoreMatrix<Field> A( n, n, panelWidth, grid, directory, "lu" );
+    WritePanels( AOrig, A );
+
+    DistPermutation P(grid);
+    mpi::Barrier( grid.Comm() );
+    Timer timer;
+    timer.Start();
+    LU( A, P );
+    mpi::Barrier( grid.Comm() );
+    const double runTime = timer.Stop();
+    const double realGFlops = 2./3.*Pow(double(n),3.)/(1.e9*runTime);
+    const double gFlops =
+      ( IsComplex<Field>::value ? 4*realGFlops : realGFlops );
+    OutputFromRoot(grid.Comm(),runTime," seconds (",gFlops," GFlop/s)");
+
+    for( const Orientation orientation : { NORMAL, ADJOINT } )
+    {
+        DistMatrix<Field> X(grid), Y(grid);
+        Uniform( X, n, numRHS );
+        Y = X;
+        lu::SolveAfter( orientation, A, P, Y );
+
+        auto E( X );
+        Gemm( orientation, NORMAL, Field(-1), AOrig, Y, Field(1), E );
+        typedef Base<Field> Real;
+        const Real eps = limits::Epsilon<Real>();
+        const Real relError =
+          InfinityNorm( E ) / (eps*n*Max(OneNorm(AOrig),OneNorm(X)));
+        OutputFromRoot
+        (grid.Comm(),
+         "|| X - op(A) Y ||_oo / (eps n Max(||A||_1,||X||_1)) = ",relError);
+        if( relError > Real(100) )
+            LogicError("Relative error was unacceptably large");
+    }
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        Int gridHeight = Input("--gridHeight","process grid height",0);
+        const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
+        const Int n = Input("--n","size of matrix",500);
+        const Int panelWidth =
+          Input("--panelWidth","out-of-core panel width",96);
+        const Int nb = Input("--nb","algorithmic blocksize",32);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",10);
+        const string directory =
+          Input("--directory","directory for the panel files",string("."));
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const Grid grid( comm, gridHeight );
+        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        TestCholesky<float>( grid, uplo, n, panelWidth, directory, numRHS );
+        TestCholesky<Complex<float>>
+        ( grid, uplo, n, panelWidth, directory, numRHS );
+        TestCholesky<double>( grid, uplo, n, panelWidth, directory, numRHS );
+        TestCholesky<Complex<double>>
+        ( grid, uplo, n, panelWidth, directory, numRHS );
+
+        TestLU<float>( grid, n, panelWidth, directory, numRHS );
+        TestLU<Complex<float>>( grid, n, panelWidth, directory, numRHS );
+        TestLU<double>( grid, n, panelWidth, directory, numRHS );
+        TestLU<Complex<double>>( grid, n, panelWidth, directory, numRHS );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -164,6 +164,44 @@ void TestQR
     PopIndent();
 }
 
+template<typename Field>
+void TestTileQR
+( Int m,
+  Int n,
+  Int tileSize,
+  bool print )
+{
+    Output("Testing tile QR with ",TypeName<Field>());
+    PushIndent();
+    Matrix<Field> A, AOrig;
+    Matrix<Field> householderScalars;
+    Matrix<Base<Field>> signature;
+
+    Uniform( A, m, n );
+    AOrig = A;
+    if( print )
+        Print( A, "A" );
+    const double mD = double(m);
+    const double nD = double(n);
+
+    Timer timer;
+    Output("Starting tile QR factorization...");
+    timer.Start();
+    qr::Tile( A, householderScalars, signature, tileSize );
+    const double runTime = timer.Stop();
+    const double realGFlops = (2.*mD*nD*nD - 2./3.*nD*nD*nD)/(1.e9*runTime);
+    const double gFlops = IsComplex<Field>::value ? 4*realGFlops : realGFlops;
+    Output("Tile: ",runTime," seconds. GFlops = ",gFlops);
+    if( print )
+    {
+        Print( A, "A after tile factorization" );
+        Print( householderScalars, "householderScalars" );
+        Print( signature, "signature" );
+    }
+    TestCorrectness( A, householderScalars, signature, AOrig );
+    PopIndent();
+}
+
 template<typename Field>
 void TestQR
 ( const Grid& grid,
@@ -207,6 +245,38 @@ void TestQR
     PopIndent();
 }
 
+// Factor two matrices of the same size with a shared workspace and demand that
+// the second factorization neither exceeds qr::WorkspaceSize nor allocates
+template<typename Field>
+void TestQRWorkspace( const Grid& grid, Int m, Int n )
+{
+    OutputFromRoot
+    (grid.Comm(),"Testing workspace reuse with ",TypeName<Field>());
+    PushIndent();
+    DistMatrix<Field> A(grid);
+    DistMatrix<Field,MD,STAR> householderScalars(grid);
+    DistMatrix<Base<Field>,MD,STAR> signature(grid);
+    Workspace<Field> workspace;
+
+    Uniform( A, m, n );
+    const Int workspaceSize = qr::WorkspaceSize( A );
+    QR( A, householderScalars, signature, workspace );
+    const Int numAllocations = workspace.NumAllocations();
+
+    Uniform( A, m, n );
+    QR( A, householderScalars, signature, workspace );
+    OutputFromRoot
+    (grid.Comm(),"Workspace peak of ",workspace.Peak()," entries (bound of ",
+     workspaceSize,") with ",workspace.NumAllocations()," allocation(s)");
+    if( workspace.Peak() > workspaceSize )
+        LogicError
+        ("Workspace peak of ",workspace.Peak()," exceeded the bound of ",
+         workspaceSize);
+    if( workspace.NumAllocations() != numAllocations )
+        LogicError("Reusing the workspace required further allocations");
+    PopIndent();
+}
+
 int
 main( int argc, char* argv[] )
 {
@@ -221,6 +291,9 @@ main( int argc, char* argv[] )
         const Int n = Input("--width","width of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",64);
         const bool sequential = Input("--sequential","test sequential?",true);
+        const bool tile =
+          Input("--tile","test the sequential tile factorization?",true);
+        const Int tileSize = Input("--tileSize","tile size",32);
         const bool correctness =
           Input("--correctness","test correctness?",true);
 #ifdef EL_HAVE_MPC
@@ -253,6 +326,14 @@ main( int argc, char* argv[] )
             TestQR<Complex<double>>
             ( m, n, correctness, print );
 
+            if( tile )
+            {
+                TestTileQR<float>( m, n, tileSize, print );
+                TestTileQR<Complex<float>>( m, n, tileSize, print );
+                TestTileQR<double>( m, n, tileSize, print );
+                TestTileQR<Complex<double>>( m, n, tileSize, print );
+            }
+
 #ifdef EL_HAVE_QD
             TestQR<DoubleDouble>
             ( m, n, correctness, print );
@@ -290,6 +371,9 @@ main( int argc, char* argv[] )
         TestQR<Complex<double>>
         ( grid, m, n, correctness, print );
 
+        TestQRWorkspace<double>( grid, m, n );
+        TestQRWorkspace<Complex<double>>( grid, m, n );
+
 #ifdef EL_HAVE_QD
         TestQR<DoubleDouble>
         ( grid, m, n, correctness, print );
@@ -316,7 +400,11 @@ main( int argc, char* argv[] )
         ( grid, m, n, correctness, print );
 #endif
     }
-    catch( exception& e ) { ReportException(e); }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
 
     return 0;
 }
@@ -0,0 +1,293 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Check that Q R matches A, that Q has orthonormal columns, and that R is
+// upper-triangular
+template<typename F>
+void CheckFactorization
+( const DistMatrix<F>& A, const DistMatrix<F>& Q, const DistMatrix<F>& R,
+  const std::string& name )
+{
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Grid& g = A.Grid();
+    const Real eps = limits::Epsilon<Real>();
+    const Real oneNormA = OneNorm( A );
+
+    DistMatrix<F> E( A );
+    Gemm( NORMAL, NORMAL, F(-1), Q, R, F(1), E );
+    const Real relError = OneNorm( E ) / oneNormA;
+
+    DistMatrix<F> Z(g);
+    Identity( Z, n, n );
+    Herk( UPPER, ADJOINT, Real(-1), Q, Real(1), Z );
+    const Real orthogError = HermitianOneNorm( UPPER, Z );
+
+    DistMatrix<F> L( R );
+    MakeTrapezoidal( LOWER, L, -1 );
+    const Real lowerNorm = FrobeniusNorm( L );
+
+    OutputFromRoot
+    (g.Comm(),name,": || A - Q R ||_1 / || A ||_1 = ",relError,
+     ", || I - Q^H Q ||_1 = ",orthogError);
+    if( relError > 100*Max(m,n)*eps || orthogError > 100*Max(m,n)*eps ||
+        lowerNorm != Real(0) )
+        LogicError(name," produced an inaccurate factorization");
+}
+
+template<typename F>
+void CheckFactorization
+( const Matrix<F>& A, const Matrix<F>& Q, const Matrix<F>& R,
+  const std::string& name )
+{
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Real eps = limits::Epsilon<Real>();
+    const Real oneNormA = OneNorm( A );
+
+    Matrix<F> E( A );
+    Gemm( NORMAL, NORMAL, F(-1), Q, R, F(1), E );
+    const Real relError = OneNorm( E ) / oneNormA;
+
+    Matrix<F> Z;
+    Identity( Z, n, n );
+    Herk( UPPER, ADJOINT, Real(-1), Q, Real(1), Z );
+    const Real orthogError = HermitianOneNorm( UPPER, Z );
+
+    Matrix<F> L( R );
+    MakeTrapezoidal( LOWER, L, -1 );
+    const Real lowerNorm = FrobeniusNorm( L );
+
+    Output
+    (name,": || A - Q R ||_1 / || A ||_1 = ",relError,
+     ", || I - Q^H Q ||_1 = ",orthogError);
+    if( relError > 100*Max(m,n)*eps || orthogError > 100*Max(m,n)*eps ||
+        lowerNorm != Real(0) )
+        LogicError(name," produced an inaccurate factorization");
+}
+
+// Columns which (partially) lie in range(Q): the first is a combination of
+// the columns of Q and the second is a multiple of the first, while the rest
+// are generic
+template<typename F>
+void InRangeColumns( const Matrix<F>& Q, Int k, Matrix<F>& C )
+{
+    const Int m = Q.Height();
+    const Int n = Q.Width();
+    Matrix<F> Y;
+    Uniform( Y, n, 1 );
+    Uniform( C, m, k );
+    auto c0 = C( ALL, IR(0) );
+    Gemm( NORMAL, NORMAL, F(1), Q, Y, c0 );
+    if( k > 1 )
+    {
+        auto c1 = C( ALL, IR(1) );
+        c1 = c0;
+        c1 *= F(2);
+    }
+}
+
+template<typename F>
+void InRangeColumns( const DistMatrix<F>& Q, Int k, DistMatrix<F>& C )
+{
+    const Grid& g = Q.Grid();
+    const Int m = Q.Height();
+    const Int n = Q.Width();
+    DistMatrix<F> Y(g);
+    Uniform( Y, n, 1 );
+    Uniform( C, m, k );
+    auto c0 = C( ALL, IR(0) );
+    Gemm( NORMAL, NORMAL, F(1), Q, Y, c0 );
+    if( k > 1 )
+    {
+        auto c1 = C( ALL, IR(1) );
+        c1 = c0;
+        c1 *= F(2);
+    }
+}
+
+template<typename F>
+void TestSequentialQRMod( Int m, Int n, Int k )
+{
+    Output("Testing sequential updates with ",TypeName<F>());
+    PushIndent();
+
+    Matrix<F> A, Q, R;
+    Uniform( A, m, n );
+    Q = A;
+    qr::Explicit( Q, R );
+
+    const Int j = n/2;
+    Matrix<F> C, ANew;
+    Uniform( C, m, k );
+    Zeros( ANew, m, n+k );
+    ANew( ALL, IR(0,j) ) = A( ALL, IR(0,j) );
+    ANew( ALL, IR(j,j+k) ) = C;
+    ANew( ALL, IR(j+k,n+k) ) = A( ALL, IR(j,n) );
+    qr::InsertColumns( Q, R, j, C );
+    CheckFactorization( ANew, Q, R, "InsertColumns" );
+
+    qr::DeleteColumns( Q, R, j, k );
+    CheckFactorization( A, Q, R, "DeleteColumns" );
+
+    Matrix<F> D;
+    Uniform( D, k, n );
+    Zeros( ANew, m+k, n );
+    ANew( IR(0,k), ALL ) = D;
+    ANew( IR(k,m+k), ALL ) = A;
+    qr::InsertRows( Q, R, 0, D );
+    CheckFactorization( ANew, Q, R, "InsertRows" );
+
+    qr::DeleteRows( Q, R, 0, k );
+    CheckFactorization( A, Q, R, "DeleteRows" );
+
+    Matrix<F> U, V;
+    Uniform( U, m, k );
+    Uniform( V, n, k );
+    Gemm( NORMAL, ADJOINT, F(1), U, V, F(1), A );
+    qr::Mod( Q, R, U, V );
+    CheckFactorization( A, Q, R, "Mod" );
+
+    // Columns within range(Q) leave rank-deficient remainders
+    InRangeColumns( Q, k, C );
+    Zeros( ANew, m, n+k );
+    ANew( ALL, IR(0,j) ) = A( ALL, IR(0,j) );
+    ANew( ALL, IR(j,j+k) ) = C;
+    ANew( ALL, IR(j+k,n+k) ) = A( ALL, IR(j,n) );
+    Matrix<F> QNew( Q ), RNew( R );
+    qr::InsertColumns( QNew, RNew, j, C );
+    CheckFactorization( ANew, QNew, RNew, "InsertColumns within range(Q)" );
+
+    InRangeColumns( Q, k, U );
+    Gemm( NORMAL, ADJOINT, F(1), U, V, F(1), A );
+    qr::Mod( Q, R, U, V );
+    CheckFactorization( A, Q, R, "Mod within range(Q)" );
+
+    PopIndent();
+}
+
+template<typename F>
+void TestQRMod( const Grid& g, Int m, Int n, Int k, bool print )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+
+    DistMatrix<F> A(g), Q(g), R(g);
+    Uniform( A, m, n );
+    Q = A;
+    qr::Explicit( Q, R );
+    if( print )
+        Print( A, "A" );
+
+    // Insert k columns into the middle
+    const Int j = n/2;
+    DistMatrix<F> C(g), ANew(g);
+    Uniform( C, m, k );
+    Zeros( ANew, m, n+k );
+    ANew( ALL, IR(0,j) ) = A( ALL, IR(0,j) );
+    ANew( ALL, IR(j,j+k) ) = C;
+    ANew( ALL, IR(j+k,n+k) ) = A( ALL, IR(j,n) );
+    qr::InsertColumns( Q, R, j, C );
+    CheckFactorization( ANew, Q, R, "InsertColumns" );
+
+    // ...and delete them again
+    qr::DeleteColumns( Q, R, j, k );
+    CheckFactorization( A, Q, R, "DeleteColumns" );
+
+    // Insert k rows at the top
+    DistMatrix<F> D(g);
+    Uniform( D, k, n );
+    Zeros( ANew, m+k, n );
+    ANew( IR(0,k), ALL ) = D;
+    ANew( IR(k,m+k), ALL ) = A;
+    qr::InsertRows( Q, R, 0, D );
+    CheckFactorization( ANew, Q, R, "InsertRows" );
+
+    // ...and delete them again
+    qr::DeleteRows( Q, R, 0, k );
+    CheckFactorization( A, Q, R, "DeleteRows" );
+
+    // Rank-k modification
+    DistMatrix<F> U(g), V(g);
+    Uniform( U, m, k );
+    Uniform( V, n, k );
+    Gemm( NORMAL, ADJOINT, F(1), U, V, F(1), A );
+    qr::Mod( Q, R, U, V );
+    CheckFactorization( A, Q, R, "Mod" );
+
+    // Appending columns to a packed factorization should match a fresh one
+    DistMatrix<F> APacked( A ), householderScalars(g);
+    DistMatrix<Base<F>> signature(g);
+    QR( APacked, householderScalars, signature );
+    qr::AppendColumns( APacked, householderScalars, signature, C );
+    Zeros( ANew, m, n+k );
+    ANew( ALL, IR(0,n) ) = A;
+    ANew( ALL, IR(n,n+k) ) = C;
+    Q = ANew;
+    qr::ApplyQ( LEFT, ADJOINT, APacked, householderScalars, signature, Q );
+    MakeTrapezoidal( LOWER, Q, -1 );
+    const Base<F> lowerNorm = FrobeniusNorm( Q );
+    OutputFromRoot(g.Comm(),"AppendColumns: || tril(Q^H A, -1) ||_F = ",
+      lowerNorm);
+    if( lowerNorm > 100*Max(m,n)*limits::Epsilon<Base<F>>()*OneNorm(ANew) )
+        LogicError("AppendColumns produced an inaccurate factorization");
+
+    // Columns within range(Q) leave rank-deficient remainders
+    Q = A;
+    qr::Explicit( Q, R );
+    InRangeColumns( Q, k, C );
+    Zeros( ANew, m, n+k );
+    ANew( ALL, IR(0,j) ) = A( ALL, IR(0,j) );
+    ANew( ALL, IR(j,j+k) ) = C;
+    ANew( ALL, IR(j+k,n+k) ) = A( ALL, IR(j,n) );
+    DistMatrix<F> QNew( Q ), RNew( R );
+    qr::InsertColumns( QNew, RNew, j, C );
+    CheckFactorization( ANew, QNew, RNew, "InsertColumns within range(Q)" );
+
+    InRangeColumns( Q, k, U );
+    Gemm( NORMAL, ADJOINT, F(1), U, V, F(1), A );
+    qr::Mod( Q, R, U, V );
+    CheckFactorization( A, Q, R, "Mod within range(Q)" );
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",300);
+        const Int n = Input("--n","width of matrix",100);
+        const Int k = Input("--k","number of modified rows/columns",8);
+        const Int nb = Input("--nb","algorithmic blocksize",32);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        SetBlocksize( nb );
+        const Grid g( comm );
+        TestQRMod<float>( g, m, n, k, print );
+        TestQRMod<Complex<double>>( g, m, n, k, print );
+        if( mpi::Rank(comm) == 0 )
+        {
+            TestSequentialQRMod<float>( m, n, k );
+            TestSequentialQRMod<Complex<double>>( m, n, k );
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,200 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void TestSequentialRFP( Int n, Int k, Int numRHS, bool print )
+{
+    Output("Testing sequential RFP Cholesky with ",TypeName<F>());
+    PushIndent();
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+
+    // Form A := G G^H + n I both in full and in packed storage
+    Matrix<F> G, A;
+    Uniform( G, n, k );
+    Identity( A, n, n );
+    RFPMatrix<F> APacked;
+    PackRFP( LOWER, A, APacked );
+    Herk( NORMAL, Real(1), G, Real(n), APacked );
+    Gemm( NORMAL, ADJOINT, F(1), G, G, F(n), A );
+    const Real AFrob = FrobeniusNorm( A );
+
+    Matrix<F> AUnpacked;
+    UnpackRFP( APacked, AUnpacked );
+    if( print )
+    {
+        Print( APacked.LockedPacked(), "APacked" );
+        Print( AUnpacked, "AUnpacked" );
+    }
+    AUnpacked -= A;
+    const Real herkErr = FrobeniusNorm( AUnpacked ) / (eps*n*AFrob);
+    Output("|| A - Unpack(Herk) ||_F / (eps n || A ||_F) = ",herkErr);
+    if( herkErr > Real(100) )
+        LogicError("Packed Herk error was unacceptably large");
+
+    // The packed tridiagonalization should match the full one
+    RFPMatrix<F> ATri( APacked );
+    Matrix<F> householderScalars, ATriFull, ARef( A ), householderScalarsRef;
+    HermitianTridiag( ATri, householderScalars );
+    HermitianTridiag( LOWER, ARef, householderScalarsRef );
+    UnpackRFP( ATri, ATriFull );
+    MakeTrapezoidal( LOWER, ATriFull );
+    MakeTrapezoidal( LOWER, ARef );
+    ATriFull -= ARef;
+    const Real tridiagErr = FrobeniusNorm( ATriFull ) / (eps*n*AFrob);
+    Output("|| Tridiag(Packed) - Tridiag(A) ||_F / (eps n || A ||_F) = ",
+      tridiagErr);
+    if( tridiagErr > Real(100) )
+        LogicError("Packed tridiagonalization differed from the full one");
+
+    Timer timer;
+    timer.Start();
+    Cholesky( APacked );
+    const double runTime = timer.Stop();
+    const double realGFlops = (1./3.)*Pow(double(n),3.)/(1.e9*runTime);
+    const double gFlops = ( IsComplex<F>::value ? 4*realGFlops : realGFlops );
+    Output("Cholesky: ",runTime," seconds (",gFlops," GFlop/s)");
+
+    Matrix<F> X, Y;
+    Uniform( X, n, numRHS );
+    Zeros( Y, n, numRHS );
+    Gemm( NORMAL, NORMAL, F(1), A, X, F(0), Y );
+    const Real oneNormY = OneNorm( Y );
+    cholesky::SolveAfter( NORMAL, APacked, Y );
+    X -= Y;
+    const Real relErr = InfinityNorm( X ) / (eps*n*oneNormY);
+    Output("||X - A \\ Y ||_oo / (eps n || Y ||_1) = ",relErr);
+    if( relErr > Real(100) )
+        LogicError("Relative error was unacceptably large");
+    PopIndent();
+}
+
+template<typename F>
+void TestRFP( const Grid& g, Int n, Int k, Int numRHS, bool print )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing distributed RFP Cholesky with ",TypeName<F>());
+    PushIndent();
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+
+    DistMatrix<F> G(g), A(g);
+    Uniform( G, n, k );
+    Identity( A, n, n );
+    DistRFPMatrix<F> APacked(g);
+    PackRFP( LOWER, A, APacked );
+    Herk( NORMAL, Real(1), G, Real(n), APacked );
+    Gemm( NORMAL, ADJOINT, F(1), G, G, F(n), A );
+    const Real AFrob = FrobeniusNorm( A );
+
+    DistMatrix<F> AUnpacked(g);
+    UnpackRFP( APacked, AUnpacked );
+    if( print )
+    {
+        Print( APacked.LockedPacked(), "APacked" );
+        Print( AUnpacked, "AUnpacked" );
+    }
+    AUnpacked -= A;
+    const Real herkErr = FrobeniusNorm( AUnpacked ) / (eps*n*AFrob);
+    OutputFromRoot
+    (g.Comm(),"|| A - Unpack(Herk) ||_F / (eps n || A ||_F) = ",herkErr);
+    if( herkErr > Real(100) )
+        LogicError("Packed Herk error was unacceptably large");
+
+    DistRFPMatrix<F> ATri( APacked );
+    DistMatrix<F,STAR,STAR> householderScalars(g), householderScalarsRef(g);
+    DistMatrix<F> ATriFull(g), ARef( A );
+    HermitianTridiag( ATri, householderScalars );
+    HermitianTridiag( LOWER, ARef, householderScalarsRef );
+    UnpackRFP( ATri, ATriFull );
+    MakeTrapezoidal( LOWER, ATriFull );
+    MakeTrapezoidal( LOWER, ARef );
+    ATriFull -= ARef;
+    const Real tridiagErr = FrobeniusNorm( ATriFull ) / (eps*n*AFrob);
+    OutputFromRoot
+    (g.Comm(),"|| Tridiag(Packed) - Tridiag(A) ||_F / (eps n || A ||_F) = ",
+     tridiagErr);
+    if( tridiagErr > Real(100) )
+        LogicError("Packed tridiagonalization differed from the full one");
+
+    Timer timer;
+    mpi::Barrier( g.Comm() );
+    if( g.Rank() == 0 )
+        timer.Start();
+    Cholesky( APacked );
+    mpi::Barrier( g.Comm() );
+    if( g.Rank() == 0 )
+    {
+        const double runTime = timer.Stop();
+        const double realGFlops = (1./3.)*Pow(double(n),3.)/(1.e9*runTime);
+        const double gFlops =
+          ( IsComplex<F>::value ? 4*realGFlops : realGFlops );
+        Output("Cholesky: ",runTime," seconds (",gFlops," GFlop/s)");
+    }
+
+    DistMatrix<F> X(g), Y(g);
+    Uniform( X, n, numRHS );
+    Zeros( Y, n, numRHS );
+    Gemm( NORMAL, NORMAL, F(1), A, X, F(0), Y );
+    const Real oneNormY = OneNorm( Y );
+    cholesky::SolveAfter( NORMAL, APacked, Y );
+    X -= Y;
+    const Real relErr = InfinityNorm( X ) / (eps*n*oneNormY);
+    OutputFromRoot
+    (g.Comm(),"||X - A \\ Y ||_oo / (eps n || Y ||_1) = ",relErr);
+    if( relErr > Real(100) )
+        LogicError("Relative error was unacceptably large");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        Int gridHeight = Input("--gridHeight","process grid height",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int n = Input("--n","size of HPD matrix",101);
+        const Int k = Input("--k","rank of the Herk update",50);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",10);
+        const Int nb = Input("--nb","algorithmic blocksize",32);
+        const bool sequential = Input("--sequential","test sequential?",true);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const GridOrder order = colMajor ? COLUMN_MAJOR : ROW_MAJOR;
+        const Grid g( comm, gridHeight, order );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( sequential && mpi::Rank(comm) == 0 )
+        {
+            TestSequentialRFP<float>( n, k, numRHS, print );
+            TestSequentialRFP<Complex<float>>( n, k, numRHS, print );
+            TestSequentialRFP<double>( n, k, numRHS, print );
+            TestSequentialRFP<Complex<double>>( n, k, numRHS, print );
+        }
+
+        TestRFP<float>( g, n, k, numRHS, print );
+        TestRFP<Complex<float>>( g, n, k, numRHS, print );
+        TestRFP<double>( g, n, k, numRHS, print );
+        TestRFP<Complex<double>>( g, n, k, numRHS, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -20,6 +20,8 @@ void TestSequentialSVD
   bool wantU,
   bool wantV,
   bool useQR,
+  bool useQDWH,
+  bool useJacobi,
   bool penalizeDerivative,
   Int divideCutoff,
   bool print )
@@ -40,6 +42,8 @@ void TestSequentialSVD
 
     SVDCtrl<Real> ctrl;
     ctrl.bidiagSVDCtrl.useQR = useQR;
+    ctrl.useQDWH = useQDWH;
+    ctrl.useJacobi = useJacobi;
     ctrl.bidiagSVDCtrl.wantU = wantU; 
     ctrl.bidiagSVDCtrl.wantV = wantV;
     ctrl.bidiagSVDCtrl.approach = approach;
@@ -166,6 +170,8 @@ void TestDistributedSVD
   bool wantU,
   bool wantV,
   bool useQR,
+  bool useQDWH,
+  bool useJacobi,
   bool penalizeDerivative,
   Int divideCutoff,
   bool print )
@@ -189,6 +195,8 @@ void TestDistributedSVD
     // Compute the SVD of A 
     SVDCtrl<Real> ctrl;
     ctrl.bidiagSVDCtrl.useQR = useQR;
+    ctrl.useQDWH = useQDWH;
+    ctrl.useJacobi = useJacobi;
     ctrl.bidiagSVDCtrl.wantU = wantU; 
     ctrl.bidiagSVDCtrl.wantV = wantV;
     ctrl.bidiagSVDCtrl.approach = approach;
@@ -344,6 +352,8 @@ void TestSVD
   bool wantU,
   bool wantV,
   bool useQR,
+  bool useQDWH,
+  bool useJacobi,
   bool penalizeDerivative,
   Int divideCutoff,
   bool print )
@@ -353,13 +363,14 @@ void TestSVD
     {
         TestSequentialSVD<F>
         ( m, n, rank, approach, tolType, tol, time, progress, wantU, wantV,
-          useQR, penalizeDerivative, divideCutoff, print );
+          useQR, useQDWH, useJacobi, penalizeDerivative, divideCutoff, print );
     }
     if( testDist )
     {
         TestDistributedSVD<F> 
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          wantU, wantV, useQR, penalizeDerivative, divideCutoff, print );
+          wantU, wantV, useQR, useQDWH, useJacobi, penalizeDerivative,
+          divideCutoff, print );
     }
 }
 
@@ -394,6 +405,9 @@ main( int argc, char* argv[] )
         const bool wantU = Input("--wantU","compute U?",true);
         const bool wantV = Input("--wantV","compute V?",true);
         const bool useQR = Input("--useQR","force use of QR algorithm?",false);
+        const bool useQDWH = Input("--useQDWH","use QDWH-SVD?",false);
+        const bool useJacobi =
+          Input("--useJacobi","use blocked one-sided Jacobi?",false);
         const bool penalizeDerivative =
           Input
           ("--penalizeDerivative","penalize secular derivative in D&C?",false);
@@ -421,62 +435,62 @@ main( int argc, char* argv[] )
 
         TestSVD<float>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useQDWH, useJacobi,
+          penalizeDerivative, divideCutoff, print );
         TestSVD<Complex<float>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useQDWH, useJacobi,
+          penalizeDerivative, divideCutoff, print );
 
         TestSVD<double>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useQDWH, useJacobi,
+          penalizeDerivative, divideCutoff, print );
         TestSVD<Complex<double>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useQDWH, useJacobi,
+          penalizeDerivative, divideCutoff, print );
 
 #ifdef EL_HAVE_QD
         TestSVD<DoubleDouble>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useQDWH, useJacobi,
+          penalizeDerivative, divideCutoff, print );
         TestSVD<Complex<DoubleDouble>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useQDWH, useJacobi,
+          penalizeDerivative, divideCutoff, print );
 
         TestSVD<QuadDouble>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useQDWH, useJacobi,
+          penalizeDerivative, divideCutoff, print );
         TestSVD<Complex<QuadDouble>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useQDWH, useJacobi,
+          penalizeDerivative, divideCutoff, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestSVD<Quad>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useQDWH, useJacobi,
+          penalizeDerivative, divideCutoff, print );
         TestSVD<Complex<Quad>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useQDWH, useJacobi,
+          penalizeDerivative, divideCutoff, print );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestSVD<BigFloat>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useQDWH, useJacobi,
+          penalizeDerivative, divideCutoff, print );
         TestSVD<Complex<BigFloat>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useQDWH, useJacobi,
+          penalizeDerivative, divideCutoff, print );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
@@ -0,0 +1,125 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Form the shifted 7-point finite-difference Laplacian over an
+// n1 x n2 x n3 grid (which is Hermitian positive-definite)
+template<typename Field>
+void ShiftedLaplacian( SparseMatrix<Field>& A, Int n1, Int n2, Int n3 )
+{
+    const Int n = n1*n2*n3;
+    Zeros( A, n, n );
+    A.Reserve( 7*n );
+    for( Int i3=0; i3<n3; ++i3 )
+    {
+        for( Int i2=0; i2<n2; ++i2 )
+        {
+            for( Int i1=0; i1<n1; ++i1 )
+            {
+                const Int s = i1 + i2*n1 + i3*n1*n2;
+                A.QueueUpdate( s, s, Field(7) );
+                if( i1 > 0 )    A.QueueUpdate( s, s-1, Field(-1) );
+                if( i1 < n1-1 ) A.QueueUpdate( s, s+1, Field(-1) );
+                if( i2 > 0 )    A.QueueUpdate( s, s-n1, Field(-1) );
+                if( i2 < n2-1 ) A.QueueUpdate( s, s+n1, Field(-1) );
+                if( i3 > 0 )    A.QueueUpdate( s, s-n1*n2, Field(-1) );
+                if( i3 < n3-1 ) A.QueueUpdate( s, s+n1*n2, Field(-1) );
+            }
+        }
+    }
+    A.ProcessQueues();
+}
+
+template<typename Field>
+void TestSparseLDL
+( Int n1,
+  Int n2,
+  Int n3,
+  Int numRHS,
+  bool natural,
+  const BisectCtrl& ctrl )
+{
+    Output("Testing with ",TypeName<Field>());
+    PushIndent();
+    typedef Base<Field> Real;
+
+    SparseMatrix<Field> A;
+    ShiftedLaplacian( A, n1, n2, n3 );
+    const Int n = A.Height();
+
+    Matrix<Field> X, B;
+    Uniform( X, n, numRHS );
+    Zeros( B, n, numRHS );
+    Multiply( NORMAL, Field(1), A, X, Field(0), B );
+    const Real BFrob = FrobeniusNorm( B );
+
+    Timer timer;
+    SparseLDLFactorization<Field> sparseLDLFact;
+    timer.Start();
+    if( natural )
+        sparseLDLFact.Initialize3DGridGraph( n1, n2, n3, A, true, ctrl );
+    else
+        sparseLDLFact.Initialize( A, true, ctrl );
+    Output("Analysis: ",timer.Stop()," seconds");
+
+    timer.Start();
+    sparseLDLFact.Factor();
+    const double factorTime = timer.Stop();
+    Output
+    ("Factorization: ",factorTime," seconds (",
+     sparseLDLFact.FactorGFlops()/factorTime," GFlop/s)");
+
+    auto Y( B );
+    timer.Start();
+    sparseLDLFact.Solve( Y );
+    Output("Solve: ",timer.Stop()," seconds");
+
+    Multiply( NORMAL, Field(-1), A, Y, Field(1), B );
+    const Real eps = limits::Epsilon<Real>();
+    const Real relResid = FrobeniusNorm( B ) / (eps*BFrob);
+    Output("|| B - A X ||_F / (eps || B ||_F) = ",relResid);
+    if( relResid > Real(1000) )
+        LogicError("Relative residual was unacceptably large");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",15);
+        const Int n2 = Input("--n2","second grid dimension",15);
+        const Int n3 = Input("--n3","third grid dimension",15);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",5);
+        const Int cutoff = Input("--cutoff","cutoff for nested dissection",64);
+        const Int numSeqSeps =
+          Input("--numSeqSeps","number of separators to try per level",3);
+        const bool natural =
+          Input("--natural","analytical nested-dissection?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        BisectCtrl ctrl;
+        ctrl.cutoff = cutoff;
+        ctrl.numSeqSeps = numSeqSeps;
+        ComplainIfDebug();
+
+        TestSparseLDL<float>( n1, n2, n3, numRHS, natural, ctrl );
+        TestSparseLDL<Complex<float>>( n1, n2, n3, numRHS, natural, ctrl );
+        TestSparseLDL<double>( n1, n2, n3, numRHS, natural, ctrl );
+        TestSparseLDL<Complex<double>>( n1, n2, n3, numRHS, natural, ctrl );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
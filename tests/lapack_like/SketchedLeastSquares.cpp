@@ -0,0 +1,83 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void TestSketch
+( const Grid& g, Int m, Int n, Int numRHS, SketchType sketch, bool print )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing ",
+     ( sketch == GAUSSIAN_SKETCH ? "Gaussian" : "sparse" ),
+     " sketches with ",TypeName<F>());
+    PushIndent();
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+
+    DistMatrix<F> A(g), B(g), X(g), XDirect(g);
+    Uniform( A, m, n );
+    Uniform( B, m, numRHS );
+    if( print )
+    {
+        Print( A, "A" );
+        Print( B, "B" );
+    }
+
+    mpi::Barrier( g.Comm() );
+    Timer timer;
+    timer.Start();
+    LeastSquares( NORMAL, A, B, XDirect );
+    mpi::Barrier( g.Comm() );
+    OutputFromRoot(g.Comm(),"Direct solve: ",timer.Stop()," secs");
+
+    SketchedLeastSquaresCtrl<Real> ctrl;
+    ctrl.sketch = sketch;
+    timer.Start();
+    LeastSquares( NORMAL, A, B, X, ctrl );
+    mpi::Barrier( g.Comm() );
+    OutputFromRoot(g.Comm(),"Sketched solve: ",timer.Stop()," secs");
+    if( print )
+        Print( X, "X" );
+
+    const Real XFrob = FrobeniusNorm( XDirect );
+    X -= XDirect;
+    const Real relErr = FrobeniusNorm( X ) / (eps*m*XFrob);
+    OutputFromRoot
+    (g.Comm(),"|| X - X_direct ||_F / (eps m || X_direct ||_F) = ",relErr);
+    if( relErr > Real(1) )
+        LogicError("Sketched solution did not match the direct solution");
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of A",2000);
+        const Int n = Input("--n","width of A",50);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",3);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        for( const SketchType sketch : { GAUSSIAN_SKETCH, SPARSE_SKETCH } )
+        {
+            TestSketch<double>( g, m, n, numRHS, sketch, print );
+            TestSketch<Complex<float>>( g, m, n, numRHS, sketch, print );
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}